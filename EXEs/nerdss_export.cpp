@@ -0,0 +1,29 @@
+/* \file nerdss_export.cpp
+ * \brief Converts the binary time-series files of a run with timeSeriesBlock > 0 to the usual text files.
+ *
+ * Usage: nerdss_export [directory]
+ * Reads copy_numbers_time.bin, bound_pair_time.bin and event_counters_time.bin from the directory (default: the
+ * current one) and writes copy_numbers_time.dat, bound_pair_time.dat and event_counters_time.dat next to them.
+ */
+
+#include "io/io.hpp"
+
+#include <iostream>
+
+int main(int argc, char* argv[])
+{
+    std::string dirName { argc > 1 ? std::string { argv[1] } + '/' : std::string {} };
+    const std::vector<std::string> seriesNames { "copy_numbers_time", "bound_pair_time", "event_counters_time" };
+
+    int numExported { 0 };
+    for (auto& seriesName : seriesNames) {
+        std::string seriesFileName { dirName + seriesName + ".bin" };
+        if (export_time_series(seriesFileName, dirName + seriesName + ".dat")) {
+            std::cout << "Wrote " << dirName + seriesName << ".dat\n";
+            ++numExported;
+        } else {
+            std::cerr << "Cannot read " << seriesFileName << ", skipping.\n";
+        }
+    }
+    return numExported == int(seriesNames.size()) ? 0 : 1;
+}
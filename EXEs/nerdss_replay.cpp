@@ -0,0 +1,30 @@
+/* \file nerdss_replay.cpp
+ * \brief Rebuilds the restart file of a checkpoint written as a delta (checkPointFullEvery > 1).
+ *
+ * Usage: nerdss_replay restart<itr>.delta [output file]
+ * Reads the full checkpoint the delta was written against, which must be next to it, and writes the restart file the
+ * checkpoint would have had, by default restart<itr>.dat. Restart from it with -r as from any checkpoint.
+ */
+
+#include "io/io.hpp"
+
+#include <iostream>
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " restart<itr>.delta [output file]\n";
+        return 1;
+    }
+
+    std::string deltaFileName { argv[1] };
+    std::string restartFileName { argc > 2 ? argv[2] : deltaFileName.substr(0, deltaFileName.rfind('.')) + ".dat" };
+    std::string text {};
+    if (!CheckpointChain::replay(deltaFileName, text))
+        return 1;
+
+    std::ofstream restartFile { restartFileName, std::ios::binary };
+    restartFile << text;
+    std::cout << "Wrote " << restartFileName << '\n';
+    return 0;
+}
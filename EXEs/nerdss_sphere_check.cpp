@@ -0,0 +1,256 @@
+/* \file nerdss_sphere_check.cpp
+ * \brief Compares the propagation of complexes on a sphere surface before and after it was made one rotation about the
+ * center (rotation_on_sphere()), for a fixed seed and a set of R, D, Dr and dt.
+ *
+ * Usage: nerdss_sphere_check [seed]
+ * For each case, walkers start uniformly on the sphere, each with an interface 5 nm from its COM along the surface,
+ * and take nSteps steps with the old propagation (the sampled step with find_spherical_coords() and rotate_on_sphere(),
+ * then translate_on_sphere() and rotate_on_sphere() for each point, as Complex::propagate() did), and again from the
+ * same random numbers with the new one (create_complex_propagation_vectors_on_sphere() and rotation_on_sphere()).
+ * Printed for each: <cos> of the angle the COM turned about the center, with its theory exp(-2Dt/R^2), the mean
+ * squared geodesic displacement of the COM, with 4Dt for the plane, the mean squared displacement of the interface,
+ * the KS distance between the old and new geodesic displacements, the largest old-new distance of a COM and of an
+ * interface, and the largest change of an interface's distance to its COM. See
+ * sample_inputs/VALIDATE_SUITE/sphere/README for the results.
+ */
+
+#include "math/matrix.hpp"
+#include "math/rand_gsl.hpp"
+#include "reactions/association/functions_for_spherical_system.hpp"
+#include "trajectory_functions/trajectory_functions.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace {
+struct SphereCase {
+    double R; //!< sphere radius, nm
+    double D; //!< nm^2/us, in x and y
+    double Dr; //!< rad^2/us, about the sphere normal
+    double dt; //!< us
+};
+
+struct Walker {
+    Coord com {};
+    Coord iface {};
+};
+
+const int numWalkers { 10000 };
+const int nSteps { 200 };
+const double ifaceDistance { 5.0 }; //!< nm, from the COM along the surface
+
+// create_complex_propagation_vectors_on_sphere() before rotation_on_sphere()
+Coord old_propagation_vector(const Parameters& params, Complex& targCom, gsl_rng* r)
+{
+    Coord trajTrans;
+
+    double dx = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV(r);
+    double dy = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV(r);
+    double dl = sqrt(dx * dx + dy * dy); // propagation length
+    double dangle = acos(dx / dl);
+    if (dy < 0.0) {
+        dangle = 2.0 * M_PI - dangle;
+    } // propagation direction
+    double rotangle = dangle - M_PI / 2.0;
+    Coord COM = targCom.comCoord;
+    Coord COMsphere = find_spherical_coords(COM);
+    double dtheta = dl / COMsphere.z;
+    Coord COMnewtmp = Coord { COMsphere.x - dtheta, COMsphere.y, COMsphere.z };
+    COMnewtmp = find_cardesian_coords(COMnewtmp);
+    // define the inner-coords-set
+    Vector i = Vector { COM.x, COM.y, COM.z };
+    i.normalize();
+    Vector temp = Vector { 0.0, 0.0, COM.get_magnitude() };
+    temp.normalize();
+    Vector j = temp.cross(i);
+    j.normalize();
+    Vector k = i.cross(j);
+    k.normalize();
+    std::array<double, 9> crdset { i.x, i.y, i.z, j.x, j.y, j.z, k.x, k.y, k.z };
+    Coord COMnew = rotate_on_sphere(COMnewtmp, COM, crdset, rotangle);
+
+    trajTrans.x = COMnew.x - targCom.comCoord.x;
+    trajTrans.y = COMnew.y - targCom.comCoord.y;
+    trajTrans.z = COMnew.z - targCom.comCoord.z;
+    return trajTrans;
+}
+
+void old_step(Walker& walker, Complex& com, const Parameters& params, gsl_rng* r)
+{
+    com.comCoord = walker.com;
+    Coord trajTrans = old_propagation_vector(params, com, r);
+    double Rotangle = sqrt(2.0 * params.timeStep * com.Dr.x) * GaussV(r);
+    Coord COM = walker.com;
+    Coord COMnew = COM + trajTrans;
+    std::array<double, 9> Crdset = inner_coord_set(COM, COMnew);
+    std::array<double, 9> Crdsetnew = inner_coord_set_new(COM, COMnew);
+    for (Coord* point : { &walker.com, &walker.iface }) {
+        Coord targ = translate_on_sphere(*point, COM, COMnew, Crdset, Crdsetnew);
+        *point = rotate_on_sphere(targ, COMnew, Crdsetnew, Rotangle);
+    }
+}
+
+void new_step(Walker& walker, Complex& com, const Parameters& params, gsl_rng* r)
+{
+    com.comCoord = walker.com;
+    Coord trajTrans = create_complex_propagation_vectors_on_sphere(params, com, r);
+    double Rotangle = sqrt(2.0 * params.timeStep * com.Dr.x) * GaussV(r);
+    Coord COM = walker.com;
+    Coord COMnew = COM + trajTrans;
+    std::array<double, 9> M = rotation_on_sphere(COM, COMnew, Rotangle).rotation_matrix();
+    for (Coord* point : { &walker.com, &walker.iface }) {
+        Vector pointVec { *point - COM };
+        pointVec = matrix_rotate(pointVec, M);
+        *point = Coord { pointVec.x, pointVec.y, pointVec.z } + COMnew;
+    }
+}
+
+// starts every walker at the same place for both propagations, then moves them with the same random numbers
+std::vector<Walker> run(const SphereCase& sphereCase, unsigned seed,
+    void (*step)(Walker&, Complex&, const Parameters&, gsl_rng*), std::vector<Walker>& startList)
+{
+    gsl_rng* r { gsl_rng_alloc(gsl_rng_default) };
+    gsl_rng_set(r, seed);
+    Parameters params {};
+    params.timeStep = sphereCase.dt;
+    Complex com {};
+    com.D = Coord { sphereCase.D, sphereCase.D, 0.0 };
+    com.Dr = Coord { sphereCase.Dr, sphereCase.Dr, sphereCase.Dr };
+
+    startList.clear();
+    std::vector<Walker> walkerList {};
+    for (int walkerItr { 0 }; walkerItr < numWalkers; ++walkerItr) {
+        // uniform on the sphere, with the interface along the surface towards the north pole
+        double cosTheta { 2.0 * rand_gsl(r) - 1.0 };
+        double phi { 2.0 * M_PI * rand_gsl(r) };
+        double sinTheta { sqrt(1.0 - cosTheta * cosTheta) };
+        Vector normal { sinTheta * cos(phi), sinTheta * sin(phi), cosTheta };
+        Vector north { -cosTheta * cos(phi), -cosTheta * sin(phi), sinTheta };
+        double dangle { ifaceDistance / sphereCase.R };
+        Walker walker {};
+        walker.com = Coord { sphereCase.R * normal.x, sphereCase.R * normal.y, sphereCase.R * normal.z };
+        walker.iface = Coord { sphereCase.R * (cos(dangle) * normal.x + sin(dangle) * north.x),
+            sphereCase.R * (cos(dangle) * normal.y + sin(dangle) * north.y),
+            sphereCase.R * (cos(dangle) * normal.z + sin(dangle) * north.z) };
+        startList.push_back(walker);
+        walkerList.push_back(walker);
+    }
+    for (auto& walker : walkerList) {
+        for (int stepItr { 0 }; stepItr < nSteps; ++stepItr)
+            step(walker, com, params, r);
+    }
+    gsl_rng_free(r);
+    return walkerList;
+}
+
+double turn_angle(const Coord& start, const Coord& end)
+{
+    Vector a { start.x, start.y, start.z };
+    Vector b { end.x, end.y, end.z };
+    Vector c { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+    c.calc_magnitude();
+    return atan2(c.magnitude, a.dot(b));
+}
+
+// largest difference between the empirical distributions of two samples
+double ks_distance(std::vector<double> sample1, std::vector<double> sample2)
+{
+    std::sort(sample1.begin(), sample1.end());
+    std::sort(sample2.begin(), sample2.end());
+    double maxDiff { 0.0 };
+    size_t i1 { 0 };
+    size_t i2 { 0 };
+    while (i1 < sample1.size() && i2 < sample2.size()) {
+        double value { std::min(sample1[i1], sample2[i2]) };
+        while (i1 < sample1.size() && sample1[i1] <= value)
+            ++i1;
+        while (i2 < sample2.size() && sample2[i2] <= value)
+            ++i2;
+        maxDiff = std::max(maxDiff, std::abs(double(i1) / sample1.size() - double(i2) / sample2.size()));
+    }
+    return maxDiff;
+}
+
+struct Summary {
+    double meanCos { 0.0 };
+    double errCos { 0.0 };
+    double msdGeodesic { 0.0 };
+    double msdIface { 0.0 };
+    double maxIfaceDrift { 0.0 };
+    std::vector<double> geodesicList {};
+};
+
+Summary summarize(const SphereCase& sphereCase, const std::vector<Walker>& startList, const std::vector<Walker>& endList)
+{
+    Summary summary {};
+    double sumCos2 { 0.0 };
+    for (size_t walkerItr { 0 }; walkerItr < endList.size(); ++walkerItr) {
+        double theta { turn_angle(startList[walkerItr].com, endList[walkerItr].com) };
+        double geodesic { sphereCase.R * theta };
+        summary.geodesicList.push_back(geodesic);
+        summary.meanCos += cos(theta);
+        sumCos2 += cos(theta) * cos(theta);
+        summary.msdGeodesic += geodesic * geodesic;
+        Coord ifaceDisp { endList[walkerItr].iface - startList[walkerItr].iface };
+        summary.msdIface += ifaceDisp.x * ifaceDisp.x + ifaceDisp.y * ifaceDisp.y + ifaceDisp.z * ifaceDisp.z;
+        double startDistance { (startList[walkerItr].iface - startList[walkerItr].com).get_magnitude() };
+        double endDistance { (endList[walkerItr].iface - endList[walkerItr].com).get_magnitude() };
+        summary.maxIfaceDrift = std::max(summary.maxIfaceDrift, std::abs(endDistance - startDistance));
+    }
+    double n { double(endList.size()) };
+    summary.meanCos /= n;
+    summary.errCos = sqrt((sumCos2 / n - summary.meanCos * summary.meanCos) / n);
+    summary.msdGeodesic /= n;
+    summary.msdIface /= n;
+    return summary;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned seed { 12345 };
+    if (argc > 1)
+        seed = unsigned(std::stoul(argv[1]));
+
+    // R nm, D nm^2/us, Dr rad^2/us, dt us. from small steps on a large sphere to steps of a tenth of its radius
+    const std::vector<SphereCase> caseList { { 500.0, 1.0, 0.01, 0.1 }, { 500.0, 1.0, 0.01, 1.0 },
+        { 500.0, 10.0, 0.1, 1.0 }, { 100.0, 10.0, 0.1, 1.0 }, { 50.0, 10.0, 1.0, 10.0 }, { 1000.0, 0.5, 0.001, 10.0 } };
+
+    std::cout << "seed " << seed << ", " << numWalkers << " walkers, " << nSteps << " steps\n";
+    std::cout << std::setw(6) << "R" << std::setw(6) << "D" << std::setw(7) << "Dr" << std::setw(6) << "dt"
+              << std::setw(10) << "theory" << std::setw(19) << "<cos> old" << std::setw(19) << "<cos> new"
+              << std::setw(10) << "4Dt" << std::setw(10) << "MSD old" << std::setw(10) << "MSD new"
+              << std::setw(11) << "iface old" << std::setw(11) << "iface new" << std::setw(7) << "KS"
+              << std::setw(10) << "max dCOM" << std::setw(10) << "max dIf" << std::setw(10) << "rigid old"
+              << std::setw(10) << "rigid new" << '\n';
+    for (const auto& sphereCase : caseList) {
+        std::vector<Walker> startList {};
+        std::vector<Walker> oldList { run(sphereCase, seed, old_step, startList) };
+        std::vector<Walker> newList { run(sphereCase, seed, new_step, startList) };
+        Summary oldSummary { summarize(sphereCase, startList, oldList) };
+        Summary newSummary { summarize(sphereCase, startList, newList) };
+        double maxComDiff { 0.0 };
+        double maxIfaceDiff { 0.0 };
+        for (size_t walkerItr { 0 }; walkerItr < oldList.size(); ++walkerItr) {
+            maxComDiff = std::max(maxComDiff, (oldList[walkerItr].com - newList[walkerItr].com).get_magnitude());
+            maxIfaceDiff = std::max(maxIfaceDiff, (oldList[walkerItr].iface - newList[walkerItr].iface).get_magnitude());
+        }
+        double t { nSteps * sphereCase.dt };
+        std::cout << std::fixed << std::setw(6) << std::setprecision(0) << sphereCase.R
+                  << std::setw(6) << std::setprecision(1) << sphereCase.D << std::setw(7) << std::setprecision(3)
+                  << sphereCase.Dr << std::setw(6) << std::setprecision(1) << sphereCase.dt << std::setprecision(5)
+                  << std::setw(10) << exp(-2.0 * sphereCase.D * t / (sphereCase.R * sphereCase.R)) << std::setw(11)
+                  << oldSummary.meanCos << "+-" << std::setw(6) << oldSummary.errCos << std::setw(11)
+                  << newSummary.meanCos << "+-" << std::setw(6) << newSummary.errCos << std::setprecision(1)
+                  << std::setw(10) << 4.0 * sphereCase.D * t << std::setw(10) << oldSummary.msdGeodesic
+                  << std::setw(10) << newSummary.msdGeodesic << std::setw(11) << oldSummary.msdIface
+                  << std::setw(11) << newSummary.msdIface << std::setprecision(3) << std::setw(7)
+                  << ks_distance(oldSummary.geodesicList, newSummary.geodesicList) << std::scientific
+                  << std::setprecision(1) << std::setw(10) << maxComDiff << std::setw(10) << maxIfaceDiff
+                  << std::setw(10) << oldSummary.maxIfaceDrift << std::setw(10) << newSummary.maxIfaceDrift << '\n';
+        std::cout.unsetf(std::ios::floatfield);
+    }
+    return 0;
+}
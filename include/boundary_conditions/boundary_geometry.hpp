@@ -0,0 +1,231 @@
+/*! \file boundary_geometry.hpp
+ * \brief Geometry shared by the box and sphere boundary functions: where the points of a Complex are, and how far
+ * they reach.
+ *
+ * Each boundary function goes over the COM and interfaces of every member of a Complex, at their current, temporary
+ * (association) or trial (after trajTrans and trajRot) positions, and keeps either their extent along the box axes
+ * or the point farthest from the sphere center. for_each_point() does the loop once for all of them, with the
+ * positions given by one of the policies below, so the compiler sees each combination as its own loop.
+ *
+ * A box axis can be periodic (Membrane::isPeriodic). It then has no walls, and separations along it are taken to the
+ * nearest image by minimum_image().
+ */
+#pragma once
+
+#include "classes/class_Membrane.hpp"
+#include "classes/class_Molecule_Complex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+/*! \ingroup BoundaryConditions
+ * \brief Component axis (0, 1, 2 for x, y, z) of a Coord or Vector.
+ */
+template <typename CoordType>
+inline double& axis_of(CoordType& crds, int axis)
+{
+    return axis == 0 ? crds.x : (axis == 1 ? crds.y : crds.z);
+}
+
+template <typename CoordType>
+inline double axis_of(const CoordType& crds, int axis)
+{
+    return axis == 0 ? crds.x : (axis == 1 ? crds.y : crds.z);
+}
+
+/*! \ingroup BoundaryConditions
+ * \brief Takes the separation (dx, dy, dz) to its nearest periodic image, along each periodic axis of the box.
+ */
+inline void minimum_image(double& dx, double& dy, double& dz, const Membrane& membraneObject)
+{
+    if (!membraneObject.hasPeriodic)
+        return;
+    if (membraneObject.isPeriodic[0])
+        dx -= membraneObject.waterBox.x * std::round(dx / membraneObject.waterBox.x);
+    if (membraneObject.isPeriodic[1])
+        dy -= membraneObject.waterBox.y * std::round(dy / membraneObject.waterBox.y);
+    if (membraneObject.isPeriodic[2])
+        dz -= membraneObject.waterBox.z * std::round(dz / membraneObject.waterBox.z);
+}
+
+inline void minimum_image(Coord& sep, const Membrane& membraneObject)
+{
+    minimum_image(sep.x, sep.y, sep.z, membraneObject);
+}
+
+/*! \ingroup BoundaryConditions
+ * \brief Current positions, comCoord and interface coords.
+ */
+struct CurrentPositions {
+    Coord com(const Molecule& oneMol) const { return oneMol.comCoord; }
+    unsigned num_ifaces(const Molecule& oneMol) const { return oneMol.interfaceList.size(); }
+    Coord iface(const Molecule& oneMol, unsigned ifaceItr) const { return oneMol.interfaceList[ifaceItr].coord; }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Temporary positions of an association, tmpComCoord and tmpICoords.
+ */
+struct TmpPositions {
+    Coord com(const Molecule& oneMol) const { return oneMol.tmpComCoord; }
+    unsigned num_ifaces(const Molecule& oneMol) const { return oneMol.tmpICoords.size(); }
+    Coord iface(const Molecule& oneMol, unsigned ifaceItr) const { return oneMol.tmpICoords[ifaceItr]; }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Positions after the trial move of a Complex: rotated by M about its COM, then translated by trajTrans.
+ *
+ * M is the rotation matrix of trajRot, built by the caller so it can be kept while trajTrans is reflected.
+ */
+struct TrialPositions {
+    const Complex& targCom;
+    const std::array<double, 9>& M;
+
+    TrialPositions(const Complex& _targCom, const std::array<double, 9>& _M)
+        : targCom(_targCom)
+        , M(_M)
+    {
+    }
+
+    Coord position(const Coord& point) const
+    {
+        Vector vec { point - targCom.comCoord };
+        return { targCom.comCoord.x + targCom.trajTrans.x + (M[0] * vec.x + M[1] * vec.y + M[2] * vec.z),
+            targCom.comCoord.y + targCom.trajTrans.y + (M[3] * vec.x + M[4] * vec.y + M[5] * vec.z),
+            targCom.comCoord.z + targCom.trajTrans.z + (M[6] * vec.x + M[7] * vec.y + M[8] * vec.z) };
+    }
+    Coord com(const Molecule& oneMol) const { return position(oneMol.comCoord); }
+    unsigned num_ifaces(const Molecule& oneMol) const { return oneMol.interfaceList.size(); }
+    Coord iface(const Molecule& oneMol, unsigned ifaceItr) const { return position(oneMol.interfaceList[ifaceItr].coord); }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Temporary positions of an association, translated by traj without rotation.
+ */
+struct TmpTrialPositions {
+    const Complex& targCom;
+    const std::array<double, 3>& traj;
+
+    TmpTrialPositions(const Complex& _targCom, const std::array<double, 3>& _traj)
+        : targCom(_targCom)
+        , traj(_traj)
+    {
+    }
+
+    Coord position(const Coord& point) const
+    {
+        Vector vec { point - targCom.tmpComCoord };
+        return { targCom.tmpComCoord.x + traj[0] + vec.x, targCom.tmpComCoord.y + traj[1] + vec.y,
+            targCom.tmpComCoord.z + traj[2] + vec.z };
+    }
+    Coord com(const Molecule& oneMol) const { return position(oneMol.tmpComCoord); }
+    unsigned num_ifaces(const Molecule& oneMol) const { return oneMol.interfaceList.size(); }
+    Coord iface(const Molecule& oneMol, unsigned ifaceItr) const { return position(oneMol.tmpICoords[ifaceItr]); }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Calls addPoint with the position of the COM and each interface of every member of targCom.
+ */
+template <typename Positions, typename AddPoint>
+void for_each_point(const Complex& targCom, const std::vector<Molecule>& moleculeList, const Positions& positions,
+    AddPoint&& addPoint, bool skipImplicitLipids = false)
+{
+    for (auto& memMol : targCom.memberList) {
+        const Molecule& oneMol { moleculeList[memMol] };
+        if (skipImplicitLipids && oneMol.isImplicitLipid)
+            continue;
+        addPoint(positions.com(oneMol));
+        unsigned numIfaces { positions.num_ifaces(oneMol) };
+        for (unsigned ifaceItr { 0 }; ifaceItr < numIfaces; ++ifaceItr)
+            addPoint(positions.iface(oneMol, ifaceItr));
+    }
+}
+
+/*! \ingroup BoundaryConditions
+ * \brief Lowest (neg) and highest (pos) coordinate along each axis, of the points added and of the starting bounds.
+ */
+struct BoxExtent {
+    std::array<double, 3> neg {};
+    std::array<double, 3> pos {};
+
+    BoxExtent(const std::array<double, 3>& _neg, const std::array<double, 3>& _pos)
+        : neg(_neg)
+        , pos(_pos)
+    {
+    }
+
+    void add(const Coord& point)
+    {
+        for (int axis { 0 }; axis < 3; ++axis) {
+            neg[axis] = std::min(neg[axis], axis_of(point, axis));
+            pos[axis] = std::max(pos[axis], axis_of(point, axis));
+        }
+    }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Walls of the box. The -z wall is the membrane, raised by RS3D for complexes in solution. A periodic axis has
+ * its walls at infinity, so nothing is ever outside along it.
+ */
+struct BoxWalls {
+    std::array<double, 3> neg {};
+    std::array<double, 3> pos {};
+
+    BoxWalls(const Membrane& membraneObject, double RS3D)
+        : neg { -membraneObject.waterBox.x / 2.0, -membraneObject.waterBox.y / 2.0,
+            -membraneObject.waterBox.z / 2.0 + RS3D }
+        , pos { membraneObject.waterBox.x / 2.0, membraneObject.waterBox.y / 2.0, membraneObject.waterBox.z / 2.0 }
+    {
+        for (int axis { 0 }; axis < 3; ++axis) {
+            if (membraneObject.isPeriodic[axis]) {
+                neg[axis] = -std::numeric_limits<double>::infinity();
+                pos[axis] = std::numeric_limits<double>::infinity();
+            }
+        }
+    }
+
+    /*! \brief An extent starting from the opposite walls, so that it only reaches a wall if a point does. */
+    BoxExtent empty_extent() const { return { pos, neg }; }
+
+    /*! \brief Axes along which a sphere of radius around center crosses a wall. */
+    std::array<bool, 3> can_be_outside(const Coord& center, double radius) const
+    {
+        std::array<bool, 3> canBeOutside {};
+        for (int axis { 0 }; axis < 3; ++axis)
+            canBeOutside[axis] = axis_of(center, axis) + radius > pos[axis] || axis_of(center, axis) - radius < neg[axis];
+        return canBeOutside;
+    }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Point farthest from the sphere center (the origin), of the points added and of the starting point.
+ */
+struct FarthestPoint {
+    Coord crds {};
+    double dist { 0 };
+    bool isFound { false }; //!< true if an added point is farther than the starting one
+
+    FarthestPoint(const Coord& _crds, double _dist)
+        : crds(_crds)
+        , dist(_dist)
+    {
+    }
+
+    void add(const Coord& point)
+    {
+        double pointDist { point.get_magnitude() };
+        if (pointDist > dist) {
+            crds = point;
+            dist = pointDist;
+            isFound = true;
+        }
+    }
+};
+
+/*! \ingroup BoundaryConditions
+ * \brief Moves the COM of targCom and the COM and interfaces of its members by trans, at their current or temporary
+ * positions.
+ */
+void translate_complex(Complex& targCom, std::vector<Molecule>& moleculeList, const Coord& trans);
+void translate_tmp_complex(Complex& targCom, std::vector<Molecule>& moleculeList, const Coord& trans);
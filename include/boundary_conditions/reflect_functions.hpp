@@ -29,9 +29,9 @@ void reflect_complex_rad_rot_sphere(const Membrane& membraneObject, Complex& tar
 /*! \ingroup BoundaryConditions
  * \brief Enforces reflecting boundary conditions during complex propagation.
  */
-void reflect_traj_complex_rad_rot(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput);
-void reflect_traj_complex_rad_rot_box(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput);
-void reflect_traj_complex_rad_rot_sphere(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput);
+void reflect_traj_complex_rad_rot(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
+void reflect_traj_complex_rad_rot_box(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
+void reflect_traj_complex_rad_rot_sphere(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
 // void reflect_traj_complex_rad_rot_new(
 //     const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, std::array<double, 9>& M, const Membrane& membraneObject, double RS3Dinput);
 
@@ -42,9 +42,9 @@ void reflect_traj_complex_rad_rot_sphere(const Parameters& params, std::vector<M
  */
 // void reflect_traj_check_span(double xtot, double ytot, double ztot, const Parameters& params, Complex& targCom,
 //     std::vector<Molecule>& moleculeList, std::array<double, 9>& M, const Membrane& membraneObject, double RS3Dinput);
-void reflect_traj_check_span(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput);
-void reflect_traj_check_span_box(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput);
-void reflect_traj_check_span_sphere(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput);
+void reflect_traj_check_span(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
+void reflect_traj_check_span_box(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
+void reflect_traj_check_span_sphere(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
 
 /*!
  * \brief Enforces reflecting boundary conditions by placing Complex and component Molecules back into the box without
@@ -82,4 +82,14 @@ void reflect_traj_tmp_crds_box(const Parameters& params, std::vector<Molecule>&
 void reflect_traj_tmp_crds_sphere(const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, std::array<double, 3>& traj, const Membrane& membraneObject, double RS3Dinput);
 
 // function to calculate the position of one interface after translation and rotation on sphere surface
-Coord calculate_update_position_interface(const Complex targCom, const Coord ifacecrds); // iface is cardesian coords
+Coord calculate_update_position_interface(const Complex& targCom, const Coord& ifacecrds); // iface is cardesian coords
+
+/* PERIODIC BOUNDARIES */
+
+/*! \ingroup BoundaryConditions
+ * \brief Puts the COM of targCom back in the box along the periodic axes, moving the whole Complex with it.
+ *
+ * Does nothing if no axis is periodic. The box functions above treat a periodic axis as having no walls. The move is
+ * added to Molecule::imageOffset of its members, so the trajectory can be written unwrapped.
+ */
+void wrap_complex_periodic(Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
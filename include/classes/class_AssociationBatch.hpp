@@ -0,0 +1,87 @@
+/*! \file class_AssociationBatch.hpp
+ * \brief Associations chosen during one timestep, held back so that several can be placed at once.
+ */
+
+#pragma once
+
+#include "classes/class_Membrane.hpp"
+#include "classes/class_MolTemplate.hpp"
+#include "classes/class_Molecule_Complex.hpp"
+#include "classes/class_Rxns.hpp"
+#include "classes/class_WorkerPool.hpp"
+#include "classes/class_copyCounters.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/*! \class AssociationBatch
+ * \brief Collects the associations chosen by the reaction loop of Simulation::step(), places them in parallel on a
+ * WorkerPool (see place_association_box()) and commits them in the order they were chosen.
+ *
+ * The reaction loop performs each chosen reaction right away, and the molecules after it see the result: partners
+ * with zero probabilities, bound interfaces, moved complexes. An association is held back only as long as the
+ * molecules after it don't look at any of that: pending() is true for a molecule if its complex, one of its partners
+ * or a partner's complex is in a held association, and the loop then calls flush() first. So held associations are
+ * between distinct complexes, each molecule decides on the same state as if they had been performed in order, and the
+ * random numbers are drawn in the same order.
+ *
+ * In flush(), a placement that was checked against the other complexes (AssocPlacement::checkedSystem) is redone
+ * before it's committed if an association committed before it, in the same flush, changed a complex within its reach.
+ * So each association has the same outcome as if it had been performed when it was chosen.
+ */
+class AssociationBatch {
+public:
+    /*! \struct Event
+     * \brief An association, with the molecules in the order of the reaction's reactants, as for associate().
+     */
+    struct Event {
+        int ifaceIndex1 { -1 };
+        int ifaceIndex2 { -1 };
+        int molIndex1 { -1 };
+        int molIndex2 { -1 };
+        int rxnIndex { -1 };
+
+        Event() = default;
+        Event(int _ifaceIndex1, int _ifaceIndex2, int _molIndex1, int _molIndex2, int _rxnIndex)
+            : ifaceIndex1(_ifaceIndex1)
+            , ifaceIndex2(_ifaceIndex2)
+            , molIndex1(_molIndex1)
+            , molIndex2(_molIndex2)
+            , rxnIndex(_rxnIndex)
+        {
+        }
+    };
+
+    explicit AssociationBatch(WorkerPool& _workerPool);
+
+    /*!
+     * \brief True if the association can be held back: it joins two complexes in a box, see place_association_box().
+     */
+    static bool can_hold(const Event& event, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
+
+    /*!
+     * \brief True if molIndex can't be evaluated until the held associations are performed.
+     */
+    bool pending(int molIndex, const std::vector<Molecule>& moleculeList) const;
+
+    void hold(const Event& event, const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList);
+
+    /*!
+     * \brief Performs the held associations, as associate() would have in the order they were held.
+     */
+    void flush(const Parameters& params, std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
+        std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList,
+        std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject,
+        SimulContext& context);
+
+    bool empty() const { return eventList.empty(); }
+
+private:
+    WorkerPool& workerPool; //!< shared with the rest of the Simulation
+    std::vector<Event> eventList {};
+    std::vector<char> isHeldCom {}; //!< per Complex index, true if it's in a held association
+    std::vector<char> isHeldMol {}; //!< per Molecule index, true if it's a partner of a held association's Molecules
+    std::vector<int> heldComList {}; //!< set entries of isHeldCom, to reset them
+    std::vector<int> heldMolList {}; //!< set entries of isHeldMol, to reset them
+};
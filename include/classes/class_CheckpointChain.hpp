@@ -0,0 +1,65 @@
+/*! \file class_CheckpointChain.hpp
+ * \brief Checkpoints written as full restart files every few checkpoints, and as differences from them in between.
+ */
+
+#pragma once
+
+#include "classes/class_Membrane.hpp"
+#include "classes/class_MolTemplate.hpp"
+#include "classes/class_Molecule_Complex.hpp"
+#include "classes/class_Parameters.hpp"
+#include "classes/class_copyCounters.hpp"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/*! \class CheckpointChain
+ * \brief Writes every fullEvery-th checkpoint as a full restart%lld.dat and the others as binary restart%lld.delta files.
+ *
+ * A delta file holds the changes since the last full checkpoint (its keyframe):
+ *  - the counters, lists and observables that change during a run, as they are now
+ *  - the bond and state changes: every Molecule or Complex whose bonds, states, interface lists or reweighting lists
+ *    differ from the keyframe, without its coordinates. The parts of a Molecule that kept their length are stored as
+ *    the runs of bytes that changed.
+ *  - the rigid body motion of each Complex: its center, as a residual from the keyframe center, and its rotation
+ *    since the keyframe, as the vector part of a quaternion
+ *  - the coordinates of each Molecule, as the difference from where the motion of its Complex takes the keyframe
+ *    coordinates. Both are mapped to ordered integers first, so the difference is exact, and it is stored in groups
+ *    of 3 bits, since most are a few units in the last place.
+ *  - the text that follows the records of write_restart, as it is
+ *
+ * nerdss_replay calls replay() to rebuild the restart file of any delta, so it can be restarted from with -r.
+ */
+class CheckpointChain {
+public:
+    explicit CheckpointChain(int _fullEvery);
+
+    /*!
+     * \brief Writes the checkpoint of iteration simItr. writeRestart writes the full restart file, for keyframes.
+     *
+     * The files go to params.output_path(). restartTail is what follows the records of write_restart in the restart file. Deltas keep it as it is.
+     */
+    void write(long long int simItr, const Parameters& params, const std::vector<Molecule>& moleculeList,
+        const std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList,
+        const std::map<std::string, int>& observablesList, const Membrane& membraneObject,
+        const copyCounters& counterArrays, const SimulContext& context, const std::string& restartTail,
+        const std::function<void(std::ostream&)>& writeRestart);
+
+    /*!
+     * \brief Rebuilds the restart file text of a delta file from its keyframe. Returns false if a file can't be read.
+     *
+     * The keyframe is read with read_restart into a SimulContext of its own, so this can run next to a simulation.
+     */
+    static bool replay(const std::string& deltaFileName, std::string& text);
+
+private:
+    int fullEvery { 1 };
+    int numSinceFull { 0 };
+    std::string keyframeName {};
+    std::vector<std::string> keyframeMolStates {}; //!< each Molecule at the keyframe, without its coordinates
+    std::vector<std::string> keyframeComStates {}; //!< each Complex at the keyframe, without its center
+    std::vector<std::vector<Coord>> keyframePoints {}; //!< center and interfaces of each Molecule, as read_restart reads them
+    std::vector<Coord> keyframeComCoords {}; //!< center of each Complex, as read_restart reads it
+};
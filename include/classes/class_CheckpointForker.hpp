@@ -0,0 +1,54 @@
+/*! \file class_CheckpointForker.hpp
+ * \brief Writes checkpoints from forked child processes while the simulation goes on.
+ */
+
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*! \class CheckpointForker
+ * \brief Forks the process at checkpoint time, and lets the child write the checkpoint from its copy of the memory.
+ *
+ * The child shares its pages with the simulation until the simulation changes them (copy-on-write), so the
+ * simulation only waits for the fork itself. The child writes to fileName.part and renames it to fileName once it is
+ * complete, so a checkpoint file is never seen half written. Finished children are reaped at every write() and a
+ * failed one is reported. At most maxChildren run at once: write() waits for the oldest one if there are more. If
+ * maxChildren = 0, or fork fails, or the platform has no fork, the checkpoint is written right away.
+ *
+ * Output threads aren't copied into the child, so the OutputQueue must be flushed before write().
+ */
+class CheckpointForker {
+public:
+    CheckpointForker(int _maxChildren, std::ostream& _log); //!< _log is flushed before each fork
+    ~CheckpointForker(); //!< waits for the running children
+
+    CheckpointForker(const CheckpointForker&) = delete;
+    CheckpointForker& operator=(const CheckpointForker&) = delete;
+
+    /*!
+     * \brief Writes fileName with writeFile, in a child process if possible.
+     */
+    void write(const std::string& fileName, const std::function<void(std::ostream&)>& writeFile);
+
+    /*!
+     * \brief Reaps the finished children. If wait is true, waits for all of them.
+     */
+    void reap(bool wait);
+
+private:
+    struct Child {
+        int pid;
+        std::string fileName;
+    };
+
+    int maxChildren { 0 };
+    std::ostream& log; //!< the log of the simulation, whose buffer the child would write again
+    bool hasForkFailed { false }; //!< a failed fork is only reported once
+    std::vector<Child> children {};
+
+    void write_now(const std::string& fileName, const std::function<void(std::ostream&)>& writeFile);
+    void wait_for(const Child& child, bool wait, bool& isDone);
+};
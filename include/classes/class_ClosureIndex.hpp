@@ -0,0 +1,86 @@
+/*! \file class_ClosureIndex.hpp
+ * \brief Free interfaces of the large Complexes, binned within each Complex, to find the loops they can close.
+ */
+
+#pragma once
+
+#include "classes/class_Molecule_Complex.hpp"
+#include "classes/class_Parameters.hpp"
+#include "classes/class_Rxns.hpp"
+
+#include <vector>
+
+/*! \class ClosureIndex
+ * \brief Pairs of free interfaces of Molecules in the same Complex, within the reach of closing a loop.
+ *
+ * Two Molecules of one Complex only bind if their interfaces are within ForwardRxn::bindRadSameCom * bindRadius of
+ * each other, see evaluate_binding_within_complex. The pair search instead looks at every two members within
+ * rMaxLimit, and at every pair of their free interfaces, which for a large lattice is most of its members. build()
+ * bins the free interfaces of each Complex with at least Parameters::closureIndexSize members on a grid of its own,
+ * with cells as wide as the largest such distance, and looks for partners only in the 27 cells around each one. The
+ * pair search skips the Complexes it marks (Complex::hasClosureIndex), and the pairs in candidateList are evaluated
+ * with check_binding_within_complex instead.
+ *
+ * Complexes move as rigid bodies, so the distances between their members only change with their bonds. The
+ * candidates of a Complex are kept, and only looked for again once its members or their free interfaces change.
+ *
+ * Distances are measured as get_distance does in a box, in the plane for Complexes on the membrane. On a spherical
+ * membrane it measures along the surface, so the index isn't used there.
+ */
+class ClosureIndex {
+public:
+    /*! \struct Candidate
+     * \brief Two free interfaces within reach, with pro1Index < pro2Index.
+     */
+    struct Candidate {
+        int pro1Index { -1 };
+        int pro2Index { -1 };
+        int relIface1 { -1 };
+        int relIface2 { -1 };
+
+        Candidate() = default;
+        Candidate(int _pro1Index, int _pro2Index, int _relIface1, int _relIface2)
+            : pro1Index(_pro1Index)
+            , pro2Index(_pro2Index)
+            , relIface1(_relIface1)
+            , relIface2(_relIface2)
+        {
+        }
+    };
+
+    double reach { 0 }; //!< in nm. largest bindRadSameCom * bindRadius of any ForwardRxn
+    int minSize { 0 }; //!< Parameters::closureIndexSize
+    std::vector<Candidate> candidateList {}; //!< pairs of all marked Complexes after the last build(), by Complex
+
+    ClosureIndex(const Parameters& params, const std::vector<ForwardRxn>& forwardRxns);
+
+    /*!
+     * \brief Sets Complex::hasClosureIndex of each Complex, and collects the candidates within those that have it.
+     *
+     * Must be called before the pair search, with the interface coordinates of the timestep.
+     */
+    void build(const std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList);
+
+private:
+    struct Entry {
+        long long cellKey { 0 };
+        int molIndex { -1 };
+        int relIface { -1 };
+        Coord coord {};
+    };
+
+    /*! \struct ComCandidates
+     * \brief Candidates of one Complex, and what they were found for.
+     */
+    struct ComCandidates {
+        unsigned long long signature { 0 }; //!< of the members and their free interfaces, see make_signature()
+        std::vector<Candidate> candidateList {};
+    };
+
+    std::vector<ComCandidates> comCandidatesList {}; //!< indexed by Complex index
+    std::vector<Entry> entryList {}; //!< free interfaces of one Complex, sorted by cell. Kept to reuse its memory
+
+    static unsigned long long make_signature(const Complex& targCom, const std::vector<Molecule>& moleculeList);
+    void find_candidates(const Complex& targCom, const std::vector<Molecule>& moleculeList,
+        std::vector<Candidate>& comCandidateList);
+};
@@ -22,5 +22,8 @@ public:
 };
 
 void cluster_one_complex(int k1, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, std::vector<ClusterPair>& pairList, std::vector<int>& finished);
+// The pairs are found again from the crossbase lists at every call, and check_bimolecular_reactions rebuilds those
+// each step from the cell lists. TODO: keep the pairs from one step to the next, adding and removing them only as
+// complexes come within or leave the reaction zone of each other.
 void define_cluster_pairs(int p1, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, std::vector<ClusterPair>& pairList);
-void resample_traj(int currStop, std::vector<ClusterPair>& pairList, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const Parameters& params, const Membrane& membraneObject, double RS3Dinput);
\ No newline at end of file
+void resample_traj(int currStop, std::vector<ClusterPair>& pairList, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const Parameters& params, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r);
\ No newline at end of file
@@ -59,7 +59,7 @@ public:
     void zero_crds();
     bool isOutOfBox(const Membrane& membraneObject);
 
-    double get_magnitude();
+    double get_magnitude() const;
 
     Coord() = default;
     Coord(double x, double y, double z);
@@ -0,0 +1,94 @@
+/*! \file class_InSituAnalysis.hpp
+ * \brief Complex size distributions, radial distribution functions and membrane surface densities, accumulated
+ * during the run.
+ */
+
+#pragma once
+
+#include "classes/class_Membrane.hpp"
+#include "classes/class_MolTemplate.hpp"
+#include "classes/class_Molecule_Complex.hpp"
+#include "classes/class_Parameters.hpp"
+#include "classes/class_SimulVolume.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*! \class InSituAnalysis
+ * \brief Samples the live system every Parameters::Analysis::write timesteps, and only writes the averages.
+ *
+ * - analysis_complex_sizes.dat: mean number of Complexes of each size, and the fraction of Molecules in them.
+ * - analysis_rdf.dat: g(r) of each pair in analysisRdfPairs, from the Molecule centers of mass. Pairs are found with
+ *   the SimulVolume cell lists, so rdfMax is at most the smallest cell width, or rMaxLimit with a SurfaceGrid. g(r)
+ *   is normalized by the ideal density in the whole volume, without correcting for the walls. If both types only
+ *   diffuse in 2D, it is normalized by the density on the membrane area instead, with annuli for shells.
+ * - analysis_surface_density.dat: Molecules per nm^2 of each type, for the Molecules of membrane-bound Complexes, on
+ *   densityBins x densityBins bins of the flat membrane (x, y), or of the sphere (cos(theta), phi).
+ *
+ * The files are rewritten with the averages so far each time write() is called, so they are complete after each
+ * restart file. The settings and the sums of the samples are written at the end of restart files, so a restarted
+ * simulation goes on adding to them.
+ */
+class InSituAnalysis {
+public:
+    InSituAnalysis(const Parameters& params, const std::vector<MolTemplate>& molTemplateList,
+        const SimulVolume& simulVolume, const Membrane& membraneObject, std::ostream& log);
+
+    /*!
+     * \brief Adds the current system to the averages.
+     *
+     * Must be called after SimulVolume::update_memberMolLists(), with no Molecules moved in between.
+     */
+    void sample(const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+        const SimulVolume& simulVolume, const Membrane& membraneObject);
+
+    /*!
+     * \brief Writes the averages of all samples so far.
+     */
+    void write(const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject) const;
+
+    /*!
+     * \brief Writes the settings and the sums of the samples after write_restart, if active.
+     */
+    void write_state(std::ostream& restartFile) const;
+
+    /*!
+     * \brief Reads what write_state wrote, if the restart file has it: the settings into params, before the
+     * InSituAnalysis is made from them, and the sums into savedState, for resume().
+     */
+    static void read_state(std::istream& restartFile, Parameters& params, std::string& savedState, std::ostream& log);
+
+    /*!
+     * \brief Adds the samples of the run this one restarts from. They are dropped if the settings changed since.
+     */
+    void resume(const std::string& savedState, std::ostream& log);
+
+    bool is_active() const { return isActive; }
+
+private:
+    struct RdfPair {
+        int molTypeA { 0 };
+        int molTypeB { 0 };
+        bool is2D { false }; //!< both types only diffuse in 2D, so g(r) is normalized on the membrane
+        std::vector<double> pairCounts {}; //!< summed over the samples
+        double sumPairDensity { 0 }; //!< sum over the samples of the number of pairs per nm^3 of an ideal gas
+    };
+
+    bool isActive { false };
+    Parameters::Analysis settings {};
+    std::string sizeFileName {}; //!< the files write() writes, in the output directory
+    std::string rdfFileName {};
+    std::string densityFileName {};
+    long long int numSamples { 0 };
+    std::vector<double> complexSizeCounts {}; //!< number of Complexes of each size, summed over the samples
+    long long int sumNumMolecules { 0 };
+
+    double rdfMax { 0 };
+    int rdfBins { 0 };
+    std::vector<RdfPair> rdfPairList {};
+    std::vector<std::vector<int>> rdfPairIndex {}; //!< index in rdfPairList of each pair of MolTemplates, or -1
+
+    int densityBins { 0 };
+    std::vector<std::vector<double>> densityCounts {}; //!< Molecules in each bin, by MolTemplate, summed over the samples
+};
@@ -6,6 +6,8 @@
 
 #include "classes/class_Membrane.hpp"
 
+#include <array>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -73,6 +75,8 @@ struct Membrane {
     std::string xBCtype; //allow reflect, or pbc
     std::string yBCtype;
     std::string zBCtype;
+    std::array<bool, 3> isPeriodic { { false, false, false } }; //!< per axis x, y, z, true if its BCtype is pbc
+    bool hasPeriodic { false }; //!< true if any axis is periodic. Only for a box, see set_BCtype
 
     /*set_value_BC is defined in src/parser/parse_input.cpp 
       And the map to BoundaryKeyword keywords is also defined in that file.
@@ -80,12 +84,17 @@ struct Membrane {
       ParameterKeywords are in include/classes/class_Parameters.hpp
      */
 
-    void set_value_BC(std::string value, BoundaryKeyword keywords);
+    void set_value_BC(std::string value, BoundaryKeyword keywords, std::ostream& log);
+
+    /*! \brief Sets the boundary type of one axis (0, 1, 2 for x, y, z), "reflect" or "pbc" (also "periodic").
+     * Defined in src/parser/parse_input.cpp. Exits if the type isn't known.
+     */
+    void set_BCtype(int axis, const std::string& value);
     /*In here, we could also store coordinate vector                                                                                                       
       for a single representative lipid                                                                                                                    
     */
 
-    void display(); // display the information for the boundary, define in the src/parse/parse_input.cpp
+    void display(std::ostream& os); // display the information for the boundary, define in the src/parse/parse_input.cpp
 
     void create_water_box(); // create box for sphere boundary, define in the src/parse/parse_input.cpp
 };
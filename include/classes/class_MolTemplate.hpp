@@ -15,6 +15,8 @@
 
 #include "classes/class_Coord.hpp"
 
+#include <ostream>
+
 /*! \defgroup Templates
  * \brief Classes holding information on each Molecule type.
  */
@@ -60,8 +62,6 @@ struct Interface {
         //!< destroyed (CreateDestructRxn)
         std::vector<unsigned> rxnPartners {};
         std::vector<std::pair<int, int>> stateChangeRxns {}; //!< indices of state change reactions (forward, back)
-        static int totalNumOfStates; //!< total number of states in the system (should be same as totalIfaceNum provided
-        //!< in Parameter file
 
         State() = default;
         explicit State(int index);
@@ -145,19 +145,15 @@ struct MolTemplate {
 
     bool bindToSurface { false }; //For use with continuum membrane binding method. 0 (default) means no surface adsorption.
     // functions to display values
-    void display() const;
-    void display(const std::string& name) const;
+    void display(std::ostream& os) const;
+    void display(std::ostream& os, const std::string& name) const;
 
     static std::map<const std::string, MolKeyword> molKeywords; //!< keywords for file parsing see MolKeywords
-    static std::vector<int> absToRelIface; //!< list of relative iface indices indexed by absolute indices
-    /*This element below numMolTypes is called in Complex::Complex() function calls.*/
-    static unsigned numMolTypes; //!< number of molecule types in system (== molTemplateList.size())
-    static std::vector<int> numEachMolType; //!< array with length numMolTypes which holds the number of each in system
 
     // functions to find values
     int find_relIndex_from_absIndex(int targStateIndex) const;
     int find_absIndex_from_relIndex(int relIndex, char state) const;
-    void set_value(std::string& line, MolKeyword molKeyword);
+    void set_value(std::string& line, MolKeyword molKeyword, std::ostream& log);
 
     MolTemplate() = default;
     MolTemplate(Coord& comCoord, std::vector<Interface>& Interfaces);
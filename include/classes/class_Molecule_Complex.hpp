@@ -22,9 +22,12 @@
 
 #include "classes/class_Membrane.hpp"
 #include "classes/class_MolTemplate.hpp"
+#include "classes/class_Quat.hpp"
+#include "classes/class_SimulContext.hpp"
 #include "classes/class_Vector.hpp"
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <fstream>
 #include <limits>
@@ -33,8 +36,6 @@
  * \brief Classes actually used for simulation objects
  */
 
-extern int propCalled;
-
 enum class TrajStatus : int {
     none = 0,
     dissociated = 1,
@@ -160,16 +161,13 @@ struct Molecule {
     double mass { -1 }; //!< mass of this molecule
     bool isLipid { false }; //!< is the molecule a lipid
     Coord comCoord; //!< center of mass coordinate
+    Coord imageOffset {}; //!< taken off the coordinates by the periodic sides, so comCoord + imageOffset is unwrapped
     std::vector<Iface> interfaceList; //!< interface coordinates
     bool isEmpty { false }; //!< true if the molecule has been destroyed and is void
     TrajStatus trajStatus { TrajStatus::none }; //!< Status of the molecule in that timestep
 
     bool isImplicitLipid = false;
     int linksToSurface { 0 }; //!<store each proteins links to surface, to ease updating complex.
-    // static variables
-    static int numberOfMolecules; //!< counter for the number of molecules in the system
-    static std::vector<int> emptyMolList; //!< list of indices to empty Molecules in moleculeList
-
     // association variables
     // temporary positions
     Coord tmpComCoord {}; //!< temporary center of mass coordinates for association
@@ -218,19 +216,19 @@ struct Molecule {
     friend std::ostream& operator<<(std::ostream& os, const Molecule& mol);
 
     // association member functions
-    void display_assoc_icoords(const std::string& name);
+    void display_assoc_icoords(std::ostream& os, const std::string& name);
     void update_association_coords(const Vector& vec);
     void set_tmp_association_coords();
     void clear_tmp_association_coords();
     void create_position_implicit_lipid(Molecule& reactMol1, int ifaceIndex2, double bindRadius, const Membrane& membraneObject);
 
     // other reaction member functions
-    void create_random_coords(const MolTemplate& molTemplate, const Membrane& membraneObject);
-    void destroy();
+    void create_random_coords(const MolTemplate& molTemplate, const Membrane& membraneObject, gsl_rng* r);
+    void destroy(SimulContext& context);
 
-    void display(const MolTemplate& molTemplate) const;
-    void display_all() const;
-    void display_my_coords(const std::string& name);
+    void display(std::ostream& os, const MolTemplate& molTemplate) const;
+    void display_all(std::ostream& os) const;
+    void display_my_coords(std::ostream& os, const std::string& name);
 
     bool operator==(const Molecule& rhs) const;
     bool operator!=(const Molecule& rhs) const;
@@ -243,6 +241,34 @@ struct Molecule {
     }
 };
 
+struct DeferredMove {
+    /*! \struct DeferredMove
+     * \ingroup SimulClasses
+     * \brief A move of the temporary association coordinates of a Complex that hasn't been applied to all of its
+     * members yet: a rotation by rotQuat about rotOrigin, or a translation by transVec. See Complex::deferredMolIndex
+     */
+    bool isRotation { false };
+    Coord rotOrigin {};
+    Quat rotQuat {};
+    Vector transVec {};
+};
+
+struct TrajRotation {
+    /*! \struct TrajRotation
+     * \ingroup SimulClasses
+     * \brief The rotation of a Complex by its trajRot angles: the quaternion (and its inverse) Complex::propagate()
+     * applies, and the Euler matrix M the boundary and sweep functions apply. See Complex::traj_rotation()
+     */
+    Coord angles {}; //!< the trajRot the rotation was built from
+    Quat quat {};
+    Quat quatInverse {};
+    std::array<double, 9> M {};
+    bool isSet { false };
+
+    void set(const Coord& _angles);
+    void rotate(Vector& vec) const; //!< same as quat.rotate(vec)
+};
+
 struct Complex {
     /*! \struct Complex
      * \ingroup SimulClasses
@@ -262,14 +288,6 @@ public:
     bool OnSurface { false }; // to check whether on the implicit-lipid membrane.
     bool tmpOnSurface { false }; //
 
-    // static variables
-    static int numberOfComplexes; //!< total number of complexes in the system. starts out equal to numberOfMolecules
-    static int currNumberComTypes;
-    static int currNumberMolTypes;
-    static std::vector<int> emptyComList; //!< list of indices to empty Complexes in complexList
-
-    // TODO: TEMPORARY
-    static std::vector<int> obs; //!< TEMPORARY observables vector
     //std::vector<int> NofEach;//!< number of each protein type in this complex
     int linksToSurface = 0; //!< for an adsorbing surface, number of bonds/links formed between this complex and the surface.
     int iLipidIndex = 0; //!< If you need to look up the implicit lipid, this is its molecule index
@@ -277,29 +295,45 @@ public:
     int ncross { 0 };
     //    int movestat{ 0 };
     TrajStatus trajStatus { TrajStatus::none };
+    bool isDormant { false }; //!< true if the Complex skips propagation this step, see update_dormant_complexes
+    int numDormantSteps { 0 }; //!< number of steps the Complex has skipped since it last moved, caught up by its next move, see move_time()
+    int stepMultiple { 1 }; //!< multiple of the timestep the Complex was found isolated for, see update_dormant_complexes
+    bool hasClosureIndex { false }; //!< true if its loop closures are found by the ClosureIndex this step, instead of the pair search
     Vector trajTrans;
     Coord trajRot;
+    TrajRotation trajRotation {}; //!< cached rotation by trajRot, see traj_rotation()
     Coord tmpComCoord;
+    int deferredMolIndex { -1 }; //!< if not -1, moves of the temporary association coordinates are only applied to this member, and kept in deferredMoves for the others, see defer_tmp_crds()
+    std::vector<DeferredMove> deferredMoves {}; //!< moves not yet applied to the members other than deferredMolIndex, in order
 
     friend std::ostream& operator<<(std::ostream& os, const Molecule& mol);
 
     void update_properties(const std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList);
-    void display();
-    void display(const std::string& name);
+    void display(std::ostream& os);
+    void display(std::ostream& os, const std::string& name);
     Complex create(const Molecule& mol, const MolTemplate& molTemp);
-    void destroy(std::vector<Molecule>& moleculeList,
-        std::vector<Complex>& complexList);
+    void destroy(std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, SimulContext& context);
     void put_back_into_SimulVolume(
-        int& itr, Molecule& errantMol, const Membrane& membraneObject, std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList);
+        int& itr, Molecule& errantMol, const Membrane& membraneObject, std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList, std::ostream& log);
     void translate(Vector transVec, std::vector<Molecule>& moleculeList);
+    /*!
+     * \brief The rotation by trajRot, built only when trajRot has been resampled since the last call. The functions
+     * reflecting and sweeping a trial move, and propagate(), share it instead of each taking the sines and cosines.
+     */
+    const TrajRotation& traj_rotation();
+    /*!
+     * \brief Time covered by the next move of the Complex: this timestep and the numDormantSteps it skipped. Every
+     * trial move, and every resampling of one, draws its Gaussian steps over this time.
+     */
+    double move_time(double timeStep) const { return (numDormantSteps + 1) * timeStep; }
     // void propagate(std::vector<Molecule>& moleculeList);
-    void propagate(std::vector<Molecule>& moleculeList, const Membrane membraneObject, const std::vector<MolTemplate>& molTemplateList);
+    void propagate(std::vector<Molecule>& moleculeList, const Membrane& membraneObject, const std::vector<MolTemplate>& molTemplateList);
     void update_association_coords_sphere(std::vector<Molecule>& moleculeList, Coord iface, Coord ifacenew);
 
     Complex() = default;
     //    Complex(Molecule mol, Coord D, Coord Dr);
-    Complex(const Molecule& mol, const MolTemplate& oneTemp);
-    Complex(int _index, const Molecule& _memMol, const MolTemplate& _molTemp);
+    Complex(const Molecule& mol, const MolTemplate& oneTemp, unsigned numMolTypes);
+    Complex(int _index, const Molecule& _memMol, const MolTemplate& _molTemp, unsigned numMolTypes);
     Complex(Coord comCoord, Coord D, Coord Dr);
 
     /*
@@ -0,0 +1,52 @@
+/*! \file class_OutputQueue.hpp
+ * \brief Background thread for formatting and writing output files.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/*! \class OutputQueue
+ * \brief Runs output jobs on a dedicated writer thread, in the order they were pushed.
+ *
+ * Each job owns a snapshot of whatever it writes, so the simulation can go on changing the system while the job
+ * formats the old state. At most maxJobs snapshots are kept: push() blocks while the queue is full, so a slow disk
+ * slows the simulation down instead of growing memory. With maxJobs = 0 there is no thread, and push() runs each job
+ * right away on the calling thread.
+ */
+class OutputQueue {
+public:
+    explicit OutputQueue(int _maxJobs);
+    ~OutputQueue(); //!< writes the pending jobs, then stops the writer thread
+
+    OutputQueue(const OutputQueue&) = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+
+    /*!
+     * \brief Queues a job for the writer thread, waiting for a free slot if maxJobs are pending.
+     */
+    void push(std::function<void()> job);
+
+    /*!
+     * \brief Waits until every job pushed so far has been written.
+     */
+    void flush();
+
+    bool is_async() const { return maxJobs > 0; }
+
+private:
+    int maxJobs { 0 }; //!< largest number of queued snapshots. 0 writes synchronously
+    bool isStopping { false };
+    bool isWriting { false }; //!< true while the writer thread runs a job it has taken off jobList
+    std::deque<std::function<void()>> jobList;
+    std::mutex queueMutex;
+    std::condition_variable jobPushed; //!< wakes the writer thread
+    std::condition_variable jobDone; //!< wakes push() and flush()
+    std::thread writerThread;
+
+    void run();
+};
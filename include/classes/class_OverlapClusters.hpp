@@ -0,0 +1,63 @@
+/*! \file class_OverlapClusters.hpp
+ * \brief Complexes whose overlaps can be resolved independently of each other, resolved in parallel.
+ */
+
+#pragma once
+
+#include "classes/class_Molecule_Complex.hpp"
+#include "classes/class_WorkerPool.hpp"
+
+#include <gsl/gsl_rng.h>
+
+#include <functional>
+#include <vector>
+
+/*! \class OverlapClusters
+ * \brief Splits the overlap checks at the end of a timestep into clusters of Complexes, and resolves the clusters on
+ * a WorkerPool.
+ *
+ * Simulation::step() resolves each Complex that hasn't moved yet, from its first Molecule in moleculeList: its
+ * displacement and those of its overlapping partners that haven't moved either are resampled until it overlaps no
+ * one, and then it is moved (see sweep_separation_complex_rot). So two Complexes only affect each other through a chain
+ * of partners (Molecule::crossbase) that haven't moved. build() joins those into clusters, each keeping the order of
+ * its Complexes, and resolve() runs the clusters in parallel.
+ *
+ * Each cluster draws its random numbers from its own generator, seeded from the simulation's in the order of the
+ * clusters. So the result only depends on the seed, not on the number of threads, though it differs from resolving
+ * all Complexes in order with the simulation's generator.
+ */
+class OverlapClusters {
+public:
+    explicit OverlapClusters(WorkerPool& _workerPool);
+    ~OverlapClusters(); //!< frees the generators
+
+    OverlapClusters(const OverlapClusters&) = delete;
+    OverlapClusters& operator=(const OverlapClusters&) = delete;
+
+    /*!
+     * \brief Finds the Complexes to resolve, and the clusters they form.
+     *
+     * Must be called after the reactions of the timestep, when crossbase holds the partners of each Molecule. Builds the
+     * rotation of the partners that aren't resolved, which the clusters only read.
+     */
+    void build(const std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList);
+
+    /*!
+     * \brief Calls resolveOne with the first Molecule of each Complex found by build(), in order within each cluster,
+     * and the generator of the cluster. The clusters are seeded from r.
+     */
+    void resolve(gsl_rng* r, const std::function<void(int, gsl_rng*)>& resolveOne);
+
+    int size() const { return int(clusterStart.size()) - 1; } //!< number of clusters found by the last build()
+
+private:
+    WorkerPool& workerPool; //!< shared with the rest of the Simulation
+    std::vector<int> parentList {}; //!< union-find parent of each Complex, indexed by Complex index
+    std::vector<int> leadMolList {}; //!< first Molecule of each Complex to resolve, in moleculeList order
+    std::vector<int> clusterStart {}; //!< Molecules of cluster i are clusterMolList[clusterStart[i]] to clusterMolList[clusterStart[i + 1] - 1]
+    std::vector<int> clusterMolList {};
+    std::vector<unsigned long> seedList {}; //!< of each cluster's generator
+    std::vector<gsl_rng*> rngList {}; //!< generator of each cluster, kept from one timestep to the next
+
+    int find_root(int comIndex);
+};
@@ -16,6 +16,7 @@
 
 #include <fstream>
 #include <map>
+#include <string>
 #include <vector>
 
 /*! \enum DebugKeywords
@@ -50,6 +51,29 @@ enum class ParamKeyword : int {
     name = 13, //!< name of the simulation
     checkPoint = 14, //!< interval to write checkpoint
     scaleMaxDisplace = 15, //!< scalar of average displacement that is acceptable upon association.
+    verletSkin = 16, //!< skin added to rMaxLimit for the Verlet pair list. 0 turns the list off
+    surfaceGrid = 17, //!< bin membrane-bound Molecules of a spherical system on a surface grid
+    maxCellOccupancy = 18, //!< split SubVolumes holding more Molecules than this for the pair search. 0 turns it off
+    dormantDisplace = 19, //!< RMS displacement a Complex may skip while dormant. 0 turns dormancy off
+    maxStepMultiple = 20, //!< largest multiple of timeStep an isolated Complex may advance by. 1 turns it off
+    outputQueueSize = 21, //!< number of output snapshots the writer thread may fall behind by. 0 writes synchronously
+    pdbStream = 22, //!< write the pdbWrite frames as models of one indexed pdb file
+    timeSeriesBlock = 23, //!< rows per block of the binary time-series files. 0 writes text
+    trajBox = 24, //!< only write Molecules with their COM in this box to the trajectory and pdb files
+    trajSphere = 25, //!< only write Molecules with their COM in this sphere to the trajectory and pdb files
+    trajMolTypes = 26, //!< only write Molecules of these types to the trajectory and pdb files
+    trajMinComplexSize = 27, //!< only write Molecules in Complexes with at least this many members
+    trajStride = 28, //!< only write every trajStride-th Molecule
+    checkPointFullEvery = 29, //!< every how many checkpoints a full restart file is written. the others are deltas
+    checkPointForks = 30, //!< number of child processes that may write checkpoints at once. 0 writes them in the simulation
+    analysisWrite = 31, //!< timestep interval to sample the in-situ analysis. -1 turns it off
+    analysisRdfPairs = 32, //!< pairs of Molecule types to compute radial distribution functions for, as [A-B, A-A]
+    analysisRdfMax = 33, //!< largest distance of the radial distribution functions
+    analysisRdfBins = 34, //!< number of bins of the radial distribution functions
+    analysisDensityBins = 35, //!< number of bins along each side of the membrane surface density maps. 0 turns them off
+    numThreads = 36, //!< number of threads the associations of a timestep are placed on. 1 performs them in order
+    closureIndexSize = 37, //!< Complexes with at least this many members find loop closures from their free interfaces. 0 turns it off
+    parallelOverlap = 38, //!< resolve overlaps in independent clusters of Complexes, each with its own random numbers, on numThreads threads
 };
 
 /*! \enum MolKeyword
@@ -115,6 +139,35 @@ struct Parameters {
         int verbosity { 0 };
     };
 
+    /*! \brief Which Molecules go to the trajectory and pdb files. A Molecule is written if it passes every criterion
+     * that is set. See select_output_molecules
+     */
+    struct TrajFilter {
+        std::vector<double> box {}; //!< [xmin, ymin, zmin, xmax, ymax, zmax] in nm, in simulation coordinates
+        std::vector<double> sphere {}; //!< [x, y, z, radius] in nm, in simulation coordinates
+        std::vector<std::string> molTypeNames {};
+        int minComplexSize { 0 };
+        int stride { 1 }; //!< Molecules with index % stride == 0, so the same ones are written every frame
+
+        bool is_active() const
+        {
+            return !box.empty() || !sphere.empty() || !molTypeNames.empty() || minComplexSize > 1 || stride > 1;
+        }
+    };
+
+    /*! \struct Analysis
+     * \brief What InSituAnalysis samples from the live system, instead of reading it back from the trajectory.
+     */
+    struct Analysis {
+        long long int write { -1 }; //!< timestep interval between samples
+        std::vector<std::pair<std::string, std::string>> rdfPairNames {};
+        double rdfMax { 0 }; //!< in nm. 0 uses the largest distance the cell lists can find all pairs within
+        int rdfBins { 50 };
+        int densityBins { 0 };
+
+        bool is_active() const { return write > 0; }
+    };
+
     // parameter values
     int rank;
     int numMolTypes { 0 }; //!< number of MolTemplates. used to be Nprotypes
@@ -144,6 +197,10 @@ struct Parameters {
     // file names, for restart
     std::string trajFile { "trajectory.xyz" };
     std::string restartFile { "restart.dat" };
+    std::string modelCacheDir {}; //!< directory of compiled models, set with --model-cache. see parse_input_cached
+    int numReplicas { 1 }; //!< independent runs of the model, set with -n. see Simulation::run_replicas
+    std::string outputDir {}; //!< if not empty, every output file is written there, set with -o. see output_path
+    std::vector<std::string> paramOverrides {}; //!< keyword = value lines read after the parameters block, or the restart file, set with -p
 
     // TODO: TEMPORARY
     bool isNonEQ { false };
@@ -152,6 +209,22 @@ struct Parameters {
     double rMaxLimit { 0 };
     double rMaxRadius { 0 };
 
+    double verletSkin { 0 }; //!< in nm. if > 0, candidate pairs within rMaxLimit + verletSkin are reused between steps
+    bool surfaceGrid { false }; //!< only used if Membrane::isSphere. see SimulVolume::SurfaceGrid
+    int maxCellOccupancy { 0 }; //!< if > 0, the pair search uses SimulVolume::AdaptiveGrid
+    double dormantDisplace { 0 }; //!< in nm. if > 0, isolated slow Complexes are not propagated, see update_dormant_complexes
+    int maxStepMultiple { 1 }; //!< if > 1, Complexes far from any partner take longer steps, see update_dormant_complexes
+    int outputQueueSize { 0 }; //!< if > 0, output is formatted and written on an OutputQueue thread
+    bool pdbStream { false }; //!< if true, pdb frames are appended to trajectory.pdb instead of one file each, see PdbStream
+    int timeSeriesBlock { 0 }; //!< if > 0, copy numbers, bound pairs and events are written to binary files, see TimeSeriesFile
+    TrajFilter trajFilter {}; //!< if active, the trajectory and pdb frames aren't padded to numTotalUnits
+    int checkPointFullEvery { 1 }; //!< if > 1, checkpoints in between full ones are restart%lld.delta files, see CheckpointChain
+    int checkPointForks { 0 }; //!< if > 0, full checkpoints are written by forked child processes, see CheckpointForker
+    Analysis analysis {}; //!< if active, complex sizes, RDFs and surface densities are sampled, see InSituAnalysis
+    int numThreads { 1 }; //!< if > 1, associations within a timestep are placed in parallel, see AssociationBatch
+    int closureIndexSize { 0 }; //!< if > 0, loops within Complexes this large are found by a ClosureIndex
+    bool parallelOverlap { false }; //!< if true, overlaps are resolved by cluster, see OverlapClusters
+
     // IO information. Iterators need to be long long because they can exceed 2^32
     bool fromRestart { false }; //!< is this simulation initialized from a restart file. used to be int restart
     long long int timeWrite { 10 }; //!< timestep interval to print timestep. used to be statwrite
@@ -160,9 +233,12 @@ struct Parameters {
     long long int pdbWrite { -1 }; //!< interval to write pdb
     long long int checkPoint { -1 }; //!< interval to write checkpoint
 
-    void display();
-    void parse_paramFile(std::ifstream& paramFile);
+    void display(std::ostream& os);
+    void parse_paramFile(std::ifstream& paramFile, std::ostream& log);
+    bool parse_paramLine(std::string line, std::ostream& log); //!< sets the parameter of one keyword = value line, false if it's unknown
+    void apply_paramOverrides(std::ostream& log); //!< parses each of paramOverrides, exits if one is unknown
+    std::string output_path(const std::string& fileName) const; //!< fileName in outputDir, unless it is absolute
 
     Parameters() = default;
-    void set_value(std::string value, ParamKeyword keywords);
+    void set_value(std::string value, ParamKeyword keywords, std::ostream& log);
 };
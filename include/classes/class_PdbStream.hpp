@@ -0,0 +1,51 @@
+/*! \file class_PdbStream.hpp
+ * \brief Multi-model pdb file with an index of its frames.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+
+/*! \class PdbStream
+ * \brief One open pdb file that each pdbWrite frame is appended to as a MODEL/ENDMDL record.
+ *
+ * Writes are buffered by the stream and only reach the disk when the buffer fills, on flush() or on close, instead of
+ * opening, writing and closing a new file every frame. Alongside the pdb file, fileName.idx gets one line per frame
+ * with the frame number, the iteration and the byte offset of its MODEL record, so a frame can be read by seeking
+ * straight to it.
+ */
+class PdbStream {
+public:
+    /*!
+     * \brief Opens fileName and its index. If append is true, frames are added after those already in the files.
+     *
+     * On append, the frames after iteration lastItr, i.e. those written after the restart file being restarted from,
+     * are first cut from both files, as is an unfinished last frame.
+     */
+    void open(const std::string& fileName, bool append, long long int lastItr);
+
+    bool is_open() const { return pdbFile.is_open(); }
+    int get_num_frames() const { return numFrames; }
+    std::ofstream& get_file() { return pdbFile; } //!< for records outside the frames, e.g. the unit cell
+
+    /*!
+     * \brief Indexes a new frame and writes its MODEL record. The ATOM records go to the returned stream.
+     */
+    std::ofstream& begin_model(long long int simItr);
+
+    /*!
+     * \brief Closes the frame started by begin_model
+     */
+    void end_model();
+
+    /*!
+     * \brief Writes the buffered frames to the disk, e.g. before a restart file is written
+     */
+    void flush();
+
+private:
+    std::ofstream pdbFile;
+    std::ofstream indexFile;
+    int numFrames { 0 };
+};
@@ -5,6 +5,7 @@
 
 #pragma once
 #include "classes/class_Vector.hpp"
+#include <array>
 #include <iostream>
 
 struct Quat {
@@ -35,6 +36,11 @@ struct Quat {
      */
     void rotate(Vector& vec);
 
+    /*!
+     * \brief The rotation matrix of a unit Quat, rotating a vector as rotate() does, for use with matrix_rotate().
+     */
+    std::array<double, 9> rotation_matrix();
+
     Quat() = default;
     Quat(double _w, double _x, double _y, double _z)
         : w(_w)
@@ -22,8 +22,6 @@
  * \brief Classes and functions specific to reaction events.
  */
 
-extern unsigned long totMatches;
-
 /*! \enum ReactionType
  * \brief Enumeration of reaction types
  */
@@ -127,9 +125,6 @@ public:
     std::vector<int> intProductList {}; //!< list of absolute interface state indices of the product(s)
     std::vector<int> intReactantList {}; //!< list of absolute interface state indices of the reactant(s)
 
-    static unsigned numberOfRxns; //!< total number of unique ForwardRxns, CreateDestructRxns, and ConditionalRates
-    static int totRxnSpecies; //!< total number of unique reactants and products
-
     std::vector<RxnIface> productListNew {}; //!< list of the product interfaces. indexed to  0 and 1, even for single
         //!< products (enters duplicate as dummy)
     std::vector<RxnIface> reactantListNew {}; //!< list of the reactant interfaces. indexed to 0 and 1, even for single
@@ -139,7 +134,7 @@ public:
     std::pair<RxnIface, RxnIface> stateChangeIface; //!< interfaces which don't change interaction but change state
     /**< Contains rates dependent on different parameters, e.g. bound interfaces, different states, etc.*/
 
-    virtual void display() const = 0;
+    virtual void display(std::ostream& os) const = 0;
 };
 
 struct ParsedRxn; // forward declaration
@@ -169,7 +164,7 @@ public:
         //!< interface)
 
         // TODO: make it so that no angle can be -M_PI
-        void display() const;
+        void display(std::ostream& os) const;
 
         explicit Angles() = default;
         explicit Angles(std::array<double, 5> angArray)
@@ -214,8 +209,8 @@ public:
 
     Angles assocAngles { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN() }; //!< Angles relative to sigma for association
 
-    void display() const override;
-    void assoc_display(const std::vector<MolTemplate>& molTemplateList) const;
+    void display(std::ostream& os) const override;
+    void assoc_display(std::ostream& os, const std::vector<MolTemplate>& molTemplateList) const;
     ForwardRxn bngl_copy_rxn();
 
     // constructors
@@ -224,7 +219,7 @@ public:
      * \brief This constructor takes a fully parsedRxn and converts it into a ForwardRxn for use during the
      simulation.
      */
-    explicit ForwardRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList);
+    explicit ForwardRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList, unsigned& numberOfRxns);
     ForwardRxn(double bindRadius, const Angles& assocAngles)
         : bindRadius(bindRadius)
         , assocAngles(assocAngles)
@@ -254,14 +249,14 @@ struct BackRxn : public RxnBase {
     size_t conjForwardRxnIndex { 0 }; //!< the index of this reaction's ForwardRxn counterpart
     std::vector<RxnBase>::iterator conjForwardRxn; //!< iterator to this reaction's ForwardRxn (not implemented)
 
-    void display() const override;
+    void display(std::ostream& os) const override;
 
     BackRxn() = default;
 
     /*!
      * \brief This constructor creates a conjugate BackRxn from a reversible ForwardRxn
      */
-    explicit BackRxn(double offRatekb, ForwardRxn& forwardRxn);
+    explicit BackRxn(double offRatekb, ForwardRxn& forwardRxn, unsigned& numberOfRxns);
 };
 
 /*******************/
@@ -301,7 +296,7 @@ struct CreateDestructRxn : public RxnBase {
     unsigned conjBackRxnIndex { 0 };
     double creationRadius { 1.0 }; //!< the radius of the sphere within which the created specie can be placed
 
-    void display() const override;
+    void display(std::ostream& os) const override;
 
     /* CONSTRUCTORS */
     CreateDestructRxn() = default;
@@ -310,5 +305,5 @@ struct CreateDestructRxn : public RxnBase {
      * \brief This function takes a fully parsed reaction block and converts it to a CreateDestructRxn for use
      * during the simulation
      */
-    explicit CreateDestructRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList);
+    explicit CreateDestructRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList, unsigned& numberOfRxns);
 };
@@ -0,0 +1,45 @@
+/*! \file class_SimulContext.hpp
+ * \brief The random number generator, counters and free lists of one simulation.
+ */
+
+#pragma once
+
+#include <gsl/gsl_rng.h>
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+/*! \struct SimulContext
+ * \brief What a simulation keeps besides its Molecules, Complexes, templates and reactions: the RNG, the stream its
+ * messages go to, the running counts of molecules, complexes, states and reactions, and the empty slots of
+ * moleculeList and complexList.
+ *
+ * Each Simulation has its own, and passes it to the parser, the reactions and the updates that use it, so two
+ * Simulations can run on different threads. The parser only fills in the counts of the model (numMolTypes to
+ * totRxnSpecies), the rest is set as the system is built.
+ */
+struct SimulContext {
+    gsl_rng* r { nullptr }; //!< owned by the Simulation. Overlap clusters draw from their own, see OverlapClusters
+    std::ostream& log = std::cout; //!< the Simulation's log, see Simulation::log
+    std::atomic<unsigned long> totMatches { 0 }; //!< atomic, since find_which_reaction also runs on AssociationBatch threads
+
+    // the model
+    unsigned numMolTypes { 0 }; //!< number of molecule types in system (== molTemplateList.size())
+    int totalNumOfStates { 0 }; //!< total number of interface states, over all molecule types
+    std::vector<int> absToRelIface {}; //!< list of relative iface indices indexed by absolute indices
+    unsigned numberOfRxns { 0 }; //!< total number of unique ForwardRxns, CreateDestructRxns, and ConditionalRates
+    int totRxnSpecies { 0 }; //!< total number of unique reactants and products
+
+    // the system
+    std::vector<int> numEachMolType {}; //!< array with length numMolTypes which holds the number of each in system
+    int numberOfMolecules { 0 }; //!< counter for the number of molecules in the system
+    std::vector<int> emptyMolList {}; //!< list of indices to empty Molecules in moleculeList
+    int numberOfComplexes { 0 }; //!< total number of complexes in the system. starts out equal to numberOfMolecules
+    std::vector<int> emptyComList {}; //!< list of indices to empty Complexes in complexList
+
+    SimulContext() = default;
+    explicit SimulContext(std::ostream& _log);
+    SimulContext(const SimulContext& other); //!< copies everything but r, which is left null
+    SimulContext& operator=(const SimulContext& other); //!< copies everything but r and log, which are kept
+};
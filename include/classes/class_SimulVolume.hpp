@@ -38,7 +38,7 @@ struct SimulVolume {
             memberMolList; //!< list of Molecule indices in moleculeList which currently reside in the SubBox
         std::vector<int> neighborList; //!< list of SubBox absolute indices which are neighbors of this SubBox.
 
-        void display();
+        void display(std::ostream& os);
     };
 
     struct Dimensions {
@@ -49,32 +49,153 @@ struct SimulVolume {
 
         /*! \func check_dimensions
          * \brief Checks the SubBoxes to make sure they are not too small
+         *
+         * The number of SubBoxes is capped by the number of pairs of the numberOfMolecules in the system.
          */
-        void check_dimensions(const Parameters& params, const Membrane &membraneObject);
+        void check_dimensions(const Parameters& params, const Membrane &membraneObject, int numberOfMolecules, std::ostream& log);
 
         Dimensions() = default;
         explicit Dimensions(const Parameters& params, const Membrane &membraneObject);
     };
 
+    /*! \struct VerletList
+     * \brief Candidate Molecule pairs within rMaxLimit + skin, reused between timesteps.
+     *
+     * The list stays valid until any Molecule has moved more than skin/2 from where it was when the list was built,
+     * since only then can a pair that was outside rMaxLimit + skin have come within rMaxLimit.
+     */
+    struct VerletList {
+        double cutoff{ 0 }; //!< rMaxLimit + skin, in nm
+        double maxDisplace{ 0 }; //!< skin/2, in nm. Molecules moving further than this invalidate the list
+        long long numRebuilds{ 0 }; //!< number of times the list has been built
+        std::vector<int> targMolList; //!< Molecule indices, in the order they are visited as the target of a pair
+        std::vector<std::vector<int>> partnerList; //!< partners of each target, indexed by Molecule index
+        std::vector<Coord> refCoordList; //!< Molecule COMs when the list was built, indexed by Molecule index
+        std::vector<bool> wasPresent; //!< was the Molecule in the SimulVolume when the list was built
+    };
+
+    /*! \struct SurfaceGrid
+     * \brief Iso-latitude partition of a spherical membrane, for the Molecules of membrane-bound Complexes.
+     *
+     * The shell is cut into rings of equal polar-angle width, and each ring into cells of roughly equal area, so
+     * occupancy follows the surface density instead of the cubic grid's crowded shell cells. The cells are appended
+     * to subCellList after the cubic SubVolumes, so the pair search treats them like any other SubVolume. Their
+     * neighborLists hold the later surface cells and the cubic SubVolumes within reach.
+     */
+    struct SurfaceGrid {
+        bool isActive{ false };
+        int firstCell{ 0 }; //!< index of the first surface cell in subCellList
+        int numRings{ 0 }; //!< number of rings, from the +z pole to the -z pole
+        double ringAngle{ 0 }; //!< polar-angle width of each ring, in radians
+        double rShellMin{ 0 }; //!< in nm. Molecules closer to the center stay in the cubic grid
+        double rShellMax{ 0 }; //!< in nm. Molecules further from the center stay in the cubic grid
+        std::vector<int> ringStart; //!< index of the first cell of each ring, relative to firstCell
+        std::vector<int> ringNumCells; //!< number of cells around each ring
+    };
+
+    /*! \struct AdaptiveGrid
+     * \brief Leaf cells for the pair search, made by recursively splitting crowded SubVolumes.
+     *
+     * Any SubVolume holding more than Parameters::maxCellOccupancy Molecules is split in half along each dimension
+     * of its members' bounding box, until every piece is small enough or maxDepth is reached. Empty pieces are never
+     * made. Each leaf's neighborList holds the later leaves whose bounding boxes are within rMaxLimit of its own, so
+     * leafList can replace subCellList in the pair search as is.
+     */
+    struct AdaptiveGrid {
+        int maxDepth{ 3 }; //!< a SubVolume is split at most this many times
+        int numSplitCells{ 0 }; //!< number of SubVolumes that were split in the last build
+        std::vector<SubVolume> leafList; //!< occupied leaves, with absIndex the index in this list
+        std::vector<Coord> lowerList; //!< lower corner of each leaf's bounding box, indexed like leafList
+        std::vector<Coord> upperList; //!< upper corner of each leaf's bounding box, indexed like leafList
+        std::vector<int> occupiedCellList; //!< SubVolumes with leaves in the last build
+        std::vector<std::vector<int>> cellLeafList; //!< leaves of each SubVolume, indexed like subCellList
+        std::vector<std::vector<int>> cellAdjacencyList; //!< neighbors of each SubVolume, in both directions
+    };
+
+    /*! \struct IsolationGrid
+     * \brief Coarse bins of all Molecules, for the distance from a Complex to its nearest neighbor.
+     *
+     * The cells are at least reach wide, so anything within reach of a Molecule is in the 27 cells around it.
+     */
+    struct IsolationGrid {
+        double reach{ 0 }; //!< in nm. largest distance find_isolation_distance can return
+        int numX{ 1 };
+        int numY{ 1 };
+        int numZ{ 1 };
+        std::vector<int> molCellList; //!< cell of each Molecule, indexed by Molecule index. -1 if not binned
+        std::vector<int> cellStart; //!< members of cell i are cellMemberList[cellStart[i]] to cellMemberList[cellStart[i + 1] - 1]
+        std::vector<int> cellMemberList;
+    };
+
     int maxNeighbors{ 13 }; //!< maximum number of neighbors a SubBox can have. Currently set to cubic
     Dimensions numSubCells{}; //!< number of SubBoxes in each dimension
     Coord subCellSize{}; //!< dimensions of each SubBox in nanometers
     std::vector<SubVolume> subCellList; //!< list of all the SubBoxes in the SimulBox. Size == numSubBoxes.tot
+    VerletList verletList{}; //!< only used if Parameters::verletSkin > 0
+    SurfaceGrid surfaceGrid{}; //!< only used if Parameters::surfaceGrid and Membrane::isSphere
+    AdaptiveGrid adaptiveGrid{}; //!< only used if Parameters::maxCellOccupancy > 0
+    IsolationGrid isolationGrid{}; //!< only used if Parameters::maxStepMultiple > 1
 
     /*!
      * \brief Main function for the creation of the SubBoxes in the SimulBox.
      *
      * \param[in] params Parameters as given by the parameter file
+     * \param[in] numberOfMolecules number of Molecules in the system, see Dimensions::check_dimensions()
      */
-    void create_simulation_volume(const Parameters& params, const Membrane &membraneObject);
+    void create_simulation_volume(const Parameters& params, const Membrane &membraneObject, int numberOfMolecules, std::ostream& log);
 
     /*!
      * \brief Set up the neighborLists for each SubBox.
      *
      * A SubBox only looks for neighbors forward and up. This prevents double counting in the pairwise interaction
-     * search later in the main function
+     * search later in the main function. Along a periodic axis of at least 3 cells, the neighbors wrap around.
      */
-    void create_cell_neighbor_list_cubic();
+    void create_cell_neighbor_list_cubic(const Membrane& membraneObject);
+
+    /*!
+     * \brief Replaces the cell indices of crds along the periodic axes, with the images folded back into the box.
+     */
+    void find_periodic_cell(const Coord& crds, const Membrane& membraneObject, int& xItr, int& yItr, int& zItr) const;
+
+    /*!
+     * \brief Appends the SurfaceGrid cells to subCellList and sets up their neighborLists.
+     * \param[in] params Parameters as given by the parameter file. Uses rMaxLimit.
+     * \param[in] membraneObject Membrane, for sphereR and the waterBox.
+     * \param[in] numberOfMolecules number of Molecules in the system, caps the number of cells.
+     *
+     * Cells are neighbors if any two points in them can be within rMaxLimit of each other, which is checked on
+     * the bounding cap of each cell. Must be called after create_cell_neighbor_list_cubic().
+     */
+    void create_surface_grid(const Parameters& params, const Membrane& membraneObject, int numberOfMolecules, std::ostream& log);
+
+    /*!
+     * \brief Finds the SurfaceGrid cell of a Molecule.
+     * \param[in] mol The Molecule.
+     * \param[in] complexList List of all Complexes in the system.
+     * \return index of the cell in subCellList, or -1 if the Molecule belongs in the cubic grid.
+     */
+    int find_surface_cell(const Molecule& mol, const std::vector<Complex>& complexList) const;
+
+    /*!
+     * \brief Bins all Molecules into the IsolationGrid.
+     * \param[in] reach largest distance of interest, in nm.
+     * \param[in] moleculeList List of all Molecules in the system.
+     * \param[in] membraneObject Membrane, for the dimensions of the waterBox.
+     */
+    void build_isolation_grid(double reach, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
+
+    /*!
+     * \brief Distance from a Complex to the nearest other Molecule or boundary, up to some maximum.
+     * \param[in] targCom the Complex.
+     * \param[in] moleculeList List of all Molecules in the system.
+     * \param[in] membraneObject Membrane, for the dimensions of the waterBox and sphere.
+     * \param[in] maxDist furthest distance of interest, in nm. No larger than the IsolationGrid reach.
+     * \return smallest COM distance from any member, or maxDist if nothing is closer.
+     *
+     * Must be called after build_isolation_grid(), with no Molecules moved in between.
+     */
+    double find_isolation_distance(const Complex& targCom, const std::vector<Molecule>& moleculeList,
+        const Membrane& membraneObject, double maxDist) const;
 
     /*!
      * \brief Update the lists of Molecule members in each SubVolume.
@@ -88,7 +209,38 @@ struct SimulVolume {
      * Molecule doesn't fit.
      */
     void update_memberMolLists(const Parameters& params, std::vector<Molecule>& moleculeList,
-			       std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, const Membrane &membraneObject, int simItr);
+			       std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, const Membrane &membraneObject, int simItr, std::ostream& log);
+
+    /*!
+     * \brief Builds the Verlet pair list.
+     * \param[in] params Parameters as provided by user. Uses rMaxLimit and verletSkin.
+     * \param[in] moleculeList List of all Molecules in the system.
+     * \param[in] membraneObject Membrane, for the dimensions of the waterBox.
+     *
+     * Molecules are binned into a temporary grid with cells no smaller than rMaxLimit + skin, and each pair within
+     * that distance is stored once, under the target visited first.
+     */
+    void build_verlet_list(const Parameters& params, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
+
+    /*!
+     * \brief Checks if the Verlet pair list has to be rebuilt.
+     * \param[in] moleculeList List of all Molecules in the system.
+     *
+     * True if any Molecule has moved more than skin/2 since the list was built, if moleculeList has changed size, or
+     * if a Molecule has been created in a slot that was empty when the list was built. A Molecule destroyed in place
+     * leaves the list valid: its pairs stay in it, and the pair search skips empty Molecules.
+     */
+    bool verlet_list_is_stale(const std::vector<Molecule>& moleculeList) const;
+
+    /*!
+     * \brief Builds the AdaptiveGrid leaves from the current memberMolLists.
+     * \param[in] params Parameters as provided by user. Uses rMaxLimit and maxCellOccupancy.
+     * \param[in] moleculeList List of all Molecules in the system.
+     *
+     * Must be called after update_memberMolLists(), since only SubVolumes that are some Molecule's mySubVolIndex
+     * are visited.
+     */
+    void build_adaptive_grid(const Parameters& params, const std::vector<Molecule>& moleculeList);
 
-    void display();
+    void display(std::ostream& os);
 };
@@ -0,0 +1,213 @@
+/*! \file class_Simulation.hpp
+ * \brief One NERDSS simulation, from parsing its input to writing its final files, for embedding in other programs.
+ */
+
+#pragma once
+
+#include "classes/class_AssociationBatch.hpp"
+#include "classes/class_CheckpointChain.hpp"
+#include "classes/class_CheckpointForker.hpp"
+#include "classes/class_ClosureIndex.hpp"
+#include "classes/class_InSituAnalysis.hpp"
+#include "classes/class_Membrane.hpp"
+#include "classes/class_MolTemplate.hpp"
+#include "classes/class_Molecule_Complex.hpp"
+#include "classes/class_OutputQueue.hpp"
+#include "classes/class_OverlapClusters.hpp"
+#include "classes/class_Parameters.hpp"
+#include "classes/class_PdbStream.hpp"
+#include "classes/class_Rxns.hpp"
+#include "classes/class_SimulVolume.hpp"
+#include "classes/class_TimeSeriesFile.hpp"
+#include "classes/class_copyCounters.hpp"
+
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*! \class Simulation
+ * \brief Everything the nerdss executable used to keep in main(): the system, the reactions, the 2D reaction tables
+ * and the output files, with init(), step() and run() in place of the time loop.
+ *
+ * Each Simulation keeps the RNG, counters and free lists the reactions and updates use in its own SimulContext, and
+ * passes it to them, so several Simulations can be created and stepped in one process, in turn or on different
+ * threads, e.g. by a parameter sweep.
+ *
+ * Messages go to the log stream given to the constructor, std::cout by default, and errors to std::cerr. Output
+ * files are written to the working directory, as with the executable, or to the output directory set with -o
+ * (see Parameters::output_path()). The input, .mol and add files are read from the working directory, and a restart
+ * file and its rng_state from the output directory. With -n, see run_replicas().
+ */
+class Simulation {
+public:
+    /*!
+     * \param _useClusterSweep overlaps of membrane-bound complexes are resolved with
+     * sweep_separation_complex_rot_memtest_cluster() instead of sweep_separation_complex_rot_memtest()
+     * \param _log where the messages of this Simulation go. It must outlive the Simulation
+     */
+    explicit Simulation(bool _useClusterSweep = false, std::ostream& _log = std::cout);
+    ~Simulation();
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    /*!
+     * \brief Reads the input or restart file named by the command line flags (see parse_command()), builds the
+     * system and writes the initial output files.
+     */
+    void init(int argc, char* argv[]);
+
+    /*!
+     * \brief Same as init() with the flags -f paramFile -s seed, -o outputDir if it isn't empty, and -p for each
+     * keyword = value line of paramOverrides.
+     */
+    void init(const std::string& paramFile, unsigned seed, const std::vector<std::string>& paramOverrides = {},
+        const std::string& outputDir = "");
+
+    /*!
+     * \brief Starts a new run of the model that source parsed from its input file, without reading it again.
+     *
+     * source must have been initialized from an input file, not from a restart file. The 2D and implicit-lipid
+     * reaction tables are shared with source, so each of them is computed once for all the runs of the model.
+     */
+    void init(const Simulation& source, unsigned seed, const std::string& outputDir = "");
+
+    /*!
+     * \brief Runs the next timestep. Returns false, without doing anything, once the last timestep has been run.
+     */
+    bool step();
+
+    /*!
+     * \brief Writes the files of the last timestep run: restart.dat, the trajectory, final_coords.xyz and the time
+     * series.
+     */
+    void finish();
+
+    /*!
+     * \brief Runs all the remaining timesteps, then finish().
+     */
+    void run();
+
+    // observers, valid between calls
+    long long int get_simItr() const { return simItr; }
+    double get_time() const; //!< simulated time, in seconds
+    const Parameters& get_params() const { return params; }
+    const std::vector<MolTemplate>& get_molTemplateList() const { return molTemplateList; }
+    const std::vector<Molecule>& get_moleculeList() const { return moleculeList; }
+    const std::vector<Complex>& get_complexList() const { return complexList; }
+    const std::map<std::string, int>& get_observablesList() const { return observablesList; }
+    const copyCounters& get_counterArrays() const { return counterArrays; }
+    const Membrane& get_membraneObject() const { return membraneObject; }
+
+private:
+    /*! \struct Model
+     * \brief What was parsed from the input file, before the system is built from it.
+     */
+    struct Model {
+        Parameters params {};
+        std::map<std::string, int> observablesList {};
+        std::vector<ForwardRxn> forwardRxns {};
+        std::vector<BackRxn> backRxns {};
+        std::vector<CreateDestructRxn> createDestructRxns {};
+        std::vector<MolTemplate> molTemplateList {};
+        Membrane membraneObject {};
+        SimulContext context {}; //!< only the counts of the model, set while parsing
+    };
+
+    /*! \struct ReactionTables
+     * \brief 2D reaction probability tables, filled in as the reactions are first tried.
+     *
+     * Shared by the Simulations initialized from one another, which can run on different threads, see run_replicas().
+     */
+    struct ReactionTables {
+        std::vector<gsl_matrix*> survMatrices {};
+        std::vector<gsl_matrix*> normMatrices {};
+        std::vector<gsl_matrix*> pirMatrices {};
+        std::vector<double> tableIDs {};
+        unsigned DDTableIndex { 0 };
+        std::vector<double> IL2DbindingVec {};
+        std::vector<double> IL2DUnbindingVec {};
+        std::vector<double> ILTableIDs {};
+        std::mutex mutex {}; //!< held while a table is looked up or made
+
+        ReactionTables() = default;
+        ReactionTables(const ReactionTables&) = delete;
+        ReactionTables& operator=(const ReactionTables&) = delete;
+        ~ReactionTables();
+    };
+
+    bool useClusterSweep { false };
+    bool isInitialized { false };
+    bool isFinished { false };
+    std::ostream& log; //!< messages, with their format flags, so Simulations on other threads don't share them
+    SimulContext context { log }; //!< context.r is allocated by setup() and freed by the destructor
+    std::shared_ptr<const Model> model {}; //!< only for a new simulation, see init(const Simulation&, unsigned)
+    std::shared_ptr<ReactionTables> tables {};
+
+    std::chrono::system_clock::time_point totalTimeStart {};
+    std::vector<std::chrono::duration<double>> durationList {};
+    int numSavedDurations { 1000 };
+
+    // Simulation species and reaction lists
+    std::vector<MolTemplate> molTemplateList {};
+    std::vector<ForwardRxn> forwardRxns {};
+    std::vector<BackRxn> backRxns {};
+    std::vector<CreateDestructRxn> createDestructRxns {};
+    std::map<std::string, int> observablesList {};
+
+    Parameters params {};
+    SimulVolume simulVolume {};
+    std::vector<Molecule> moleculeList {};
+    std::vector<Complex> complexList {};
+    Membrane membraneObject {};
+    copyCounters counterArrays {};
+    int implicitlipidIndex { 0 };
+    long long int simItr { 0 };
+    int numDormantComplexes { 0 };
+
+    // output files. the streams must outlive the OutputQueue that writes to them
+    std::string observablesFileName { "observables_time.dat" };
+    std::string trajFileName { "trajectory.xyz" };
+    std::string restartFileName { "restart.dat" };
+    std::ofstream assemblyfile {};
+    std::ofstream dimerfile {};
+    std::ofstream eventFile {};
+    std::ofstream pairOutfile {};
+    std::ofstream speciesFile1 {};
+    int meanComplexSize { 0 };
+    TimeSeriesSet timeSeries {};
+    PdbStream pdbStream {};
+    std::unique_ptr<OutputQueue> outputQueue {};
+    std::unique_ptr<CheckpointChain> checkpointChain {};
+    std::unique_ptr<CheckpointForker> checkpointForker {};
+    std::unique_ptr<InSituAnalysis> inSituAnalysis {};
+    std::unique_ptr<WorkerPool> workerPool {}; //!< only with numThreads > 1 or parallelOverlap
+    std::unique_ptr<AssociationBatch> associationBatch {}; //!< only with numThreads > 1
+    std::unique_ptr<ClosureIndex> closureIndex {}; //!< only with closureIndexSize > 0, in a box
+    std::unique_ptr<OverlapClusters> overlapClusters {}; //!< only with parallelOverlap, without the cluster sweep
+
+    void set_output_dir(); //!< creates params.outputDir, if any, and makes it absolute
+    void flush_associations(); //!< performs the associations held in associationBatch, if any
+    void resolve_overlap(Molecule& mol, gsl_rng* r); //!< checks mol's Complex for overlaps with its partners, and moves it
+
+    /*!
+     * \brief Runs params.numReplicas new runs of the parsed model, in replica_<k> directories.
+     *
+     * Called once the input files are parsed, and before anything is written. The seeds are drawn from seed with
+     * std::seed_seq and printed, so a replica can be rerun alone with -s. The replicas are run by a WorkerPool with at
+     * most one thread per hardware thread (per numThreads threads, if the replicas use more), each with
+     * init(const Simulation&, ...), so each has its own RNG and counters and shares the parsed model and the reaction
+     * tables, which are made once for all of them. Each logs to its own nerdss.log. The directories and logs are made
+     * before any replica starts, and if one can't be, nothing is run. An error in a replica ends the process, as it
+     * would a single run.
+     */
+    void run_replicas(unsigned seed);
+    void setup(std::string paramFile, std::string restartFileNameInput, std::string addFileNameInput, unsigned seed);
+};
@@ -0,0 +1,92 @@
+/*! \file class_TimeSeriesFile.hpp
+ * \brief Binary, column-oriented storage of the counters written every timeWrite steps.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*! \enum TimeSeriesKind
+ * \brief Which text file a TimeSeriesFile stands in for, and so how its columns are laid out.
+ */
+enum class TimeSeriesKind : int {
+    copyNumbers = 0, //!< copy_numbers_time.dat: copyCounters::copyNumSpecies
+    boundPairs = 1, //!< bound_pair_time.dat: nBoundPairs in proPairlist order, then the eight association counters
+    eventCounters = 2, //!< event_counters_time.dat: events3D, events3Dto2D, then events2D
+};
+
+/*! \class TimeSeriesFile
+ * \brief Appends rows of integer counters to a binary file, in blocks stored column by column.
+ *
+ * The file starts with a fixed header: the magic string NERDSSTS, the format version, the TimeSeriesKind, the number
+ * of columns, the time parameters needed to rebuild the time of each row, and the header line of the text file it
+ * replaces. It is followed by blocks of up to blockSize rows: the number of rows, the iteration of each row (int64),
+ * its time in seconds (double), then each column in turn (int32). Rows are kept in memory until a block is full or
+ * flush() is called, so the disk is written to once every blockSize rows.
+ *
+ * nerdss_export reads the file back with read() and writes the text file with the same functions the simulation
+ * uses, so the regenerated file is identical to the one a text run writes.
+ */
+class TimeSeriesFile {
+public:
+    struct Header {
+        TimeSeriesKind kind { TimeSeriesKind::copyNumbers };
+        int numColumns { 0 };
+        double timeStep { 0 }; //!< Parameters::timeStep
+        long long int itrRestartFrom { 0 }; //!< Parameters::itrRestartFrom
+        double timeRestartFrom { 0 }; //!< Parameters::timeRestartFrom
+        std::string textHeader {}; //!< written at the top of the text file, including the newline
+    };
+
+    TimeSeriesFile() = default;
+    ~TimeSeriesFile(); //!< writes the rows still in memory
+    TimeSeriesFile(const TimeSeriesFile&) = delete;
+    TimeSeriesFile& operator=(const TimeSeriesFile&) = delete;
+
+    /*!
+     * \brief Creates fileName and writes the header. Rows are written out every _blockSize rows.
+     */
+    void open(const std::string& fileName, const Header& _header, int _blockSize);
+    bool is_open() const { return seriesFile.is_open(); }
+
+    /*!
+     * \brief Adds one row. values must hold header.numColumns counters.
+     */
+    void append_row(long long int simItr, double simTime, const std::vector<int>& values);
+
+    /*!
+     * \brief Writes the rows kept in memory as a block, and flushes the file
+     */
+    void flush();
+
+    /*!
+     * \brief Reads fileName, calling onRow for every row in order. Returns false if it isn't a time series file.
+     */
+    static bool read(const std::string& fileName, Header& header,
+        const std::function<void(long long int simItr, double simTime, const std::vector<int>& values)>& onRow);
+
+private:
+    std::ofstream seriesFile;
+    Header header {};
+    int blockSize { 1 };
+    std::vector<long long int> itrColumn;
+    std::vector<double> timeColumn;
+    std::vector<std::vector<int>> valueColumns;
+
+    void write_block();
+};
+
+/*! \struct TimeSeriesSet
+ * \brief The TimeSeriesFiles of one simulation. Only open if Parameters::timeSeriesBlock > 0.
+ */
+struct TimeSeriesSet {
+    TimeSeriesFile copyNumbers;
+    TimeSeriesFile boundPairs;
+    TimeSeriesFile eventCounters;
+
+    bool is_open() const { return copyNumbers.is_open(); }
+    void flush();
+};
@@ -0,0 +1,49 @@
+/*! \file class_WorkerPool.hpp
+ * \brief Fixed set of threads that run the iterations of a loop in parallel.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*! \class WorkerPool
+ * \brief Runs task(0) ... task(numTasks - 1) on numThreads threads, the calling one included, and returns once all of
+ * them are done.
+ *
+ * The threads are started once and wait between calls, so the pool is cheap to use for the few tasks of one timestep.
+ * Tasks are handed out in order, one at a time, as threads become free. The tasks must not touch the same data, and
+ * tasks drawing random numbers each need a generator of their own (see OverlapClusters). With numThreads = 1 there is
+ * no thread, and run() loops over the tasks on the calling thread.
+ */
+class WorkerPool {
+public:
+    explicit WorkerPool(int _numThreads);
+    ~WorkerPool(); //!< stops the threads
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void run(int numTasks, const std::function<void(int)>& task);
+
+    int size() const { return numThreads; }
+
+private:
+    int numThreads { 1 };
+    bool isStopping { false };
+    long long callItr { 0 }; //!< incremented by each run(), to wake the threads
+    int numTasks { 0 };
+    int nextTask { 0 };
+    int numRunning { 0 }; //!< threads other than the caller still working on the current run()
+    const std::function<void(int)>* task { nullptr };
+    std::mutex poolMutex;
+    std::condition_variable callStarted; //!< wakes the threads
+    std::condition_variable callDone; //!< wakes run()
+    std::vector<std::thread> threadList;
+
+    void work();
+    void run_tasks(std::unique_lock<std::mutex>& lock);
+};
@@ -72,14 +72,14 @@ struct ParsedMol {
         // change the status of the reaction, for products
         void change_ifaceRxnStatus(int newIndex, Involvement newRxnStatus);
 
-        void display()
+        void display(std::ostream& os)
         {
-            std::cout << absIndex << ", ";
+            os << absIndex << ", ";
             if (state != '\0')
-                std::cout << state << ", ";
+                os << state << ", ";
             else
-                std::cout << "NO STATE, ";
-            std::cout << std::boolalpha << isBound << ", " << bondIndex << ", " << ifaceRxnStatus;
+                os << "NO STATE, ";
+            os << std::boolalpha << isBound << ", " << bondIndex << ", " << ifaceRxnStatus;
         }
 
         IfaceInfo() = default;
@@ -110,7 +110,7 @@ struct ParsedMol {
     void set_molTypeIndex(const std::vector<MolTemplate>& molTemplateList);
     //    bool has_no_Z_iface();
 
-    void display() const;
+    void display(std::ostream& os) const;
 
     ParsedMol() = default;
     explicit ParsedMol(const MolTemplate& oneTemp);
@@ -156,7 +156,7 @@ struct ParsedRxn : public ForwardRxn {
      * reactions for the reactants. If none of the reactions already have the state change product as a reaction
      * forming the state change reactant exists, create a new absolute interface index.
      */
-    void check_previous_bound_states(int& totSpecies, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList);
+    void check_previous_bound_states(int& totSpecies, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, std::ostream& log);
 
     /*!\ingroup Parser
      * \brief The purpose of this function is to determine which of the parsed interfaces are reactants.
@@ -168,7 +168,7 @@ struct ParsedRxn : public ForwardRxn {
      *   have possible/stateChange (since the other involved Involvments are not determine for the products yet to the
      *   reactants which have the ifaceRxnStatus = possible
      */
-    void determine_reactants();
+    void determine_reactants(std::ostream& log);
 
     /*! \ingroup Parser
      * \brief Need to determine creation products separately as they are not determined elsewhere
@@ -200,7 +200,7 @@ struct ParsedRxn : public ForwardRxn {
      * TODO: Sigma and the association angles should not be changed, maybe check if they are and kick back
      */
     bool check_for_conditional_rates(
-        int& totSpecies, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns);
+        int& totSpecies, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns, std::ostream& log);
 
     /*! \ingroup Parser
      * \brief This function is meant to make on individual reaction when splitting a reaction into multiples
@@ -232,15 +232,16 @@ struct ParsedRxn : public ForwardRxn {
      * relevant reactions for use in the simulations
      */
     void assemble_reactions(std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-        std::vector<CreateDestructRxn>& createDestructRxns, const std::vector<MolTemplate>& molTemplateList);
+        std::vector<CreateDestructRxn>& createDestructRxns, const std::vector<MolTemplate>& molTemplateList,
+        unsigned& numberOfRxns);
 
     // Parsing function
-    void set_value(std::string& line, RxnKeyword rxnKeyword);
+    void set_value(std::string& line, RxnKeyword rxnKeyword, std::ostream& log);
     std::pair<bool, std::string> isComplete(const std::vector<MolTemplate>& molTemplateList);
 
     // display functions
-    void display_angles() const;
-    void display() const override;
+    void display_angles(std::ostream& os) const;
+    void display(std::ostream& os) const override;
 
     ParsedRxn() = default;
 };
@@ -15,8 +15,14 @@
 
 //#include "classes/class_mol_containers.hpp"
 #include "classes/class_Observable.hpp"
+#include "classes/class_CheckpointChain.hpp"
+#include "classes/class_CheckpointForker.hpp"
+#include "classes/class_InSituAnalysis.hpp"
+#include "classes/class_OutputQueue.hpp"
+#include "classes/class_PdbStream.hpp"
 #include "classes/class_Rxns.hpp"
 #include "classes/class_SimulVolume.hpp"
+#include "classes/class_TimeSeriesFile.hpp"
 #include "classes/class_copyCounters.hpp"
 
 /*! \defgroup IO
@@ -31,10 +37,10 @@ std::ostream& boff(std::ostream& os);
 std::ostream& linebreak(std::ostream& os);
 std::ostream& llinebreak(std::ostream& os);
 void write_psf(const Parameters& params, const std::vector<Molecule>& moleculeList,
-    const std::vector<MolTemplate>& molTemplateList);
+    const std::vector<MolTemplate>& molTemplateList, const SimulContext& context);
 void write_crds(std::string name, const std::vector<Complex>& Complexlist, const std::vector<Molecule>& bases);
-void write_crds(const std::vector<Complex>& Complexlist,
-    const std::vector<Molecule>& bases); // overloaded crd dump for errors
+void write_crds(const Parameters& params, const std::vector<Complex>& Complexlist,
+    const std::vector<Molecule>& bases); // overloaded crd dump for errors, in outputDir/out
 
 /*!
  * \brief Writes the coordinates of all Molecules in the system to an XYZ coordinate file.
@@ -63,24 +69,26 @@ void write_xyz_assoc_cout(const Complex& reactCom1, const Complex& reactCom2,
 /*! \ingroup IO
  * \brief Writes the coordinates of a complex to a file
  */
-void write_complex_crds(
+void write_complex_crds(const Parameters& params,
     std::string name, const Complex& complex1, const Complex& complex2, std::vector<Molecule>& moleculeList);
 
 /*! \ingroup IO
  * \brief Writes out timestep information, such as the different molecular types in the system.
  *
  * TODO: This description needs more information
+ * currNumberMolTypes is the number of rows of molecTypesList filled so far.
  */
 void write_timestep_information(long long int simItr, std::ofstream& outFile, std::ofstream& molecTypesFile,
     std::ofstream& textTimeStatFile, const Parameters& params, std::vector<std::vector<int>>& molecTypesList,
-    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList);
+    int& currNumberMolTypes, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
+    std::vector<MolTemplate>& molTemplateList, const SimulContext& context);
 
 /*! \ingroup IO
  * \brief Writes the number of each component Molecule in all complexes at the current timestep
  */
 void write_complex_components(long long int simItr, std::ofstream& complexFile, const Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    const std::vector<MolTemplate>& molTemplateList);
+    const std::vector<MolTemplate>& molTemplateList, const SimulContext& context);
 
 /*! \ingroup IO
  * \brief Writes a plain text restart file at intervals specified in the Parameters file.
@@ -88,11 +96,12 @@ void write_complex_components(long long int simItr, std::ofstream& complexFile,
  * This is a formatted text file, which is essentially illegible to the user, but it's not like they'd need to look at
  * it anyway.
  */
-void write_restart(long long int simItr, std::ofstream& restartFile, const Parameters& params, const SimulVolume& simulVolume,
+void write_restart(long long int simItr, std::ostream& restartFile, const Parameters& params, const SimulVolume& simulVolume,
     const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
     const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
     const std::vector<BackRxn>& backRxns, const std::vector<CreateDestructRxn>& createDestructRxns,
-    const std::map<std::string, int>& observablesList, const Membrane& membraneObject, const copyCounters& counterArrays);
+    const std::map<std::string, int>& observablesList, const Membrane& membraneObject, const copyCounters& counterArrays,
+    const SimulContext& context);
 
 /*! \ingroup IO
  * \brief Reads a restart file and sets up the simulation
@@ -101,7 +110,8 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<CreateDestructRxn>& createDestructRxns,
-    std::map<std::string, int>& observablesList, Membrane& membraneObject, copyCounters& counterArrays);
+    std::map<std::string, int>& observablesList, Membrane& membraneObject, copyCounters& counterArrays,
+    SimulContext& context);
 
 /*! \ingroup IO
  * \ingroup SpeciesTracker
@@ -110,25 +120,92 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
 void write_observables(
     double simTime, std::ofstream& observablesFile, const std::map<std::string, int>& observablesList);
 
+/*! \ingroup IO
+ * \brief Copies the Molecule fields read by write_traj and write_pdb, for writing on the OutputQueue thread.
+ */
+std::vector<Molecule> snapshot_molecules(const std::vector<Molecule>& moleculeList);
+
+/*! \ingroup IO
+ * \brief Like snapshot_molecules, but the Molecules left out by Parameters::trajFilter are copied as empty.
+ */
+std::vector<Molecule> select_output_molecules(const Parameters& params, const std::vector<Molecule>& moleculeList,
+    const std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList);
+
+/*! \ingroup IO
+ * \brief Copies the Complex fields read by print_dimers and print_complex_hist, for writing on the OutputQueue thread.
+ */
+std::vector<Complex> snapshot_complexes(const std::vector<Complex>& complexList);
+
+/*! \ingroup IO
+ * \brief Appends the current frame to the trajectory, from a snapshot on the OutputQueue thread if it has one.
+ * Only the Molecules selected by Parameters::trajFilter are written.
+ */
+void queue_write_traj(OutputQueue& outputQueue, long long int simItr, const std::string& trajFileName,
+    const Parameters& params, const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+
+/*! \ingroup IO
+ * \brief Writes a pdb file for the current frame, or appends it to pdbStream if that is open. From a snapshot on the
+ * OutputQueue thread if it has one. Only the Molecules selected by Parameters::trajFilter are written.
+ */
+void queue_write_pdb(OutputQueue& outputQueue, PdbStream& pdbStream, long long int simItr, const Parameters& params,
+    const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+
+/*! \ingroup IO
+ * \brief Creates the binary copy number, bound pair and event counter files. The headers are the first lines of the
+ * text files they replace.
+ */
+void open_time_series(TimeSeriesSet& timeSeries, const Parameters& params, const copyCounters& counterArrays,
+    const std::string& speciesHeader, const std::string& pairHeader);
+
+/*! \ingroup IO
+ * \brief Writes the copy numbers, bound pairs and association events of the current step, as text or, if timeSeries
+ * is open, as rows of the binary files.
+ */
+void write_counter_time_series(TimeSeriesSet& timeSeries, long long int simItr, const Parameters& params,
+    copyCounters& counterArrays, std::ofstream& pairOutfile, std::ofstream& eventFile, std::ofstream& speciesFile);
+
+/*! \ingroup IO
+ * \brief Writes the text file a binary time series stands in for. Returns false if seriesFileName can't be read.
+ */
+bool export_time_series(const std::string& seriesFileName, const std::string& textFileName);
+
+/*! \ingroup IO
+ * \brief Writes the timeWrite outputs: bound pairs, monomer/dimer counts, association events, the complex histogram,
+ * observables and species copy numbers. From a snapshot on the OutputQueue thread if it has one.
+ */
+void queue_write_time_series(OutputQueue& outputQueue, long long int simItr, const Parameters& params,
+    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, const std::vector<int>& numEachMolType,
+    copyCounters& counterArrays, const std::map<std::string, int>& observablesList, const std::string& observablesFileName,
+    const Membrane& membraneObject, TimeSeriesSet& timeSeries, std::ofstream& pairOutfile, std::ofstream& dimerfile,
+    std::ofstream& eventFile, std::ofstream& assemblyfile, std::ofstream& speciesFile);
+
 /*! \ingroup IO
  * \brief Writes a pdb file for the current frame
  */
 void write_pdb(long long int simItr, unsigned frameNum, const Parameters& params, const std::vector<Molecule>& moleculeList,
     const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
 
+/*! \ingroup IO
+ * \brief Appends the current frame to a multi-model pdb file as one MODEL
+ */
+void write_pdb_model(PdbStream& pdbStream, long long int simItr, const std::vector<Molecule>& moleculeList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+
 /*! \ingroup IO
  * \brief first line description of the MONODIMER output file.
  */
 void init_print_dimers(std::ofstream& outfile, Parameters params, std::vector<MolTemplate>& molTemplateList);
 void print_dimers(std::vector<Complex>& complexList, std::ofstream& outfile, int it, Parameters params,
-    std::vector<MolTemplate>& molTemplateList);
+    std::vector<MolTemplate>& molTemplateList, const std::vector<int>& numEachMolType);
 
 /*! \ingroup IO
  * \brief Nbound pairs are counting all directly bound pairs of protein A and partner B. Does not matter if A or B are
  * also bound via other interfaces to other proteins.
  */
 void init_NboundPairs(
-    copyCounters& counterArray, std::ofstream& outfile, Parameters params, std::vector<MolTemplate>& molTemplateList, std::vector<Molecule>& moleculeList);
+    copyCounters& counterArray, std::ostream& outfile, Parameters params, std::vector<MolTemplate>& molTemplateList, std::vector<Molecule>& moleculeList);
 
 /*! \ingroup IO
  * \brief write: Nbound pairs are counting all directly bound pairs of protein A and partner B. Does not matter if A or
@@ -140,7 +217,8 @@ void write_NboundPairs(copyCounters& counterArrays, std::ofstream& outfile, int
  * \brief print calculated histogram of distinct types of complexes, based on protein/lipid composition.
  */
 double print_complex_hist(std::vector<Complex>& complexList, std::ofstream& outfile, int it, Parameters params,
-    std::vector<MolTemplate>& molTemplateList, int nImplicitLipids);
+    std::vector<MolTemplate>& molTemplateList, int nImplicitLipids,
+    const std::vector<int>& numEachMolType);
 
 /*! \ingroup IO
  * \brief initialize array of counterArrays.copyNumSpecies, based on the initial molecule Species and their interface
@@ -152,7 +230,7 @@ void init_counterCopyNums(copyCounters& counterArrays, std::vector<Molecule>& mo
  * \brief writes out the names of species in the all_species.dat file.
  */
 
-int init_speciesFile(std::ofstream& speciesFile, copyCounters& counterArrays, std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns, Parameters& params);
+int init_speciesFile(std::ostream& speciesFile, copyCounters& counterArrays, std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns, Parameters& params);
 /*! \ingroup IO
  * \brief Writes all the species in the system, from a copyCounter object
  */
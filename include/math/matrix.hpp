@@ -17,7 +17,7 @@
 /*!
  * \brief Rotate a vector using a rotation matrix (LEGACY).
  */
-Vector matrix_rotate(Vector& vec, std::array<double, 9>& M);
+Vector matrix_rotate(const Vector& vec, const std::array<double, 9>& M);
 
 /*!
  * \brief Create an Euler (Tait-Bryan angles) rotation matrix from x, y, z values.
@@ -2,19 +2,13 @@
 
 #include "gsl/gsl_rng.h"
 
-extern gsl_rng* r;
-extern long long randNum;
+#include <string>
 
 /*!
- * \brief Uses the previously initialized random number generator to return a random number
+ * \brief Uses the random number generator r to return a random number
  * \param[out] double Uniformly distributed random double.
  */
-double rand_gsl();
-
-/*!
- * \brief Initializes the GSL random number generator.
- */
-void srand_gsl(int);
+double rand_gsl(gsl_rng* r);
 
 /*!
  * \brief Wrapper for the internal GSL RNG state read function.
@@ -22,24 +16,17 @@ void srand_gsl(int);
  * Reads a previously written binary file with the current status of the RNG, so restarting will give the same random
  * numbers as a continuous run would.
  */
-void read_rng_state();
-
-/*!
- * \brief Wrapper for the internal GSL RNG state write function.
- *
- * Writes the current state of the RNG to a binary file.
- */
-void write_rng_state();
+void read_rng_state(gsl_rng* r, const std::string& fileName);
 
 /*!
  * \brief Wrapper for the internal GSL RNG state write function.
  *
- * Writes the current state of the RNG to a binary file for check point.
+ * Writes the current state of the RNG to a binary file, rng_state for restarts or rng_state<simItr> for check points.
  */
-void write_rng_state_simItr(int simItr);
+void write_rng_state(const gsl_rng* r, const std::string& fileName);
 
 /*!
  * \brief Uses Box-Mueller method to greate Gaussian-distributed random numbers from a uniform random number generator.
  * \param[out] double Gaussian-distributed random double.
  */
-double GaussV();
+double GaussV(gsl_rng* r);
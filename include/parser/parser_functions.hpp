@@ -84,10 +84,25 @@
  * \brief Main input file parsing function.
  *
  * Delegates to parse_reactionFile(), parse_paramFile(), and parse_molFile().
+ * With onlySettings, only the parameters and boundaries blocks are read, and the molecules, reactions and
+ * observables blocks are skipped.
  */
 void parse_input(std::string& fileName, Parameters& params, std::map<std::string, int>& observableList,
     std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject);
+    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject,
+    SimulContext& context, bool onlySettings = false);
+
+/*! \ingroup Parser
+ * \brief Reads the input file like parse_input(), taking the molecules, reactions and observables from a compiled model
+ * in modelCacheDir if one was written for the same input.
+ *
+ * The model is keyed by a hash of every block of the input file but the parameters, so runs that only change
+ * parameters share it. It also stores a hash of each .mol file and is only used if they are unchanged. Otherwise the
+ * input is parsed as usual and the compiled model is (re)written.
+ */
+void parse_input_cached(const std::string& modelCacheDir, std::string& fileName, Parameters& params,
+    std::map<std::string, int>& observableList, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
+    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject, SimulContext& context);
 
 /*!\ingroup Parser
  * \brief This function parses input for restart with add.inp.
@@ -96,14 +111,14 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
  */
 void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std::string, int>& observableList,
     std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject, int numDoubleBeforeAdd);
+    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject, int numDoubleBeforeAdd, SimulContext& context);
 
 /*!\ingroup Parser
  * \brief This function parses command line flag.
  *
  * TODO: 
  */
-void parse_command(int argc, char* argv[], Parameters& params, std::string& paramFileName, std::string& restartFileName, std::string& addFileName, unsigned int& seed);
+void parse_command(int argc, char* argv[], Parameters& params, std::string& paramFileName, std::string& restartFileName, std::string& addFileName, unsigned int& seed, std::ostream& log);
 
 /* INDEX DETERMINATION FUNCTIONS */
 
@@ -121,7 +136,7 @@ void parse_command(int argc, char* argv[], Parameters& params, std::string& para
  * one to this function
  */
 void check_for_valid_states(
-    size_t parsedMolIndex, ParsedMol& targMol, ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList);
+    size_t parsedMolIndex, ParsedMol& targMol, ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList, std::ostream& log);
 
 /*!\ingroup Parser
  * \brief The purpose of this function is to take some target iface, which has a state, of the reactants and compare
@@ -130,7 +145,7 @@ void check_for_valid_states(
  * @param[in] targetIface interface to check for a state change
  * @param[in] the molecule on which the targetIface is located
  */
-void check_for_state_change(ParsedMol::IfaceInfo& targetIface, ParsedMol& targetMol, ParsedRxn& parsedRxn);
+void check_for_state_change(ParsedMol::IfaceInfo& targetIface, ParsedMol& targetMol, ParsedRxn& parsedRxn, std::ostream& log);
 
 /*!\ingroup Parser
  * \brief This function determines the iface indices of a molecule based on its name
@@ -206,11 +221,12 @@ ParsedMolNumState parse_number_bngl(std::string oneLine);
  * @param[in] forwardRxns vector of ForwardRxns
  * @param[in] backRxns vector of BackRxns, inverse reactions of a corresponding reversible ForwardRxn
  * @param[in] createDestructRxns vector of CreateDestructRxns
+ * @param[in,out] numberOfRxns number of reactions made so far, gives each new one its absRxnIndex
  */
 void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvidedRxns,
     std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<CreateDestructRxn>& createDestructRxns,
-    std::map<std::string, int>& observablesList, Membrane& membraneObject);
+    std::map<std::string, int>& observablesList, Membrane& membraneObject, unsigned& numberOfRxns, std::ostream& log);
 
 bool read_boolean(std::string fileLine);
 
@@ -222,7 +238,7 @@ bool read_boolean(std::string fileLine);
  *     COM   x y z
  *     Iface x y z
  */
-void read_internal_coordinates(std::ifstream& molFile, MolTemplate& molTemplate);
+void read_internal_coordinates(std::ifstream& molFile, MolTemplate& molTemplate, std::ostream& log);
 
 /*!\ingroup Parser
  * \brief just a simple function to remove comments, if they exist
@@ -235,7 +251,7 @@ void remove_comment(std::string& line);
  * @param[in] mol molecule to whom the molecule information file belongs
  * @param[out] completed MolTemplate
  */
-MolTemplate parse_molFile(std::string& mol);
+MolTemplate parse_molFile(std::string& mol, SimulContext& context);
 
 /*! \ingroup Parser
  * \brief Reads the diffusion constant arrays from the parameters block
@@ -245,7 +261,7 @@ std::vector<double> parse_input_array(std::string& line);
 /*!\ingroup Parser
  * \brief Parses the state lines from the molecule information files and adds them to the MolTemplate
  */
-void parse_states(std::string& line, MolTemplate& molTemplate);
+void parse_states(std::string& line, MolTemplate& molTemplate, std::ostream& log);
 
 /*!\ingroup Parser
  * \brief Reads a boolean in either numeric or alphabetical format
@@ -253,7 +269,7 @@ void parse_states(std::string& line, MolTemplate& molTemplate);
  * @param[in] fileLine line from the input file containing a boolean
  * @param[out] bool parsed boolean
  */
-void read_bonds(int numBonds, std::ifstream& molFile, MolTemplate& molTemplate);
+void read_bonds(int numBonds, std::ifstream& molFile, MolTemplate& molTemplate, std::ostream& log);
 /*************************/
 
 /*************************/
@@ -276,7 +292,7 @@ void populate_reaction_lists(const std::vector<ForwardRxn>& forwardRxns, const s
 /*******************/
 void populate_reaction_lists_for_add(const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns,
-    std::vector<MolTemplate>& molTemplateList, int addForwardRxnNum, int addBackRxnNum, int addCreateDestructRxnNum);
+    std::vector<MolTemplate>& molTemplateList, int addForwardRxnNum, int addBackRxnNum, int addCreateDestructRxnNum, std::ostream& log);
 
 /* DISPLAY */
 std::string write_mol_iface(std::string mol, std::string iface);
@@ -284,7 +300,7 @@ std::string write_mol_iface(std::string mol, std::string iface);
 /*! \ingroup Parser
  * \brief Just displays all reactions as parsed from the input file
  */
-void display_all_reactions(const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
+void display_all_reactions(std::ostream& os, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns);
-void display_all_MolTemplates(const std::vector<MolTemplate>& molTemplates);
+void display_all_MolTemplates(std::ostream& os, const std::vector<MolTemplate>& molTemplates);
 /*******************/
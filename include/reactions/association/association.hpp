@@ -13,7 +13,48 @@
 #include "classes/class_Rxns.hpp"
 #include "classes/class_copyCounters.hpp"
 
-extern unsigned numAssoc;
+/*! \struct MolGeometry
+ * \ingroup Associate
+ * \brief Just the center of mass and interface coordinates of a Molecule, for the orientation functions that move a
+ * scratch copy of them around (transform(), orient_crds_to_template(), determine_normal()).
+ *
+ * Copying a whole Molecule copies every one of its lists. These are called several times per association, for each
+ * angle, so they work on this instead.
+ */
+struct MolGeometry {
+    Coord comCoord {};
+    std::vector<Coord> iCoords {};
+
+    MolGeometry() = default;
+    MolGeometry(const Coord& _comCoord, const std::vector<Coord>& _iCoords)
+        : comCoord(_comCoord)
+        , iCoords(_iCoords)
+    {
+    }
+};
+
+/*! \ingroup Associate
+ * \brief The temporary association coordinates of a Molecule, tmpComCoord and tmpICoords.
+ */
+inline MolGeometry tmp_geometry(const Molecule& mol) { return { mol.tmpComCoord, mol.tmpICoords }; }
+
+/*! \enum AssocCancel
+ * \ingroup Associate
+ * \brief Which check canceled an association, i.e. which of the nCancel counters of copyCounters it counts toward.
+ */
+enum class AssocCancel { none, overlapPartner, overlapSystem, spanBox, displace2D, displace3D, displace3Dto2D };
+
+/*! \struct AssocPlacement
+ * \ingroup Associate
+ * \brief Outcome of place_association_box(), for commit_association_box().
+ */
+struct AssocPlacement {
+    AssocCancel cancelReason { AssocCancel::none };
+    bool isOnMembrane { false }; //!< both complexes are on the membrane
+    bool transitionToSurface { false }; //!< one complex is on the membrane and the other isn't
+    bool checkedSystem { false }; //!< check_for_structure_overlap_system() was run, so the outcome depends on the other complexes
+    Coord imageShift2 {}; //!< translation of reactCom2 to the periodic image nearest reactCom1, see move_to_nearest_image()
+};
 
 /* MAIN FUNCTION */
 /*! \ingroup Associate
@@ -41,28 +82,51 @@ extern unsigned numAssoc;
 void associate(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context);
 void associate_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context);
+
+/*! \ingroup Associate
+ * \brief The part of associate_box() that moves the two complexes' temporary coordinates into place and checks them,
+ * without changing anything but the temporary coordinates of their members.
+ *
+ * Associations of disjoint pairs of complexes can be placed at the same time, see AssociationBatch. The temporary
+ * coordinates are kept, even if the association is canceled, until commit_association_box().
+ */
+AssocPlacement place_association_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2,
+    Complex& reactCom1, Complex& reactCom2, const Parameters& params, const ForwardRxn& currRxn,
+    std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList,
+    const std::vector<Complex>& complexList, const Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns,
+    const std::vector<BackRxn>& backRxns, SimulContext& context);
+
+/*! \ingroup Associate
+ * \brief The rest of associate_box(): counts a canceled association, or writes the placed coordinates and binds the
+ * interfaces. If reactCom1 and reactCom2 are the same Complex, closing a loop, placement isn't used.
+ */
+void commit_association_box(const AssocPlacement& placement, int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1,
+    Molecule& reactMol2, Complex& reactCom1, Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn,
+    std::vector<Molecule>& moleculeList, std::vector<MolTemplate>& molTemplateList,
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, SimulContext& context);
+
 void associate_sphere(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context);
 
 void associate_implicitlipid(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context);
 void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context);
 void associate_implicitlipid_sphere(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context);
 
 /* BOOLEANS */
 /*! \ingroup Associate
@@ -118,11 +182,10 @@ Vector create_arbitrary_vector(Vector& vec);
  * \param[in] reactMol2 other molecule in the association event
  * \param[in] axis axis around which the molecules are rotating
  *
- * NOTE: Only use this function if the calling function is passed reactMol1 and reactMol2 by value, NOT by
- * reference. This function alters the coordinates in a way that is not desired by association, but required in the
- * course of it.
+ * NOTE: Only use this function on scratch copies of the temporary coordinates (see tmp_geometry()). This function
+ * alters the coordinates in a way that is not desired by association, but required in the course of it.
  */
-void transform(Coord& reactIface, Molecule& reactMol1, Molecule& reactMol2, const Vector& axis);
+void transform(Coord& reactIface, MolGeometry& reactMol1, MolGeometry& reactMol2, const Vector& axis);
 
 /*! \ingroup Parser
  * \brief This subroutine determines the normal of the protein based on
@@ -145,7 +208,7 @@ void transform(Coord& reactIface, Molecule& reactMol1, Molecule& reactMol2, cons
  *   direction to determine the normal for the real coordinates of the protein
  *   5. normalize and pass back
  */
-Vector determine_normal(Vector normal, const MolTemplate& molTemplate, Molecule oneMol);
+Vector determine_normal(Vector normal, const MolTemplate& molTemplate, MolGeometry oneMol);
 
 /*! \ingroup Associate
  * \brief Determine the rotation angles for each Complex, according to their diffusion constants.
@@ -163,8 +226,15 @@ void determine_rotation_angles(double targAngle, double currAngle, double& rotAn
  *
  * If the Molecule is not a rod, two interfaces to center of mass vectors are used to determine the quaternion.
  * TODO: Write how/why
+ *
+ * targMol is rotated along with the quaternion.
+ */
+Quat orient_crds_to_template(const MolTemplate& oneTemplate, MolGeometry& targMol);
+
+/*! \ingroup Associate
+ * \brief Same as above, with the template coordinates given as a MolGeometry, e.g. another Molecule's coordinates.
  */
-Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol);
+Quat orient_crds_to_template(const MolGeometry& oneTemplate, bool isRod, MolGeometry& targMol);
 
 /*! \ingroup Associate
  * \brief This function is meant to rotate a target Complex with a rotation quaternion determined from the
@@ -180,6 +250,74 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol);
  */
 void rotate(Coord& rotOrigin, Quat& rotQuat, Complex& targCom, std::vector<Molecule>& moleculeList);
 
+/*! \ingroup Associate
+ * \brief Returns point rotated by rotQuat about rotOrigin.
+ */
+Coord rotate_point(const Coord& point, const Coord& rotOrigin, Quat& rotQuat);
+
+/*! \ingroup Associate
+ * \brief Rotates the temporary coordinates of one Molecule by rotQuat about rotOrigin, as rotate() does for each member.
+ */
+void rotate_tmp_crds(const Coord& rotOrigin, Quat& rotQuat, Molecule& targMol);
+
+/*! \ingroup Associate
+ * \brief Translates the temporary coordinates of all members of targCom by transVec.
+ */
+void translate_tmp_crds(const Vector& transVec, Complex& targCom, std::vector<Molecule>& moleculeList);
+
+/*! \ingroup Associate
+ * \brief Translates the temporary coordinates of reactCom2 to the periodic image of it nearest reactCom1, given the
+ * reacting interfaces. Does nothing if no axis is periodic.
+ *
+ * The interfaces are taken by value, as they are usually temporary coordinates of reactCom2 that get moved. Returns the
+ * translation, to take off Molecule::imageOffset of the members of reactCom2 once their coordinates are kept.
+ */
+Coord move_to_nearest_image(Coord reactIface1, Coord reactIface2, Complex& reactCom2,
+    std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
+
+/*! \ingroup Associate
+ * \brief Sets up the temporary coordinates of reactMol only, and makes rotate() and translate_tmp_crds() move
+ * reactMol and targCom.tmpComCoord, which starts at the Complex's COM, and keep the moves for the other members.
+ *
+ * The other members are moved with update_deferred_tmp_crds() once the association is known to go ahead, or never,
+ * with clear_tmp_crds(), if it's canceled. Their coordinates then come out exactly as if they had been moved
+ * along.
+ */
+void defer_tmp_crds(Complex& targCom, Molecule& reactMol, std::vector<Molecule>& moleculeList);
+
+/*! \ingroup Associate
+ * \brief Applies the moves kept since defer_tmp_crds() to the tmpComCoord of the other members of targCom, and not
+ * to their interfaces, which are left without temporary coordinates. The moves are still kept.
+ */
+void update_deferred_tmp_com_crds(Complex& targCom, std::vector<Molecule>& moleculeList);
+
+/*! \ingroup Associate
+ * \brief Applies the moves kept since defer_tmp_crds() to oneMol, a member of targCom without temporary
+ * coordinates, which targCom keeps deferring.
+ */
+void update_deferred_tmp_crds(const Complex& targCom, Molecule& oneMol);
+
+/*! \ingroup Associate
+ * \brief Applies the moves kept since defer_tmp_crds() to the other members of targCom that still need them, and
+ * stops deferring them.
+ */
+void update_deferred_tmp_crds(Complex& targCom, std::vector<Molecule>& moleculeList);
+
+/*! \ingroup Associate
+ * \brief Clears the temporary coordinates of targCom's members, and drops any moves kept since defer_tmp_crds().
+ */
+void clear_tmp_crds(Complex& targCom, std::vector<Molecule>& moleculeList);
+
+/*! \ingroup Associate
+ * \brief True if, once the moves kept since defer_tmp_crds() are applied, neither reflect_traj_tmp_crds() nor
+ * check_if_spans_box() can move targCom's members, i.e. every member and interface stays inside the box.
+ *
+ * Tested on targCom's bounding sphere, around targCom.tmpComCoord, without looking at the members' temporary
+ * coordinates.
+ */
+bool deferred_crds_stay_in_box(const Complex& targCom, const std::vector<Molecule>& moleculeList,
+    const Membrane& membraneObject);
+
 /*! \ingroup Associate
  * \brief This function is meant to rotate a Molecule in the reverse direction.
  *
@@ -258,9 +396,9 @@ void theta_rotation(Coord& reactIface1, Coord& reactIface2, Molecule& reactMol1,
  * Why the index of the inferior interface?
  *
  * The index of infIface is needed because domIface and infIface are references to references to (yes, references to
- * references) their respective coordinates in their respective Molecule's assocICoords vector. Since domIface,
- * infIface, domMol, and infMol are passed by value to calculate_phi(), and through it also to transform(). The
- * transform() function does a coordinate transformation which changes the domMol and infMol coordinates but does
+ * references) their respective coordinates in their respective Molecule's assocICoords vector. Since domIface and
+ * infIface are passed by value to calculate_phi(), which passes copies of the domMol and infMol coordinates to
+ * transform(). The transform() function does a coordinate transformation which changes those copies but does
  * not change domIface or infIface, since they are references to different objects. Because of this, the creation of
  * the projected vectors in calculate_phi() will fail unless the index of infIface is passed to it.
  */
@@ -298,7 +436,7 @@ void omega_rotation(Coord& reactIface1, Coord& reactIface2, int ifaceIndex2, Mol
  *   4. return omega.
  */
 double calculate_omega(Coord reactIface1, int reactIface2, Vector& sigma,
-    const ForwardRxn& currRxn, Molecule reactMol1, Molecule reactMol2, const std::vector<MolTemplate>& molTemplateList);
+    const ForwardRxn& currRxn, const Molecule& reactMol1, const Molecule& reactMol2, const std::vector<MolTemplate>& molTemplateList);
 
 /*! \ingroup Associate
  * \brief this should get phi via an orthographic projected onto the xy-plane.
@@ -308,7 +446,7 @@ double calculate_omega(Coord reactIface1, int reactIface2, Vector& sigma,
  *   3. determine phi between sigma and norm.
  *   4. return phi.
  */
-double calculate_phi(Coord reactIface1, int ifaceIndex2, Molecule reactMol1, Molecule reactMol2, const Vector& normal,
+double calculate_phi(Coord reactIface1, int ifaceIndex2, const Molecule& reactMol1, const Molecule& reactMol2, const Vector& normal,
     Vector axis, const ForwardRxn& currRxn, const std::vector<MolTemplate>& molTemplateList);
 
 /* OTHER */
@@ -335,16 +473,25 @@ void check_for_structure_overlap(bool& cancelAssoc, const Complex& reactCom1, co
     const std::vector<Molecule>& moleculeList, const Parameters& params,
     const std::vector<MolTemplate>& molTemplateList);
 
+/*! \ingroup Associate
+ * \brief Sphere around the temporary coordinates of reactCom's members, with room for their interfaces, which
+ * check_for_structure_overlap_system() tests against the other complexes before looking at their proteins.
+ */
+void tmp_bounding_sphere(const Complex& reactCom, const std::vector<Molecule>& moleculeList,
+    const std::vector<MolTemplate>& molTemplateList, Coord& center, double& radius);
+
 /*! \ingroup Associate
  * \brief Checks to see if the centers of masses of any of the molecules that are undergoing physical association
  * overlap with any of the other molecules in the system! Only checks molecules that are flagged with checkOverlap=1
  *
- * If so, cancels association.
+ * If so, cancels association. Members of a Complex that defers its moves, see update_deferred_tmp_com_crds(), are
+ * given their temporary interface coordinates once they need to be checked.
  */
 
 void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, const Complex& reactCom2,
     std::vector<Molecule>& moleculeList, const Parameters& params,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
+    const Membrane& membraneObject, SimulContext& context);
 
 /*! \ingroup Associate
  * \brief Checks to see if the centers of masses of any of the molecules that are undergoing physical association
@@ -356,7 +503,24 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
  */
 void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& reactCom2,
     std::vector<Molecule>& moleculeList, const Parameters& params,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList);
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList,
+    const Membrane& membraneObject);
+
+/*! \ingroup Associate
+ * \brief Largest displacement allowed for a Molecule of reactCom during association, params.scaleMaxDisplace times
+ * its mean displacement in a timestep from translational and rotational diffusion.
+ */
+double max_association_displacement(const Complex& reactCom, const Parameters& params);
+
+/*! \ingroup Associate
+ * \brief Same test as measure_complex_displacement(), from the reacting Molecules and the tmpComCoord of each
+ * Complex, while the moves of their other members are deferred (see defer_tmp_crds()).
+ *
+ * Only sets flag if measure_complex_displacement() would, once the moves are applied and if the Complexes don't reach
+ * the walls, see deferred_crds_stay_in_box().
+ */
+void measure_deferred_displacement(bool& flag, const Molecule& reactMol1, const Molecule& reactMol2,
+    const Complex& reactCom1, const Complex& reactCom2, const Parameters& params, const Membrane& membraneObject);
 
 /*! \ingroup Associate
  * \brief  Routine to calculate how far a vector has rotated (in radians) from its position store in original coordinates to its position store in tmpCoords. Used during associate to evaluate the extent to which rotation into the proper orientation has caused re-alignment of the interface-COM vectors of associating interfaces.
@@ -378,17 +542,19 @@ double calc_one_angular_displacement(int ifaceIndex1, Molecule& reactMol1, Compl
  * If interfaces overlap, cancels association.
  */
 
-void measure_overlap_protein_interfaces(Molecule base1, Molecule baseTmp, bool& flagCancel);
+void measure_overlap_protein_interfaces(const Molecule& base1, const Molecule& baseTmp, bool& flagCancel,
+    const Membrane& membraneObject);
 
-void measure_overlap_free_protein_interfaces(Molecule base1, Molecule baseTmp, bool& flagCancel,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns);
+void measure_overlap_free_protein_interfaces(const Molecule& base1, const Molecule& baseTmp, bool& flagCancel,
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
+    const Membrane& membraneObject, SimulContext& context);
 
 /*! \ingroup Associate
  * \brief Store Calculate rotation matrix for orienting one molecule to itself (at another timepoint, e.g.)
  * First molecule is tru coordinate, second molecule--uses temporarary coordinates
  */
 
-Quat save_mem_orientation(Molecule baseTarget, Molecule base1, MolTemplate onePro);
+Quat save_mem_orientation(const Molecule& baseTarget, const Molecule& base1, const MolTemplate& onePro);
 
 /*! \ingroup Associate
  * \brief calculate the COM of two complexes prior to their association
@@ -34,8 +34,9 @@ std::array<double, 3> calculate_inner_coord_coefficients(Coord TARG, Coord COM,
 Coord translate_on_sphere(Coord targ, Coord COM, Coord COMnew, std::array<double, 9> crdset, std::array<double, 9> crdsetnew);
 //Coord rotate_on_sphere(Coord targ, Coord COM, double dangle);
 Coord rotate_on_sphere(Coord Targ, Coord COM, std::array<double, 9> crdset, double dangle);
+Quat rotation_on_sphere(Coord COM, Coord COMnew, double dangle); // translate_on_sphere from COM to COMnew, then rotate_on_sphere by dangle, as one rotation about the sphere center
 
 double calc_bindRadius2D(double bindRadius, Coord iFace);
 
-void set_memProtein_sphere(Complex reactCom, Molecule& memProtein, std::vector<Molecule> moleculeList, const Membrane membraneObject);
-void find_Lipid_sphere(Complex reactCom, Molecule& Lipid, std::vector<Molecule> moleculeList, const Membrane membraneObject);
\ No newline at end of file
+void set_memProtein_sphere(const Complex& reactCom, Molecule& memProtein, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
+void find_Lipid_sphere(const Complex& reactCom, Molecule& Lipid, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject);
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "classes/class_Rxns.hpp"
 #include <classes/class_copyCounters.hpp>
 #include <gsl/gsl_matrix.h>
+#include <mutex>
 
 struct BiMolData {
     int pro1Index { 0 };
@@ -55,7 +56,7 @@ void determine_2D_bimolecular_reaction_probability(int simItr, int rxnIndex, int
     unsigned& DDTableIndex, double* tableIDs, BiMolData& biMolData, const Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns,
     const std::vector<BackRxn>& backRxns, Membrane& membraneObject, std::vector<gsl_matrix*>& normMatrices,
-    std::vector<gsl_matrix*>& survMatrices, std::vector<gsl_matrix*>& pirMatrices);
+    std::vector<gsl_matrix*>& survMatrices, std::vector<gsl_matrix*>& pirMatrices, std::mutex& tableMutex);
 
 void determine_3D_bimolecular_reaction_probability(int simItr, int rxnIndex, int rateIndex, bool isStateChangeBackRxn,
     unsigned& DDTableIndex, double* tableIDs, BiMolData& biMolData, const Parameters& params,
@@ -67,30 +68,30 @@ void perform_bimolecular_state_change(int stateChangeIface, int facilitatorIface
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject);
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context);
 void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorIface, std::array<int, 3>& rxnItr,
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject);
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context);
 void perform_bimolecular_state_change_sphere(int stateChangeIface, int facilitatorIface, std::array<int, 3>& rxnItr,
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject);
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context);
 
 void perform_implicitlipid_state_change(int stateChangeIface, int facilitatorIface, std::array<int, 3>& rxnItr,
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject);
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context);
 void perform_implicitlipid_state_change_box(int stateChangeIface, int facilitatorIface, std::array<int, 3>& rxnItr,
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject);
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context);
 void perform_implicitlipid_state_change_sphere(int stateChangeIface, int facilitatorIface, std::array<int, 3>& rxnItr,
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject);
\ No newline at end of file
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context);
\ No newline at end of file
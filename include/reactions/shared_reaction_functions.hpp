@@ -17,6 +17,7 @@
 #include "gsl/gsl_matrix.h"
 
 #include <algorithm>
+#include <mutex>
 
 /*!
  * \brief Determines if the Interface::State of the reactant is equivalent to the reactant as contained in the
@@ -65,7 +66,7 @@ size_t find_reaction_rate_state(const Molecule& reactMol1, const Molecule& react
 void find_which_reaction(int ifaceIndex1, int ifaceIndex2, int& rxnIndex, int& rateIndex, bool& isStateChangeBackRxn,
     const Interface::State& currState, const Molecule& reactMol1, const Molecule& reactMol2,
     const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
-    const std::vector<MolTemplate>& molTemplateList);
+    const std::vector<MolTemplate>& molTemplateList, SimulContext& context);
 
 /*!
  * \brief Determines which state change reaction to use based on the identity of the current Interface::State of the
@@ -85,7 +86,6 @@ std::array<int, 2> find_which_reaction(int ifaceIndex, const Molecule& reactMol,
  */
 // double passocF(double r0, double tCurr, double Dtot, double bindRadius, double alpha, double cof);
 
-extern int evalBindNum;
 /*!
  * \brief Main function for evaluating the potential interactions between two Molecules.
  *
@@ -98,6 +98,7 @@ extern int evalBindNum;
  * \param[in] normMatrices List of all previously calculated normMatrix
  * \param[in] survMatrices List of all previously calculated survMatrix
  * \param[in] pirMatrices List of all previously calculated pirMatrix
+ * \param[in] tableMutex Held while the 2D tables are looked up or made, since they can be shared between threads
  * \param[in] moleculeList List of all Molecules in the system.
  * \param[in] complexList List of all Complexes in the system.
  * \param[in] molTemplateList List of all user-provided MolTemplates.
@@ -107,9 +108,10 @@ extern int evalBindNum;
  */
 void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, double* tableIDs, unsigned& DDTableIndex,
     const Parameters& params, std::vector<gsl_matrix*>& normMatrices, std::vector<gsl_matrix*>& survMatrices,
-    std::vector<gsl_matrix*>& pirMatrices, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject);
+    std::vector<gsl_matrix*>& pirMatrices, std::mutex& tableMutex, std::vector<Molecule>& moleculeList,
+    std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList,
+    const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, copyCounters& counterArrays,
+    Membrane& membraneObject, SimulContext& context);
 
 /*!
  * \brief Determines if binding of two molecules within the same complex can occur.
@@ -123,13 +125,24 @@ void evaluate_binding_within_complex(int pro1Index, int pro2Index, int iface1Ind
     const std::vector<MolTemplate>& molTemplateList, const ForwardRxn& oneRxn,
     const std::vector<BackRxn>& backRxns, Membrane& membraneObject, copyCounters& counterArrays);
 
+/*!
+ * \brief Evaluates binding of two free interfaces of Molecules in the same Complex, found by a ClosureIndex.
+ *
+ * Does for the one pair of interfaces what check_bimolecular_reactions does for each pair of free interfaces of two
+ * Molecules in the same Complex.
+ */
+void check_binding_within_complex(int pro1Index, int pro2Index, int relIface1, int relIface2, const Parameters& params,
+    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
+    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context);
+
 bool determine_if_reaction_occurs(int& crossIndex1, int& crossIndex2, const double maxRandInt, Molecule& mol,
-    std::vector<Molecule>& moleculeList, const std::vector<ForwardRxn>& forwardRxns);
+    std::vector<Molecule>& moleculeList, const std::vector<ForwardRxn>& forwardRxns, gsl_rng* r);
 
 void update_Nboundpairs(int ptype1, int ptype2, int chg, const Parameters& params, copyCounters& counterArrays);
 
 void check_implicit_reactions(int pro1Index, int pro2Index, int simItr,
     const Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs);
+    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs, std::mutex& tableMutex, SimulContext& context);
 
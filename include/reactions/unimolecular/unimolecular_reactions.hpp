@@ -34,27 +34,27 @@ void create_molecule_and_complex_from_rxn(int parentMolIndex, int& newMolIndex,
     const CreateDestructRxn& currRxn, SimulVolume& simulVolume,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     std::vector<MolTemplate>& molTemplateList,
-    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject);
+    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, SimulContext& context);
 
 void check_for_zeroth_order_creation(unsigned simItr, Parameters& params, SimulVolume& simulVolume,
     const std::vector<ForwardRxn>& forwardRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context);
 
 void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs, SimulContext& context);
 void check_for_unimolstatechange_reactions(unsigned simItr, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, gsl_rng* r);
 void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject);
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context);
 
 void check_for_destruction(unsigned simItr, const Parameters& params, const std::vector<CreateDestructRxn>& createDestructRxns,
     const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
@@ -62,7 +62,7 @@ void check_for_destruction(unsigned simItr, const Parameters& params, const std:
 
 bool break_interaction(size_t relIface1, size_t relIface2, Molecule& reactMol1, Molecule& reactMol2,
     const BackRxn& currRxn, std::vector<Molecule>& moleculeList,
-    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, int ILindexMol);
+    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, int ILindexMol, SimulContext& context);
 
 bool determine_parent_complex(int pro1Index, int pro2Index, int newComIndex, std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList);
@@ -75,7 +75,7 @@ bool determine_parent_complex_IL(int pro1Index, int pro2Index, int newComIndex,
  * Used for zeroth order creation reactions.
  */
 Molecule initialize_molecule_after_zeroth_reaction(
-    int index, Parameters& params, MolTemplate& molTemplate, const CreateDestructRxn& currRxn, const Membrane& membraneObject);
+    int index, Parameters& params, MolTemplate& molTemplate, const CreateDestructRxn& currRxn, const Membrane& membraneObject, SimulContext& context);
 
 /*! \ingroup Reactions
  * \brief Initializes a molecule created from a unimolecular reaction (i.e. by another Molecule)
@@ -87,10 +87,10 @@ Molecule initialize_molecule_after_zeroth_reaction(
  * transVec = \sigma\f$(\cos\theta\sin\phi,\sin\theta\sin\phi,\cos\phi)\f$
  */
 Molecule initialize_molecule_after_uni_reaction(int index, const Molecule& parentMol, Parameters& params,
-    MolTemplate& molTemplate, const CreateDestructRxn& currRxn);
+    MolTemplate& molTemplate, const CreateDestructRxn& currRxn, SimulContext& context);
 
 void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolume& simulVolume,
     std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, unsigned int molItr,
     std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, const std::vector<BackRxn>& backRxns, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<CreateDestructRxn>& createDestructRxns, copyCounters& counterArrays, const Membrane& membraneObject);
+    const std::vector<CreateDestructRxn>& createDestructRxns, copyCounters& counterArrays, const Membrane& membraneObject, SimulContext& context);
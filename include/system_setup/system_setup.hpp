@@ -39,7 +39,7 @@ bool areInVicinity(const Molecule& mol1, const Molecule& mol2, const std::vector
  */
 void generate_coordinates(const Parameters& params, std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList,
-    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject);
+    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, SimulContext& context);
 
 /*!
  * \ingroup SystemSetup
@@ -51,12 +51,13 @@ void generate_coordinates(const Parameters& params, std::vector<Molecule>& molec
  * Used to create the dimensions for the box cells.
  */
 void set_rMaxLimit(Parameters& params, const std::vector<MolTemplate>& molTemplateList,
-    const std::vector<ForwardRxn>& forwardRxns, int numDoubleBeforeAdd, int numMolTemplateBeforeAdd);
+    const std::vector<ForwardRxn>& forwardRxns, int numDoubleBeforeAdd, int numMolTemplateBeforeAdd,
+    const std::vector<int>& absToRelIface, std::ostream& log);
 
 //void create(const MolTemplate& oneTemp, std::vector<int>& emptyMolList, std::vector<int>& emptyComList,
 //	    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList);
-Molecule initialize_molecule(int comIndex, const Parameters& params, const MolTemplate& molTemplate, const Membrane& membraneObject);
-Complex initialize_complex(const Molecule& mol, const MolTemplate& molTemp);
+Molecule initialize_molecule(int comIndex, const Parameters& params, const MolTemplate& molTemplate, const Membrane& membraneObject, SimulContext& context);
+Complex initialize_complex(const Molecule& mol, const MolTemplate& molTemp, SimulContext& context);
 
 // set up some important parameters for implicit-lipid model;
 void initialize_paramters_for_implicitlipid_model(int& implicitlipidIndex, const Parameters& params, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList,
@@ -65,13 +66,13 @@ void initialize_paramters_for_implicitlipid_model(int& implicitlipidIndex, const
 //functions to generate new added molecules and complexes fo a restart simulation
 void generate_coordinates_for_restart(Parameters& params, std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList,
-    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, int numMolTemplateBeforeAdd, int numForwardRxnBdeforeAdd);
+    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, int numMolTemplateBeforeAdd, int numForwardRxnBdeforeAdd, SimulContext& context);
 
 void create_molecule_and_complex_for_restart(MolTemplate& createdMolTemp, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject);
+    std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, SimulContext& context);
 
 Molecule initialize_molecule_for_restart(
-    int index, Parameters& params, MolTemplate& molTemplate, const Membrane& membraneObject);
+    int index, Parameters& params, MolTemplate& molTemplate, const Membrane& membraneObject, SimulContext& context);
 
 bool moleculeOverlapsForRestart(const Parameters& params, Molecule& createdMol,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns,
@@ -14,6 +14,7 @@
 
 //#include "classes/class_mol_containers.hpp"
 #include "classes/class_Rxns.hpp"
+#include "classes/class_SimulVolume.hpp"
 
 /*!
  * \brief Simply translates a Complex and its member Molecules along some translation Vector.
@@ -32,8 +33,38 @@ void translate_complex_tmpCoords(const Vector& transVec, Complex& targCom, std::
  * Only occurs if the molecule has not dissociated or associated during the timestep
  */
 void create_complex_propagation_vectors(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList,
-    std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
-Coord create_complex_propagation_vectors_on_sphere(const Parameters& params, Complex& targCom);
+    std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
+Coord create_complex_propagation_vectors_on_sphere(const Parameters& params, Complex& targCom, gsl_rng* r);
+
+/*!
+ * \brief Puts isolated, slowly moving Complexes to sleep for this step.
+ * \param[in] params Simulation parameters as provided by user. Uses dormantDisplace, maxStepMultiple, rMaxLimit and timeStep.
+ * \param[in,out] simulVolume SimulVolume, whose IsolationGrid is rebuilt for the distance to the nearest other Molecule.
+ * \param[in] membraneObject Membrane, for the boundaries.
+ * \param[in] moleculeList List of all Molecules in the system.
+ * \param[in] complexList List of all Complexes in the system.
+ * \return number of dormant Complexes this step.
+ *
+ * Called after the pair search. A Complex with no reaction partners (ncross == 0) whose members neither reacted nor
+ * dissociated this step is marked propagated without moving, as long as the RMS displacement it has skipped stays
+ * below dormantDisplace, or it is far enough from everything else to advance by up to maxStepMultiple timesteps at
+ * once. The skipped steps stay in numDormantSteps until a move of the Complex covers them, see Complex::move_time.
+ */
+int update_dormant_complexes(const Parameters& params, SimulVolume& simulVolume, const Membrane& membraneObject,
+    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList);
+
+/*!
+ * \brief Moves a Complex by the steps it skipped while dormant, ahead of its move for this step.
+ * \param[in] params Simulation parameters as provided by user.
+ * \param[in] targCom The Complex, which is left as it is if it has no skipped steps or is still dormant.
+ * \param[in] moleculeList List of all Molecules in the system.
+ *
+ * Called where the next move of the Complex would not cover the skipped steps: before a bimolecular reaction, which
+ * places the Complex instead of moving it, and before the cluster sweep splits this step into sub-steps. The
+ * Molecules keep their trajStatus, and a trial move already drawn for this step is drawn again for this step alone.
+ */
+void catch_up_dormant_complex(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList,
+    std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
 
 bool complexSpansBox(Vector& transVec, const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList);
 
@@ -62,27 +93,27 @@ void clear_reweight_vecs(Molecule& oneMol);
 void sweep_separation_complex_rot_memtest(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log);
 void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
 void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log);
 void sweep_separation_complex_rot_memtest_cluster(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log);
 void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
 void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log);
 
 /*!
  * \brief Checks for overlap of proteins in solution.
@@ -92,15 +123,15 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
 void sweep_separation_complex_rot(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
 void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
 void sweep_separation_complex_rot_sphere(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject);
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r);
 // void sweep_separation_complex_rot_cluster(int simItr, int pro1Index, const Parameters& params,
 //     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
 //     const std::vector<ForwardRxn>& forwardRxns,
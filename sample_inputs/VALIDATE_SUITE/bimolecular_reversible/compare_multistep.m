@@ -0,0 +1,24 @@
+%Compare a run with multiple time stepping (maxStepMultiple > 1) against a
+%run on the regular timestep and the ODE theory, for the reversible
+%bimolecular tests. Run parms3d.inp and parms3d_multistep.inp (or the 2D
+%versions) in separate directories with the same seeds, then e.g.
+%   compare_multistep('fine/', 'multi/', 'rev_3D/TheoryODE_Avst_3D.dat')
+%Both runs should scatter around the theory by the same amount; A(t) of
+%the multistep run should not drift to one side of the regular run.
+
+function[devFine, devMulti]=compare_multistep(fineDir, multiDir, theoryFile)
+fine=csvread([fineDir, 'copy_numbers_time.dat'], 1, 0);
+multi=csvread([multiDir, 'copy_numbers_time.dat'], 1, 0);
+theory=importdata(theoryFile);
+theory=theory.data;
+
+%copy numbers are written every timeWrite steps, column 2 is A(t)
+Afine=interp1(theory(:,1), theory(:,2), fine(:,1));
+Amulti=interp1(theory(:,1), theory(:,2), multi(:,1));
+devFine=mean(fine(:,2)-Afine)
+devMulti=mean(multi(:,2)-Amulti)
+
+plot(theory(:,1), theory(:,2), 'k-', fine(:,1), fine(:,2), 'b.', multi(:,1), multi(:,2), 'r.');
+xlabel('time (s)');
+ylabel('A(t)');
+legend('ODE theory', 'regular timestep', 'multiple time stepping');
@@ -4,6 +4,7 @@
  * ***
  * can make this more efficient by just kicking out whenever cancelAssoc = true
  */
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "boundary_conditions/reflect_functions.hpp"
 #include "tracing.hpp"
 
@@ -16,341 +17,71 @@ void check_if_spans_box(bool& cancelAssoc, const Parameters& params, Complex& re
     // Associating proteins have been moved to contact. Before assigning them to the complexsame complex,
     // test to see if the complex is too big to fit in the box.
     // declare the six boundary sides of the system box;
-    double posX = membraneObject.waterBox.x / 2.0;
-    double negX = -membraneObject.waterBox.x / 2.0;
-    double posY = membraneObject.waterBox.y / 2.0;
-    double negY = -membraneObject.waterBox.y / 2.0;
-    double posZ = membraneObject.waterBox.z / 2.0;
-    double negZ = -membraneObject.waterBox.z / 2.0; // no considering the reflecting-surface, because here we are checking whether to span the box
+    BoxWalls walls { membraneObject, 0.0 }; // no considering the reflecting-surface, because here we are checking whether to span the box
 
-    bool canBeOutsideX { ((reactCom1.radius + reactCom2.radius) > (membraneObject.waterBox.x / 2.0)) };
-    bool canBeOutsideY { ((reactCom1.radius + reactCom2.radius) > (membraneObject.waterBox.y / 2.0)) };
-    bool canBeOutsideZ { ((reactCom1.radius + reactCom2.radius) > (membraneObject.waterBox.z / 2.0)) };
-
-    if (canBeOutsideZ) {
-        // std::cout << "CHECK BOX SPAN in Z. Complex 1 Radius, Complex 2 radius " << reactCom1.radius << ' ' << reactCom2.radius << '\n';
-        // The approximate size of the complex in z (max size) puts it as outside, now test interface positions.
-        bool outsidePos { false };
-        bool outsideNeg { false };
-        double posWall = -membraneObject.waterBox.z / 2.0; //initialize to negative value.
-        double negWall = -membraneObject.waterBox.z / 2.0;
-        double zplus = posWall;
-        double zneg = negWall;
-
-        double currz;
-        // find the farthest position of complex1 both in +Z and -Z
-        for (int memMol : reactCom1.memberList) {
-            currz = moleculeList[memMol].tmpComCoord.z;
-            zplus = currz - posZ;
-            zneg = negZ - currz;
-            if (zplus > posWall)
-                posWall = zplus; //distance to +z
-            if (zneg > negWall)
-                negWall = zneg; //distance to -z
-
-            // measure each interface
-            for (const auto& iface : moleculeList[memMol].tmpICoords) {
-                currz = iface.z;
-                zplus = currz - posZ;
-                zneg = negZ - currz;
-                if (zplus > posWall)
-                    posWall = zplus; //distance to +z
-                if (zneg > negWall)
-                    negWall = zneg; //distance to -z
-            }
-        }
-        // find the farthest position of complex2 both in +Z and -Z
-        for (int memMol : reactCom2.memberList) {
-            currz = moleculeList[memMol].tmpComCoord.z;
-            zplus = currz - posZ;
-            zneg = negZ - currz;
-            if (zplus > posWall)
-                posWall = zplus; //distance to +z
-            if (zneg > negWall)
-                negWall = zneg; //distance to -z
-
-            // measure each interface
-            for (const auto& iface : moleculeList[memMol].tmpICoords) {
-                currz = iface.z;
-                zplus = currz - posZ;
-                zneg = negZ - currz;
-                if (zplus > posWall)
-                    posWall = zplus; //distance to +z
-                if (zneg > negWall)
-                    negWall = zneg; //distance to -z
-            }
-        }
-
-        // check whether to span the box
-        if (posWall > 0)
-            outsidePos = true;
-        if (negWall > 0)
-            outsideNeg = true;
-        // translation or cancel
-        if (outsideNeg && outsidePos) {
-            // std::cout << "STICKS OUT BOTH SIZES in Z, CANCEL ASSOCIATION " << '\n';
+    /*along a periodic axis there are no walls, but the complex can't be longer than the box, or it reaches its own
+      image. Nor can it be longer than a side with walls that its rotations turn it toward (all of them in 3D, x and y
+      on the membrane), or reflect_traj_check_span_box can't keep it inside*/
+    if (membraneObject.hasPeriodic) {
+        BoxExtent span { walls.empty_extent() };
+        for_each_point(reactCom1, moleculeList, TmpPositions {}, [&](const Coord& point) { span.add(point); });
+        for_each_point(reactCom2, moleculeList, TmpPositions {}, [&](const Coord& point) { span.add(point); });
+        int numTurnedAxes { (reactCom1.D.z < 1E-14 && reactCom2.D.z < 1E-14) ? 2 : 3 };
+        double shortestWalledSide { std::numeric_limits<double>::infinity() };
+        double longestSpan { 0 };
+        for (int axis { 0 }; axis < numTurnedAxes; ++axis) {
+            if (!membraneObject.isPeriodic[axis])
+                shortestWalledSide = std::min(shortestWalledSide, axis_of(membraneObject.waterBox, axis));
+            longestSpan = std::max(longestSpan, span.pos[axis] - span.neg[axis]);
+        }
+        for (int axis { 0 }; axis < 3; ++axis) {
+            double length { axis_of(membraneObject.waterBox, axis) };
+            if (membraneObject.isPeriodic[axis] && span.pos[axis] - span.neg[axis] > length)
+                cancelAssoc = true;
+        }
+        if (longestSpan > shortestWalledSide)
             cancelAssoc = true;
-        }
-        /*Also check if it sticks out far enough in one direction, that pushing back in will cause 
-	       it to stick out the other side.
-	     */
-        if (posWall + negWall > 0) {
-            // std::cout << "WILL STICK OUT BOTH SIZES in Z, CANCEL ASSOCIATION " << '\n';
-            cancelAssoc = true;
-        }
-        if (outsideNeg && !outsidePos) {
-            // put back in the box. put at edge, rather than bouncing off.
-            double transZ { -negWall };
-            reactCom1.tmpComCoord.z -= transZ;
-            for (int memMol : reactCom1.memberList) {
-                moleculeList[memMol].tmpComCoord.z -= transZ;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.z -= transZ;
-            }
-            reactCom2.tmpComCoord.z -= transZ;
-            for (int memMol : reactCom2.memberList) {
-                moleculeList[memMol].tmpComCoord.z -= transZ;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.z -= transZ;
-            }
-        }
-        if (!outsideNeg && outsidePos) {
-            // put back in the box. put at edge, rather than bouncing off.
-            double transZ { posWall };
-            reactCom1.tmpComCoord.z -= transZ;
-            for (int memMol : reactCom1.memberList) {
-                moleculeList[memMol].tmpComCoord.z -= transZ;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.z -= transZ;
-            }
-            reactCom2.tmpComCoord.z -= transZ;
-            for (int memMol : reactCom2.memberList) {
-                moleculeList[memMol].tmpComCoord.z -= transZ;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.z -= transZ;
-            }
-        }
+        if (cancelAssoc)
+            return;
     }
 
-    if (canBeOutsideY) {
-        // std::cout << "CHECK BOX SPAN in Y. Complex 1 Radius, Complex 2 radius " << reactCom1.radius << ' ' << reactCom2.radius << '\n';
-        // The approximate size of the complex in y (max size) puts it as outside, now test interface positions.
-        bool outsidePos { false };
-        bool outsideNeg { false };
-        //double posWall{ negY };
-        // double negWall{ posY };
-        double curry;
-        double posWall = -membraneObject.waterBox.y / 2.0; //initialize to negative value.
-        double negWall = -membraneObject.waterBox.y / 2.0;
-        double yplus = posWall;
-        double yneg = negWall;
-        // find the farthest position of complex1 both in +Y and -Y
-        for (int memMol : reactCom1.memberList) {
-            curry = moleculeList[memMol].tmpComCoord.y;
-            /*These will be positive if there is extension beyond the box*/
-            yplus = curry - posY;
-            yneg = negY - curry;
-            if (yplus > posWall)
-                posWall = yplus;
-            if (yneg > negWall)
-                negWall = yneg;
-            // measure each interface
-            for (const auto& iface : moleculeList[memMol].tmpICoords) {
-                curry = iface.y;
-                yplus = curry - posY;
-                yneg = negY - curry;
-                if (yplus > posWall)
-                    posWall = yplus; //distance to +y
-                if (yneg > negWall)
-                    negWall = yneg; //distance to -y
-            }
-        }
-        // find the farthest position of complex2 both in +y and -y
-        for (int memMol : reactCom2.memberList) {
-            curry = moleculeList[memMol].tmpComCoord.y;
-            yplus = curry - posY;
-            yneg = negY - curry;
-            if (yplus > posWall)
-                posWall = yplus; //distance to +y
-            if (yneg > negWall)
-                negWall = yneg; //distance to -y
-
-            // measure each interface
-            for (const auto& iface : moleculeList[memMol].tmpICoords) {
-                curry = iface.y;
-                yplus = curry - posY;
-                yneg = negY - curry;
-                if (yplus > posWall)
-                    posWall = yplus; //distance to +y
-                if (yneg > negWall)
-                    negWall = yneg; //distance to -y
-            }
-        }
-        // check whether to span the box
-        if (posWall > 0)
-            outsidePos = true;
-        if (negWall > 0)
-            outsideNeg = true;
-        // translation or cancel
-        if (outsideNeg && outsidePos) {
-            // std::cout << "STICKS OUT BOTH SIZES in Y, CANCEL ASSOCIATION " << '\n';
-            cancelAssoc = true;
-        }
-        /*Also check if it sticks out far enough in one direction, that pushing back in will cause 
-	  it to stick out the other side.
-	 */
-        if (posWall + negWall > 0) {
-            // std::cout << "WILL STICK OUT BOTH SIZES in Y, CANCEL ASSOCIATION " << posWall << ' ' << negWall << '\n';
-            cancelAssoc = true;
-        }
-
-        if (outsideNeg && !outsidePos) {
-            // put back in the box. put at edge, rather than bouncing off.
-            double transy { -negWall };
-            reactCom1.tmpComCoord.y -= transy;
-            for (int memMol : reactCom1.memberList) {
-                moleculeList[memMol].tmpComCoord.y -= transy;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.y -= transy;
-            }
-            reactCom2.tmpComCoord.y -= transy;
-            for (int memMol : reactCom2.memberList) {
-                moleculeList[memMol].tmpComCoord.y -= transy;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.y -= transy;
-            }
-        }
-        if (!outsideNeg && outsidePos) {
-            // put back in the box. put at edge, rather than bouncing off.
-            double transy { posWall };
-            reactCom1.tmpComCoord.y -= transy;
-            for (int memMol : reactCom1.memberList) {
-                moleculeList[memMol].tmpComCoord.y -= transy;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.y -= transy;
-            }
-            reactCom2.tmpComCoord.y -= transy;
-            for (int memMol : reactCom2.memberList) {
-                moleculeList[memMol].tmpComCoord.y -= transy;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.y -= transy;
-            }
-        }
-    }
+    std::array<bool, 3> canBeOutside {};
+    for (int axis { 0 }; axis < 3; ++axis)
+        canBeOutside[axis] = (reactCom1.radius + reactCom2.radius) > walls.pos[axis];
+    if (!canBeOutside[0] && !canBeOutside[1] && !canBeOutside[2])
+        return;
 
-    if (canBeOutsideX) {
-        // std::cout << "CHECK BOX SPAN in X. Complex 1 Radius, Complex 2 radius " << reactCom1.radius << ' ' << reactCom2.radius << '\n';
-        // The approximate size of the complex in x (max size) puts it as outside, now test interface positions.
-        bool outsidePos { false };
-        bool outsideNeg { false };
-        double posWall = -membraneObject.waterBox.x / 2.0; //initialize to negative value.
-        double negWall = -membraneObject.waterBox.x / 2.0;
-        double xplus = posWall;
-        double xneg = negWall;
+    // The approximate size of the complex (max size) puts it as outside, now test interface positions.
+    // find the farthest position of both complexes in each direction, counting the box center as reached, so the
+    // distances beyond the walls below are at least -L/2.
+    BoxExtent extent { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } };
+    for_each_point(reactCom1, moleculeList, TmpPositions {}, [&](const Coord& point) { extent.add(point); });
+    for_each_point(reactCom2, moleculeList, TmpPositions {}, [&](const Coord& point) { extent.add(point); });
 
-        double currx;
-        // find the farthest position of complex1 both in +X and -X
-        for (int memMol : reactCom1.memberList) {
-            currx = moleculeList[memMol].tmpComCoord.x;
-            xplus = currx - posX;
-            xneg = negX - currx;
-            if (xplus > posWall)
-                posWall = xplus; //distance to +x
-            if (xneg > negWall)
-                negWall = xneg; //distance to -x
-                    // measure each interface
-            for (const auto& iface : moleculeList[memMol].tmpICoords) {
-                currx = iface.x;
-                xplus = currx - posX;
-                xneg = negX - currx;
-                if (xplus > posWall)
-                    posWall = xplus; //distance to +x
-                if (xneg > negWall)
-                    negWall = xneg; //distance to -x
-            }
-        }
-        // find the farthest position of complex2 both in +x and -x
-        for (int memMol : reactCom2.memberList) {
-            currx = moleculeList[memMol].tmpComCoord.x;
-            xplus = currx - posX;
-            xneg = negX - currx;
-            if (xplus > posWall)
-                posWall = xplus; //distance to +x
-            if (xneg > negWall)
-                negWall = xneg; //distance to -x
+    for (int axis { 2 }; axis >= 0; --axis) {
+        if (!canBeOutside[axis])
+            continue;
 
-            // measure each interface
-            for (const auto& iface : moleculeList[memMol].tmpICoords) {
-                currx = iface.x;
-                xplus = currx - posX;
-                xneg = negX - currx;
-                if (xplus > posWall)
-                    posWall = xplus; //distance to +x
-                if (xneg > negWall)
-                    negWall = xneg; //distance to -x
-            }
-        }
-        // check whether to span the box
-        if (posWall > 0)
-            outsidePos = true;
-        if (negWall > 0)
-            outsideNeg = true;
+        // These will be positive if there is extension beyond the box
+        double posDist { extent.pos[axis] - walls.pos[axis] };
+        double negDist { walls.neg[axis] - extent.neg[axis] };
+        bool outsidePos { posDist > 0 };
+        bool outsideNeg { negDist > 0 };
         // translation or cancel
-        if (outsideNeg && outsidePos) {
-            // std::cout << "STICKS OUT BOTH SIZES in X, CANCEL ASSOCIATION " << '\n';
+        if (outsideNeg && outsidePos)
             cancelAssoc = true;
-        }
         /*Also check if it sticks out far enough in one direction, that pushing back in will cause 
 	  it to stick out the other side.
 	 */
-        if (posWall + negWall > 0) {
-            // std::cout << "WILL STICK OUT BOTH SIZES in X, CANCEL ASSOCIATION " << '\n';
+        if (posDist + negDist > 0)
             cancelAssoc = true;
-        }
 
-        if (outsideNeg && !outsidePos) {
-            // put back in the box. put at edge, rather than bouncing off.
-            double transx { -negWall };
-            reactCom1.tmpComCoord.x -= transx;
-            for (int memMol : reactCom1.memberList) {
-                moleculeList[memMol].tmpComCoord.x -= transx;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.x -= transx;
-            }
-            reactCom2.tmpComCoord.x -= transx;
-            for (int memMol : reactCom2.memberList) {
-                moleculeList[memMol].tmpComCoord.x -= transx;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.x -= transx;
-            }
-        }
-        if (!outsideNeg && outsidePos) {
-            // put back in the box. put at edge, rather than bouncing off.
-            double transx { posWall };
-            reactCom1.tmpComCoord.x -= transx;
-            for (int memMol : reactCom1.memberList) {
-                moleculeList[memMol].tmpComCoord.x -= transx;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.x -= transx;
-            }
-            reactCom2.tmpComCoord.x -= transx;
-            for (int memMol : reactCom2.memberList) {
-                moleculeList[memMol].tmpComCoord.x -= transx;
-                // update interface coords
-                for (auto& iface : moleculeList[memMol].tmpICoords)
-                    iface.x -= transx;
-            }
+        // put back in the box. put at edge, rather than bouncing off.
+        if (outsideNeg != outsidePos) {
+            Coord shift {};
+            axis_of(shift, axis) = outsideNeg ? negDist : -posDist;
+            translate_tmp_complex(reactCom1, moleculeList, shift);
+            translate_tmp_complex(reactCom2, moleculeList, shift);
         }
     }
-}
\ No newline at end of file
+}
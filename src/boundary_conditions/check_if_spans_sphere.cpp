@@ -1,6 +1,7 @@
 /*! \file check_if_spans_sphere.cpp
  * ### Created on 2020-02-23 by Yiben Fu
  */
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "boundary_conditions/reflect_functions.hpp"
 #include "reactions/association/association.hpp"
 #include "reactions/association/functions_for_spherical_system.hpp"
@@ -22,36 +23,14 @@ void check_if_spans_sphere(bool& cancelAssoc, const Parameters& params, Complex&
     Coord newCom;
     double newRadius = 0.0;
     com_of_two_tmp_complexes(reactCom1, reactCom2, newCom, moleculeList);
-    for (auto& memMol : reactCom1.memberList) {
-        if (moleculeList[memMol].isImplicitLipid)
-            continue;
-
-        Vector disVec { moleculeList[memMol].tmpComCoord - newCom };
+    auto add_to_radius = [&](const Coord& point) {
+        Vector disVec { point - newCom };
         disVec.calc_magnitude();
         if (disVec.magnitude > newRadius)
             newRadius = disVec.magnitude;
-        for (const auto& iface : moleculeList[memMol].tmpICoords) {
-            disVec = Vector(iface - newCom);
-            disVec.calc_magnitude();
-            if (disVec.magnitude > newRadius)
-                newRadius = disVec.magnitude;
-        }
-    }
-    for (auto& memMol : reactCom2.memberList) {
-        if (moleculeList[memMol].isImplicitLipid)
-            continue;
-
-        Vector disVec { moleculeList[memMol].tmpComCoord - newCom };
-        disVec.calc_magnitude();
-        if (disVec.magnitude > newRadius)
-            newRadius = disVec.magnitude;
-        for (const auto& iface : moleculeList[memMol].tmpICoords) {
-            disVec = Vector(iface - newCom);
-            disVec.calc_magnitude();
-            if (disVec.magnitude > newRadius)
-                newRadius = disVec.magnitude;
-        }
-    }
+    };
+    for_each_point(reactCom1, moleculeList, TmpPositions {}, add_to_radius, true);
+    for_each_point(reactCom2, moleculeList, TmpPositions {}, add_to_radius, true);
 
     if (newRadius > sphereR) {
         // std::cout << "STICKS OUT THE SPHERE, CANCEL ASSOCIATION " << '\n';
@@ -59,77 +38,27 @@ void check_if_spans_sphere(bool& cancelAssoc, const Parameters& params, Complex&
         return;
     }
 
-    // std::cout << "CHECK SPHERE SPAN. Complex 1 Radius, Complex 2 radius " << reactCom1.radius << ' ' << reactCom2.radius << '\n';
     // The approximate size of the complex (max size) puts it as outside, now test interface positions.
+    // find the farthest position of both complexes
     bool outside { false };
-
-    Coord curr;
     double dr = 0.0;
     Coord targcrds;
-    // find the farthest position of complex1
-    for (int memMol : reactCom1.memberList) {
-        if (moleculeList[memMol].isImplicitLipid)
-            continue;
-
-        curr = moleculeList[memMol].tmpComCoord;
-        double drtmp = curr.get_magnitude() - sphereR;
+    auto add_to_farthest = [&](const Coord& point) {
+        double drtmp = point.get_magnitude() - sphereR;
         if (drtmp > dr) {
             outside = true;
             dr = drtmp;
-            targcrds = curr;
+            targcrds = point;
         }
-        // measure each interface
-        for (const auto& iface : moleculeList[memMol].tmpICoords) {
-            curr = iface;
-            drtmp = curr.get_magnitude() - sphereR;
-            if (drtmp > dr) {
-                outside = true;
-                dr = drtmp;
-                targcrds = curr;
-            }
-        }
-    }
-    // find the farthest position of complex2
-    for (int memMol : reactCom2.memberList) {
-        if (moleculeList[memMol].isImplicitLipid)
-            continue;
+    };
+    for_each_point(reactCom1, moleculeList, TmpPositions {}, add_to_farthest, true);
+    for_each_point(reactCom2, moleculeList, TmpPositions {}, add_to_farthest, true);
 
-        curr = moleculeList[memMol].tmpComCoord;
-        double drtmp = curr.get_magnitude() - sphereR;
-        if (drtmp > dr) {
-            outside = true;
-            dr = drtmp;
-            targcrds = curr;
-        }
-        // measure each interface
-        for (const auto& iface : moleculeList[memMol].tmpICoords) {
-            curr = iface;
-            drtmp = curr.get_magnitude() - sphereR;
-            if (drtmp > dr) {
-                outside = true;
-                dr = drtmp;
-                targcrds = curr;
-            }
-        }
-    }
-
-    // put back in the box. put at edge, rather than bouncing off.
+    // put back in the sphere. put at edge, rather than bouncing off.
     if (outside == true) {
         double lamda = -dr / targcrds.get_magnitude();
         Coord trans = lamda * targcrds;
-        reactCom1.tmpComCoord += trans;
-        for (int memMol : reactCom1.memberList) {
-            moleculeList[memMol].tmpComCoord += trans;
-            // update interface coords
-            for (auto& iface : moleculeList[memMol].tmpICoords)
-                iface += trans;
-        }
-        reactCom2.tmpComCoord += trans;
-        for (int memMol : reactCom2.memberList) {
-            moleculeList[memMol].tmpComCoord += trans;
-            // update interface coords
-            for (auto& iface : moleculeList[memMol].tmpICoords)
-                iface += trans;
-        }
+        translate_tmp_complex(reactCom1, moleculeList, trans);
+        translate_tmp_complex(reactCom2, moleculeList, trans);
     }
-}
\ No newline at end of file
+}
@@ -9,6 +9,7 @@
  * ### TODO List
  * ***
  */
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "boundary_conditions/reflect_functions.hpp"
 #include "tracing.hpp"
 
@@ -26,87 +27,32 @@ void reflect_complex_rad_rot_sphere(const Membrane& membraneObject, Complex& tar
         sphereR = membraneObject.sphereR - RS3Dinput;
     }
 
-    Coord curr = targCom.comCoord;
-    double currR = curr.get_magnitude();
-
-    bool canBeOutsideX { false };
-    bool outside { false };
-
-    if ((currR + targCom.radius) > sphereR)
-        canBeOutsideX = true;
-
-    if (canBeOutsideX == true) {
+    if ((targCom.comCoord.get_magnitude() + targCom.radius) > sphereR) {
         // find the farthest point
-        Coord targcrds { 0, 0, sphereR }; // to store the furthest point' coords.
-        double rtmp = sphereR; // to store the furthest point' distance to the sphere center.
-        for (auto& memMol : targCom.memberList) {
-            //measure each protein COM
-            curr = moleculeList[memMol].comCoord;
-            currR = curr.get_magnitude();
-            if (currR > sphereR && currR > rtmp) {
-                targcrds = curr;
-                rtmp = currR;
-                outside = true;
-            }
-
-            // measure each interface
-            for (auto& iface : moleculeList[memMol].interfaceList) {
-                curr = iface.coord;
-                currR = curr.get_magnitude();
-                if (currR > sphereR && currR > rtmp) {
-                    targcrds = curr;
-                    rtmp = currR;
-                    outside = true;
-                }
-            }
-        }
+        auto find_farthest = [&]() {
+            FarthestPoint farthest { Coord { 0, 0, sphereR }, sphereR };
+            for_each_point(targCom, moleculeList, CurrentPositions {}, [&](const Coord& point) { farthest.add(point); });
+            return farthest;
+        };
+        FarthestPoint farthest { find_farthest() };
 
         int times = 0; // to count the loop-times of 'while'
-        while (outside == true) {
+        while (farthest.isFound) {
             times++;
-            rtmp = targcrds.get_magnitude();
+            double rtmp = farthest.crds.get_magnitude();
             double lamda = -2.0 * (rtmp - sphereR) / rtmp;
-            Coord dtrans = lamda * targcrds;
-            targCom.comCoord += dtrans;
-            for (auto memMol : targCom.memberList) {
-                moleculeList[memMol].comCoord += dtrans;
-                for (auto& iface : moleculeList[memMol].interfaceList)
-                    iface.coord += dtrans;
-            }
+            Coord dtrans = lamda * farthest.crds;
+            translate_complex(targCom, moleculeList, dtrans);
             // reflecting may make the complex outside the sphere in other direction,
             // thus we need to recheck whether outside
-            // initialize outside, targcrds;
-            outside = false;
-            targcrds = Coord(0, 0, sphereR); // to store the furthest point' coords.
-            rtmp = sphereR; // to store the furthest point' distance to the sphere center.
-            for (auto& memMol : targCom.memberList) {
-                //measure each protein COM
-                curr = moleculeList[memMol].comCoord;
-                currR = curr.get_magnitude();
-                if (currR > sphereR && currR > rtmp) {
-                    targcrds = curr;
-                    rtmp = currR;
-                    outside = true;
-                }
-
-                // measure each interface
-                for (auto& iface : moleculeList[memMol].interfaceList) {
-                    curr = iface.coord;
-                    currR = curr.get_magnitude();
-                    if (currR > sphereR && currR > rtmp) {
-                        targcrds = curr;
-                        rtmp = currR;
-                        outside = true;
-                    }
-                }
-            }
+            farthest = find_farthest();
 
             if (times > 100) {
                 // so many times reflection still cannot make the complex back inside the sphere, thus we may need report 'WRONG!!'
-                std::cout << "ALREADY UPDATED POSITIONS.BUT, IN REFLECT COMPLEX_RAD_ROT_SPHERE, 100 TIMES REFLECTIONS CAN'T MOVE THE COMPLEX BACK INSIDE SPHERE." << '\n';
-                std::cout << "COMPLEX " << targCom.index << ", COMPLEX COM " << targCom.comCoord.x << ", " << targCom.comCoord.y << ", " << targCom.comCoord.z << '\n';
-                std::cout << "COMPLEX RADIUS " << targCom.radius << ", COMPLEX SIZE " << targCom.memberList.size() << '\n';
-                std::cout << "EXITING..." << '\n';
+                std::cerr << "ALREADY UPDATED POSITIONS.BUT, IN REFLECT COMPLEX_RAD_ROT_SPHERE, 100 TIMES REFLECTIONS CAN'T MOVE THE COMPLEX BACK INSIDE SPHERE." << '\n';
+                std::cerr << "COMPLEX " << targCom.index << ", COMPLEX COM " << targCom.comCoord.x << ", " << targCom.comCoord.y << ", " << targCom.comCoord.z << '\n';
+                std::cerr << "COMPLEX RADIUS " << targCom.radius << ", COMPLEX SIZE " << targCom.memberList.size() << '\n';
+                std::cerr << "EXITING..." << '\n';
                 exit(1);
             }
         } // end of while-loop
@@ -13,12 +13,12 @@
 #include "math/matrix.hpp"
 #include "math/rand_gsl.hpp"
 
-void reflect_traj_check_span(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput)
+void reflect_traj_check_span(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r)
 {
     if (membraneObject.isSphere)
-        reflect_traj_check_span_sphere(params, targCom, moleculeList, membraneObject, RS3Dinput);
+        reflect_traj_check_span_sphere(params, targCom, moleculeList, membraneObject, RS3Dinput, r);
     else
-        reflect_traj_check_span_box(params, targCom, moleculeList, membraneObject, RS3Dinput);
+        reflect_traj_check_span_box(params, targCom, moleculeList, membraneObject, RS3Dinput, r);
 }
 
 // #include "boundary_conditions/reflect_functions.hpp"
@@ -234,12 +234,12 @@ void reflect_traj_check_span(const Parameters& params, Complex& targCom, std::ve
 
 //         if (moveFailed == true) {
 //             // Resample, extends in x, y, and/or z
-//             targCom.trajTrans.x = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV();
-//             targCom.trajTrans.y = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV();
-//             targCom.trajTrans.z = sqrt(2.0 * params.timeStep * targCom.D.z) * GaussV();
-//             targCom.trajRot.x = sqrt(2.0 * params.timeStep * targCom.Dr.x) * GaussV();
-//             targCom.trajRot.y = sqrt(2.0 * params.timeStep * targCom.Dr.y) * GaussV();
-//             targCom.trajRot.z = sqrt(2.0 * params.timeStep * targCom.Dr.z) * GaussV();
+//             targCom.trajTrans.x = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV(r);
+//             targCom.trajTrans.y = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV(r);
+//             targCom.trajTrans.z = sqrt(2.0 * params.timeStep * targCom.D.z) * GaussV(r);
+//             targCom.trajRot.x = sqrt(2.0 * params.timeStep * targCom.Dr.x) * GaussV(r);
+//             targCom.trajRot.y = sqrt(2.0 * params.timeStep * targCom.Dr.y) * GaussV(r);
+//             targCom.trajRot.z = sqrt(2.0 * params.timeStep * targCom.Dr.z) * GaussV(r);
 
 //             M = create_euler_rotation_matrix(targCom.trajRot);
 //             reflect_traj_complex_rad_rot_nocheck(params, targCom, moleculeList, M, membraneObject, RS3Dinput);
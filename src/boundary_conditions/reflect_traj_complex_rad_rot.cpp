@@ -2,12 +2,12 @@
 #include "math/matrix.hpp"
 
 void reflect_traj_complex_rad_rot(
-    const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput)
+    const Parameters& params, std::vector<Molecule>& moleculeList, Complex& targCom, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r)
 {
     if (membraneObject.isSphere == true)
-        reflect_traj_complex_rad_rot_sphere(params, moleculeList, targCom, membraneObject, RS3Dinput);
+        reflect_traj_complex_rad_rot_sphere(params, moleculeList, targCom, membraneObject, RS3Dinput, r);
     else
-        reflect_traj_complex_rad_rot_box(params, moleculeList, targCom, membraneObject, RS3Dinput);
+        reflect_traj_complex_rad_rot_box(params, moleculeList, targCom, membraneObject, RS3Dinput, r);
 
     // // NOTE: it only works for a box system with the membrane surface located on the Z-bottom.
 
@@ -0,0 +1,21 @@
+#include "boundary_conditions/boundary_geometry.hpp"
+
+void translate_complex(Complex& targCom, std::vector<Molecule>& moleculeList, const Coord& trans)
+{
+    targCom.comCoord += trans;
+    for (auto& memMol : targCom.memberList) {
+        moleculeList[memMol].comCoord += trans;
+        for (auto& iface : moleculeList[memMol].interfaceList)
+            iface.coord += trans;
+    }
+}
+
+void translate_tmp_complex(Complex& targCom, std::vector<Molecule>& moleculeList, const Coord& trans)
+{
+    targCom.tmpComCoord += trans;
+    for (auto& memMol : targCom.memberList) {
+        moleculeList[memMol].tmpComCoord += trans;
+        for (auto& iface : moleculeList[memMol].tmpICoords)
+            iface += trans;
+    }
+}
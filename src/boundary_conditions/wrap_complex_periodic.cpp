@@ -0,0 +1,29 @@
+#include "boundary_conditions/boundary_geometry.hpp"
+#include "boundary_conditions/reflect_functions.hpp"
+
+#include <cmath>
+
+void wrap_complex_periodic(Complex& targCom, std::vector<Molecule>& moleculeList, const Membrane& membraneObject)
+{
+    if (!membraneObject.hasPeriodic)
+        return;
+
+    // the complex is kept whole, only its COM is put back in the box, so its members can stick out of a periodic side
+    Coord shift {};
+    bool isShifted { false };
+    for (int axis { 0 }; axis < 3; ++axis) {
+        if (!membraneObject.isPeriodic[axis])
+            continue;
+        double length { axis_of(membraneObject.waterBox, axis) };
+        double numImages { std::floor(axis_of(targCom.comCoord, axis) / length + 0.5) };
+        if (numImages != 0) {
+            axis_of(shift, axis) = -length * numImages;
+            isShifted = true;
+        }
+    }
+    if (isShifted) {
+        translate_complex(targCom, moleculeList, shift);
+        for (auto& memMol : targCom.memberList)
+            moleculeList[memMol].imageOffset -= shift;
+    }
+}
@@ -0,0 +1,152 @@
+#include "classes/class_AssociationBatch.hpp"
+#include "boundary_conditions/boundary_geometry.hpp"
+#include "reactions/association/association.hpp"
+
+namespace {
+struct Sphere {
+    Coord center {};
+    double radius { 0 };
+
+    Sphere() = default;
+    Sphere(const Coord& _center, double _radius)
+        : center(_center)
+        , radius(_radius)
+    {
+    }
+};
+
+/*Whether check_for_structure_overlap_system(), placing a complex within sphere, looks at the proteins of a complex
+  within oneChanged. The tolerance only errs toward placing again*/
+bool is_within_reach(const Sphere& sphere, const Sphere& oneChanged, const Parameters& params,
+    const Membrane& membraneObject)
+{
+    const double tol { 1E-6 };
+    Vector distVec { oneChanged.center - sphere.center };
+    minimum_image(distVec, membraneObject);
+    return distVec.get_magnitude() < oneChanged.radius + sphere.radius + params.overlapSepLimit + tol;
+}
+}
+
+AssociationBatch::AssociationBatch(WorkerPool& _workerPool)
+    : workerPool(_workerPool)
+{
+}
+
+bool AssociationBatch::can_hold(const Event& event, const std::vector<Molecule>& moleculeList,
+    const Membrane& membraneObject)
+{
+    const Molecule& reactMol1 { moleculeList[event.molIndex1] };
+    const Molecule& reactMol2 { moleculeList[event.molIndex2] };
+    return !membraneObject.isSphere && !reactMol1.isImplicitLipid && !reactMol2.isImplicitLipid
+        && reactMol1.myComIndex != reactMol2.myComIndex;
+}
+
+bool AssociationBatch::pending(int molIndex, const std::vector<Molecule>& moleculeList) const
+{
+    if (eventList.empty())
+        return false;
+
+    auto is_held = [&](int oneMolIndex) {
+        int comIndex { moleculeList[oneMolIndex].myComIndex };
+        return (oneMolIndex < int(isHeldMol.size()) && isHeldMol[oneMolIndex])
+            || (comIndex >= 0 && comIndex < int(isHeldCom.size()) && isHeldCom[comIndex]);
+    };
+    if (is_held(molIndex))
+        return true;
+    for (auto& partnerIndex : moleculeList[molIndex].crossbase) {
+        if (is_held(partnerIndex))
+            return true;
+    }
+    return false;
+}
+
+void AssociationBatch::hold(const Event& event, const std::vector<Molecule>& moleculeList,
+    const std::vector<Complex>& complexList)
+{
+    if (isHeldCom.size() < complexList.size())
+        isHeldCom.resize(complexList.size(), false);
+    if (isHeldMol.size() < moleculeList.size())
+        isHeldMol.resize(moleculeList.size(), false);
+
+    for (int molIndex : { event.molIndex1, event.molIndex2 }) {
+        const Molecule& reactMol { moleculeList[molIndex] };
+        isHeldCom[reactMol.myComIndex] = true;
+        heldComList.push_back(reactMol.myComIndex);
+        // the partners' probabilities of reacting with reactMol are set to 0 once it's bound
+        for (auto& partnerIndex : reactMol.crossbase) {
+            isHeldMol[partnerIndex] = true;
+            heldMolList.push_back(partnerIndex);
+        }
+    }
+    eventList.push_back(event);
+}
+
+void AssociationBatch::flush(const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
+    const std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList,
+    copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context)
+{
+    if (eventList.empty())
+        return;
+
+    std::vector<AssocPlacement> placementList(eventList.size());
+    std::function<void(int)> place = [&](int eventItr) {
+        const Event& event { eventList[eventItr] };
+        Molecule& reactMol1 { moleculeList[event.molIndex1] };
+        Molecule& reactMol2 { moleculeList[event.molIndex2] };
+        placementList[eventItr] = place_association_box(event.ifaceIndex1, event.ifaceIndex2, reactMol1, reactMol2,
+            complexList[reactMol1.myComIndex], complexList[reactMol2.myComIndex], params, forwardRxns[event.rxnIndex],
+            moleculeList, molTemplateList, complexList, membraneObject, forwardRxns, backRxns, context);
+    };
+    workerPool.run(int(eventList.size()), place);
+
+    // complexes changed by the associations committed so far, as they were and as they are now
+    std::vector<Sphere> changedList {};
+    for (unsigned eventItr { 0 }; eventItr < eventList.size(); ++eventItr) {
+        const Event& event { eventList[eventItr] };
+        Molecule& reactMol1 { moleculeList[event.molIndex1] };
+        Molecule& reactMol2 { moleculeList[event.molIndex2] };
+        Complex& reactCom1 { complexList[reactMol1.myComIndex] };
+        Complex& reactCom2 { complexList[reactMol2.myComIndex] };
+
+        if (placementList[eventItr].checkedSystem && !changedList.empty()) {
+            Sphere sphere1 {};
+            Sphere sphere2 {};
+            tmp_bounding_sphere(reactCom1, moleculeList, molTemplateList, sphere1.center, sphere1.radius);
+            tmp_bounding_sphere(reactCom2, moleculeList, molTemplateList, sphere2.center, sphere2.radius);
+            bool isStale { false };
+            for (auto& oneChanged : changedList) {
+                if (is_within_reach(sphere1, oneChanged, params, membraneObject)
+                    || is_within_reach(sphere2, oneChanged, params, membraneObject)) {
+                    isStale = true;
+                    break;
+                }
+            }
+            if (isStale) {
+                clear_tmp_crds(reactCom1, moleculeList);
+                clear_tmp_crds(reactCom2, moleculeList);
+                place(eventItr);
+            }
+        }
+
+        const AssocPlacement& placement { placementList[eventItr] };
+        bool isAccepted { placement.cancelReason == AssocCancel::none };
+        if (isAccepted) {
+            changedList.push_back({ reactCom1.comCoord, reactCom1.radius });
+            changedList.push_back({ reactCom2.comCoord, reactCom2.radius });
+        }
+        commit_association_box(placement, event.ifaceIndex1, event.ifaceIndex2, reactMol1, reactMol2, reactCom1,
+            reactCom2, params, forwardRxns[event.rxnIndex], moleculeList, molTemplateList, observablesList,
+            counterArrays, complexList, membraneObject, context);
+        if (isAccepted)
+            changedList.push_back({ reactCom1.comCoord, reactCom1.radius });
+    }
+
+    for (auto& comIndex : heldComList)
+        isHeldCom[comIndex] = false;
+    for (auto& molIndex : heldMolList)
+        isHeldMol[molIndex] = false;
+    heldComList.clear();
+    heldMolList.clear();
+    eventList.clear();
+}
@@ -0,0 +1,948 @@
+#include "classes/class_CheckpointChain.hpp"
+#include "io/io.hpp"
+#include "reactions/association/association.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+const std::string deltaMagic { "NERDSS_RESTART_DELTA 3\n" };
+
+// largest list a delta file is expected to hold. a larger size means the file is damaged
+const uint64_t maxListSize { uint64_t(1) << 32 };
+
+// unsigned integers in groups of 7 bits, low ones first, so small ones take a byte
+void append_varint(std::string& bytes, uint64_t value)
+{
+    while (value >= 0x80) {
+        bytes += char((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    bytes += char(value);
+}
+
+bool read_varint(const std::string& bytes, std::size_t& pos, uint64_t& value)
+{
+    value = 0;
+    for (int shift { 0 };; shift += 7) {
+        if (pos >= bytes.size() || shift > 63)
+            return false;
+        unsigned char byte = bytes[pos++];
+        value |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+}
+
+/* The same in groups of 3 bits, two to a byte. Most coordinate residuals are a few units in the last place, so they
+ * take half a byte. numNibbles is how many groups bytes holds.
+ */
+void append_nibble_varint(std::string& bytes, std::size_t& numNibbles, uint64_t value)
+{
+    do {
+        unsigned nibble { unsigned(value & 0x7) };
+        value >>= 3;
+        if (value != 0)
+            nibble |= 0x8;
+        if (numNibbles % 2 == 0)
+            bytes += char(nibble);
+        else
+            bytes.back() = char(bytes.back() | (nibble << 4));
+        ++numNibbles;
+    } while (value != 0);
+}
+
+bool read_nibble_varint(const std::string& bytes, std::size_t& nibblePos, uint64_t& value)
+{
+    value = 0;
+    for (int shift { 0 };; shift += 3) {
+        if (nibblePos / 2 >= bytes.size() || shift > 63)
+            return false;
+        unsigned nibble { (static_cast<unsigned char>(bytes[nibblePos / 2]) >> (4 * (nibblePos % 2))) & 0xfu };
+        ++nibblePos;
+        value |= uint64_t(nibble & 0x7) << shift;
+        if (!(nibble & 0x8))
+            return true;
+    }
+}
+
+// integers wider than a byte are stored as varints, zigzag encoded if they're signed so small negative ones are small
+template <typename T>
+struct is_varint : std::integral_constant<bool, std::is_integral<T>::value && (sizeof(T) > 1)> {
+};
+
+template <typename T> uint64_t to_zigzag(T value)
+{
+    if (!std::is_signed<T>::value)
+        return uint64_t(value);
+    int64_t wide { int64_t(value) };
+    return (uint64_t(wide) << 1) ^ (wide < 0 ? ~uint64_t(0) : 0);
+}
+
+template <typename T> T from_zigzag(uint64_t code)
+{
+    if (!std::is_signed<T>::value)
+        return T(code);
+    return T(int64_t((code >> 1) ^ ((code & 1) ? ~uint64_t(0) : 0)));
+}
+
+/* The bytes of a part that differ from its keyframe bytes, which have the same length: the number of runs, and for
+ * each run the number of equal bytes before it, its length and its bytes. Runs a byte or two apart are joined, since
+ * a run costs two bytes.
+ */
+void append_byte_runs(std::string& bytes, const std::string& oldState, const std::string& newState)
+{
+    std::vector<std::pair<std::size_t, std::size_t>> runs {};
+    for (std::size_t bytePos { 0 }; bytePos < newState.size(); ++bytePos) {
+        if (newState[bytePos] == oldState[bytePos])
+            continue;
+        if (!runs.empty() && bytePos <= runs.back().second + 2)
+            runs.back().second = bytePos + 1;
+        else
+            runs.emplace_back(bytePos, bytePos + 1);
+    }
+    append_varint(bytes, runs.size());
+    std::size_t runEnd { 0 };
+    for (auto& run : runs) {
+        append_varint(bytes, run.first - runEnd);
+        append_varint(bytes, run.second - run.first);
+        bytes.append(newState, run.first, run.second - run.first);
+        runEnd = run.second;
+    }
+}
+
+// list sizes and integers are varints, everything else is stored as it is in memory
+class DeltaWriter {
+public:
+    explicit DeltaWriter(std::string& _bytes)
+        : bytes(_bytes)
+    {
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value && !is_varint<T>::value>::type operator()(const T& value)
+    {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    template <typename T> typename std::enable_if<is_varint<T>::value>::type operator()(const T& value)
+    {
+        append_varint(bytes, to_zigzag(value));
+    }
+    void operator()(const std::string& text)
+    {
+        append_varint(bytes, text.size());
+        bytes += text;
+    }
+    template <typename T> void operator()(const std::vector<T>& list)
+    {
+        append_varint(bytes, list.size());
+        for (auto& elem : list)
+            (*this)(elem);
+    }
+    void operator()(const std::map<std::string, int>& list)
+    {
+        append_varint(bytes, list.size());
+        for (auto& elem : list) {
+            (*this)(elem.first);
+            (*this)(elem.second);
+        }
+    }
+    template <typename T> typename std::enable_if<std::is_class<T>::value>::type operator()(const T& elem)
+    {
+        // transfer only reads elem when writing
+        transfer(*this, const_cast<T&>(elem));
+    }
+
+private:
+    std::string& bytes;
+};
+
+class DeltaReader {
+public:
+    DeltaReader(const std::string& _bytes, std::size_t _pos)
+        : bytes(_bytes)
+        , pos(_pos)
+    {
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value && !is_varint<T>::value>::type operator()(T& value)
+    {
+        if (!isGood || bytes.size() - pos < sizeof(T)) {
+            isGood = false;
+            value = T {};
+            return;
+        }
+        std::memcpy(&value, &bytes[pos], sizeof(T));
+        pos += sizeof(T);
+    }
+    template <typename T> typename std::enable_if<is_varint<T>::value>::type operator()(T& value)
+    {
+        uint64_t code { 0 };
+        varint(code);
+        value = from_zigzag<T>(code);
+    }
+    void operator()(std::string& text)
+    {
+        uint64_t size { read_size() };
+        text.assign(bytes, pos, size);
+        pos += size;
+    }
+    template <typename T> void operator()(std::vector<T>& list)
+    {
+        uint64_t size { read_size() };
+        list.clear();
+        list.resize(size);
+        for (auto& elem : list)
+            (*this)(elem);
+    }
+    void operator()(std::map<std::string, int>& list)
+    {
+        uint64_t size { read_size() };
+        list.clear();
+        for (uint64_t elemItr { 0 }; elemItr < size; ++elemItr) {
+            std::string key {};
+            int value { 0 };
+            (*this)(key);
+            (*this)(value);
+            list[key] = value;
+        }
+    }
+    template <typename T> typename std::enable_if<std::is_class<T>::value>::type operator()(T& elem)
+    {
+        transfer(*this, elem);
+    }
+
+    void varint(uint64_t& value)
+    {
+        if (!isGood || !read_varint(bytes, pos, value)) {
+            isGood = false;
+            value = 0;
+        }
+    }
+
+    // applies the byte runs of append_byte_runs to the keyframe bytes of a part
+    void patch(std::string& state)
+    {
+        uint64_t numRuns { 0 };
+        varint(numRuns);
+        std::size_t statePos { 0 };
+        for (uint64_t runItr { 0 }; runItr < numRuns && isGood; ++runItr) {
+            uint64_t skip { 0 };
+            uint64_t length { 0 };
+            varint(skip);
+            varint(length);
+            if (!isGood || skip > state.size() - statePos || length > state.size() - statePos - skip
+                || length > bytes.size() - pos) {
+                isGood = false;
+                return;
+            }
+            statePos += skip;
+            state.replace(statePos, length, bytes, pos, length);
+            statePos += length;
+            pos += length;
+        }
+    }
+
+    bool is_good() const { return isGood; }
+
+private:
+    const std::string& bytes;
+    std::size_t pos { 0 };
+    bool isGood { true };
+
+    // every element takes at least a byte, so a size larger than what is left means the file is damaged
+    uint64_t read_size()
+    {
+        uint64_t size { 0 };
+        if (!isGood || !read_varint(bytes, pos, size) || size > maxListSize || size > bytes.size() - pos) {
+            isGood = false;
+            size = 0;
+        }
+        return size;
+    }
+};
+
+template <typename Archive> void transfer(Archive& archive, Coord& coord)
+{
+    archive(coord.x);
+    archive(coord.y);
+    archive(coord.z);
+}
+
+// what write_restart writes of an interface, but its coordinates
+template <typename Archive> void transfer(Archive& archive, Molecule::Iface& iface)
+{
+    archive(iface.index);
+    archive(iface.relIndex);
+    archive(iface.molTypeIndex);
+    archive(iface.stateIndex);
+    archive(iface.stateIden);
+    archive(iface.isBound);
+    if (iface.isBound) {
+        archive(iface.interaction.partnerIndex);
+        archive(iface.interaction.partnerIfaceIndex);
+        archive(iface.interaction.conjBackRxn);
+    }
+}
+
+/* What write_restart writes of a Molecule, but its coordinates, in parts that change at different rates: what it is,
+ * its sub-volume and image offset, its bonds and states, and its reweighting lists. A delta only holds the parts that
+ * changed.
+ */
+const int numMolParts { 4 };
+
+template <typename Archive> void transfer_part(Archive& archive, Molecule& mol, int part)
+{
+    if (part == 0) {
+        archive(mol.index);
+        archive(mol.isEmpty);
+        archive(mol.myComIndex);
+        archive(mol.molTypeIndex);
+        archive(mol.mass);
+        archive(mol.isLipid);
+        archive(mol.isImplicitLipid);
+        archive(mol.linksToSurface);
+    } else if (part == 1) {
+        archive(mol.mySubVolIndex);
+        archive(mol.imageOffset);
+    } else if (part == 2) {
+        archive(mol.freelist);
+        archive(mol.bndlist);
+        archive(mol.bndpartner);
+        archive(mol.interfaceList);
+    } else {
+        archive(mol.prevlist);
+        archive(mol.prevmyface);
+        archive(mol.prevpface);
+        archive(mol.prevnorm);
+        archive(mol.ps_prev);
+        archive(mol.prevsep);
+    }
+}
+
+// what write_restart writes of a Complex, but its center
+template <typename Archive> void transfer(Archive& archive, Complex& com)
+{
+    archive(com.index);
+    archive(com.isEmpty);
+    archive(com.radius);
+    archive(com.mass);
+    archive(com.linksToSurface);
+    archive(com.iLipidIndex);
+    archive(com.OnSurface);
+    archive(com.D);
+    archive(com.Dr);
+    archive(com.memberList);
+    archive(com.numEachMol);
+}
+
+// what write_restart writes besides the Molecules and Complexes, and a run changes
+template <typename Archive>
+void transfer_run_state(Archive& archive, Parameters& params, std::vector<MolTemplate>& molTemplateList,
+    std::map<std::string, int>& observablesList, Membrane& membraneObject, copyCounters& counterArrays,
+    SimulContext& context)
+{
+    archive(params.nItr);
+    archive(params.itrRestartFrom);
+    archive(params.timeRestartFrom);
+    archive(params.numMolTypes);
+    archive(params.numTotalSpecies);
+    archive(params.numTotalComplex);
+    archive(params.numTotalUnits);
+    archive(params.numLipids);
+    archive(params.rMaxLimit);
+
+    archive(membraneObject.implicitlipidIndex);
+    archive(membraneObject.nSites);
+    archive(membraneObject.nStates);
+    archive(membraneObject.No_free_lipids);
+    archive(membraneObject.No_protein);
+    archive(membraneObject.totalSA);
+    archive(membraneObject.numberOfFreeLipidsEachState);
+
+    // MolTemplates aren't added during a run, so the keyframe has the same ones
+    archive(context.numEachMolType);
+    for (auto& oneTemp : molTemplateList)
+        archive(oneTemp.monomerList);
+
+    archive(context.numberOfMolecules);
+    archive(context.emptyMolList);
+    archive(context.numberOfComplexes);
+    archive(context.emptyComList);
+
+    archive(observablesList);
+    archive(counterArrays.nLoops);
+    archive(counterArrays.nCancelOverlapPartner);
+    archive(counterArrays.nCancelOverlapSystem);
+    archive(counterArrays.nCancelDisplace2D);
+    archive(counterArrays.nCancelDisplace3D);
+    archive(counterArrays.nCancelDisplace3Dto2D);
+    archive(counterArrays.nCancelSpanBox);
+    archive(counterArrays.nAssocSuccess);
+    archive(counterArrays.eventArraySize);
+    archive(counterArrays.events3D);
+    archive(counterArrays.events3Dto2D);
+    archive(counterArrays.events2D);
+    archive(counterArrays.bindPairList);
+}
+
+struct ComplexMotion {
+    Coord center { 0, 0, 0 }; //!< the Complex's center now
+    std::array<double, 4> rotation { { 1, 0, 0, 0 } }; //!< unit quaternion (w, x, y, z) of its rotation since the keyframe
+};
+
+// the value read_restart reads back from the std::fixed, precision 20 text of write_restart
+double read_back(double value)
+{
+    char text[400];
+    std::snprintf(text, sizeof(text), "%.20f", value);
+    return std::strtod(text, nullptr);
+}
+
+// the parts of a Molecule as read_restart reads them back, which deltas patch in replay
+Molecule read_back(Molecule mol)
+{
+    mol.mass = read_back(mol.mass);
+    mol.imageOffset = Coord { read_back(mol.imageOffset.x), read_back(mol.imageOffset.y), read_back(mol.imageOffset.z) };
+    for (auto* list : { &mol.prevnorm, &mol.ps_prev, &mol.prevsep }) {
+        for (auto& elem : *list)
+            elem = read_back(elem);
+    }
+    return mol;
+}
+
+void get_points(const Molecule& mol, std::vector<Coord>& points)
+{
+    points.clear();
+    points.push_back(mol.comCoord);
+    for (auto& oneIface : mol.interfaceList)
+        points.push_back(oneIface.coord);
+}
+
+double dot(const Coord& a, const Coord& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+Coord cross(const Coord& a, const Coord& b)
+{
+    return Coord { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+Coord scaled(const Coord& a, double scale) { return Coord { a.x * scale, a.y * scale, a.z * scale }; }
+
+std::array<double, 4> normalized(const std::array<double, 4>& quat)
+{
+    double norm { std::sqrt(quat[0] * quat[0] + quat[1] * quat[1] + quat[2] * quat[2] + quat[3] * quat[3]) };
+    return { { quat[0] / norm, quat[1] / norm, quat[2] / norm, quat[3] / norm } };
+}
+
+// row-major rotation matrix of a unit quaternion. the writer and replay both predict the coordinates with it
+std::array<double, 9> rotation_matrix(const std::array<double, 4>& quat)
+{
+    double w { quat[0] }, x { quat[1] }, y { quat[2] }, z { quat[3] };
+    return { { 1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y),
+        2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x),
+        2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y) } };
+}
+
+std::array<double, 4> to_quaternion(const std::array<double, 9>& m)
+{
+    double trace { m[0] + m[4] + m[8] };
+    if (trace > 0) {
+        double s { 2 * std::sqrt(trace + 1) };
+        return normalized({ { s / 4, (m[7] - m[5]) / s, (m[2] - m[6]) / s, (m[3] - m[1]) / s } });
+    } else if (m[0] > m[4] && m[0] > m[8]) {
+        double s { 2 * std::sqrt(1 + m[0] - m[4] - m[8]) };
+        return normalized({ { (m[7] - m[5]) / s, s / 4, (m[1] + m[3]) / s, (m[2] + m[6]) / s } });
+    } else if (m[4] > m[8]) {
+        double s { 2 * std::sqrt(1 + m[4] - m[0] - m[8]) };
+        return normalized({ { (m[2] - m[6]) / s, (m[1] + m[3]) / s, s / 4, (m[5] + m[7]) / s } });
+    }
+    double s { 2 * std::sqrt(1 + m[8] - m[0] - m[4]) };
+    return normalized({ { (m[3] - m[1]) / s, (m[2] + m[6]) / s, (m[5] + m[7]) / s, s / 4 } });
+}
+
+/* A rotation is stored as the vector part of its quaternion with w >= 0, since -q is the same rotation. The writer
+ * predicts the coordinates with the quaternion replay rebuilds from it.
+ */
+std::array<double, 4> from_vector_part(double x, double y, double z)
+{
+    return { { std::sqrt(std::max(0.0, 1 - x * x - y * y - z * z)), x, y, z } };
+}
+
+std::array<double, 4> stored_rotation(const std::array<double, 4>& quat)
+{
+    double sign { quat[0] < 0 ? -1.0 : 1.0 };
+    return from_vector_part(sign * quat[1], sign * quat[2], sign * quat[3]);
+}
+
+// smallest rotation taking the direction of a to that of b
+std::array<double, 4> shortest_arc(const Coord& a, const Coord& b)
+{
+    Coord axis { cross(a, b) };
+    double w { std::sqrt(dot(a, a) * dot(b, b)) + dot(a, b) };
+    if (w <= 1E-12 * std::sqrt(dot(a, a) * dot(b, b))) {
+        // opposite, so half a turn about any axis perpendicular to a
+        axis = cross(a, std::fabs(a.x) < std::fabs(a.y) ? Coord { 1, 0, 0 } : Coord { 0, 1, 0 });
+        w = 0;
+    }
+    return normalized({ { w, axis.x, axis.y, axis.z } });
+}
+
+// orthonormal frame of u and the part of v perpendicular to it. false if they're parallel
+bool make_frame(const Coord& u, const Coord& v, std::array<Coord, 3>& frame)
+{
+    frame[0] = scaled(u, 1 / std::sqrt(dot(u, u)));
+    Coord w { v - scaled(frame[0], dot(v, frame[0])) };
+    double normSq { dot(w, w) };
+    if (normSq <= 1E-12 * dot(v, v))
+        return false;
+    frame[1] = scaled(w, 1 / std::sqrt(normSq));
+    frame[2] = cross(frame[0], frame[1]);
+    return true;
+}
+
+/* Rotation of a Complex since the keyframe, from the keyframe and current coordinates of its members. The Complex is
+ * rigid between bond changes, so it's the rotation of the frame of its longest arm from the first point and the arm
+ * furthest from parallel to it. It only has to be close: the coordinates are stored as differences from where it
+ * takes them.
+ */
+std::array<double, 4> complex_rotation(const std::vector<Coord>& oldPoints, const std::vector<Coord>& newPoints)
+{
+    const std::array<double, 4> identity { { 1, 0, 0, 0 } };
+    std::size_t longest { 0 };
+    double longestSq { 0 };
+    for (std::size_t pointItr { 1 }; pointItr < oldPoints.size(); ++pointItr) {
+        Coord arm { oldPoints[pointItr] - oldPoints[0] };
+        if (dot(arm, arm) > longestSq) {
+            longest = pointItr;
+            longestSq = dot(arm, arm);
+        }
+    }
+    if (longestSq == 0)
+        return identity;
+
+    Coord oldU { oldPoints[longest] - oldPoints[0] };
+    Coord newU { newPoints[longest] - newPoints[0] };
+    if (dot(newU, newU) == 0)
+        return identity;
+    std::size_t widest { 0 };
+    double widestSq { 0 };
+    for (std::size_t pointItr { 1 }; pointItr < oldPoints.size(); ++pointItr) {
+        Coord normal { cross(oldU, oldPoints[pointItr] - oldPoints[0]) };
+        if (dot(normal, normal) > widestSq) {
+            widest = pointItr;
+            widestSq = dot(normal, normal);
+        }
+    }
+
+    std::array<Coord, 3> oldFrame {};
+    std::array<Coord, 3> newFrame {};
+    if (widest == 0 || !make_frame(oldU, oldPoints[widest] - oldPoints[0], oldFrame)
+        || !make_frame(newU, newPoints[widest] - newPoints[0], newFrame))
+        return shortest_arc(oldU, newU);
+
+    std::array<double, 9> matrix {};
+    for (int axisItr { 0 }; axisItr < 3; ++axisItr) {
+        const Coord& from = oldFrame[axisItr];
+        const Coord& to = newFrame[axisItr];
+        matrix[0] += to.x * from.x;
+        matrix[1] += to.x * from.y;
+        matrix[2] += to.x * from.z;
+        matrix[3] += to.y * from.x;
+        matrix[4] += to.y * from.y;
+        matrix[5] += to.y * from.z;
+        matrix[6] += to.z * from.x;
+        matrix[7] += to.z * from.y;
+        matrix[8] += to.z * from.z;
+    }
+    return to_quaternion(matrix);
+}
+
+/* Where the motion of its Complex takes the keyframe coordinates of a Molecule: its center and then its interfaces.
+ * A Molecule that isn't in the keyframe, or has another number of interfaces, is predicted at 0, and one whose
+ * Complex isn't, where it was.
+ */
+void predict_points(int molIndex, int comIndex, std::size_t numPoints,
+    const std::vector<std::vector<Coord>>& keyframePoints, const std::vector<Coord>& keyframeComCoords,
+    const std::vector<ComplexMotion>& motions, std::vector<Coord>& predicted)
+{
+    if (molIndex >= int(keyframePoints.size()) || keyframePoints[molIndex].size() != numPoints) {
+        predicted.assign(numPoints, Coord { 0, 0, 0 });
+        return;
+    }
+    const std::vector<Coord>& oldPoints = keyframePoints[molIndex];
+    if (comIndex < 0 || comIndex >= int(keyframeComCoords.size()) || comIndex >= int(motions.size())) {
+        predicted = oldPoints;
+        return;
+    }
+
+    std::array<double, 9> m { rotation_matrix(motions[comIndex].rotation) };
+    const Coord& oldCenter = keyframeComCoords[comIndex];
+    const Coord& newCenter = motions[comIndex].center;
+    predicted.resize(numPoints);
+    for (std::size_t pointItr { 0 }; pointItr < numPoints; ++pointItr) {
+        double x { oldPoints[pointItr].x - oldCenter.x };
+        double y { oldPoints[pointItr].y - oldCenter.y };
+        double z { oldPoints[pointItr].z - oldCenter.z };
+        predicted[pointItr] = Coord { m[0] * x + m[1] * y + m[2] * z + newCenter.x,
+            m[3] * x + m[4] * y + m[5] * z + newCenter.y, m[6] * x + m[7] * y + m[8] * z + newCenter.z };
+    }
+}
+
+// maps doubles to integers in the same order, so close values have close integers. -0 and 0 stay apart
+int64_t ordered_bits(double value)
+{
+    int64_t bits { 0 };
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits < 0 ? -(bits & INT64_MAX) - 1 : bits;
+}
+
+double from_ordered_bits(int64_t ordered)
+{
+    int64_t bits { ordered < 0 ? (-(ordered + 1)) | INT64_MIN : ordered };
+    double value { 0 };
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// the difference of the ordered integers, zigzag encoded so small negative ones are small too
+uint64_t residual_code(double value, double predicted)
+{
+    uint64_t difference { uint64_t(ordered_bits(value)) - uint64_t(ordered_bits(predicted)) };
+    return (difference << 1) ^ ((difference >> 63) ? ~uint64_t(0) : 0);
+}
+
+double from_residual_code(uint64_t zigzag, double predicted)
+{
+    uint64_t difference { (zigzag >> 1) ^ ((zigzag & 1) ? ~uint64_t(0) : 0) };
+    return from_ordered_bits(int64_t(uint64_t(ordered_bits(predicted)) + difference));
+}
+
+bool read_residual(const std::string& residuals, std::size_t& nibblePos, double predicted, double& value)
+{
+    uint64_t zigzag { 0 };
+    if (!read_nibble_varint(residuals, nibblePos, zigzag))
+        return false;
+    value = from_residual_code(zigzag, predicted);
+    return true;
+}
+
+std::string directory_of(const std::string& fileName)
+{
+    auto slashPos = fileName.rfind('/');
+    return slashPos == std::string::npos ? std::string {} : fileName.substr(0, slashPos + 1);
+}
+}
+
+CheckpointChain::CheckpointChain(int _fullEvery)
+    : fullEvery(_fullEvery)
+{
+}
+
+void CheckpointChain::write(long long int simItr, const Parameters& params, const std::vector<Molecule>& moleculeList,
+    const std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList,
+    const std::map<std::string, int>& observablesList, const Membrane& membraneObject,
+    const copyCounters& counterArrays, const SimulContext& context, const std::string& restartTail,
+    const std::function<void(std::ostream&)>& writeRestart)
+{
+    std::string itrName { "restart" + std::to_string(simItr) };
+
+    if (keyframeName.empty() || numSinceFull + 1 >= fullEvery) {
+        std::ofstream restartFile { params.output_path(itrName + ".dat") };
+        writeRestart(restartFile);
+        restartFile << restartTail;
+
+        numSinceFull = 0;
+        keyframeName = itrName + ".dat";
+        keyframeMolStates.assign(moleculeList.size() * numMolParts, std::string {});
+        keyframePoints.resize(moleculeList.size());
+        for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+            Molecule keyframeMol { read_back(moleculeList[molItr]) };
+            for (int part { 0 }; part < numMolParts; ++part) {
+                DeltaWriter partWriter { keyframeMolStates[molItr * numMolParts + part] };
+                transfer_part(partWriter, keyframeMol, part);
+            }
+            get_points(moleculeList[molItr], keyframePoints[molItr]);
+            for (auto& point : keyframePoints[molItr])
+                point = Coord { read_back(point.x), read_back(point.y), read_back(point.z) };
+        }
+        keyframeComStates.assign(complexList.size(), std::string {});
+        keyframeComCoords.resize(complexList.size());
+        for (unsigned comItr { 0 }; comItr < complexList.size(); ++comItr) {
+            DeltaWriter comWriter { keyframeComStates[comItr] };
+            comWriter(complexList[comItr]);
+            const Coord& center = complexList[comItr].comCoord;
+            keyframeComCoords[comItr] = Coord { read_back(center.x), read_back(center.y), read_back(center.z) };
+        }
+        return;
+    }
+
+    ++numSinceFull;
+    std::string bytes {};
+    DeltaWriter writer { bytes };
+    writer(keyframeName);
+    writer(int64_t(simItr));
+    // transfer_run_state only reads them when writing
+    transfer_run_state(writer, const_cast<Parameters&>(params), const_cast<std::vector<MolTemplate>&>(molTemplateList),
+        const_cast<std::map<std::string, int>&>(observablesList), const_cast<Membrane&>(membraneObject),
+        const_cast<copyCounters&>(counterArrays), const_cast<SimulContext&>(context));
+
+    /* bond and state changes. Each changed Molecule has the number of Molecules since the last changed one, a byte
+     * with a bit for each changed part and a bit (shifted by numMolParts) for each part stored whole, and the parts.
+     * A part is stored whole if the keyframe doesn't have it with the same length, and as byte runs otherwise.
+     */
+    std::string state {};
+    std::string changes {};
+    uint64_t numChanged { 0 };
+    std::string parts {};
+    unsigned nextMol { 0 };
+    for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+        uint8_t changedParts { 0 };
+        parts.clear();
+        for (int part { 0 }; part < numMolParts; ++part) {
+            state.clear();
+            DeltaWriter partWriter { state };
+            transfer_part(partWriter, const_cast<Molecule&>(moleculeList[molItr]), part);
+            if (molItr >= keyframePoints.size()) {
+                changedParts |= (1 | 1 << numMolParts) << part;
+                parts += state;
+                continue;
+            }
+            const std::string& oldState = keyframeMolStates[molItr * numMolParts + part];
+            if (state == oldState)
+                continue;
+            changedParts |= 1 << part;
+            if (state.size() == oldState.size()) {
+                append_byte_runs(parts, oldState, state);
+            } else {
+                changedParts |= 1 << (numMolParts + part);
+                parts += state;
+            }
+        }
+        if (changedParts != 0) {
+            append_varint(changes, molItr - nextMol);
+            changes += char(changedParts);
+            changes += parts;
+            nextMol = molItr + 1;
+            ++numChanged;
+        }
+    }
+    writer(uint64_t(moleculeList.size()));
+    writer(numChanged);
+    bytes += changes;
+
+    changes.clear();
+    numChanged = 0;
+    for (unsigned comItr { 0 }; comItr < complexList.size(); ++comItr) {
+        state.clear();
+        DeltaWriter comWriter { state };
+        comWriter(complexList[comItr]);
+        if (comItr >= keyframeComStates.size() || state != keyframeComStates[comItr]) {
+            DeltaWriter changeWriter { changes };
+            changeWriter(int32_t(comItr));
+            changes += state;
+            ++numChanged;
+        }
+    }
+    writer(uint64_t(complexList.size()));
+    writer(numChanged);
+    bytes += changes;
+
+    // rigid body motion of each Complex, from the members it shares with the keyframe. The center is stored as a
+    // residual from the keyframe center
+    std::vector<ComplexMotion> motions(complexList.size());
+    std::vector<Coord> oldPoints {};
+    std::vector<Coord> newPoints {};
+    std::vector<Coord> points {};
+    for (unsigned comItr { 0 }; comItr < complexList.size(); ++comItr) {
+        const Complex& oneCom = complexList[comItr];
+        motions[comItr].center = oneCom.comCoord;
+        if (comItr < keyframeComCoords.size() && !oneCom.isEmpty) {
+            oldPoints.clear();
+            newPoints.clear();
+            for (auto memMol : oneCom.memberList) {
+                get_points(moleculeList[memMol], points);
+                if (memMol < int(keyframePoints.size()) && keyframePoints[memMol].size() == points.size()) {
+                    oldPoints.insert(oldPoints.end(), keyframePoints[memMol].begin(), keyframePoints[memMol].end());
+                    newPoints.insert(newPoints.end(), points.begin(), points.end());
+                }
+            }
+            motions[comItr].rotation = stored_rotation(complex_rotation(oldPoints, newPoints));
+        }
+        const Coord& oldCenter = comItr < keyframeComCoords.size() ? keyframeComCoords[comItr] : Coord { 0, 0, 0 };
+        append_varint(bytes, residual_code(motions[comItr].center.x, oldCenter.x));
+        append_varint(bytes, residual_code(motions[comItr].center.y, oldCenter.y));
+        append_varint(bytes, residual_code(motions[comItr].center.z, oldCenter.z));
+        for (int axisItr { 1 }; axisItr < 4; ++axisItr)
+            writer(motions[comItr].rotation[axisItr]);
+    }
+
+    // coordinates, as differences from where the motion of their Complex takes them
+    std::string residuals {};
+    std::size_t numNibbles { 0 };
+    std::vector<Coord> predicted {};
+    for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+        get_points(moleculeList[molItr], points);
+        predict_points(molItr, moleculeList[molItr].myComIndex, points.size(), keyframePoints, keyframeComCoords,
+            motions, predicted);
+        for (std::size_t pointItr { 0 }; pointItr < points.size(); ++pointItr) {
+            append_nibble_varint(residuals, numNibbles, residual_code(points[pointItr].x, predicted[pointItr].x));
+            append_nibble_varint(residuals, numNibbles, residual_code(points[pointItr].y, predicted[pointItr].y));
+            append_nibble_varint(residuals, numNibbles, residual_code(points[pointItr].z, predicted[pointItr].z));
+        }
+    }
+    writer(residuals);
+    writer(restartTail);
+
+    std::ofstream deltaFile { params.output_path(itrName + ".delta"), std::ios::binary };
+    deltaFile << deltaMagic;
+    deltaFile.write(bytes.data(), bytes.size());
+}
+
+bool CheckpointChain::replay(const std::string& deltaFileName, std::string& text)
+{
+    std::ifstream deltaFile { deltaFileName, std::ios::binary };
+    std::ostringstream deltaText;
+    deltaText << deltaFile.rdbuf();
+    std::string bytes { deltaText.str() };
+    if (!deltaFile || bytes.compare(0, deltaMagic.size(), deltaMagic) != 0) {
+        std::cerr << "ERROR: " << deltaFileName << " is not a restart delta file.\n";
+        return false;
+    }
+    DeltaReader reader { bytes, deltaMagic.size() };
+    std::string keyframeFileName {};
+    int64_t simItr { 0 };
+    reader(keyframeFileName);
+    reader(simItr);
+
+    // the keyframe is next to the delta file
+    std::ifstream keyframeFile { directory_of(deltaFileName) + keyframeFileName };
+    if (!reader.is_good() || !keyframeFile) {
+        std::cerr << "ERROR: Cannot read the keyframe " << directory_of(deltaFileName) + keyframeFileName << ".\n";
+        return false;
+    }
+    long long int keyframeItr { 0 };
+    Parameters params {};
+    SimulVolume simulVolume {};
+    std::vector<Molecule> moleculeList {};
+    std::vector<Complex> complexList {};
+    std::vector<MolTemplate> molTemplateList {};
+    std::vector<ForwardRxn> forwardRxns {};
+    std::vector<BackRxn> backRxns {};
+    std::vector<CreateDestructRxn> createDestructRxns {};
+    std::map<std::string, int> observablesList {};
+    Membrane membraneObject {};
+    copyCounters counterArrays {};
+    SimulContext context {};
+    init_association_events(counterArrays); // read_restart fills in the event histograms
+    read_restart(keyframeItr, keyframeFile, params, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns,
+        backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+
+    // the keyframe coordinates the delta's are predicted from
+    std::vector<std::vector<Coord>> keyframePoints(moleculeList.size());
+    for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr)
+        get_points(moleculeList[molItr], keyframePoints[molItr]);
+    std::vector<Coord> keyframeComCoords {};
+    for (auto& oneCom : complexList)
+        keyframeComCoords.push_back(oneCom.comCoord);
+
+    transfer_run_state(reader, params, molTemplateList, observablesList, membraneObject, counterArrays, context);
+    uint64_t numMols { 0 };
+    uint64_t numChanged { 0 };
+    reader(numMols);
+    reader(numChanged);
+    bool isRead { numMols <= maxListSize };
+    moleculeList.resize(isRead ? numMols : 0);
+    uint64_t index { 0 };
+    std::string state {};
+    for (uint64_t changeItr { 0 }; changeItr < numChanged && isRead; ++changeItr) {
+        uint64_t numSkipped { 0 };
+        uint8_t changedParts { 0 };
+        reader.varint(numSkipped);
+        reader(changedParts);
+        index += numSkipped;
+        isRead = reader.is_good() && index < moleculeList.size();
+        for (int part { 0 }; part < numMolParts && isRead; ++part) {
+            if (!(changedParts & (1 << part)))
+                continue;
+            if (changedParts & (1 << (numMolParts + part))) {
+                transfer_part(reader, moleculeList[index], part);
+                continue;
+            }
+            state.clear();
+            DeltaWriter partWriter { state };
+            transfer_part(partWriter, moleculeList[index], part);
+            reader.patch(state);
+            DeltaReader partReader { state, 0 };
+            transfer_part(partReader, moleculeList[index], part);
+            isRead = reader.is_good() && partReader.is_good();
+        }
+        ++index;
+    }
+
+    uint64_t numComs { 0 };
+    reader(numComs);
+    reader(numChanged);
+    isRead = isRead && numComs <= maxListSize;
+    complexList.resize(isRead ? numComs : 0);
+    for (uint64_t changeItr { 0 }; changeItr < numChanged && isRead; ++changeItr) {
+        int32_t index { -1 };
+        reader(index);
+        isRead = reader.is_good() && index >= 0 && uint64_t(index) < complexList.size();
+        if (isRead)
+            reader(complexList[index]);
+    }
+
+    std::vector<ComplexMotion> motions(complexList.size());
+    for (unsigned comItr { 0 }; comItr < complexList.size(); ++comItr) {
+        const Coord oldCenter { comItr < keyframeComCoords.size() ? keyframeComCoords[comItr] : Coord { 0, 0, 0 } };
+        uint64_t code[3] {};
+        double rotation[3] {};
+        for (auto& elem : code)
+            reader.varint(elem);
+        for (auto& elem : rotation)
+            reader(elem);
+        motions[comItr].center = Coord { from_residual_code(code[0], oldCenter.x),
+            from_residual_code(code[1], oldCenter.y), from_residual_code(code[2], oldCenter.z) };
+        motions[comItr].rotation = from_vector_part(rotation[0], rotation[1], rotation[2]);
+        complexList[comItr].comCoord = motions[comItr].center;
+    }
+
+    std::string residuals {};
+    std::string restartTail {};
+    reader(residuals);
+    reader(restartTail);
+    isRead = isRead && reader.is_good();
+    std::size_t nibblePos { 0 };
+    std::vector<Coord> predicted {};
+    for (unsigned molItr { 0 }; molItr < moleculeList.size() && isRead; ++molItr) {
+        Molecule& oneMol = moleculeList[molItr];
+        predict_points(molItr, oneMol.myComIndex, oneMol.interfaceList.size() + 1, keyframePoints, keyframeComCoords,
+            motions, predicted);
+        for (std::size_t pointItr { 0 }; pointItr < predicted.size() && isRead; ++pointItr) {
+            Coord& point = pointItr == 0 ? oneMol.comCoord : oneMol.interfaceList[pointItr - 1].coord;
+            isRead = read_residual(residuals, nibblePos, predicted[pointItr].x, point.x)
+                && read_residual(residuals, nibblePos, predicted[pointItr].y, point.y)
+                && read_residual(residuals, nibblePos, predicted[pointItr].z, point.z);
+        }
+    }
+    if (!isRead || (nibblePos + 1) / 2 != residuals.size()) {
+        std::cerr << "ERROR: " << deltaFileName << " is cut short.\n";
+        return false;
+    }
+
+    std::ostringstream restartText;
+    write_restart(simItr, restartText, params, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns,
+        backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+    text = restartText.str() + restartTail;
+    return true;
+}
@@ -0,0 +1,99 @@
+#include "classes/class_CheckpointForker.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define NERDSS_HAS_FORK
+#endif
+
+CheckpointForker::CheckpointForker(int _maxChildren, std::ostream& _log)
+    : maxChildren(_maxChildren)
+    , log(_log)
+{
+}
+
+CheckpointForker::~CheckpointForker() { reap(true); }
+
+void CheckpointForker::write_now(const std::string& fileName, const std::function<void(std::ostream&)>& writeFile)
+{
+    std::ofstream checkpointFile { fileName };
+    writeFile(checkpointFile);
+}
+
+void CheckpointForker::write(const std::string& fileName, const std::function<void(std::ostream&)>& writeFile)
+{
+#ifdef NERDSS_HAS_FORK
+    if (maxChildren <= 0) {
+        write_now(fileName, writeFile);
+        return;
+    }
+
+    reap(false);
+    while (int(children.size()) >= maxChildren) {
+        bool isDone { false };
+        wait_for(children.front(), true, isDone);
+        children.erase(children.begin());
+    }
+
+    // anything buffered would be written again by the child
+    log.flush();
+    std::cout.flush();
+    std::cerr.flush();
+    pid_t pid { fork() };
+    if (pid == 0) {
+        // the child only writes the checkpoint, and skips the destructors and exit handlers of the simulation
+        std::string partFileName { fileName + ".part" };
+        bool isWritten { false };
+        try {
+            std::ofstream checkpointFile { partFileName };
+            writeFile(checkpointFile);
+            checkpointFile.close();
+            isWritten = bool(checkpointFile) && std::rename(partFileName.c_str(), fileName.c_str()) == 0;
+        } catch (...) {
+        }
+        _exit(isWritten ? 0 : 1);
+    }
+    if (pid > 0) {
+        children.push_back(Child { int(pid), fileName });
+        return;
+    }
+
+    if (!hasForkFailed) {
+        std::cerr << "WARNING: Cannot fork to write " << fileName
+                  << ", writing the checkpoints without forking while fork fails.\n";
+        hasForkFailed = true;
+    }
+#endif
+    write_now(fileName, writeFile);
+}
+
+void CheckpointForker::wait_for(const Child& child, bool wait, bool& isDone)
+{
+#ifdef NERDSS_HAS_FORK
+    int status { 0 };
+    pid_t result { waitpid(child.pid, &status, wait ? 0 : WNOHANG) };
+    if (result == 0) {
+        isDone = false;
+        return;
+    }
+    isDone = true;
+    if (result < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        std::cerr << "WARNING: The child process writing " << child.fileName << " failed.\n";
+#else
+    isDone = true;
+#endif
+}
+
+void CheckpointForker::reap(bool wait)
+{
+    for (auto child = children.begin(); child != children.end();) {
+        bool isDone { false };
+        wait_for(*child, wait, isDone);
+        child = isDone ? children.erase(child) : child + 1;
+    }
+}
@@ -0,0 +1,124 @@
+#include "classes/class_ClosureIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+ClosureIndex::ClosureIndex(const Parameters& params, const std::vector<ForwardRxn>& forwardRxns)
+    : minSize(params.closureIndexSize)
+{
+    for (auto& oneRxn : forwardRxns)
+        reach = std::max(reach, oneRxn.bindRadSameCom * oneRxn.bindRadius);
+}
+
+void ClosureIndex::build(const std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList)
+{
+    if (comCandidatesList.size() < complexList.size())
+        comCandidatesList.resize(complexList.size());
+
+    candidateList.clear();
+    for (auto& oneCom : complexList) {
+        oneCom.hasClosureIndex = !oneCom.isEmpty && reach > 0 && int(oneCom.memberList.size()) >= minSize;
+        if (!oneCom.hasClosureIndex)
+            continue;
+
+        ComCandidates& comCandidates = comCandidatesList[oneCom.index];
+        unsigned long long signature { make_signature(oneCom, moleculeList) };
+        if (signature != comCandidates.signature) {
+            comCandidates.signature = signature;
+            find_candidates(oneCom, moleculeList, comCandidates.candidateList);
+        }
+        candidateList.insert(candidateList.end(), comCandidates.candidateList.begin(),
+            comCandidates.candidateList.end());
+    }
+}
+
+unsigned long long ClosureIndex::make_signature(const Complex& targCom, const std::vector<Molecule>& moleculeList)
+{
+    // FNV-1a over the members, their free interfaces and whether distances are in the plane
+    const unsigned long long prime { 1099511628211ULL };
+    unsigned long long signature { 14695981039346656037ULL };
+    auto add = [&](long long value) { signature = (signature ^ static_cast<unsigned long long>(value)) * prime; };
+    add(std::abs(targCom.D.z) < 1E-10);
+    for (auto& memMol : targCom.memberList) {
+        add(memMol);
+        add(static_cast<long long>(moleculeList[memMol].freelist.size()));
+        for (auto& relIface : moleculeList[memMol].freelist)
+            add(relIface);
+    }
+    return signature;
+}
+
+void ClosureIndex::find_candidates(const Complex& targCom, const std::vector<Molecule>& moleculeList,
+    std::vector<Candidate>& comCandidateList)
+{
+    comCandidateList.clear();
+    // as get_distance, which ignores z if the Complex is on the membrane
+    bool is2D { std::abs(targCom.D.z) < 1E-10 };
+
+    entryList.clear();
+    Coord lower { 0, 0, 0 };
+    for (auto& memMol : targCom.memberList) {
+        for (auto& relIface : moleculeList[memMol].freelist) {
+            Entry entry {};
+            entry.molIndex = memMol;
+            entry.relIface = relIface;
+            entry.coord = moleculeList[memMol].interfaceList[relIface].coord;
+            if (is2D)
+                entry.coord.z = 0;
+            if (entryList.empty())
+                lower = entry.coord;
+            lower.x = std::min(lower.x, entry.coord.x);
+            lower.y = std::min(lower.y, entry.coord.y);
+            lower.z = std::min(lower.z, entry.coord.z);
+            entryList.push_back(entry);
+        }
+    }
+    if (entryList.size() < 2)
+        return;
+
+    // the grid only spans the Complex, so keys stay small. The extra cell on each side keeps neighbor keys unique
+    const double tol { 1E-6 };
+    double cellSize { reach + tol };
+    long long numX { 3 };
+    long long numY { 3 };
+    for (auto& entry : entryList) {
+        numX = std::max(numX, static_cast<long long>((entry.coord.x - lower.x) / cellSize) + 3);
+        numY = std::max(numY, static_cast<long long>((entry.coord.y - lower.y) / cellSize) + 3);
+    }
+    auto cell_key = [&](long long ix, long long iy, long long iz) { return ix + numX * (iy + numY * iz); };
+    for (auto& entry : entryList) {
+        entry.cellKey = cell_key(static_cast<long long>((entry.coord.x - lower.x) / cellSize) + 1,
+            static_cast<long long>((entry.coord.y - lower.y) / cellSize) + 1,
+            static_cast<long long>((entry.coord.z - lower.z) / cellSize) + 1);
+    }
+    std::sort(entryList.begin(), entryList.end(), [](const Entry& a, const Entry& b) {
+        return std::tie(a.cellKey, a.molIndex, a.relIface) < std::tie(b.cellKey, b.molIndex, b.relIface);
+    });
+
+    for (auto& entry : entryList) {
+        for (int dz { -1 }; dz <= 1; ++dz) {
+            for (int dy { -1 }; dy <= 1; ++dy) {
+                for (int dx { -1 }; dx <= 1; ++dx) {
+                    long long neighKey { entry.cellKey + cell_key(dx, dy, dz) };
+                    auto partner = std::lower_bound(entryList.begin(), entryList.end(), neighKey,
+                        [](const Entry& a, long long key) { return a.cellKey < key; });
+                    for (; partner != entryList.end() && partner->cellKey == neighKey; ++partner) {
+                        // each pair once, under the lower Molecule index
+                        if (partner->molIndex <= entry.molIndex)
+                            continue;
+                        Vector sepVec { partner->coord - entry.coord };
+                        if (sepVec.get_magnitude() < cellSize)
+                            comCandidateList.emplace_back(entry.molIndex, partner->molIndex, entry.relIface,
+                                partner->relIface);
+                    }
+                }
+            }
+        }
+    }
+    std::sort(comCandidateList.begin(), comCandidateList.end(),
+        [](const Candidate& a, const Candidate& b) {
+            return std::tie(a.pro1Index, a.pro2Index, a.relIface1, a.relIface2)
+                < std::tie(b.pro1Index, b.pro2Index, b.relIface1, b.relIface2);
+        });
+}
@@ -41,9 +41,10 @@ void cluster_one_complex(int k1, std::vector<Molecule>& moleculeList, std::vecto
                 newPair.i1 = i1;
                 newPair.bindrad = forwardRxns[rxn].bindRadius;
                 // get the partner interface
-                newPair.i2 = (forwardRxns[rxn].reactantListNew[0].relIfaceIndex == i1)
+                i2 = (forwardRxns[rxn].reactantListNew[0].relIfaceIndex == i1)
                     ? forwardRxns[rxn].reactantListNew[1].relIfaceIndex
                     : forwardRxns[rxn].reactantListNew[0].relIfaceIndex;
+                newPair.i2 = i2;
 
                 flag = 0;
                 for (int j = 0; j < pairList.size(); j++) {
@@ -107,7 +108,7 @@ void define_cluster_pairs(int p1, std::vector<Molecule>& moleculeList, std::vect
     }
 }
 
-void resample_traj(int currStop, std::vector<ClusterPair>& pairList, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const Parameters& params, const Membrane& membraneObject, double RS3Dinput)
+void resample_traj(int currStop, std::vector<ClusterPair>& pairList, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const Parameters& params, const Membrane& membraneObject, double RS3Dinput, gsl_rng* r)
 {
     int i;
     int k1, k2;
@@ -129,23 +130,23 @@ void resample_traj(int currStop, std::vector<ClusterPair>& pairList, std::vector
             if (flag == 0) {
 
                 if (membraneObject.isSphere == true && complexList[k1].D.z < 1E-15) { // complex on sphere surface
-                    Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k1]);
+                    Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k1], r);
                     complexList[k1].trajTrans.x = targTrans.x;
                     complexList[k1].trajTrans.y = targTrans.y;
                     complexList[k1].trajTrans.z = targTrans.z;
-                    complexList[k1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k1].Dr.x) * GaussV();
-                    complexList[k1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k1].Dr.y) * GaussV();
-                    complexList[k1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k1].Dr.z) * GaussV();
+                    complexList[k1].trajRot.x = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].Dr.x) * GaussV(r);
+                    complexList[k1].trajRot.y = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].Dr.y) * GaussV(r);
+                    complexList[k1].trajRot.z = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].Dr.z) * GaussV(r);
                 } else {
-                    complexList[k1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k1].D.x) * GaussV();
-                    complexList[k1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k1].D.y) * GaussV();
-                    complexList[k1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k1].D.z) * GaussV();
-                    complexList[k1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k1].Dr.x) * GaussV();
-                    complexList[k1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k1].Dr.y) * GaussV();
-                    complexList[k1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k1].Dr.z) * GaussV();
+                    complexList[k1].trajTrans.x = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].D.x) * GaussV(r);
+                    complexList[k1].trajTrans.y = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].D.y) * GaussV(r);
+                    complexList[k1].trajTrans.z = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].D.z) * GaussV(r);
+                    complexList[k1].trajRot.x = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].Dr.x) * GaussV(r);
+                    complexList[k1].trajRot.y = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].Dr.y) * GaussV(r);
+                    complexList[k1].trajRot.z = sqrt(2.0 * complexList[k1].move_time(params.timeStep) * complexList[k1].Dr.z) * GaussV(r);
                 }
 
-                reflect_traj_complex_rad_rot(params, moleculeList, complexList[k1], membraneObject, RS3Dinput);
+                reflect_traj_complex_rad_rot(params, moleculeList, complexList[k1], membraneObject, RS3Dinput, r);
 
                 didMove.push_back(k1);
             }
@@ -159,23 +160,23 @@ void resample_traj(int currStop, std::vector<ClusterPair>& pairList, std::vector
             if (flag == 0) {
 
                 if (membraneObject.isSphere == true && complexList[k2].D.z < 1E-15) { // complex on sphere surface
-                    Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k2]);
+                    Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k2], r);
                     complexList[k2].trajTrans.x = targTrans.x;
                     complexList[k2].trajTrans.y = targTrans.y;
                     complexList[k2].trajTrans.z = targTrans.z;
-                    complexList[k2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k2].Dr.x) * GaussV();
-                    complexList[k2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k2].Dr.y) * GaussV();
-                    complexList[k2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k2].Dr.z) * GaussV();
+                    complexList[k2].trajRot.x = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].Dr.x) * GaussV(r);
+                    complexList[k2].trajRot.y = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].Dr.y) * GaussV(r);
+                    complexList[k2].trajRot.z = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].Dr.z) * GaussV(r);
                 } else {
-                    complexList[k2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k2].D.x) * GaussV();
-                    complexList[k2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k2].D.y) * GaussV();
-                    complexList[k2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k2].D.z) * GaussV();
-                    complexList[k2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k2].Dr.x) * GaussV();
-                    complexList[k2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k2].Dr.y) * GaussV();
-                    complexList[k2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k2].Dr.z) * GaussV();
+                    complexList[k2].trajTrans.x = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].D.x) * GaussV(r);
+                    complexList[k2].trajTrans.y = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].D.y) * GaussV(r);
+                    complexList[k2].trajTrans.z = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].D.z) * GaussV(r);
+                    complexList[k2].trajRot.x = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].Dr.x) * GaussV(r);
+                    complexList[k2].trajRot.y = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].Dr.y) * GaussV(r);
+                    complexList[k2].trajRot.z = sqrt(2.0 * complexList[k2].move_time(params.timeStep) * complexList[k2].Dr.z) * GaussV(r);
                 }
 
-                reflect_traj_complex_rad_rot(params, moleculeList, complexList[k2], membraneObject, RS3Dinput);
+                reflect_traj_complex_rad_rot(params, moleculeList, complexList[k2], membraneObject, RS3Dinput, r);
 
                 didMove.push_back(k2);
             }
@@ -34,7 +34,7 @@ Coord::Coord(std::vector<double> vals)
     , z(vals[2])
 {
     if (vals.size() > 3) {
-        std::cout << "Coordinate cannot have more than 3 points. Exiting." << '\n';
+        std::cerr << "Coordinate cannot have more than 3 points. Exiting." << '\n';
         exit(1);
     }
 }
@@ -150,7 +150,7 @@ bool Coord::isOutOfBox(const Membrane& membraneObject)
     return false;
 }
 
-double Coord::get_magnitude()
+double Coord::get_magnitude() const
 {
     return sqrt(x * x + y * y + z * z);
 }
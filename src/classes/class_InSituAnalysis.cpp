@@ -0,0 +1,351 @@
+#include "classes/class_InSituAnalysis.hpp"
+#include "boundary_conditions/boundary_geometry.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+int find_mol_type(const std::string& molName, const std::vector<MolTemplate>& molTemplateList)
+{
+    for (auto& oneTemp : molTemplateList) {
+        if (oneTemp.molName == molName)
+            return oneTemp.molTypeIndex;
+    }
+    std::cerr << "ERROR: analysisRdfPairs names " << molName << ", which is not a molecule type. Exiting...\n";
+    exit(1);
+}
+
+double system_volume(const Membrane& membraneObject)
+{
+    if (membraneObject.isSphere)
+        return 4.0 / 3.0 * M_PI * pow(membraneObject.sphereR, 3);
+    return membraneObject.waterBox.x * membraneObject.waterBox.y * membraneObject.waterBox.z;
+}
+
+// area of the membrane, in nm^2
+double membrane_area(const Membrane& membraneObject)
+{
+    if (membraneObject.isSphere)
+        return 4.0 * M_PI * membraneObject.sphereR * membraneObject.sphereR;
+    return membraneObject.waterBox.x * membraneObject.waterBox.y;
+}
+
+// area of one bin of the surface density maps, in nm^2
+double density_bin_area(const Membrane& membraneObject, int densityBins)
+{
+    return membrane_area(membraneObject) / (densityBins * densityBins);
+}
+}
+
+InSituAnalysis::InSituAnalysis(const Parameters& params, const std::vector<MolTemplate>& molTemplateList,
+    const SimulVolume& simulVolume, const Membrane& membraneObject, std::ostream& log)
+    : isActive(params.analysis.is_active())
+    , settings(params.analysis)
+    , sizeFileName(params.output_path("analysis_complex_sizes.dat"))
+    , rdfFileName(params.output_path("analysis_rdf.dat"))
+    , densityFileName(params.output_path("analysis_surface_density.dat"))
+    , rdfBins(params.analysis.rdfBins)
+    , densityBins(params.analysis.densityBins)
+{
+    if (!isActive)
+        return;
+
+    rdfPairIndex.assign(molTemplateList.size(), std::vector<int>(molTemplateList.size(), -1));
+    for (auto& names : params.analysis.rdfPairNames) {
+        RdfPair rdfPair {};
+        rdfPair.molTypeA = find_mol_type(names.first, molTemplateList);
+        rdfPair.molTypeB = find_mol_type(names.second, molTemplateList);
+        // on a sphere too, the area within a straight distance r of a point is pi r^2
+        rdfPair.is2D = molTemplateList[rdfPair.molTypeA].D.z == 0 && molTemplateList[rdfPair.molTypeB].D.z == 0;
+        rdfPair.pairCounts.assign(rdfBins, 0);
+        rdfPairIndex[rdfPair.molTypeA][rdfPair.molTypeB] = rdfPairList.size();
+        rdfPairIndex[rdfPair.molTypeB][rdfPair.molTypeA] = rdfPairList.size();
+        rdfPairList.push_back(rdfPair);
+    }
+
+    // every pair closer than the smallest cell width is in the same or neighboring cells. the SurfaceGrid only
+    // guarantees that for rMaxLimit
+    double cellReach { simulVolume.surfaceGrid.isActive ? params.rMaxLimit
+                                                         : std::min(simulVolume.subCellSize.x, simulVolume.subCellSize.y) };
+    if (membraneObject.waterBox.z > 0 && !simulVolume.surfaceGrid.isActive)
+        cellReach = std::min(cellReach, simulVolume.subCellSize.z);
+    // past half a periodic side, pairs are only counted at their nearest image
+    for (int axis { 0 }; axis < 3; ++axis) {
+        if (membraneObject.isPeriodic[axis])
+            cellReach = std::min(cellReach, axis_of(membraneObject.waterBox, axis) / 2.0);
+    }
+    rdfMax = params.analysis.rdfMax > 0 ? params.analysis.rdfMax : cellReach;
+    if (!rdfPairList.empty() && rdfMax > cellReach) {
+        log << "WARNING: analysisRdfMax is larger than the cell lists can reach, using " << cellReach << " nm.\n";
+        rdfMax = cellReach;
+    }
+
+    if (densityBins > 0)
+        densityCounts.assign(molTemplateList.size(), std::vector<double>(densityBins * densityBins, 0));
+}
+
+void InSituAnalysis::sample(const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+    const SimulVolume& simulVolume, const Membrane& membraneObject)
+{
+    ++numSamples;
+
+    // complex sizes, without the implicit lipids
+    for (auto& oneCom : complexList) {
+        if (oneCom.isEmpty)
+            continue;
+        int size { 0 };
+        for (auto molItr : oneCom.memberList) {
+            if (!moleculeList[molItr].isImplicitLipid)
+                ++size;
+        }
+        if (size == 0)
+            continue;
+        if (size >= int(complexSizeCounts.size()))
+            complexSizeCounts.resize(size + 1, 0);
+        complexSizeCounts[size] += 1;
+        sumNumMolecules += size;
+    }
+
+    if (!rdfPairList.empty()) {
+        std::vector<int> numEachMolType(rdfPairIndex.size(), 0);
+        for (auto& mol : moleculeList) {
+            if (!mol.isEmpty && !mol.isImplicitLipid)
+                ++numEachMolType[mol.molTypeIndex];
+        }
+        double volume { system_volume(membraneObject) };
+        double area { membrane_area(membraneObject) };
+        for (auto& rdfPair : rdfPairList) {
+            double numPairs { rdfPair.molTypeA == rdfPair.molTypeB
+                    ? 0.5 * numEachMolType[rdfPair.molTypeA] * (numEachMolType[rdfPair.molTypeA] - 1)
+                    : 1.0 * numEachMolType[rdfPair.molTypeA] * numEachMolType[rdfPair.molTypeB] };
+            rdfPair.sumPairDensity += numPairs / (rdfPair.is2D ? area : volume);
+        }
+
+        // each pair of cells is visited once, as in the pair search of the time loop
+        double binWidth { rdfMax / rdfBins };
+        auto add_pair = [&](int molIndex, int partIndex) {
+            int rdfIndex { rdfPairIndex[moleculeList[molIndex].molTypeIndex][moleculeList[partIndex].molTypeIndex] };
+            if (rdfIndex < 0)
+                return;
+            const Coord& molCoord = moleculeList[molIndex].comCoord;
+            const Coord& partCoord = moleculeList[partIndex].comCoord;
+            double dx { molCoord.x - partCoord.x };
+            double dy { molCoord.y - partCoord.y };
+            double dz { molCoord.z - partCoord.z };
+            minimum_image(dx, dy, dz, membraneObject);
+            double dist { sqrt(dx * dx + dy * dy + dz * dz) };
+            if (dist < rdfMax)
+                rdfPairList[rdfIndex].pairCounts[int(dist / binWidth)] += 1;
+        };
+        for (auto& subCell : simulVolume.subCellList) {
+            const std::vector<int>& memberMolList = subCell.memberMolList;
+            for (unsigned memItr { 0 }; memItr < memberMolList.size(); ++memItr) {
+                for (unsigned partItr { memItr + 1 }; partItr < memberMolList.size(); ++partItr)
+                    add_pair(memberMolList[memItr], memberMolList[partItr]);
+                for (auto neighCell : subCell.neighborList) {
+                    for (auto partIndex : simulVolume.subCellList[neighCell].memberMolList)
+                        add_pair(memberMolList[memItr], partIndex);
+                }
+            }
+        }
+    }
+
+    if (densityBins > 0) {
+        for (auto& mol : moleculeList) {
+            if (mol.isEmpty || mol.isImplicitLipid || complexList[mol.myComIndex].D.z >= 1E-8)
+                continue;
+            double u { 0 };
+            double v { 0 };
+            if (membraneObject.isSphere) {
+                double centerDist { sqrt(mol.comCoord.x * mol.comCoord.x + mol.comCoord.y * mol.comCoord.y
+                    + mol.comCoord.z * mol.comCoord.z) };
+                if (centerDist <= 0)
+                    continue;
+                u = 0.5 * (mol.comCoord.z / centerDist + 1.0);
+                v = (atan2(mol.comCoord.y, mol.comCoord.x) + M_PI) / (2.0 * M_PI);
+            } else {
+                u = mol.comCoord.x / membraneObject.waterBox.x + 0.5;
+                v = mol.comCoord.y / membraneObject.waterBox.y + 0.5;
+            }
+            int uBin { std::max(0, std::min(densityBins - 1, int(u * densityBins))) };
+            int vBin { std::max(0, std::min(densityBins - 1, int(v * densityBins))) };
+            densityCounts[mol.molTypeIndex][uBin * densityBins + vBin] += 1;
+        }
+    }
+}
+
+void InSituAnalysis::write(const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject) const
+{
+    if (numSamples == 0)
+        return;
+
+    std::ofstream sizeFile { sizeFileName };
+    sizeFile << "# samples: " << numSamples << '\n';
+    sizeFile << "# size mean_number_of_complexes fraction_of_molecules\n";
+    for (unsigned size { 1 }; size < complexSizeCounts.size(); ++size) {
+        if (complexSizeCounts[size] > 0)
+            sizeFile << size << ' ' << complexSizeCounts[size] / numSamples << ' '
+                     << size * complexSizeCounts[size] / sumNumMolecules << '\n';
+    }
+
+    if (!rdfPairList.empty()) {
+        std::ofstream rdfFile { rdfFileName };
+        rdfFile << "# samples: " << numSamples << '\n';
+        rdfFile << "# r(nm)";
+        for (auto& rdfPair : rdfPairList)
+            rdfFile << " g_" << molTemplateList[rdfPair.molTypeA].molName << '-'
+                    << molTemplateList[rdfPair.molTypeB].molName;
+        rdfFile << '\n';
+        double binWidth { rdfMax / rdfBins };
+        for (int bin { 0 }; bin < rdfBins; ++bin) {
+            double shellVolume { 4.0 / 3.0 * M_PI * (pow((bin + 1) * binWidth, 3) - pow(bin * binWidth, 3)) };
+            double annulusArea { M_PI * (pow((bin + 1) * binWidth, 2) - pow(bin * binWidth, 2)) };
+            rdfFile << (bin + 0.5) * binWidth;
+            for (auto& rdfPair : rdfPairList) {
+                double idealCount { rdfPair.sumPairDensity * (rdfPair.is2D ? annulusArea : shellVolume) };
+                rdfFile << ' ' << (idealCount > 0 ? rdfPair.pairCounts[bin] / idealCount : 0.0);
+            }
+            rdfFile << '\n';
+        }
+    }
+
+    if (densityBins > 0) {
+        std::ofstream densityFile { densityFileName };
+        densityFile << "# samples: " << numSamples << '\n';
+        if (membraneObject.isSphere)
+            densityFile << "# molecule cos(theta) phi density(nm^-2)\n";
+        else
+            densityFile << "# molecule x(nm) y(nm) density(nm^-2)\n";
+        double binArea { density_bin_area(membraneObject, densityBins) };
+        for (unsigned molTypeItr { 0 }; molTypeItr < densityCounts.size(); ++molTypeItr) {
+            // types that were never on the membrane are left out
+            const std::vector<double>& counts = densityCounts[molTypeItr];
+            if (std::all_of(counts.begin(), counts.end(), [](double count) { return count == 0; }))
+                continue;
+            for (int uBin { 0 }; uBin < densityBins; ++uBin) {
+                for (int vBin { 0 }; vBin < densityBins; ++vBin) {
+                    double u { (uBin + 0.5) / densityBins };
+                    double v { (vBin + 0.5) / densityBins };
+                    if (membraneObject.isSphere) {
+                        u = 2.0 * u - 1.0;
+                        v = 2.0 * M_PI * v - M_PI;
+                    } else {
+                        u = (u - 0.5) * membraneObject.waterBox.x;
+                        v = (v - 0.5) * membraneObject.waterBox.y;
+                    }
+                    densityFile << molTemplateList[molTypeItr].molName << ' ' << u << ' ' << v << ' '
+                                << counts[uBin * densityBins + vBin] / (numSamples * binArea) << '\n';
+                }
+            }
+        }
+    }
+}
+
+void InSituAnalysis::write_state(std::ostream& restartFile) const
+{
+    if (!isActive)
+        return;
+
+    restartFile << "#InSituAnalysis\n";
+    restartFile << "analysisWrite = " << settings.write << '\n';
+    if (!settings.rdfPairNames.empty()) {
+        restartFile << "analysisRdfPairs = ";
+        for (unsigned pairItr { 0 }; pairItr < settings.rdfPairNames.size(); ++pairItr)
+            restartFile << (pairItr > 0 ? "," : "[") << settings.rdfPairNames[pairItr].first << '-'
+                        << settings.rdfPairNames[pairItr].second;
+        restartFile << "]\n";
+    }
+    restartFile.unsetf(std::ios::floatfield);
+    restartFile.precision(17);
+    restartFile << "analysisRdfMax = " << settings.rdfMax << '\n';
+    restartFile << "analysisRdfBins = " << settings.rdfBins << '\n';
+    restartFile << "analysisDensityBins = " << settings.densityBins << '\n';
+
+    restartFile << "#samples\n";
+    restartFile << numSamples << ' ' << sumNumMolecules << '\n';
+    restartFile << complexSizeCounts.size();
+    for (auto count : complexSizeCounts)
+        restartFile << ' ' << count;
+    restartFile << '\n';
+    restartFile << rdfPairList.size() << ' ' << rdfBins << ' ' << rdfMax << '\n';
+    for (auto& rdfPair : rdfPairList) {
+        restartFile << rdfPair.molTypeA << ' ' << rdfPair.molTypeB << ' ' << rdfPair.sumPairDensity;
+        for (auto count : rdfPair.pairCounts)
+            restartFile << ' ' << count;
+        restartFile << '\n';
+    }
+    restartFile << densityCounts.size() << ' ' << densityBins << '\n';
+    for (auto& counts : densityCounts) {
+        for (unsigned binItr { 0 }; binItr < counts.size(); ++binItr)
+            restartFile << (binItr > 0 ? " " : "") << counts[binItr];
+        restartFile << '\n';
+    }
+}
+
+void InSituAnalysis::read_state(std::istream& restartFile, Parameters& params, std::string& savedState, std::ostream& log)
+{
+    savedState.clear();
+    std::string line {};
+    restartFile >> std::ws;
+    if (!std::getline(restartFile, line) || line.compare(0, 15, "#InSituAnalysis") != 0)
+        return;
+
+    log << "Reading the in-situ analysis from the restart file" << std::endl;
+    while (std::getline(restartFile, line) && line.compare(0, 8, "#samples") != 0) {
+        line.erase(
+            std::remove_if(line.begin(), line.end(), [](unsigned char x) { return std::isspace(x); }), line.end());
+        params.parse_paramLine(line, log);
+    }
+    std::ostringstream samples;
+    samples << restartFile.rdbuf();
+    savedState = samples.str();
+}
+
+void InSituAnalysis::resume(const std::string& savedState, std::ostream& log)
+{
+    if (!isActive || savedState.empty())
+        return;
+
+    // read into a copy, so nothing is added unless all of it matches
+    InSituAnalysis saved { *this };
+    std::istringstream stateText { savedState };
+    std::size_t numSizes { 0 };
+    stateText >> saved.numSamples >> saved.sumNumMolecules >> numSizes;
+    if (stateText && numSizes < (std::size_t(1) << 32)) {
+        saved.complexSizeCounts.assign(numSizes, 0);
+        for (auto& count : saved.complexSizeCounts)
+            stateText >> count;
+    }
+    std::size_t numRdfPairs { 0 };
+    int savedRdfBins { 0 };
+    double savedRdfMax { 0 };
+    stateText >> numRdfPairs >> savedRdfBins >> savedRdfMax;
+    bool isMatch { numRdfPairs == rdfPairList.size() && savedRdfBins == rdfBins && savedRdfMax == rdfMax };
+    for (auto& rdfPair : saved.rdfPairList) {
+        int savedTypeA { -1 };
+        int savedTypeB { -1 };
+        stateText >> savedTypeA >> savedTypeB >> rdfPair.sumPairDensity;
+        isMatch = isMatch && savedTypeA == rdfPair.molTypeA && savedTypeB == rdfPair.molTypeB;
+        for (auto& count : rdfPair.pairCounts)
+            stateText >> count;
+    }
+    std::size_t numDensityTypes { 0 };
+    int savedDensityBins { 0 };
+    stateText >> numDensityTypes >> savedDensityBins;
+    isMatch = isMatch && numDensityTypes == densityCounts.size() && savedDensityBins == densityBins;
+    for (auto& counts : saved.densityCounts) {
+        for (auto& count : counts)
+            stateText >> count;
+    }
+
+    if (!stateText || !isMatch) {
+        log << "WARNING: The in-situ analysis settings changed since the restart file, its samples are dropped.\n";
+        return;
+    }
+    *this = saved;
+    log << "Resuming the in-situ analysis from " << numSamples << " samples" << std::endl;
+}
@@ -17,12 +17,6 @@
 #include <iostream>
 
 /* INTERFACE */
-// Static Variables
-int Interface::State::totalNumOfStates = 0;
-std::vector<int> MolTemplate::absToRelIface {};
-unsigned MolTemplate::numMolTypes = 0;
-std::vector<int> MolTemplate::numEachMolType {};
-
 // Constructors
 Interface::State::State(int index)
     : index(index)
@@ -85,48 +79,48 @@ MolTemplate::MolTemplate(Coord& comCoord, std::vector<Interface>& Interfaces)
 }
 
 // Functions
-void MolTemplate::display() const
+void MolTemplate::display(std::ostream& os) const
 {
-    std::cout << "Molecule template " << molTypeIndex << '\n';
-    std::cout << "Name: " << molName << '\n';
-    std::cout << "Copy number:" << copies << '\n';
-    std::cout <<" Diffusion trans: "<<D.x <<' '<<D.y<<' '<<D.z<<'\n';
-    std::cout <<" Diffusion Rot: "<<Dr.x <<' '<<Dr.y<<' '<<Dr.z<<'\n';
+    os << "Molecule template " << molTypeIndex << '\n';
+    os << "Name: " << molName << '\n';
+    os << "Copy number:" << copies << '\n';
+    os <<" Diffusion trans: "<<D.x <<' '<<D.y<<' '<<D.z<<'\n';
+    os <<" Diffusion Rot: "<<Dr.x <<' '<<Dr.y<<' '<<Dr.z<<'\n';
     
     if (isLipid) {
         if (isImplicitLipid)
-            std::cout << "Is a implicitLipid: " << std::boolalpha << isImplicitLipid << '\n';
+            os << "Is a implicitLipid: " << std::boolalpha << isImplicitLipid << '\n';
         else
-            std::cout << "Is a lipid: " << std::boolalpha << isLipid << '\n';
+            os << "Is a lipid: " << std::boolalpha << isLipid << '\n';
     }
-    std::cout << "Is a rod: " << std::boolalpha << isRod << '\n';
-    std::cout << "Is a point: " << std::boolalpha << isPoint << '\n';
-    std::cout << "Radius: " << radius << '\n';
-    std::cout << "\nInterfaces:\n";
+    os << "Is a rod: " << std::boolalpha << isRod << '\n';
+    os << "Is a point: " << std::boolalpha << isPoint << '\n';
+    os << "Radius: " << radius << '\n';
+    os << "\nInterfaces:\n";
     for (auto& iface : interfaceList) {
         if (iface.stateList.size() == 1) {
-            std::cout << "Name: " << iface.name << '\n';
-            std::cout << "Relative index: " << iface.index << '\n';
-            std::cout << "Absolute index: " << iface.stateList[0].index << '\n';
+            os << "Name: " << iface.name << '\n';
+            os << "Relative index: " << iface.index << '\n';
+            os << "Absolute index: " << iface.stateList[0].index << '\n';
             if (!iface.stateList[0].myForwardRxns.empty()) {
-                std::cout << "Forward Reactions: ";
+                os << "Forward Reactions: ";
                 for (auto& rxn : iface.stateList[0].myForwardRxns)
-                    std::cout << " (" << rxn << ")";
-                std::cout << '\n';
+                    os << " (" << rxn << ")";
+                os << '\n';
             }
             if (!iface.stateList[0].myCreateDestructRxns.empty()) {
-                std::cout << "Creation/Destruction Reactions: ";
+                os << "Creation/Destruction Reactions: ";
                 for (auto& rxn : iface.stateList[0].myCreateDestructRxns)
-                    std::cout << " (" << rxn << ")";
-                std::cout << '\n';
+                    os << " (" << rxn << ")";
+                os << '\n';
             }
-            std::cout << '\n';
+            os << '\n';
         } else {
-            std::cout << "Name: " << iface.name << '\n';
-            std::cout << "Relative index: " << iface.index << '\n';
-            std::cout << "States:" << '\n';
+            os << "Name: " << iface.name << '\n';
+            os << "Relative index: " << iface.index << '\n';
+            os << "States:" << '\n';
             for (auto& state : iface.stateList) {
-                std::cout << ""
+                os << ""
                           << "(identity: " << state.iden << ", absolute index: " << state.index << ")\n";
                 //                if (!state.myForwardRxns.empty()) {
                 //                    std::cout << "Forward Reactions: ";
@@ -146,21 +140,21 @@ void MolTemplate::display() const
                 //                        for (auto& rxn : iface.stateList[0].myCreateDestructRxns)
                 //                    std::cout << '\n';
                 //                }
-                std::cout << '\n';
+                os << '\n';
             }
         }
     }
 }
 
-void MolTemplate::display(const std::string& name) const
+void MolTemplate::display(std::ostream& os, const std::string& name) const
 {
-    std::cout << "MolTemplate " << name << ':' << '\n';
-    std::cout << "Rod? " << std::boolalpha << isRod << '\n';
-    std::cout << "Radius: " << radius << '\n';
-    std::cout << comCoord << '\n';
+    os << "MolTemplate " << name << ':' << '\n';
+    os << "Rod? " << std::boolalpha << isRod << '\n';
+    os << "Radius: " << radius << '\n';
+    os << comCoord << '\n';
     for (auto& iface : interfaceList)
-        std::cout << iface.iCoord << '\n';
-    std::cout << '\n';
+        os << iface.iCoord << '\n';
+    os << '\n';
 }
 
 int MolTemplate::find_relIndex_from_absIndex(int targStateIndex) const
@@ -198,7 +192,7 @@ int MolTemplate::find_absIndex_from_relIndex(int relIndex, char state) const
     exit(1);
 }
 
-void MolTemplate::set_value(std::string& line, MolKeyword molKeyword)
+void MolTemplate::set_value(std::string& line, MolKeyword molKeyword, std::ostream& log)
 {
     /*! \ingroup Parser
      * \brief sets the value of a MolTemplate's variable based on the keyword parsed from the parameter input file
@@ -220,27 +214,27 @@ void MolTemplate::set_value(std::string& line, MolKeyword molKeyword)
     }
     case 3: {
         isLipid = read_boolean(line);
-        std::cout << "Read in isLipid: " << std::boolalpha << isLipid << std::endl;
+        log << "Read in isLipid: " << std::boolalpha << isLipid << std::endl;
         break;
     }
     case 4: {
         D = Coord(parse_input_array(line));
-        std::cout << "Read in D: [" << D.x << "um^2s^-1, " << D.y << "um^2s^-1, " << D.z << "um^2s^-1]" << std::endl;
+        log << "Read in D: [" << D.x << "um^2s^-1, " << D.y << "um^2s^-1, " << D.z << "um^2s^-1]" << std::endl;
         break;
     }
     case 5: {
         Dr = Coord(parse_input_array(line));
-        std::cout << "Read in Dr: [" << Dr.x << "rad^2s^-1, " << Dr.y << "rad^2s^-1, " << Dr.z << "rad^2s^-1]" << std::endl;
+        log << "Read in Dr: [" << Dr.x << "rad^2s^-1, " << Dr.y << "rad^2s^-1, " << Dr.z << "rad^2s^-1]" << std::endl;
         break;
     }
     case 8: {
         mass = std::stod(line);
-        std::cout << "Read in mass: " << std::boolalpha << mass << std::endl;
+        log << "Read in mass: " << std::boolalpha << mass << std::endl;
         break;
     }
     case 9: {
         checkOverlap = read_boolean(line);
-        std::cout << "Read in checkOverlap: " << std::boolalpha << checkOverlap << std::endl;
+        log << "Read in checkOverlap: " << std::boolalpha << checkOverlap << std::endl;
         break;
     }
     case 11: {
@@ -252,11 +246,11 @@ void MolTemplate::set_value(std::string& line, MolKeyword molKeyword)
         if (isImplicitLipid == true) {
             isLipid = true;
         }
-        std::cout << "Read in isImplicitLipid: " << std::boolalpha << isImplicitLipid << std::endl;
+        log << "Read in isImplicitLipid: " << std::boolalpha << isImplicitLipid << std::endl;
         break;
     }
     default: {
-        std::cout << "Keyword [BLANK] is not a valid keyword, ignoring." << '\n';
+        log << "Keyword [BLANK] is not a valid keyword, ignoring." << '\n';
     }
     }
 }
@@ -10,6 +10,7 @@
  * ***
  */
 
+#include "boundary_conditions/reflect_functions.hpp"
 #include "classes/class_Molecule_Complex.hpp"
 #include "classes/class_Rxns.hpp"
 #include "classes/class_bngl_parser.hpp"
@@ -23,16 +24,6 @@
 #include <iomanip>
 #include <numeric>
 
-int Molecule::numberOfMolecules = 0;
-int Complex::numberOfComplexes = 0;
-int Complex::currNumberComTypes = 0;
-int Complex::currNumberMolTypes = 0;
-std::vector<int> Complex::emptyComList {};
-std::vector<int> Molecule::emptyMolList {};
-std::vector<int> Complex::obs {};
-
-int propCalled = 0;
-
 bool skipLine(std::string line)
 {
     // check if the line is a comment or empty. I can't get regex to work with this in particular, without also
@@ -40,7 +31,7 @@ bool skipLine(std::string line)
     return line.empty() || line[0] == '#';
 }
 
-Complex::Complex(const Molecule& mol, const MolTemplate& oneTemp)
+Complex::Complex(const Molecule& mol, const MolTemplate& oneTemp, unsigned numMolTypes)
     : comCoord(mol.comCoord)
     , D(oneTemp.D)
     , Dr(oneTemp.Dr)
@@ -51,11 +42,11 @@ Complex::Complex(const Molecule& mol, const MolTemplate& oneTemp)
     index = mol.index;
     radius = oneTemp.radius;
     // Will elements of this array below be initialized to zero??
-    numEachMol = std::vector<int>(MolTemplate::numMolTypes);
+    numEachMol = std::vector<int>(numMolTypes);
     ++numEachMol[oneTemp.molTypeIndex];
 }
 
-Complex::Complex(int _index, const Molecule& _memMol, const MolTemplate& _molTemp)
+Complex::Complex(int _index, const Molecule& _memMol, const MolTemplate& _molTemp, unsigned numMolTypes)
     : comCoord(_memMol.comCoord)
     , D(_molTemp.D)
     , Dr(_molTemp.Dr)
@@ -66,7 +57,7 @@ Complex::Complex(int _index, const Molecule& _memMol, const MolTemplate& _molTem
     index = _index;
     radius = _molTemp.radius;
     // Will elements of this array below be initialized to zero??
-    numEachMol = std::vector<int>(MolTemplate::numMolTypes);
+    numEachMol = std::vector<int>(numMolTypes);
     ++numEachMol[_molTemp.molTypeIndex];
 }
 
@@ -121,76 +112,76 @@ void Molecule::Iface::change_state(int newRelIndex, int newAbsIndex, char newIde
 }
 
 /* MOLECULE */
-void Molecule::display(const MolTemplate& molTemplate) const
+void Molecule::display(std::ostream& os, const MolTemplate& molTemplate) const
 {
-    std::cout << "Index: " << index << '\n';
-    std::cout << "Is empty: " << std::boolalpha << isEmpty << '\n';
+    os << "Index: " << index << '\n';
+    os << "Is empty: " << std::boolalpha << isEmpty << '\n';
     if (!isEmpty) {
-        std::cout << "Type: " << molTemplate.molName << '\n';
-        std::cout << "Parent complex index: " << myComIndex << '\n';
-        std::cout << "Sub volume index: " << mySubVolIndex << '\n';
-        std::cout << "Is a lipid: " << std::boolalpha << isLipid << '\n';
-        std::cout << "Center of mass coordinate: " << comCoord << '\n';
-        std::cout << "Interfaces:\n";
+        os << "Type: " << molTemplate.molName << '\n';
+        os << "Parent complex index: " << myComIndex << '\n';
+        os << "Sub volume index: " << mySubVolIndex << '\n';
+        os << "Is a lipid: " << std::boolalpha << isLipid << '\n';
+        os << "Center of mass coordinate: " << comCoord << '\n';
+        os << "Interfaces:\n";
         for (const auto& iface : interfaceList) {
-            std::cout << "\t---\n";
-            std::cout << "\tRelative index: " << iface.relIndex << '\n';
-            std::cout << "\tAbsolute index: " << iface.index << '\n';
-            std::cout << "\tInterface name: "
+            os << "\t---\n";
+            os << "\tRelative index: " << iface.relIndex << '\n';
+            os << "\tAbsolute index: " << iface.index << '\n';
+            os << "\tInterface name: "
                       << molTemplate.interfaceList[iface.relIndex].name << '\n';
-            std::cout << "\tCoordinate: " << iface.coord << '\n';
+            os << "\tCoordinate: " << iface.coord << '\n';
             if (iface.stateIden != '\0')
-                std::cout << "\tCurrent state: " << iface.stateIden << '\n';
+                os << "\tCurrent state: " << iface.stateIden << '\n';
             if (iface.isBound) {
-                std::cout << "\tInteraction:\n";
-                std::cout << "\t\tPartner index: " << iface.interaction.partnerIndex << '\n';
-                std::cout << "\t\tPartner interface index " << iface.interaction.partnerIfaceIndex << '\n';
+                os << "\tInteraction:\n";
+                os << "\t\tPartner index: " << iface.interaction.partnerIndex << '\n';
+                os << "\t\tPartner interface index " << iface.interaction.partnerIfaceIndex << '\n';
             }
         }
     }
 }
-void Molecule::display_all() const
+void Molecule::display_all(std::ostream& os) const
 {
-    std::cout << "Index: " << index << '\n';
-    std::cout << "Is empty: " << std::boolalpha << isEmpty << '\n';
+    os << "Index: " << index << '\n';
+    os << "Is empty: " << std::boolalpha << isEmpty << '\n';
     if (!isEmpty) {
 
-        std::cout << "Parent complex index: " << myComIndex << '\n';
-        std::cout << "Sub volume index: " << mySubVolIndex << '\n';
-        std::cout << "Is a lipid: " << std::boolalpha << isLipid << '\n';
-        std::cout << "Center of mass coordinate: " << comCoord << '\n';
-        std::cout << "Interfaces:\n";
+        os << "Parent complex index: " << myComIndex << '\n';
+        os << "Sub volume index: " << mySubVolIndex << '\n';
+        os << "Is a lipid: " << std::boolalpha << isLipid << '\n';
+        os << "Center of mass coordinate: " << comCoord << '\n';
+        os << "Interfaces:\n";
         for (const auto& iface : interfaceList) {
-            std::cout << "\t---\n";
-            std::cout << "\tRelative index: " << iface.relIndex << '\n';
-            std::cout << "\tAbsolute index: " << iface.index << '\n';
+            os << "\t---\n";
+            os << "\tRelative index: " << iface.relIndex << '\n';
+            os << "\tAbsolute index: " << iface.index << '\n';
 
-            std::cout << "\tCoordinate: " << iface.coord << '\n';
+            os << "\tCoordinate: " << iface.coord << '\n';
             if (iface.stateIden != '\0')
-                std::cout << "\tCurrent state: " << iface.stateIden << '\n';
+                os << "\tCurrent state: " << iface.stateIden << '\n';
             if (iface.isBound) {
-                std::cout << "\tInteraction:\n";
-                std::cout << "\t\tPartner index: " << iface.interaction.partnerIndex << '\n';
-                std::cout << "\t\tPartner interface index " << iface.interaction.partnerIfaceIndex << '\n';
+                os << "\tInteraction:\n";
+                os << "\t\tPartner index: " << iface.interaction.partnerIndex << '\n';
+                os << "\t\tPartner interface index " << iface.interaction.partnerIfaceIndex << '\n';
             }
         }
     }
 }
 
-void Molecule::display_assoc_icoords(const std::string& name)
+void Molecule::display_assoc_icoords(std::ostream& os, const std::string& name)
 {
-    std::cout << name << ':' << std::endl;
-    std::cout << std::setw(8) << std::setprecision(12) << std::right << tmpComCoord << std::endl;
+    os << name << ':' << std::endl;
+    os << std::setw(8) << std::setprecision(12) << std::right << tmpComCoord << std::endl;
     for (auto& icoord : tmpICoords)
-        std::cout << std::setw(8) << std::setprecision(12) << std::right << icoord << std::endl;
-    std::cout << std::endl;
+        os << std::setw(8) << std::setprecision(12) << std::right << icoord << std::endl;
+    os << std::endl;
 }
-void Molecule::display_my_coords(const std::string& name)
+void Molecule::display_my_coords(std::ostream& os, const std::string& name)
 {
-    std::cout << name << ':' << std::endl;
-    std::cout << comCoord << '\n';
+    os << name << ':' << std::endl;
+    os << comCoord << '\n';
     for (const auto& iface : interfaceList) {
-        std::cout << iface.coord << '\n';
+        os << iface.coord << '\n';
     }
 }
 
@@ -221,7 +212,7 @@ void Molecule::clear_tmp_association_coords()
     tmpICoords.erase(tmpICoords.begin(), tmpICoords.end());
 }
 
-void Molecule::destroy()
+void Molecule::destroy(SimulContext& context)
 {
     /*! \ingroup Reactions
      * \brief Destroys the parent Molecule.
@@ -230,10 +221,10 @@ void Molecule::destroy()
      */
 
     // add to the list of empty Molecules
-    Molecule::emptyMolList.push_back(index);
+    context.emptyMolList.push_back(index);
 
     // keep track of molecule types
-    --MolTemplate::numEachMolType[molTypeIndex];
+    --context.numEachMolType[molTypeIndex];
 
     myComIndex = -1;
     molTypeIndex = -1;
@@ -242,6 +233,7 @@ void Molecule::destroy()
 
     // clear coordinates
     comCoord.zero_crds();
+    imageOffset.zero_crds();
     interfaceList.clear();
 
     // clear association lists
@@ -252,13 +244,13 @@ void Molecule::destroy()
     interfaceList.clear();
 
     // iterate the total number of molecules
-    --numberOfMolecules;
+    --context.numberOfMolecules;
 
     // set to void
     isEmpty = true;
 }
 
-void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membrane& membraneObject)
+void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membrane& membraneObject, gsl_rng* r)
 {
     /*!
      * \brief Create random coordinates for a Molecule
@@ -267,9 +259,9 @@ void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membra
     if (membraneObject.isSphere) {
         double R = membraneObject.sphereR;
 
-        comCoord.x = (membraneObject.sphereR * 2 * rand_gsl() - (membraneObject.sphereR));
-        comCoord.y = (membraneObject.sphereR * 2 * rand_gsl() - (membraneObject.sphereR));
-        comCoord.z = (membraneObject.sphereR * 2 * rand_gsl() - (membraneObject.sphereR));
+        comCoord.x = (membraneObject.sphereR * 2 * rand_gsl(r) - (membraneObject.sphereR));
+        comCoord.y = (membraneObject.sphereR * 2 * rand_gsl(r) - (membraneObject.sphereR));
+        comCoord.z = (membraneObject.sphereR * 2 * rand_gsl(r) - (membraneObject.sphereR));
 
         bool outOfBox { false }; // TODO: commented out for testing purposes only
         // if the molecule is a lipid, place it along the bottom of the box and don't give it a rotation
@@ -321,7 +313,7 @@ void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membra
 
             // set interface coordinates, with a random rotation on the entire molecule
             // TODO: Commented this out for testing against old version
-            Quat rotQuat { rand_gsl() * 2 - 1, rand_gsl() * 2 - 1, rand_gsl() * 2 - 1, rand_gsl() * 2 - 1 };
+            Quat rotQuat { rand_gsl(r) * 2 - 1, rand_gsl(r) * 2 - 1, rand_gsl(r) * 2 - 1, rand_gsl(r) * 2 - 1 };
             rotQuat = rotQuat.unit();
             for (unsigned int ifaceItr { 0 }; ifaceItr < molTemplate.interfaceList.size(); ++ifaceItr) {
                 Vector ifaceVec { Coord { comCoord + molTemplate.interfaceList[ifaceItr].iCoord } - comCoord };
@@ -346,11 +338,11 @@ void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membra
 
         // TODO: Commented out for testing
         if (outOfBox)
-            this->create_random_coords(molTemplate, membraneObject);
+            this->create_random_coords(molTemplate, membraneObject, r);
 
     } else {
-        comCoord.x = (membraneObject.waterBox.x * rand_gsl()) - (membraneObject.waterBox.x / 2.0);
-        comCoord.y = (membraneObject.waterBox.y * rand_gsl()) - (membraneObject.waterBox.y / 2.0);
+        comCoord.x = (membraneObject.waterBox.x * rand_gsl(r)) - (membraneObject.waterBox.x / 2.0);
+        comCoord.y = (membraneObject.waterBox.y * rand_gsl(r)) - (membraneObject.waterBox.y / 2.0);
 
         bool outOfBox { false }; // TODO: commented out for testing purposes only
         // if the molecule is a lipid, place it along the bottom of the box and don't give it a rotation
@@ -378,11 +370,11 @@ void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membra
                 interfaceList[ifaceItr].molTypeIndex = molTemplate.molTypeIndex;
             }
         } else {
-            comCoord.z = (membraneObject.waterBox.z * rand_gsl()) - (membraneObject.waterBox.z / 2.0);
+            comCoord.z = (membraneObject.waterBox.z * rand_gsl(r)) - (membraneObject.waterBox.z / 2.0);
 
             // set interface coordinates, with a random rotation on the entire molecule
             // TODO: Commented this out for testing against old version
-            Quat rotQuat { rand_gsl() * 2 - 1, rand_gsl() * 2 - 1, rand_gsl() * 2 - 1, rand_gsl() * 2 - 1 };
+            Quat rotQuat { rand_gsl(r) * 2 - 1, rand_gsl(r) * 2 - 1, rand_gsl(r) * 2 - 1, rand_gsl(r) * 2 - 1 };
             rotQuat = rotQuat.unit();
             for (unsigned int ifaceItr { 0 }; ifaceItr < molTemplate.interfaceList.size(); ++ifaceItr) {
                 Vector ifaceVec { Coord { comCoord + molTemplate.interfaceList[ifaceItr].iCoord } - comCoord };
@@ -405,7 +397,7 @@ void Molecule::create_random_coords(const MolTemplate& molTemplate, const Membra
 
         // TODO: Commented out for testing
         if (outOfBox)
-            this->create_random_coords(molTemplate, membraneObject);
+            this->create_random_coords(molTemplate, membraneObject, r);
     }
 }
 
@@ -619,33 +611,32 @@ void Complex::update_properties(
         ++numEachMol[moleculeList[memMol].molTypeIndex];
 }
 
-void Complex::display()
+void Complex::display(std::ostream& os)
 {
-    std::cout << "Comcoords: " << comCoord << std::endl;
-    std::cout << "Member list:";
+    os << "Comcoords: " << comCoord << std::endl;
+    os << "Member list:";
     for (auto& mp : memberList)
-        std::cout << ' ' << mp;
-    std::cout << std::endl;
-    std::cout << "D: " << D << '\n';
-    std::cout << "Dr: " << Dr << '\n';
-    std::cout << std::endl;
+        os << ' ' << mp;
+    os << std::endl;
+    os << "D: " << D << '\n';
+    os << "Dr: " << Dr << '\n';
+    os << std::endl;
 }
 
-void Complex::display(const std::string& name)
+void Complex::display(std::ostream& os, const std::string& name)
 {
-    std::cout << name << std::endl;
-    std::cout << "Comcoords: " << comCoord << std::endl;
-    std::cout << "Member list:";
+    os << name << std::endl;
+    os << "Comcoords: " << comCoord << std::endl;
+    os << "Member list:";
     for (auto& mp : memberList)
-        std::cout << ' ' << mp;
-    std::cout << std::endl;
-    std::cout << "D: " << D << '\n';
-    std::cout << "Dr: " << Dr << '\n';
-    std::cout << std::endl;
+        os << ' ' << mp;
+    os << std::endl;
+    os << "D: " << D << '\n';
+    os << "Dr: " << Dr << '\n';
+    os << std::endl;
 }
 
-void Complex::destroy(
-    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList)
+void Complex::destroy(std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, SimulContext& context)
 {
     /*! \ingroup Reactions
      * \brief This function destroys its parent Complex.
@@ -656,7 +647,7 @@ void Complex::destroy(
      */
 
     // add to the empty complex list
-    Complex::emptyComList.push_back(index);
+    context.emptyComList.push_back(index);
 
     // zero all the coordinates and diffusion coefficients
     comCoord.zero_crds();
@@ -664,22 +655,25 @@ void Complex::destroy(
     Dr.zero_crds();
 
     for (auto& memMol : memberList)
-        moleculeList[memMol].destroy();
+        moleculeList[memMol].destroy(context);
 
     memberList.clear();
     numEachMol.clear();
     isEmpty = true;
+    isDormant = false;
+    numDormantSteps = 0;
+    stepMultiple = 1;
 
     // iterate down the number of complexes in the system.
     trajStatus = TrajStatus::empty;
-    --Complex::numberOfComplexes;
+    --context.numberOfComplexes;
 }
 
 void Complex::put_back_into_SimulVolume(
-    int& itr, Molecule& errantMol, const Membrane& membraneObject, std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList)
+    int& itr, Molecule& errantMol, const Membrane& membraneObject, std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList, std::ostream& log)
 {
-    std::cout << "Attempting to put complex " << index << " back into simulation volume...\n";
-    display();
+    log << "Attempting to put complex " << index << " back into simulation volume...\n";
+    display(log);
 
     Vector transVec { 0, 0, 0 };
 
@@ -716,7 +710,7 @@ void Complex::put_back_into_SimulVolume(
 
     ++itr;
     if (itr == 1000) {
-        std::cout << "Cannot fit complex " << index << " into simulation volume. Exiting...\n";
+        std::cerr << "Cannot fit complex " << index << " into simulation volume. Exiting...\n";
         exit(1);
     }
 }
@@ -768,12 +762,51 @@ void Complex::put_back_into_SimulVolume(
 //     trajRot.zero_crds();
 // }
 
-void Complex::propagate(std::vector<Molecule>& moleculeList, const Membrane membraneObject, const std::vector<MolTemplate>& molTemplateList)
+void TrajRotation::set(const Coord& _angles)
+{
+    angles = _angles;
+
+    // Create the quaternion
+    double cosZ { cos(angles.z * 0.5) };
+    double sinZ { sin(angles.z * 0.5) };
+    double cosY { cos(angles.y * 0.5) };
+    double sinY { sin(angles.y * 0.5) };
+    double cosX { cos(angles.x * 0.5) };
+    double sinX { sin(angles.x * 0.5) };
+
+    quat.x = (sinX * cosY * cosZ) - (cosX * sinY * sinZ);
+    quat.y = (cosX * sinY * cosZ) + (sinX * cosY * sinZ);
+    quat.z = (cosX * cosY * sinZ) - (sinX * sinY * cosZ);
+    quat.w = (cosX * cosY * cosZ) + (sinX * sinY * sinZ);
+    quatInverse = quat.inverse();
+
+    M = create_euler_rotation_matrix(angles);
+    isSet = true;
+}
+
+void TrajRotation::rotate(Vector& vec) const
 {
-    ++propCalled;
+    Quat qv { 0, vec.x, vec.y, vec.z };
+    Quat qm { quat };
+    qm = qm * qv * quatInverse;
 
+    vec.x = qm.x;
+    vec.y = qm.y;
+    vec.z = qm.z;
+}
+
+const TrajRotation& Complex::traj_rotation()
+{
+    // compared exactly, so any resampling of trajRot builds a new rotation
+    if (!trajRotation.isSet || trajRotation.angles.x != trajRot.x || trajRotation.angles.y != trajRot.y
+        || trajRotation.angles.z != trajRot.z)
+        trajRotation.set(trajRot);
+    return trajRotation;
+}
+
+void Complex::propagate(std::vector<Molecule>& moleculeList, const Membrane& membraneObject, const std::vector<MolTemplate>& molTemplateList)
+{
     /*debug*/
-    //std::cout << "propCalled: " << propCalled << std::endl;
     //std::cout << "startComCoord: " << std::fixed << std::setprecision(20) << comCoord.x << " " << comCoord.y << " " << comCoord.z << std::endl;
     // std::cout << "trajTrans: " << std::setprecision(20) << trajTrans.x << " " << trajTrans.y << " " << trajTrans.z << std::endl;
     // std::cout << "trajRot: " << std::setprecision(20) << trajRot.x << " " << trajRot.y << " " << trajRot.z << " " << std::endl;
@@ -783,46 +816,32 @@ void Complex::propagate(std::vector<Molecule>& moleculeList, const Membrane memb
     if (membraneObject.isSphere && this->D.z < 1E-14) {
         Coord COM = comCoord;
         Coord COMnew = comCoord + trajTrans;
-        std::array<double, 9> Crdset = inner_coord_set(COM, COMnew);
-        std::array<double, 9> Crdsetnew = inner_coord_set_new(COM, COMnew);
-        // propagate the com of the complex
-        //comCoord += trajTrans;
         // get the rotation angle: dangle
         double Rotangle = trajRot.x; // we select the rotation angle x as the angle that the complex rotate on the sphere
+        // the translation from COM to COMnew and the rotation about the sphere normal, as one rotation about the center
+        std::array<double, 9> M = rotation_on_sphere(COM, COMnew, Rotangle).rotation_matrix();
         // update the member proteins
         for (auto mol : memberList) {
-            Coord targmol = moleculeList[mol].comCoord;
-            targmol = translate_on_sphere(targmol, COM, COMnew, Crdset, Crdsetnew);
-            moleculeList[mol].comCoord = rotate_on_sphere(targmol, COMnew, Crdsetnew, Rotangle);
+            Vector comVec { moleculeList[mol].comCoord - COM };
+            comVec = matrix_rotate(comVec, M);
+            moleculeList[mol].comCoord = Coord { comVec.x, comVec.y, comVec.z } + COMnew;
             moleculeList[mol].trajStatus = TrajStatus::propagated;
             // now update each interface of the molecule
             for (auto& iface : moleculeList[mol].interfaceList) {
-                Coord targiface = iface.coord;
-                targiface = translate_on_sphere(targiface, COM, COMnew, Crdset, Crdsetnew);
-                iface.coord = rotate_on_sphere(targiface, COMnew, Crdsetnew, Rotangle);
+                Vector ifaceVec { iface.coord - COM };
+                ifaceVec = matrix_rotate(ifaceVec, M);
+                iface.coord = Coord { ifaceVec.x, ifaceVec.y, ifaceVec.z } + COMnew;
             }
         }
         this->update_properties(moleculeList, molTemplateList);
     } else { // for the complex in solution or on box surface
-        // Create the quaternion
-        double cosZ { cos(trajRot.z * 0.5) };
-        double sinZ { sin(trajRot.z * 0.5) };
-        double cosY { cos(trajRot.y * 0.5) };
-        double sinY { sin(trajRot.y * 0.5) };
-        double cosX { cos(trajRot.x * 0.5) };
-        double sinX { sin(trajRot.x * 0.5) };
-
-        Quat rotQuat {};
-        rotQuat.x = (sinX * cosY * cosZ) - (cosX * sinY * sinZ);
-        rotQuat.y = (cosX * sinY * cosZ) + (sinX * cosY * sinZ);
-        rotQuat.z = (cosX * cosY * sinZ) - (sinX * sinY * cosZ);
-        rotQuat.w = (cosX * cosY * cosZ) + (sinX * sinY * sinZ);
-        rotQuat.unit();
+        // the quaternion, usually already built when the trial move was reflected
+        const TrajRotation& rotation { traj_rotation() };
 
         // update the member proteins
         for (auto mol : memberList) {
             Vector comVec { moleculeList[mol].comCoord - this->comCoord };
-            rotQuat.rotate(comVec);
+            rotation.rotate(comVec);
             moleculeList[mol].comCoord = Coord { comVec.x, comVec.y, comVec.z } + this->comCoord + trajTrans;
 
             // now rotate each member molecule of the complex
@@ -830,7 +849,7 @@ void Complex::propagate(std::vector<Molecule>& moleculeList, const Membrane memb
                 // get the vector from the interface to the target interface
                 Vector ifaceVec { iface.coord - comCoord };
                 // rotate
-                rotQuat.rotate(ifaceVec);
+                rotation.rotate(ifaceVec);
                 iface.coord = Coord { ifaceVec.x, ifaceVec.y, ifaceVec.z } + comCoord + trajTrans;
             }
             moleculeList[mol].trajStatus = TrajStatus::propagated;
@@ -840,11 +859,13 @@ void Complex::propagate(std::vector<Molecule>& moleculeList, const Membrane memb
         //std::cout << "comCoord: " << std::fixed << std::setprecision(20) << comCoord.x << " " << comCoord.y << " " << comCoord.z << std::endl;
         //comCoord += trajTrans;
         this->update_properties(moleculeList, molTemplateList);
+        wrap_complex_periodic(*this, moleculeList, membraneObject);
         // std::cout << "comCoord: " << std::setprecision(20) << comCoord.x << " " << comCoord.y << " " << comCoord.z << std::endl;
     }
-    // zero the propagation values
+    // zero the propagation values. the move covered the steps skipped while dormant
     trajTrans.zero_crds();
     trajRot.zero_crds();
+    numDormantSteps = 0;
 }
 
 //only used for the temporary movement on sphere
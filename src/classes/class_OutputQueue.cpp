@@ -0,0 +1,69 @@
+#include "classes/class_OutputQueue.hpp"
+
+OutputQueue::OutputQueue(int _maxJobs)
+    : maxJobs(_maxJobs)
+{
+    if (maxJobs > 0)
+        writerThread = std::thread(&OutputQueue::run, this);
+}
+
+OutputQueue::~OutputQueue()
+{
+    if (writerThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            isStopping = true;
+        }
+        jobPushed.notify_one();
+        writerThread.join();
+    }
+}
+
+void OutputQueue::push(std::function<void()> job)
+{
+    if (maxJobs <= 0) {
+        job();
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        jobDone.wait(lock, [this] { return int(jobList.size()) < maxJobs; });
+        jobList.push_back(std::move(job));
+    }
+    jobPushed.notify_one();
+}
+
+void OutputQueue::flush()
+{
+    if (maxJobs <= 0)
+        return;
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    jobDone.wait(lock, [this] { return jobList.empty() && !isWriting; });
+}
+
+void OutputQueue::run()
+{
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            jobPushed.wait(lock, [this] { return isStopping || !jobList.empty(); });
+            // pending jobs are still written when stopping
+            if (jobList.empty())
+                return;
+            job = std::move(jobList.front());
+            jobList.pop_front();
+            isWriting = true;
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            isWriting = false;
+        }
+        jobDone.notify_all();
+    }
+}
@@ -0,0 +1,105 @@
+#include "classes/class_OverlapClusters.hpp"
+#include "math/rand_gsl.hpp"
+
+namespace {
+bool can_be_resolved(const Molecule& mol)
+{
+    return !mol.isEmpty && !mol.isImplicitLipid
+        && (mol.trajStatus == TrajStatus::none || mol.trajStatus == TrajStatus::canBeResampled);
+}
+}
+
+OverlapClusters::OverlapClusters(WorkerPool& _workerPool)
+    : workerPool(_workerPool)
+{
+}
+
+OverlapClusters::~OverlapClusters()
+{
+    for (auto& rng : rngList)
+        gsl_rng_free(rng);
+}
+
+int OverlapClusters::find_root(int comIndex)
+{
+    while (parentList[comIndex] != comIndex) {
+        parentList[comIndex] = parentList[parentList[comIndex]];
+        comIndex = parentList[comIndex];
+    }
+    return comIndex;
+}
+
+void OverlapClusters::build(const std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList)
+{
+    // -1 for the Complexes that aren't resolved
+    parentList.assign(complexList.size(), -1);
+    leadMolList.clear();
+    for (auto& mol : moleculeList) {
+        if (can_be_resolved(mol) && parentList[mol.myComIndex] == -1) {
+            parentList[mol.myComIndex] = mol.myComIndex;
+            leadMolList.push_back(mol.index);
+        }
+    }
+
+    // only the partners that can still be resampled tie two Complexes together, the others are only read. They can be
+    // read by several clusters at once, so their rotation (see Complex::traj_rotation()) is built here, beforehand
+    for (auto& leadMol : leadMolList) {
+        const Complex& oneCom = complexList[moleculeList[leadMol].myComIndex];
+        if (oneCom.ncross == 0)
+            continue;
+        for (auto& memMol : oneCom.memberList) {
+            for (auto& partnerIndex : moleculeList[memMol].crossbase) {
+                int partnerComIndex { moleculeList[partnerIndex].myComIndex };
+                if (moleculeList[partnerIndex].isImplicitLipid || partnerComIndex == oneCom.index)
+                    continue;
+                if (parentList[partnerComIndex] == -1) {
+                    complexList[partnerComIndex].traj_rotation();
+                    continue;
+                }
+                int root1 { find_root(oneCom.index) };
+                int root2 { find_root(partnerComIndex) };
+                if (root1 != root2)
+                    parentList[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+    }
+
+    // clusters are numbered in the order of their first Molecule
+    std::vector<int> clusterOfRoot(complexList.size(), -1);
+    std::vector<int> leadClusterList(leadMolList.size());
+    clusterStart.assign(1, 0);
+    for (unsigned leadItr { 0 }; leadItr < leadMolList.size(); ++leadItr) {
+        int root { find_root(moleculeList[leadMolList[leadItr]].myComIndex) };
+        if (clusterOfRoot[root] == -1) {
+            clusterOfRoot[root] = int(clusterStart.size()) - 1;
+            clusterStart.push_back(0);
+        }
+        leadClusterList[leadItr] = clusterOfRoot[root];
+        ++clusterStart[clusterOfRoot[root] + 1];
+    }
+    for (unsigned clusterItr { 1 }; clusterItr < clusterStart.size(); ++clusterItr)
+        clusterStart[clusterItr] += clusterStart[clusterItr - 1];
+
+    std::vector<int> nextSlot(clusterStart.begin(), clusterStart.end() - 1);
+    clusterMolList.resize(leadMolList.size());
+    for (unsigned leadItr { 0 }; leadItr < leadMolList.size(); ++leadItr)
+        clusterMolList[nextSlot[leadClusterList[leadItr]]++] = leadMolList[leadItr];
+}
+
+void OverlapClusters::resolve(gsl_rng* r, const std::function<void(int, gsl_rng*)>& resolveOne)
+{
+    seedList.resize(size());
+    for (auto& seed : seedList)
+        seed = gsl_rng_get(r);
+    // taus2 is cheap to seed, which matters since most clusters are a single Complex
+    while (int(rngList.size()) < size())
+        rngList.push_back(gsl_rng_alloc(gsl_rng_taus2));
+
+    std::function<void(int)> resolveCluster = [&](int clusterItr) {
+        gsl_rng* clusterRng { rngList[clusterItr] };
+        gsl_rng_set(clusterRng, seedList[clusterItr]);
+        for (int molItr { clusterStart[clusterItr] }; molItr < clusterStart[clusterItr + 1]; ++molItr)
+            resolveOne(clusterMolList[molItr], clusterRng);
+    };
+    workerPool.run(size(), resolveCluster);
+}
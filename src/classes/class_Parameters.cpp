@@ -26,10 +26,22 @@ std::map<const std::string, ParamKeyword> parmKeywords = {
     { "mass", ParamKeyword::mass }, { "restartwrite", ParamKeyword::restartWrite },
     { "pdbwrite", ParamKeyword::pdbWrite },
     { "overlapseplimit", ParamKeyword::overlapSepLimit }, { "name", ParamKeyword::name },
-    { "checkpoint", ParamKeyword::checkPoint }, { "scalemaxdisplace", ParamKeyword::scaleMaxDisplace }
+    { "checkpoint", ParamKeyword::checkPoint }, { "scalemaxdisplace", ParamKeyword::scaleMaxDisplace },
+    { "verletskin", ParamKeyword::verletSkin }, { "surfacegrid", ParamKeyword::surfaceGrid },
+    { "maxcelloccupancy", ParamKeyword::maxCellOccupancy }, { "dormantdisplace", ParamKeyword::dormantDisplace },
+    { "maxstepmultiple", ParamKeyword::maxStepMultiple }, { "outputqueuesize", ParamKeyword::outputQueueSize },
+    { "pdbstream", ParamKeyword::pdbStream }, { "timeseriesblock", ParamKeyword::timeSeriesBlock },
+    { "trajbox", ParamKeyword::trajBox }, { "trajsphere", ParamKeyword::trajSphere },
+    { "trajmoltypes", ParamKeyword::trajMolTypes }, { "trajmincomplexsize", ParamKeyword::trajMinComplexSize },
+    { "trajstride", ParamKeyword::trajStride }, { "checkpointfullevery", ParamKeyword::checkPointFullEvery },
+    { "checkpointforks", ParamKeyword::checkPointForks }, { "analysiswrite", ParamKeyword::analysisWrite },
+    { "analysisrdfpairs", ParamKeyword::analysisRdfPairs }, { "analysisrdfmax", ParamKeyword::analysisRdfMax },
+    { "analysisrdfbins", ParamKeyword::analysisRdfBins }, { "analysisdensitybins", ParamKeyword::analysisDensityBins },
+    { "numthreads", ParamKeyword::numThreads }, { "closureindexsize", ParamKeyword::closureIndexSize },
+    { "paralleloverlap", ParamKeyword::parallelOverlap }
 };
 
-void Parameters::set_value(std::string value, ParamKeyword keywords)
+void Parameters::set_value(std::string value, ParamKeyword keywords, std::ostream& log)
 {
     /*! \ingroup Parser
      * \brief Sets the parameters based on the enumeration key.
@@ -42,76 +54,218 @@ void Parameters::set_value(std::string value, ParamKeyword keywords)
         switch (key) {
         case 0:
             this->numMolTypes = std::stoi(value);
-            std::cout << "Read in numMolTypes: " << this->numMolTypes << std::endl;
+            log << "Read in numMolTypes: " << this->numMolTypes << std::endl;
             break;
         case 1:
             this->numTotalSpecies = std::stoi(value);
-            std::cout << "Read in numTotalSpecies: " << this->numTotalSpecies << std::endl;
+            log << "Read in numTotalSpecies: " << this->numTotalSpecies << std::endl;
             break;
         case 2:
             nit = std::stod(value);
             this->nItr = (long long)(nit); //std::stoi(value);
-            std::cout << "Read in nItr: " << this->nItr << " timeSteps" << std::endl;
+            log << "Read in nItr: " << this->nItr << " timeSteps" << std::endl;
             break;
         case 3:
             this->fromRestart = read_boolean(value);
-            std::cout << "Read in fromRestart: " << std::boolalpha << this->fromRestart << std::endl;
+            log << "Read in fromRestart: " << std::boolalpha << this->fromRestart << std::endl;
             break;
         case 4:
             this->timeWrite = std::stoi(value);
-            std::cout << "Read in timeWrite: " << this->timeWrite << " timeSteps" << std::endl;
+            log << "Read in timeWrite: " << this->timeWrite << " timeSteps" << std::endl;
             break;
         case 5:
             this->trajWrite = std::stoi(value);
-            std::cout << "Read in trajWrite: " << this->trajWrite << " timeSteps" << std::endl;
+            log << "Read in trajWrite: " << this->trajWrite << " timeSteps" << std::endl;
             break;
         case 6:
             this->timeStep = std::stod(value);
-            std::cout << "Read in timeStep: " << this->timeStep << " us" << std::endl;
+            log << "Read in timeStep: " << this->timeStep << " us" << std::endl;
             break;
         case 7:
             this->numTotalComplex = std::stoi(value);
-            std::cout << "Read in numTotalComplex: " << this->numTotalComplex << std::endl;
+            log << "Read in numTotalComplex: " << this->numTotalComplex << std::endl;
             break;
         case 8:
             this->mass = std::stod(value);
-            std::cout << "Read in mass: " << this->mass << std::endl;
+            log << "Read in mass: " << this->mass << std::endl;
             break;
         case 10:
             this->restartWrite = std::stoi(value);
-            std::cout << "Read in restartWrite: " << this->restartWrite << " timeSteps" << std::endl;
+            log << "Read in restartWrite: " << this->restartWrite << " timeSteps" << std::endl;
             break;
         case 11:
             this->pdbWrite = std::stoi(value);
-            std::cout << "Read in pdbWrite: " << this->pdbWrite << " timeSteps" << std::endl;
+            log << "Read in pdbWrite: " << this->pdbWrite << " timeSteps" << std::endl;
             break;
         case 12:
             this->overlapSepLimit = std::stod(value);
-            std::cout << "Read in overlapSepLimit: " << this->overlapSepLimit << " nm" << std::endl;
+            log << "Read in overlapSepLimit: " << this->overlapSepLimit << " nm" << std::endl;
             break;
         case 13:
             this->name = value;
-            std::cout << "Read in name: " << value << std::endl;
+            log << "Read in name: " << value << std::endl;
             break;
         case 14:
             checkit = std::stod(value);
             this->checkPoint = (long long)(checkit);
-            std::cout << "Read in checkPoint: " << this->checkPoint << " timeSteps" << std::endl;
+            log << "Read in checkPoint: " << this->checkPoint << " timeSteps" << std::endl;
             break;
         case 15:
 	    this->scaleMaxDisplace = std::stod(value);
-	    std::cout << "Read in scaleMaxDisplace: " << this->scaleMaxDisplace << std::endl;
+	    log << "Read in scaleMaxDisplace: " << this->scaleMaxDisplace << std::endl;
+            break;
+        case 16:
+            this->verletSkin = std::stod(value);
+            log << "Read in verletSkin: " << this->verletSkin << " nm" << std::endl;
+            break;
+        case 17:
+            this->surfaceGrid = read_boolean(value);
+            log << "Read in surfaceGrid: " << std::boolalpha << this->surfaceGrid << std::endl;
+            break;
+        case 18:
+            this->maxCellOccupancy = std::stoi(value);
+            log << "Read in maxCellOccupancy: " << this->maxCellOccupancy << std::endl;
+            break;
+        case 19:
+            this->dormantDisplace = std::stod(value);
+            log << "Read in dormantDisplace: " << this->dormantDisplace << " nm" << std::endl;
+            break;
+        case 20:
+            this->maxStepMultiple = std::stoi(value);
+            log << "Read in maxStepMultiple: " << this->maxStepMultiple << std::endl;
+            break;
+        case 21:
+            this->outputQueueSize = std::stoi(value);
+            log << "Read in outputQueueSize: " << this->outputQueueSize << std::endl;
+            break;
+        case 22:
+            this->pdbStream = read_boolean(value);
+            log << "Read in pdbStream: " << std::boolalpha << this->pdbStream << std::endl;
+            break;
+        case 23:
+            this->timeSeriesBlock = std::stoi(value);
+            log << "Read in timeSeriesBlock: " << this->timeSeriesBlock << std::endl;
+            break;
+        case 24:
+            this->trajFilter.box = parse_input_array(value);
+            if (trajFilter.box.size() != 6)
+                throw std::invalid_argument("trajBox needs [xmin, ymin, zmin, xmax, ymax, zmax].");
+            log << "Read in trajBox: [" << trajFilter.box[0] << ", " << trajFilter.box[1] << ", " << trajFilter.box[2]
+                      << "] to [" << trajFilter.box[3] << ", " << trajFilter.box[4] << ", " << trajFilter.box[5] << "] nm"
+                      << std::endl;
+            break;
+        case 25:
+            this->trajFilter.sphere = parse_input_array(value);
+            if (trajFilter.sphere.size() != 4)
+                throw std::invalid_argument("trajSphere needs [x, y, z, radius].");
+            log << "Read in trajSphere: center [" << trajFilter.sphere[0] << ", " << trajFilter.sphere[1] << ", "
+                      << trajFilter.sphere[2] << "] nm, radius " << trajFilter.sphere[3] << " nm" << std::endl;
+            break;
+        case 26: {
+            // comma separated names, optionally in brackets
+            this->trajFilter.molTypeNames.clear();
+            std::string name;
+            for (auto character : value) {
+                if (character == '[' || character == ']')
+                    continue;
+                if (character == ',') {
+                    trajFilter.molTypeNames.push_back(name);
+                    name.clear();
+                } else {
+                    name += character;
+                }
+            }
+            if (!name.empty())
+                trajFilter.molTypeNames.push_back(name);
+            log << "Read in trajMolTypes:";
+            for (auto& molTypeName : trajFilter.molTypeNames)
+                log << ' ' << molTypeName;
+            log << std::endl;
+            break;
+        }
+        case 27:
+            this->trajFilter.minComplexSize = std::stoi(value);
+            log << "Read in trajMinComplexSize: " << this->trajFilter.minComplexSize << std::endl;
+            break;
+        case 28:
+            this->trajFilter.stride = std::stoi(value);
+            log << "Read in trajStride: " << this->trajFilter.stride << std::endl;
+            break;
+        case 29:
+            this->checkPointFullEvery = std::stoi(value);
+            log << "Read in checkPointFullEvery: " << this->checkPointFullEvery << std::endl;
+            break;
+        case 30:
+            this->checkPointForks = std::stoi(value);
+            log << "Read in checkPointForks: " << this->checkPointForks << std::endl;
+            break;
+        case 31:
+            this->analysis.write = std::stoll(value);
+            log << "Read in analysisWrite: " << this->analysis.write << std::endl;
+            break;
+        case 32: {
+            // comma separated pairs of names joined by '-', optionally in brackets
+            this->analysis.rdfPairNames.clear();
+            std::string pairName;
+            for (auto character : value + ',') {
+                if (character == '[' || character == ']')
+                    continue;
+                if (character != ',') {
+                    pairName += character;
+                    continue;
+                }
+                if (pairName.empty())
+                    continue;
+                auto dashPos = pairName.find('-');
+                if (dashPos == std::string::npos || dashPos == 0 || dashPos == pairName.size() - 1)
+                    throw std::invalid_argument("analysisRdfPairs needs pairs of molecule names, as [A-B, A-A].");
+                analysis.rdfPairNames.emplace_back(pairName.substr(0, dashPos), pairName.substr(dashPos + 1));
+                pairName.clear();
+            }
+            log << "Read in analysisRdfPairs:";
+            for (auto& names : analysis.rdfPairNames)
+                log << ' ' << names.first << '-' << names.second;
+            log << std::endl;
+            break;
+        }
+        case 33:
+            this->analysis.rdfMax = std::stod(value);
+            log << "Read in analysisRdfMax: " << this->analysis.rdfMax << " nm" << std::endl;
+            break;
+        case 34:
+            this->analysis.rdfBins = std::stoi(value);
+            if (analysis.rdfBins < 1)
+                throw std::invalid_argument("analysisRdfBins must be at least 1.");
+            log << "Read in analysisRdfBins: " << this->analysis.rdfBins << std::endl;
+            break;
+        case 35:
+            this->analysis.densityBins = std::stoi(value);
+            log << "Read in analysisDensityBins: " << this->analysis.densityBins << std::endl;
+            break;
+        case 36:
+            this->numThreads = std::stoi(value);
+            if (numThreads < 1)
+                throw std::invalid_argument("numThreads must be at least 1.");
+            log << "Read in numThreads: " << this->numThreads << std::endl;
+            break;
+        case 37:
+            this->closureIndexSize = std::stoi(value);
+            log << "Read in closureIndexSize: " << this->closureIndexSize << std::endl;
+            break;
+        case 38:
+            this->parallelOverlap = read_boolean(value);
+            log << "Read in parallelOverlap: " << std::boolalpha << this->parallelOverlap << std::endl;
             break;
         default:
             throw std::invalid_argument("Not a valid keyword.");
         }
     } catch (std::invalid_argument& e) {
-        std::cout << e.what() << '\n';
+        std::cerr << e.what() << '\n';
         exit(1);
     }
 }
 
-void Parameters::parse_paramFile(std::ifstream& paramFile)
+void Parameters::parse_paramFile(std::ifstream& paramFile, std::ostream& log)
 {
     /*! \ingroup Parser
      * \brief Main function to parse the parameters block of an input file
@@ -131,7 +285,7 @@ void Parameters::parse_paramFile(std::ifstream& paramFile)
 
         if (tmpLine == "endparameters") {
             paramFile.seekg(startPos);
-            return;
+            break;
         }
         // if the line starts with a comment, skip it
         if (tmpLine[0] == '#')
@@ -139,45 +293,103 @@ void Parameters::parse_paramFile(std::ifstream& paramFile)
         else
             remove_comment(line);
 
-        bool gotValue { false };
-        std::string buffer;
-        for (auto lineItr = line.begin(); lineItr != line.end(); ++lineItr) {
-            if (std::isalnum(*lineItr))
-                buffer += std::tolower(static_cast<char>(*lineItr));
-            else if (*lineItr == '=') {
-                auto keyFind = parmKeywords.find(buffer);
-                line.erase(line.begin(), lineItr + 1); // + 1 removes the '=' sign. could make this erase(remove_if)
+        parse_paramLine(line, log);
+    }
 
-                // find the value type from the keyword and then set that parameter
-                if (keyFind != parmKeywords.end()) {
-                    // std::cout << "Keyword found: " << keyFind->first << '\n';
-                    this->set_value(line, keyFind->second);
-                    gotValue = true;
-                    break;
-                } else {
-                    std::cout << "Warning, ignoring unknown keyword " << buffer << '\n';
-                    break;
-                }
+    // the lines given with -p replace those of the file
+    apply_paramOverrides(log);
+}
+
+void Parameters::apply_paramOverrides(std::ostream& log)
+{
+    for (auto& overrideLine : paramOverrides) {
+        std::string line { overrideLine };
+        line.erase(
+            std::remove_if(line.begin(), line.end(), [](unsigned char x) { return std::isspace(x); }), line.end());
+        log << "Parameter set with -p: " << line << '\n';
+        if (!parse_paramLine(line, log)) {
+            std::cerr << "ERROR: Cannot set the parameter " << overrideLine << ". Exiting...\n";
+            exit(1);
+        }
+    }
+}
+
+std::string Parameters::output_path(const std::string& fileName) const
+{
+    if (outputDir.empty() || (!fileName.empty() && fileName[0] == '/'))
+        return fileName;
+    return outputDir + '/' + fileName;
+}
+
+bool Parameters::parse_paramLine(std::string line, std::ostream& log)
+{
+    std::string buffer;
+    for (auto lineItr = line.begin(); lineItr != line.end(); ++lineItr) {
+        if (std::isalnum(*lineItr))
+            buffer += std::tolower(static_cast<char>(*lineItr));
+        else if (*lineItr == '=') {
+            auto keyFind = parmKeywords.find(buffer);
+            line.erase(line.begin(), lineItr + 1); // + 1 removes the '=' sign. could make this erase(remove_if)
+
+            // find the value type from the keyword and then set that parameter
+            if (keyFind != parmKeywords.end()) {
+                // std::cout << "Keyword found: " << keyFind->first << '\n';
+                this->set_value(line, keyFind->second, log);
+                return true;
+            } else {
+                log << "Warning, ignoring unknown keyword " << buffer << '\n';
+                return false;
             }
         }
     }
+    return false;
 }
 
-void Parameters::display()
+void Parameters::display(std::ostream& os)
 {
-    std::cout << "Number of iterations: " << nItr << " timesteps\n";
-    std::cout << "Timestep: " << timeStep << " us\n";
-    std::cout << "Timestep log interval (timeWrite): " << timeWrite << " timesteps\n";
-    std::cout << "Restart file write interval: " << restartWrite << " timesteps\n";
-    std::cout << "Coordinate write interval (trajWrite): " << trajWrite << " timesteps\n";
-    std::cout << "PDB Coordinate write interval: " << pdbWrite << " timesteps\n";
-    std::cout << "Checkpoint write interval: " << checkPoint << " timesteps\n";
-    std::cout << "overlapSepLimit: " << overlapSepLimit << " nm\n";
+    os << "Number of iterations: " << nItr << " timesteps\n";
+    os << "Timestep: " << timeStep << " us\n";
+    os << "Timestep log interval (timeWrite): " << timeWrite << " timesteps\n";
+    os << "Restart file write interval: " << restartWrite << " timesteps\n";
+    os << "Coordinate write interval (trajWrite): " << trajWrite << " timesteps\n";
+    os << "PDB Coordinate write interval: " << pdbWrite << " timesteps\n";
+    os << "Checkpoint write interval: " << checkPoint << " timesteps\n";
+    os << "overlapSepLimit: " << overlapSepLimit << " nm\n";
+    if (verletSkin > 0)
+        os << "Verlet list skin: " << verletSkin << " nm\n";
+    if (surfaceGrid)
+        os << "Surface grid for membrane-bound molecules: on\n";
+    if (maxCellOccupancy > 0)
+        os << "Maximum molecules per cell in the pair search: " << maxCellOccupancy << '\n';
+    if (dormantDisplace > 0)
+        os << "Maximum skipped displacement of dormant complexes: " << dormantDisplace << " nm\n";
+    if (maxStepMultiple > 1)
+        os << "Maximum timestep multiple of isolated complexes: " << maxStepMultiple << '\n';
+    if (outputQueueSize > 0)
+        os << "Output written on a separate thread, up to " << outputQueueSize << " snapshots behind\n";
+    if (pdbStream)
+        os << "PDB frames written as models of trajectory.pdb\n";
+    if (timeSeriesBlock > 0)
+        os << "Copy numbers, bound pairs and events written as binary, in blocks of " << timeSeriesBlock << " rows\n";
+    if (trajFilter.is_active())
+        os << "Trajectory and PDB files only hold the molecules selected by the traj* filters\n";
+    if (checkPointFullEvery > 1)
+        os << "Full checkpoint every " << checkPointFullEvery << " checkpoints, deltas in between\n";
+    if (checkPointForks > 0)
+        os << "Full checkpoints written by up to " << checkPointForks << " forked processes\n";
+    if (analysis.is_active())
+        os << "In-situ analysis sampled every " << analysis.write << " timesteps\n";
+    if (numThreads > 1)
+        os << "Associations placed on " << numThreads << " threads\n";
+    if (closureIndexSize > 0)
+        os << "Loop closures within complexes of at least " << closureIndexSize << " molecules found from their free interfaces\n";
+    if (parallelOverlap)
+        os << "Overlaps resolved by independent clusters of complexes, each with its own random numbers\n";
 
-    std::cout << "Molecule specific parameters:\n";
-    std::cout << "Number of unique molecule types: " << numMolTypes << '\n';
-    std::cout << "Total number of unique interfaces and states, including product states: " << numTotalSpecies << '\n';
-    std::cout << "Total number of complexes in system at start: " << numTotalComplex << '\n';
-    std::cout << "Total number of units (molecules + interfaces) in system at start: " << numTotalUnits << '\n';
-    std::cout << "Maximum allowed number of unique 2D reactions: " << max2DRxns << '\n';
+    os << "Molecule specific parameters:\n";
+    os << "Number of unique molecule types: " << numMolTypes << '\n';
+    os << "Total number of unique interfaces and states, including product states: " << numTotalSpecies << '\n';
+    os << "Total number of complexes in system at start: " << numTotalComplex << '\n';
+    os << "Total number of units (molecules + interfaces) in system at start: " << numTotalUnits << '\n';
+    os << "Maximum allowed number of unique 2D reactions: " << max2DRxns << '\n';
 }
@@ -0,0 +1,122 @@
+#include "classes/class_PdbStream.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+// keeps the first numBytes of fileName, through a copy that replaces it
+bool keep_file_prefix(const std::string& fileName, std::streamoff numBytes)
+{
+    std::string partFileName { fileName + ".part" };
+    {
+        std::ifstream oldFile { fileName, std::ios::binary };
+        std::ofstream newFile { partFileName, std::ios::binary | std::ios::trunc };
+        std::vector<char> buffer(1 << 20);
+        while (numBytes > 0 && oldFile) {
+            oldFile.read(buffer.data(), std::min<std::streamoff>(numBytes, buffer.size()));
+            newFile.write(buffer.data(), oldFile.gcount());
+            numBytes -= oldFile.gcount();
+        }
+        if (numBytes > 0 || !newFile) {
+            newFile.close();
+            std::remove(partFileName.c_str());
+            return false;
+        }
+    }
+    return std::rename(partFileName.c_str(), fileName.c_str()) == 0;
+}
+}
+
+void PdbStream::open(const std::string& fileName, bool append, long long int lastItr)
+{
+    numFrames = 0;
+    std::vector<std::string> keptIndexList {};
+    std::streamoff keptBytes { 0 };
+    bool isCut { false };
+    if (append) {
+        // continue the frame numbering of the run being restarted, from the last frame written before its restart
+        // file. Later frames would be written again
+        std::ifstream oldIndex { fileName + ".idx" };
+        std::vector<std::streamoff> offsetList {};
+        std::string line;
+        while (std::getline(oldIndex, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+            std::istringstream fields { line };
+            int frame { 0 };
+            long long int simItr { 0 };
+            long long int offset { 0 };
+            fields >> frame >> simItr >> offset;
+            if (!fields || simItr > lastItr) {
+                isCut = true;
+                break;
+            }
+            keptIndexList.push_back(line);
+            offsetList.push_back(offset);
+        }
+
+        // the kept frames end at the ENDMDL of the last one. If it has none, the run stopped while writing it
+        std::ifstream oldPdb { fileName, std::ios::binary };
+        while (!keptIndexList.empty()) {
+            oldPdb.clear();
+            oldPdb.seekg(offsetList.back());
+            std::string record;
+            while (std::getline(oldPdb, record) && record.compare(0, 6, "ENDMDL") != 0) { }
+            if (oldPdb) {
+                keptBytes = oldPdb.tellg();
+                break;
+            }
+            isCut = true;
+            keptIndexList.pop_back();
+            offsetList.pop_back();
+        }
+        numFrames = keptIndexList.size();
+        oldPdb.clear();
+        if (numFrames > 0 && oldPdb.seekg(0, std::ios::end) && oldPdb.tellg() > keptBytes) {
+            isCut = true;
+            oldPdb.close();
+            if (!keep_file_prefix(fileName, keptBytes)) {
+                std::cerr << "ERROR: Cannot remove the frames after iteration " << lastItr << " from " << fileName
+                          << ". Exiting...\n";
+                exit(1);
+            }
+        }
+    }
+
+    std::ios_base::openmode mode { numFrames > 0 ? std::ios::app : std::ios::trunc };
+    pdbFile.open(fileName, std::ios::out | mode);
+    indexFile.open(fileName + ".idx", std::ios::out | (numFrames > 0 && !isCut ? std::ios::app : std::ios::trunc));
+    if (!pdbFile || !indexFile) {
+        std::cerr << "ERROR: Cannot open " << fileName << " for writing. Exiting...\n";
+        exit(1);
+    }
+    if (numFrames == 0 || isCut) {
+        indexFile << "# frame iteration offset(bytes)\n";
+        for (auto& keptLine : keptIndexList)
+            indexFile << keptLine << '\n';
+    }
+}
+
+std::ofstream& PdbStream::begin_model(long long int simItr)
+{
+    ++numFrames;
+    indexFile << numFrames << ' ' << simItr << ' ' << pdbFile.tellp() << '\n';
+    pdbFile << std::left << std::setw(6) << "MODEL" << "    " << std::right << std::setw(4) << numFrames << '\n';
+    pdbFile << std::left << std::setw(6) << "REMARK" << ' ' << "PDB TIMESTEP " << simItr << '\n';
+    return pdbFile;
+}
+
+void PdbStream::end_model() { pdbFile << "ENDMDL\n"; }
+
+void PdbStream::flush()
+{
+    if (!is_open())
+        return;
+    pdbFile.flush();
+    indexFile.flush();
+}
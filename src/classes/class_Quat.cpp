@@ -45,3 +45,10 @@ void Quat::rotate(Vector& vec)
     vec.y = qm.y;
     vec.z = qm.z;
 }
+
+std::array<double, 9> Quat::rotation_matrix()
+{
+    return { 1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y),
+        2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x),
+        2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y) };
+}
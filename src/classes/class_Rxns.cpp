@@ -16,10 +16,6 @@
 
 #include <iomanip>
 
-// Defined some static variables
-unsigned RxnBase::numberOfRxns = 0;
-int RxnBase::totRxnSpecies = 0;
-
 /* RXNIFACE */
 RxnIface::RxnIface(std::string ifaceName, int molTypeIndex, int absIfaceIndex, int relIfaceIndex, char requiresState,
     bool requiresInteraction)
@@ -55,7 +51,7 @@ bool RxnIface::operator==(const Molecule::Iface& molIface) const
 }
 
 /* FORWARDRXN */
-ForwardRxn::ForwardRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList)
+ForwardRxn::ForwardRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList, unsigned& numberOfRxns)
 {
     // set booleans
     isReversible = parsedRxn.isReversible;
@@ -78,8 +74,8 @@ ForwardRxn::ForwardRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& mol
     // set reaction type
     rxnType = parsedRxn.rxnType;
 
-    absRxnIndex = RxnBase::numberOfRxns;
-    ++RxnBase::numberOfRxns;
+    absRxnIndex = numberOfRxns;
+    ++numberOfRxns;
 
     assocAngles = parsedRxn.assocAngles;
     bindRadius = parsedRxn.bindRadius;
@@ -142,97 +138,97 @@ ForwardRxn::ForwardRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& mol
     }
 }
 
-void ForwardRxn::display() const
+void ForwardRxn::display(std::ostream& os) const
 {
-    std::cout << "Absolute index: " << absRxnIndex << std::endl;
-    std::cout << "Type: " << rxnType << std::endl;
+    os << "Absolute index: " << absRxnIndex << std::endl;
+    os << "Type: " << rxnType << std::endl;
 
     if (rxnType == ReactionType::bimolecular) {
-        std::cout << "Reactants:\n";
+        os << "Reactants:\n";
         for (auto& reactant : reactantListNew)
-            std::cout << ' ' << reactant << std::endl;
-        std::cout << std::endl;
-        std::cout << "Products:\n";
+            os << ' ' << reactant << std::endl;
+        os << std::endl;
+        os << "Products:\n";
         for (auto& product : productListNew)
-            std::cout << ' ' << product << std::endl;
-        std::cout << std::endl;
+            os << ' ' << product << std::endl;
+        os << std::endl;
     } else if (rxnType == ReactionType::biMolStateChange) {
-        std::cout << "Facilitator: ";
+        os << "Facilitator: ";
         for (auto& reactant : reactantListNew) {
             if (reactant.absIfaceIndex != stateChangeIface.first.absIfaceIndex)
-                std::cout << reactant << std::endl;
+                os << reactant << std::endl;
         }
     }
 
     if (hasStateChange) {
-        std::cout << "State Change Reactant: " << stateChangeIface.first << std::endl;
-        std::cout << "State Change Product: " << stateChangeIface.second << std::endl;
+        os << "State Change Reactant: " << stateChangeIface.first << std::endl;
+        os << "State Change Product: " << stateChangeIface.second << std::endl;
     }
 
-    std::cout << "Rate(s):" << std::endl;
+    os << "Rate(s):" << std::endl;
     if (rxnType != ReactionType::uniMolStateChange) {
         for (auto& rate : rateList) {
-            std::cout << "Rate " << &rate - &rateList[0] << ": " << rate.rate << std::endl;
+            os << "Rate " << &rate - &rateList[0] << ": " << rate.rate << std::endl;
             if (!rate.otherIfaceLists.empty()) {
-                std::cout << "Reactant 1 requires interfaces:" << std::endl;
+                os << "Reactant 1 requires interfaces:" << std::endl;
                 for (auto& iface : rate.otherIfaceLists[0]) {
-                    std::cout << ' ' << iface << std::endl;
+                    os << ' ' << iface << std::endl;
                 }
-                std::cout << "Reactant 2 requires interfaces:" << std::endl;
+                os << "Reactant 2 requires interfaces:" << std::endl;
                 for (auto& iface : rate.otherIfaceLists[1]) {
-                    std::cout << ' ' << iface << std::endl;
+                    os << ' ' << iface << std::endl;
                 }
             }
         }
     } else {
         for (auto& rate : rateList) {
-            std::cout << "Rate " << &rate - &rateList[0] << ": " << rate.rate << std::endl;
+            os << "Rate " << &rate - &rateList[0] << ": " << rate.rate << std::endl;
         }
     }
 
     if (rxnType == ReactionType::bimolecular) {
-        std::cout << "Sigma: " << bindRadius;
-        std::cout << std::endl;
-        assocAngles.display();
-        std::cout << std::endl;
+        os << "Sigma: " << bindRadius;
+        os << std::endl;
+        assocAngles.display(os);
+        os << std::endl;
     }
 
-    std::cout << "label: " << rxnLabel << std::endl;
+    os << "label: " << rxnLabel << std::endl;
 
     if (rxnType != ReactionType::uniMolStateChange) {
-        std::cout << "Is On Membrane: " << std::boolalpha << isOnMem << std::endl;
-        std::cout << "bindRadSameCom " << bindRadSameCom << std::endl;
-        std::cout << "loopCoopFactor " << loopCoopFactor << std::endl;
-        std::cout << "length3Dto2D " << length3Dto2D << std::endl;
-        std::cout << "isCoupled? " << isCoupled << std::endl;
+        os << "Is On Membrane: " << std::boolalpha << isOnMem << std::endl;
+        os << "bindRadSameCom " << bindRadSameCom << std::endl;
+        os << "loopCoopFactor " << loopCoopFactor << std::endl;
+        os << "length3Dto2D " << length3Dto2D << std::endl;
+        os << "isCoupled? " << isCoupled << std::endl;
         if (isCoupled)
-            std::cout << " coupledRxn Number: " << coupledRxn.absRxnIndex << " type: " << coupledRxn.rxnType << " prob to perform coupled: " << coupledRxn.probCoupled << std::endl;
+            os << " coupledRxn Number: " << coupledRxn.absRxnIndex << " type: " << coupledRxn.rxnType << " prob to perform coupled: " << coupledRxn.probCoupled << std::endl;
     }
 }
 
-void ForwardRxn::assoc_display(const std::vector<MolTemplate>& molTemplateList) const
+void ForwardRxn::assoc_display(std::ostream& os, const std::vector<MolTemplate>& molTemplateList) const
 {
-    std::cout << "\nReaction data:\n";
+    os << "\nReaction data:\n";
     // TODO: break this off into the constructor, and maybe put it onto RateState, because each conditional rate will
     // have different otherIfaceList and/or stateChangeIface.
-    std::cout << "Product: ";
-    std::cout << molTemplateList[productListNew.front().molTypeIndex].molName << '(' << productListNew.front().ifaceName
+    os << "Product: ";
+    os << molTemplateList[productListNew.front().molTypeIndex].molName << '(' << productListNew.front().ifaceName
               << "!1)";
     for (const auto& product : productListNew)
-        std::cout << '.' << molTemplateList[product.molTypeIndex].molName << '(' << product.ifaceName << "!1)";
-    std::cout << "\nAngles:\n";
-    assocAngles.display();
-    std::cout << std::endl;
+        os << '.' << molTemplateList[product.molTypeIndex].molName << '(' << product.ifaceName << "!1)";
+    os << "\nAngles:\n";
+    assocAngles.display(os);
+    os << std::endl;
 }
 
-void ForwardRxn::Angles::display() const
+void ForwardRxn::Angles::display(std::ostream& os) const
 {
-    std::cout << "Association angles:\n";
-    std::cout << std::setw(10) << std::left << "Theta 1" << std::setw(7) << std::right << theta1 << '\n';
-    std::cout << std::setw(10) << std::left << "Theta 2" << std::setw(7) << std::right << theta2 << '\n';
-    std::cout << std::setw(10) << std::left << "Phi 1" << std::setw(7) << std::right << phi1 << '\n';
-    std::cout << std::setw(10) << std::left << "Phi 2" << std::setw(7) << std::right << phi2 << '\n';
-    std::cout << std::setw(10) << std::left << "Omega" << std::setw(7) << std::right << omega << '\n';
+    os << "Association angles:\n";
+    os << std::setw(10) << std::left << "Theta 1" << std::setw(7) << std::right << theta1 << '\n';
+    os << std::setw(10) << std::left << "Theta 2" << std::setw(7) << std::right << theta2 << '\n';
+    os << std::setw(10) << std::left << "Phi 1" << std::setw(7) << std::right << phi1 << '\n';
+    os << std::setw(10) << std::left << "Phi 2" << std::setw(7) << std::right << phi2 << '\n';
+    os << std::setw(10) << std::left << "Omega" << std::setw(7) << std::right << omega << '\n';
 }
 
 ForwardRxn ForwardRxn::bngl_copy_rxn()
@@ -246,7 +242,7 @@ ForwardRxn ForwardRxn::bngl_copy_rxn()
 }
 
 /* BACKRXN */
-BackRxn::BackRxn(double offRatekb, ForwardRxn& forwardRxn)
+BackRxn::BackRxn(double offRatekb, ForwardRxn& forwardRxn, unsigned& numberOfRxns)
 {
     // set booleans
     isOnMem = forwardRxn.isOnMem;
@@ -263,8 +259,8 @@ BackRxn::BackRxn(double offRatekb, ForwardRxn& forwardRxn)
     // set reaction type
     rxnType = forwardRxn.rxnType;
 
-    absRxnIndex = RxnBase::numberOfRxns;
-    ++RxnBase::numberOfRxns;
+    absRxnIndex = numberOfRxns;
+    ++numberOfRxns;
 
     // swap reactants and products
     stateChangeIface
@@ -285,52 +281,52 @@ BackRxn::BackRxn(double offRatekb, ForwardRxn& forwardRxn)
     rateList.emplace_back(offRatekb, forwardRxn.rateList.back().otherIfaceLists);
 }
 
-void BackRxn::display() const
+void BackRxn::display(std::ostream& os) const
 {
-    std::cout << "Absolute index: " << absRxnIndex << '\n';
-    std::cout << "Type: " << rxnType << '\n';
+    os << "Absolute index: " << absRxnIndex << '\n';
+    os << "Type: " << rxnType << '\n';
     if (!hasStateChange && rxnType == ReactionType::bimolecular) {
-        std::cout << "Reactants:\n";
+        os << "Reactants:\n";
         for (auto& reactant : reactantListNew)
-            std::cout << ' ' << reactant << '\n';
-        std::cout << std::endl;
-        std::cout << "Products:\n";
+            os << ' ' << reactant << '\n';
+        os << std::endl;
+        os << "Products:\n";
         for (auto& product : productListNew)
-            std::cout << ' ' << product << '\n';
-        std::cout << std::endl;
+            os << ' ' << product << '\n';
+        os << std::endl;
     } else if (rxnType == ReactionType::biMolStateChange) {
-        std::cout << "Facilitator: ";
+        os << "Facilitator: ";
         for (auto& reactant : reactantListNew) {
             if (reactant.absIfaceIndex != stateChangeIface.first.absIfaceIndex)
-                std::cout << reactant << '\n';
+                os << reactant << '\n';
         }
     }
 
     if (hasStateChange) {
-        std::cout << "State Change Reactant: " << stateChangeIface.first << '\n';
-        std::cout << "State Change Product: " << stateChangeIface.second << '\n';
+        os << "State Change Reactant: " << stateChangeIface.first << '\n';
+        os << "State Change Product: " << stateChangeIface.second << '\n';
     }
 
-    std::cout << "\nRate(s):\n";
+    os << "\nRate(s):\n";
     for (auto& rate : rateList) {
-        std::cout << "Rate " << &rate - &rateList[0] << ": " << rate.rate << '\n';
+        os << "Rate " << &rate - &rateList[0] << ": " << rate.rate << '\n';
         if (!rate.otherIfaceLists.empty()) {
-            std::cout << "Reactant 1 requires interfaces:\n";
+            os << "Reactant 1 requires interfaces:\n";
             for (auto& iface : rate.otherIfaceLists[0]) {
-                std::cout << ' ' << iface << '\n';
+                os << ' ' << iface << '\n';
             }
-            std::cout << "Reactant 2 requires interfaces:\n";
+            os << "Reactant 2 requires interfaces:\n";
             for (auto& iface : rate.otherIfaceLists[1]) {
-                std::cout << ' ' << iface << '\n';
+                os << ' ' << iface << '\n';
             }
         }
     }
-    std::cout << "On Membrane? " << std::boolalpha << isOnMem << std::endl;
+    os << "On Membrane? " << std::boolalpha << isOnMem << std::endl;
 }
 
 /* CREATEDESTRUCTRXNS */
 
-CreateDestructRxn::CreateDestructRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList)
+CreateDestructRxn::CreateDestructRxn(ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList, unsigned& numberOfRxns)
 {
     // set booleans
     isOnMem = parsedRxn.isOnMem;
@@ -395,35 +391,35 @@ CreateDestructRxn::CreateDestructRxn(ParsedRxn& parsedRxn, const std::vector<Mol
     // set reactant/product lists, depending on the reaction type
 }
 
-void CreateDestructRxn::display() const
+void CreateDestructRxn::display(std::ostream& os) const
 {
     // TODO: Flesh this out so it outputs interfaces too
-    std::cout << "Absolute index: " << absRxnIndex << '\n';
-    std::cout << "Type: " << rxnType << '\n';
+    os << "Absolute index: " << absRxnIndex << '\n';
+    os << "Type: " << rxnType << '\n';
     if (rxnType != ReactionType::zerothOrderCreation) {
-        std::cout << "Reactants:";
+        os << "Reactants:";
         for (auto& reactant : reactantMolList)
-            std::cout << " [" << reactant.molName << ']';
-        std::cout << std::endl;
+            os << " [" << reactant.molName << ']';
+        os << std::endl;
     }
     if (rxnType != ReactionType::destruction) {
-        std::cout << "Products:";
+        os << "Products:";
         for (auto& product : productMolList)
-            std::cout << " [" << product.molName << ']';
-        std::cout << std::endl;
+            os << " [" << product.molName << ']';
+        os << std::endl;
     }
-    std::cout << "On Membrane? " << std::boolalpha << isOnMem << '\n';
-    std::cout << " Number of rates: " << rateList.size() << " first rate: " << rateList[0].rate << '\n';
-    std::cout << "otherIfaceListSize: " << rateList[0].otherIfaceLists.size() << '\n';
-    std::cout << "Rate(s):\n";
+    os << "On Membrane? " << std::boolalpha << isOnMem << '\n';
+    os << " Number of rates: " << rateList.size() << " first rate: " << rateList[0].rate << '\n';
+    os << "otherIfaceListSize: " << rateList[0].otherIfaceLists.size() << '\n';
+    os << "Rate(s):\n";
     for (auto& rate : rateList) {
-        std::cout << "Rate " << &rate - &rateList[0] << ": " << rate.rate << '\n';
+        os << "Rate " << &rate - &rateList[0] << ": " << rate.rate << '\n';
         if (!rate.otherIfaceLists.empty()) {
-            std::cout << "Reactant 1 requires interfaces:\n";
+            os << "Reactant 1 requires interfaces:\n";
             for (auto& iface : rate.otherIfaceLists[0]) {
-                std::cout << ' ' << iface << '\n';
+                os << ' ' << iface << '\n';
             }
         }
     }
-    std::cout << "label: " << rxnLabel << std::endl;
+    os << "label: " << rxnLabel << std::endl;
 }
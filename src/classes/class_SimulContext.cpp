@@ -0,0 +1,38 @@
+#include "classes/class_SimulContext.hpp"
+
+SimulContext::SimulContext(std::ostream& _log)
+    : log(_log)
+{
+}
+
+SimulContext::SimulContext(const SimulContext& other)
+    : log(other.log)
+    , totMatches(other.totMatches.load())
+    , numMolTypes(other.numMolTypes)
+    , totalNumOfStates(other.totalNumOfStates)
+    , absToRelIface(other.absToRelIface)
+    , numberOfRxns(other.numberOfRxns)
+    , totRxnSpecies(other.totRxnSpecies)
+    , numEachMolType(other.numEachMolType)
+    , numberOfMolecules(other.numberOfMolecules)
+    , emptyMolList(other.emptyMolList)
+    , numberOfComplexes(other.numberOfComplexes)
+    , emptyComList(other.emptyComList)
+{
+}
+
+SimulContext& SimulContext::operator=(const SimulContext& other)
+{
+    totMatches = other.totMatches.load();
+    numMolTypes = other.numMolTypes;
+    totalNumOfStates = other.totalNumOfStates;
+    absToRelIface = other.absToRelIface;
+    numberOfRxns = other.numberOfRxns;
+    totRxnSpecies = other.totRxnSpecies;
+    numEachMolType = other.numEachMolType;
+    numberOfMolecules = other.numberOfMolecules;
+    emptyMolList = other.emptyMolList;
+    numberOfComplexes = other.numberOfComplexes;
+    emptyComList = other.emptyComList;
+    return *this;
+}
@@ -11,25 +11,35 @@
  * ***
  */
 #include "classes/class_SimulVolume.hpp"
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "io/io.hpp"
 
 #include <chrono>
 #include <classes/class_SimulVolume.hpp>
 #include <iostream>
 
+namespace {
+/*Cell of a point fromLow nm from the low side of a periodic axis, with its images folded back in*/
+int periodic_cell_index(double fromLow, double cellSize, int numCells)
+{
+    int cellItr { int(floor(fromLow / cellSize)) % numCells };
+    return cellItr < 0 ? cellItr + numCells : cellItr;
+}
+}
+
 /* SIMULBOX::SUBBOX */
 // Member Functions
-void SimulVolume::SubVolume::display()
+void SimulVolume::SubVolume::display(std::ostream& os)
 {
-    std::cout << "SubVolume " << absIndex << '\n';
-    std::cout << "\tRel. Indices: [" << xIndex << ", " << yIndex << ", " << zIndex << "]\n";
-    std::cout << "\tMolecule Members:";
+    os << "SubVolume " << absIndex << '\n';
+    os << "\tRel. Indices: [" << xIndex << ", " << yIndex << ", " << zIndex << "]\n";
+    os << "\tMolecule Members:";
     for (auto& mol : memberMolList)
-        std::cout << ' ' << mol;
-    std::cout << "\n\tNeighbors (abs. index):";
+        os << ' ' << mol;
+    os << "\n\tNeighbors (abs. index):";
     for (auto& cell : neighborList)
-        std::cout << ' ' << cell;
-    std::cout << std::endl;
+        os << ' ' << cell;
+    os << std::endl;
 }
 
 /* SIMULBOX::DIMENSIONS */
@@ -48,7 +58,7 @@ SimulVolume::Dimensions::Dimensions(const Parameters& params, const Membrane& me
 }
 
 // Member Functions
-void SimulVolume::Dimensions::check_dimensions(const Parameters& params, const Membrane& membraneObject)
+void SimulVolume::Dimensions::check_dimensions(const Parameters& params, const Membrane& membraneObject, int numberOfMolecules, std::ostream& log)
 {
     // now check to make sure none of the dimensions are too small
     // if they are, change the scale
@@ -70,7 +80,7 @@ void SimulVolume::Dimensions::check_dimensions(const Parameters& params, const M
     //At the same time, if the numberOfMolecules changes throughout the simulation,
     //do not want the subvolumes to be too large.
     //based on total molecules
-    int totMol = Molecule::numberOfMolecules;
+    int totMol = numberOfMolecules;
     double maxPairsMols { 0.5 * totMol * totMol };
     double setLowerMax = 4000; //allow this many subvolumes, even if it is larger than maxPairsMols.
     double maxPairs = std::max(setLowerMax, maxPairsMols);
@@ -81,9 +91,9 @@ void SimulVolume::Dimensions::check_dimensions(const Parameters& params, const M
     // number of cells, which can get VERY slow
     if (tot > maxPairs) { //&& !params.isNonEQ) {
         while (tot > maxPairs && tot > minCells) {
-            std::cout << "CELL PAIR MAX EXCEEDED\n"
+            log << "CELL PAIR MAX EXCEEDED\n"
                       << "\tCurrent number of cells: " << tot << "\n\tMax number of cells: " << maxPairs << '\n';
-            std::cout << "Scaling down number of cells.\n";
+            log << "Scaling down number of cells.\n";
 
             x = std::max(2, int(floor(membraneObject.waterBox.x / cellLength) / scale));
             y = std::max(2, int(floor(membraneObject.waterBox.y / cellLength) / scale));
@@ -99,20 +109,68 @@ void SimulVolume::Dimensions::check_dimensions(const Parameters& params, const M
 /* SIMULBOX */
 // Member Functions
 
-void SimulVolume::display()
+void SimulVolume::display(std::ostream& os)
 {
-    std::cout << "Simulation volume parameters:\n";
-    std::cout << "Total sub-volumes: " << numSubCells.tot << '\n';
-    std::cout << "\tDimensions: [" << numSubCells.x << ", " << numSubCells.y << ", " << numSubCells.z << "]\n";
-    std::cout << "\tMaximum sub-volume neighbors: " << maxNeighbors << '\n';
-    std::cout << "\tSub-volume size: [" << subCellSize.x << ", " << subCellSize.y << ", " << subCellSize.z << "]\n";
+    os << "Simulation volume parameters:\n";
+    os << "Total sub-volumes: " << numSubCells.tot << '\n';
+    os << "\tDimensions: [" << numSubCells.x << ", " << numSubCells.y << ", " << numSubCells.z << "]\n";
+    os << "\tMaximum sub-volume neighbors: " << maxNeighbors << '\n';
+    os << "\tSub-volume size: [" << subCellSize.x << ", " << subCellSize.y << ", " << subCellSize.z << "]\n";
+    if (verletList.cutoff > 0)
+        os << "\tVerlet list cutoff: " << verletList.cutoff << " nm, rebuilt " << verletList.numRebuilds << " times\n";
+    if (surfaceGrid.isActive)
+        os << "\tSurface cells: " << subCellList.size() - surfaceGrid.firstCell << " in " << surfaceGrid.numRings
+                  << " rings, for membrane-bound molecules between " << surfaceGrid.rShellMin << " and "
+                  << surfaceGrid.rShellMax << " nm from the center\n";
+    if (!adaptiveGrid.leafList.empty())
+        os << "\tAdaptive grid: " << adaptiveGrid.leafList.size() << " occupied leaves, "
+                  << adaptiveGrid.numSplitCells << " sub-volumes split\n";
 }
 
-void SimulVolume::create_simulation_volume(const Parameters& params, const Membrane& membraneObject)
+void SimulVolume::create_simulation_volume(const Parameters& params, const Membrane& membraneObject, int numberOfMolecules, std::ostream& log)
 {
+    if (membraneObject.hasPeriodic) {
+        if (membraneObject.isSphere) {
+            std::cerr << "ERROR: periodic boundaries are only for a box, not a sphere. Exiting..." << std::endl;
+            exit(1);
+        }
+        if (membraneObject.implicitLipid && membraneObject.isPeriodic[2]) {
+            std::cerr << "ERROR: the implicit membrane is the -z side of the box, z can't be periodic. Exiting..." << std::endl;
+            exit(1);
+        }
+        if (params.maxCellOccupancy > 0 || params.maxStepMultiple > 1) {
+            std::cerr << "ERROR: maxCellOccupancy and maxStepMultiple don't support periodic boundaries. Exiting..." << std::endl;
+            exit(1);
+        }
+        // a shorter side would let a Molecule reach two images of the same partner
+        for (int axis { 0 }; axis < 3; ++axis) {
+            double length { axis == 0 ? membraneObject.waterBox.x : (axis == 1 ? membraneObject.waterBox.y : membraneObject.waterBox.z) };
+            if (membraneObject.isPeriodic[axis] && length < 2 * params.rMaxLimit) {
+                std::cerr << "ERROR: a periodic side of the box must be at least 2 * rMaxLimit = " << 2 * params.rMaxLimit
+                          << " nm long, but " << "xyz"[axis] << " is " << length << " nm. Exiting..." << std::endl;
+                exit(1);
+            }
+        }
+    }
+
     // Determine the number of boxes there will be in each dimension
     numSubCells = Dimensions(params, membraneObject);
-    numSubCells.check_dimensions(params, membraneObject);
+    numSubCells.check_dimensions(params, membraneObject, numberOfMolecules, log);
+    if (membraneObject.hasPeriodic) {
+        /*Along a periodic axis the cells wrap around, so they must be at least rMaxLimit wide, and at least 3 of
+          them, or a cell would be its own neighbor on both sides. Otherwise the axis is one cell*/
+        int* numCellsList[3] { &numSubCells.x, &numSubCells.y, &numSubCells.z };
+        for (int axis { 0 }; axis < 3; ++axis) {
+            if (!membraneObject.isPeriodic[axis])
+                continue;
+            double length { axis == 0 ? membraneObject.waterBox.x : (axis == 1 ? membraneObject.waterBox.y : membraneObject.waterBox.z) };
+            int& numCells { *numCellsList[axis] };
+            numCells = std::min(numCells, int(floor(length / params.rMaxLimit)));
+            if (numCells < 3)
+                numCells = 1;
+        }
+        numSubCells.tot = numSubCells.x * numSubCells.y * numSubCells.z;
+    }
 
     // Calculate the cells' dimensions in nanometers
     if (membraneObject.waterBox.z > 0)
@@ -123,75 +181,259 @@ void SimulVolume::create_simulation_volume(const Parameters& params, const Membr
             1 };
     // Create cell neighborlists.
     subCellList = std::vector<SubVolume>(numSubCells.tot);
-    create_cell_neighbor_list_cubic();
+    create_cell_neighbor_list_cubic(membraneObject);
+
+    surfaceGrid = SurfaceGrid {};
+    if (params.surfaceGrid && membraneObject.isSphere)
+        create_surface_grid(params, membraneObject, numberOfMolecules, log);
+}
+
+void SimulVolume::create_surface_grid(const Parameters& params, const Membrane& membraneObject, int numberOfMolecules, std::ostream& log)
+{
+    surfaceGrid.rShellMin = std::max(0.5 * membraneObject.sphereR, membraneObject.sphereR - params.rMaxLimit);
+    surfaceGrid.rShellMax = membraneObject.sphereR + 0.5 * params.rMaxLimit;
+
+    // two Molecules in the shell within rMaxLimit of each other are at most this far apart in angle
+    double reachAngle { 2.0 * asin(std::min(1.0, params.rMaxLimit / (2.0 * surfaceGrid.rShellMin))) };
+
+    // same limit on the number of cells as check_dimensions uses for the cubic grid
+    int totMol = numberOfMolecules;
+    double maxCells { std::max(4000.0, 0.5 * totMol * totMol) };
+    double cellAngle { std::max(reachAngle, sqrt(4.0 * M_PI / maxCells)) };
+    surfaceGrid.numRings = int(floor(M_PI / cellAngle));
+    if (surfaceGrid.numRings < 3) {
+        log << "Sphere is too small for a surface grid, membrane-bound molecules stay in the cubic grid.\n";
+        return;
+    }
+    surfaceGrid.ringAngle = M_PI / surfaceGrid.numRings;
+
+    // the two polar rings are single caps, the rest are split into cells about ringAngle wide
+    int numCells { 0 };
+    for (int ringItr { 0 }; ringItr < surfaceGrid.numRings; ++ringItr) {
+        int numAround { 1 };
+        if (ringItr != 0 && ringItr != surfaceGrid.numRings - 1)
+            numAround = std::max(1, int(round(2.0 * M_PI * sin((ringItr + 0.5) * surfaceGrid.ringAngle) / surfaceGrid.ringAngle)));
+        surfaceGrid.ringStart.push_back(numCells);
+        surfaceGrid.ringNumCells.push_back(numAround);
+        numCells += numAround;
+    }
+
+    // center direction of each cell and the angle of the smallest cap around it that holds the whole cell
+    auto direction = [](double theta, double phi) { return Coord { sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta) }; };
+    auto angleBetween = [](const Coord& u, const Coord& v) {
+        return acos(std::max(-1.0, std::min(1.0, u.x * v.x + u.y * v.y + u.z * v.z)));
+    };
+    std::vector<Coord> centerList {};
+    std::vector<double> capAngleList {};
+    std::vector<int> cellRingList {};
+    for (int ringItr { 0 }; ringItr < surfaceGrid.numRings; ++ringItr) {
+        int numAround { surfaceGrid.ringNumCells[ringItr] };
+        double thetaLow { ringItr * surfaceGrid.ringAngle };
+        double thetaHigh { (ringItr + 1) * surfaceGrid.ringAngle };
+        double phiWidth { 2.0 * M_PI / numAround };
+        for (int phiItr { 0 }; phiItr < numAround; ++phiItr) {
+            cellRingList.push_back(ringItr);
+            if (ringItr == 0) {
+                centerList.push_back(Coord { 0, 0, 1 });
+                capAngleList.push_back(surfaceGrid.ringAngle);
+            } else if (ringItr == surfaceGrid.numRings - 1) {
+                centerList.push_back(Coord { 0, 0, -1 });
+                capAngleList.push_back(surfaceGrid.ringAngle);
+            } else if (numAround == 1) {
+                centerList.push_back(Coord { 0, 0, 1 });
+                capAngleList.push_back(M_PI);
+            } else {
+                // the angle from the center grows monotonically along each edge, so the corners are furthest
+                double phiMid { -M_PI + (phiItr + 0.5) * phiWidth };
+                Coord center { direction(0.5 * (thetaLow + thetaHigh), phiMid) };
+                double capAngle { 0 };
+                for (double theta : { thetaLow, thetaHigh }) {
+                    for (double phi : { phiMid - 0.5 * phiWidth, phiMid + 0.5 * phiWidth })
+                        capAngle = std::max(capAngle, angleBetween(center, direction(theta, phi)));
+                }
+                centerList.push_back(center);
+                capAngleList.push_back(capAngle);
+            }
+        }
+    }
+
+    surfaceGrid.firstCell = int(subCellList.size());
+    surfaceGrid.isActive = true;
+    subCellList.resize(surfaceGrid.firstCell + numCells);
+    double rMid { 0.5 * (surfaceGrid.rShellMin + surfaceGrid.rShellMax) };
+    for (int cellItr { 0 }; cellItr < numCells; ++cellItr) {
+        SubVolume& cell = subCellList[surfaceGrid.firstCell + cellItr];
+        cell.absIndex = surfaceGrid.firstCell + cellItr;
+        cell.xIndex = cellItr - surfaceGrid.ringStart[cellRingList[cellItr]];
+        cell.yIndex = cellRingList[cellItr];
+        cell.zIndex = -1;
+
+        // later surface cells, so each pair of surface cells is only visited once. Points can only be within reach
+        // of the same or the next ring, since rings are at least reachAngle wide
+        int lastRing { std::min(surfaceGrid.numRings - 1, cellRingList[cellItr] + 1) };
+        int lastCell { surfaceGrid.ringStart[lastRing] + surfaceGrid.ringNumCells[lastRing] };
+        for (int cellItr2 { cellItr + 1 }; cellItr2 < lastCell; ++cellItr2) {
+            if (angleBetween(centerList[cellItr], centerList[cellItr2])
+                <= capAngleList[cellItr] + capAngleList[cellItr2] + reachAngle)
+                cell.neighborList.push_back(surfaceGrid.firstCell + cellItr2);
+        }
+
+        // cubic SubVolumes within rMaxLimit of the bounding sphere of the cell's part of the shell
+        Coord ballCenter { rMid * centerList[cellItr].x, rMid * centerList[cellItr].y, rMid * centerList[cellItr].z };
+        double ballRadius { 0 };
+        for (double r : { surfaceGrid.rShellMin, surfaceGrid.rShellMax })
+            ballRadius = std::max(ballRadius, sqrt(r * r + rMid * rMid - 2.0 * r * rMid * cos(capAngleList[cellItr])));
+        double reach { ballRadius + params.rMaxLimit };
+        int xLow { std::max(0, int(floor((ballCenter.x - reach + membraneObject.waterBox.x / 2) / subCellSize.x))) };
+        int xHigh { std::min(numSubCells.x - 1, int(floor((ballCenter.x + reach + membraneObject.waterBox.x / 2) / subCellSize.x))) };
+        int yLow { std::max(0, int(floor((ballCenter.y - reach + membraneObject.waterBox.y / 2) / subCellSize.y))) };
+        int yHigh { std::min(numSubCells.y - 1, int(floor((ballCenter.y + reach + membraneObject.waterBox.y / 2) / subCellSize.y))) };
+        int zLow { std::max(0, int(floor((membraneObject.waterBox.z / 2 - ballCenter.z - reach) / subCellSize.z))) };
+        int zHigh { std::min(numSubCells.z - 1, int(floor((membraneObject.waterBox.z / 2 - ballCenter.z + reach) / subCellSize.z))) };
+        for (int zItr { zLow }; zItr <= zHigh; ++zItr) {
+            for (int yItr { yLow }; yItr <= yHigh; ++yItr) {
+                for (int xItr { xLow }; xItr <= xHigh; ++xItr) {
+                    double xMin { -membraneObject.waterBox.x / 2 + xItr * subCellSize.x };
+                    double yMin { -membraneObject.waterBox.y / 2 + yItr * subCellSize.y };
+                    double zMax { membraneObject.waterBox.z / 2 - zItr * subCellSize.z };
+                    double dx { std::max(0.0, std::max(xMin - ballCenter.x, ballCenter.x - (xMin + subCellSize.x))) };
+                    double dy { std::max(0.0, std::max(yMin - ballCenter.y, ballCenter.y - (yMin + subCellSize.y))) };
+                    double dz { std::max(0.0, std::max((zMax - subCellSize.z) - ballCenter.z, ballCenter.z - zMax)) };
+                    if (dx * dx + dy * dy + dz * dz <= reach * reach)
+                        cell.neighborList.push_back(xItr + yItr * numSubCells.x + zItr * numSubCells.x * numSubCells.y);
+                }
+            }
+        }
+    }
+}
+
+int SimulVolume::find_surface_cell(const Molecule& mol, const std::vector<Complex>& complexList) const
+{
+    if (!surfaceGrid.isActive || complexList[mol.myComIndex].D.z >= 1E-8)
+        return -1;
+
+    double r { sqrt(mol.comCoord.x * mol.comCoord.x + mol.comCoord.y * mol.comCoord.y + mol.comCoord.z * mol.comCoord.z) };
+    if (r < surfaceGrid.rShellMin || r > surfaceGrid.rShellMax)
+        return -1;
+
+    double theta { acos(std::max(-1.0, std::min(1.0, mol.comCoord.z / r))) };
+    int ringItr { std::min(surfaceGrid.numRings - 1, int(theta / surfaceGrid.ringAngle)) };
+    int numAround { surfaceGrid.ringNumCells[ringItr] };
+    int phiItr { std::min(numAround - 1, int((atan2(mol.comCoord.y, mol.comCoord.x) + M_PI) / (2.0 * M_PI) * numAround)) };
+    return surfaceGrid.firstCell + surfaceGrid.ringStart[ringItr] + phiItr;
+}
+
+void SimulVolume::build_isolation_grid(double reach, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject)
+{
+    IsolationGrid& grid { isolationGrid };
+    grid.reach = reach;
+    grid.numX = std::max(1, int(floor(membraneObject.waterBox.x / reach)));
+    grid.numY = std::max(1, int(floor(membraneObject.waterBox.y / reach)));
+    grid.numZ = std::max(1, int(floor(membraneObject.waterBox.z / reach)));
+    int numCells { grid.numX * grid.numY * grid.numZ };
+
+    grid.molCellList.assign(moleculeList.size(), -1);
+    grid.cellStart.assign(numCells + 1, 0);
+    for (auto& mol : moleculeList) {
+        if (mol.isEmpty || mol.isImplicitLipid)
+            continue;
+        int xItr { std::min(grid.numX - 1, std::max(0, int((mol.comCoord.x + membraneObject.waterBox.x / 2) / membraneObject.waterBox.x * grid.numX))) };
+        int yItr { std::min(grid.numY - 1, std::max(0, int((mol.comCoord.y + membraneObject.waterBox.y / 2) / membraneObject.waterBox.y * grid.numY))) };
+        int zItr { 0 };
+        if (membraneObject.waterBox.z > 0)
+            zItr = std::min(grid.numZ - 1, std::max(0, int((mol.comCoord.z + membraneObject.waterBox.z / 2) / membraneObject.waterBox.z * grid.numZ)));
+        grid.molCellList[mol.index] = xItr + yItr * grid.numX + zItr * grid.numX * grid.numY;
+        ++grid.cellStart[grid.molCellList[mol.index] + 1];
+    }
+    for (int cellItr { 0 }; cellItr < numCells; ++cellItr)
+        grid.cellStart[cellItr + 1] += grid.cellStart[cellItr];
+    grid.cellMemberList.resize(grid.cellStart[numCells]);
+    std::vector<int> cellFill(grid.cellStart.begin(), grid.cellStart.end() - 1);
+    for (auto& mol : moleculeList) {
+        if (grid.molCellList[mol.index] >= 0)
+            grid.cellMemberList[cellFill[grid.molCellList[mol.index]]++] = mol.index;
+    }
 }
 
-void SimulVolume::create_cell_neighbor_list_cubic()
+double SimulVolume::find_isolation_distance(const Complex& targCom, const std::vector<Molecule>& moleculeList,
+    const Membrane& membraneObject, double maxDist) const
 {
+    const IsolationGrid& grid { isolationGrid };
+    bool movesInZ { std::abs(targCom.D.z) > 1E-14 };
+    double minDist { maxDist };
+    for (auto memIndex : targCom.memberList) {
+        const Molecule& mol = moleculeList[memIndex];
+        int cellIndex { grid.molCellList[memIndex] };
+        if (cellIndex < 0)
+            return 0;
+
+        // the boundaries
+        minDist = std::min(minDist, membraneObject.waterBox.x / 2.0 - std::abs(mol.comCoord.x));
+        minDist = std::min(minDist, membraneObject.waterBox.y / 2.0 - std::abs(mol.comCoord.y));
+        if (movesInZ)
+            minDist = std::min(minDist, membraneObject.waterBox.z / 2.0 - std::abs(mol.comCoord.z));
+        if (membraneObject.isSphere && movesInZ) {
+            double r { sqrt(mol.comCoord.x * mol.comCoord.x + mol.comCoord.y * mol.comCoord.y + mol.comCoord.z * mol.comCoord.z) };
+            minDist = std::min(minDist, membraneObject.sphereR - r);
+        }
+
+        // the cell itself and its 26 neighbors
+        int xIndex { cellIndex % grid.numX };
+        int yIndex { (cellIndex / grid.numX) % grid.numY };
+        int zIndex { cellIndex / (grid.numX * grid.numY) };
+        for (int zItr { std::max(zIndex - 1, 0) }; zItr <= std::min(zIndex + 1, grid.numZ - 1); ++zItr) {
+            for (int yItr { std::max(yIndex - 1, 0) }; yItr <= std::min(yIndex + 1, grid.numY - 1); ++yItr) {
+                for (int xItr { std::max(xIndex - 1, 0) }; xItr <= std::min(xIndex + 1, grid.numX - 1); ++xItr) {
+                    int neighCell { xItr + yItr * grid.numX + zItr * grid.numX * grid.numY };
+                    for (int memItr { grid.cellStart[neighCell] }; memItr < grid.cellStart[neighCell + 1]; ++memItr) {
+                        const Molecule& partMol = moleculeList[grid.cellMemberList[memItr]];
+                        if (partMol.myComIndex == targCom.index)
+                            continue;
+                        Coord sep { mol.comCoord - partMol.comCoord };
+                        minDist = std::min(minDist, sqrt(sep.x * sep.x + sep.y * sep.y + sep.z * sep.z));
+                    }
+                }
+            }
+        }
+    }
+    return std::max(minDist, 0.0);
+}
+
+void SimulVolume::create_cell_neighbor_list_cubic(const Membrane& membraneObject)
+{
+    /*For each cell figure out its 13 neighbors that are ~forward and up*/
+    const int offsetList[13][3] { { 1, 0, 0 }, { 1, 1, 0 }, { 1, 1, 1 }, { 1, 0, 1 }, { 0, 1, 0 }, { -1, 1, 0 },
+        { -1, 1, 1 }, { 0, 1, 1 }, { 0, 0, 1 }, { -1, 0, 1 }, { -1, -1, 1 }, { 0, -1, 1 }, { 1, -1, 1 } };
+    const int numCellsList[3] { numSubCells.x, numSubCells.y, numSubCells.z };
+    // a periodic axis of a single cell has no neighbors along it, see create_simulation_volume
+    const bool wrapsList[3] { membraneObject.isPeriodic[0] && numSubCells.x >= 3,
+        membraneObject.isPeriodic[1] && numSubCells.y >= 3, membraneObject.isPeriodic[2] && numSubCells.z >= 3 };
+
     int cellNum { 0 };
-    for (unsigned zItr { 0 }; zItr < numSubCells.z; ++zItr) {
-        for (unsigned yItr { 0 }; yItr < numSubCells.y; ++yItr) {
-            for (unsigned xItr { 0 }; xItr < numSubCells.x; ++xItr) {
+    for (int zItr { 0 }; zItr < numSubCells.z; ++zItr) {
+        for (int yItr { 0 }; yItr < numSubCells.y; ++yItr) {
+            for (int xItr { 0 }; xItr < numSubCells.x; ++xItr) {
                 // set up SubVolume
                 subCellList[cellNum].absIndex = cellNum;
                 subCellList[cellNum].xIndex = xItr;
                 subCellList[cellNum].yIndex = yItr;
                 subCellList[cellNum].zIndex = zItr;
 
-                /*For each cell figure out its 13 neighbors that are ~forward and up*/
                 // This only works for cubic subvolumes
-                if (xItr < (numSubCells.x - 1)) {
-                    // count all the plus x boxes
-                    subCellList[cellNum].neighborList.push_back(
-                        (xItr + 1) + yItr * numSubCells.x + zItr * (numSubCells.x * numSubCells.y));
-                    if (yItr < (numSubCells.y - 1)) {
-                        subCellList[cellNum].neighborList.push_back(
-                            (xItr + 1) + (yItr + 1) * numSubCells.x + zItr * (numSubCells.x * numSubCells.y));
-                        if (zItr < (numSubCells.z - 1)) {
-                            subCellList[cellNum].neighborList.push_back(
-                                (xItr + 1) + (yItr + 1) * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                        }
+                for (auto& offset : offsetList) {
+                    int neighItr[3] { xItr + offset[0], yItr + offset[1], zItr + offset[2] };
+                    bool isInside { true };
+                    for (int axis { 0 }; axis < 3; ++axis) {
+                        if (neighItr[axis] >= 0 && neighItr[axis] < numCellsList[axis])
+                            continue;
+                        if (wrapsList[axis])
+                            neighItr[axis] = (neighItr[axis] + numCellsList[axis]) % numCellsList[axis];
+                        else
+                            isInside = false;
                     }
-                    if (zItr < (numSubCells.z - 1)) {
+                    if (isInside)
                         subCellList[cellNum].neighborList.push_back(
-                            (xItr + 1) + yItr * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                    }
-                }
-                if (yItr < (numSubCells.y - 1)) {
-                    subCellList[cellNum].neighborList.push_back(
-                        xItr + (yItr + 1) * numSubCells.x + zItr * (numSubCells.x * numSubCells.y));
-                    if (xItr > 0) {
-                        subCellList[cellNum].neighborList.push_back(
-                            (xItr - 1) + (yItr + 1) * numSubCells.x + zItr * (numSubCells.x * numSubCells.y));
-                        if (zItr < (numSubCells.z - 1)) {
-                            subCellList[cellNum].neighborList.push_back(
-                                (xItr - 1) + (yItr + 1) * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                        }
-                    }
-                    if (zItr < (numSubCells.z - 1)) {
-                        subCellList[cellNum].neighborList.push_back(
-                            xItr + (yItr + 1) * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                    }
-                }
-                if (zItr < (numSubCells.z - 1)) {
-                    subCellList[cellNum].neighborList.push_back(
-                        xItr + yItr * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                    if (xItr > 0) {
-                        subCellList[cellNum].neighborList.push_back(
-                            xItr - 1 + yItr * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                        if (yItr > 0) {
-                            subCellList[cellNum].neighborList.push_back(
-                                xItr - 1 + (yItr - 1) * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                        }
-                    }
-                    if (yItr > 0) {
-                        subCellList[cellNum].neighborList.push_back(
-                            xItr + (yItr - 1) * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                        if (xItr < (numSubCells.x - 1)) {
-                            subCellList[cellNum].neighborList.push_back(
-                                xItr + 1 + (yItr - 1) * numSubCells.x + (zItr + 1) * (numSubCells.x * numSubCells.y));
-                        }
-                    }
+                            neighItr[0] + neighItr[1] * numSubCells.x + neighItr[2] * (numSubCells.x * numSubCells.y));
                 }
                 if (subCellList[cellNum].neighborList.size() > maxNeighbors) {
                     std::cerr << "ERROR: Maximum number of neighbors exceeded for SubVolume " << cellNum
@@ -204,12 +446,25 @@ void SimulVolume::create_cell_neighbor_list_cubic()
     } // end looping over x cells
 }
 
+void SimulVolume::find_periodic_cell(const Coord& crds, const Membrane& membraneObject, int& xItr, int& yItr, int& zItr) const
+{
+    if (membraneObject.isPeriodic[0])
+        xItr = periodic_cell_index(crds.x + membraneObject.waterBox.x / 2, subCellSize.x, numSubCells.x);
+    if (membraneObject.isPeriodic[1])
+        yItr = periodic_cell_index(crds.y + membraneObject.waterBox.y / 2, subCellSize.y, numSubCells.y);
+    if (membraneObject.isPeriodic[2])
+        zItr = periodic_cell_index(-(crds.z + 1E-6 - membraneObject.waterBox.z / 2.0), subCellSize.z, numSubCells.z);
+}
+
 void SimulVolume::update_memberMolLists(const Parameters& params, std::vector<Molecule>& moleculeList,
-    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, int simItr)
+    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, int simItr, std::ostream& log)
 {
-    // make sure the list of member molecules is empty
-    for (auto& subBox : subCellList)
-        subBox.memberMolList.clear();
+    // make sure the list of member molecules is empty. Every occupied SubVolume is the mySubVolIndex of some
+    // Molecule, so there's no need to touch the (mostly empty) rest of subCellList
+    for (auto& mol : moleculeList) {
+        if (mol.mySubVolIndex >= 0 && mol.mySubVolIndex < int(subCellList.size()))
+            subCellList[mol.mySubVolIndex].memberMolList.clear();
+    }
 
     int itrCheck = 1000; //no need to check every step if it violates box boundaries.
 
@@ -230,6 +485,8 @@ void SimulVolume::update_memberMolLists(const Parameters& params, std::vector<Mo
                 zItr = int(-(mol.comCoord.z + 1E-6 - membraneObject.waterBox.z / 2.0) / subCellSize.z);
             else
                 zItr = 0;
+            if (membraneObject.hasPeriodic)
+                find_periodic_cell(mol.comCoord, membraneObject, xItr, yItr, zItr);
 
             // allow the modecule a bit out of the box
             if (xItr == -1)
@@ -247,13 +504,16 @@ void SimulVolume::update_memberMolLists(const Parameters& params, std::vector<Mo
 
             int currBin = xItr + (yItr * numSubCells.x) + (zItr * numSubCells.x * numSubCells.y);
 
-            mol.mySubVolIndex = currBin;
             if (currBin >= numSubCells.tot) {
                 std::cerr << "Molecule " << mol.index
                           << " seems outside simulation volume, with center of mass coordinates ["
                           << mol.comCoord << "].\n";
                 exit(1);
             }
+            int surfaceBin { find_surface_cell(mol, complexList) };
+            if (surfaceBin >= 0)
+                currBin = surfaceBin;
+            mol.mySubVolIndex = currBin;
             subCellList[currBin].memberMolList.push_back(mol.index);
         }
     } else {
@@ -272,6 +532,8 @@ void SimulVolume::update_memberMolLists(const Parameters& params, std::vector<Mo
                 zItr = int(-(mol.comCoord.z + 1E-6 - membraneObject.waterBox.z / 2.0) / subCellSize.z);
             else
                 zItr = 0;
+            if (membraneObject.hasPeriodic)
+                find_periodic_cell(mol.comCoord, membraneObject, xItr, yItr, zItr);
 
             if (xItr == -1)
                 xItr = 0;
@@ -305,52 +567,300 @@ void SimulVolume::update_memberMolLists(const Parameters& params, std::vector<Mo
                     std::cerr << "Molecule " << mol.index << " of type " << molTemplateList[mol.molTypeIndex].molName
                               << " is off the membrane. Writing coordinates and exiting.\n";
                     //  std::cout << mol.molTypeIndex << "\t" << -membraneObject.waterBox.z * 0.5 + RS3Dinput << "\t" << RS3Dinput << "\n";
-                    write_xyz(std::string { "error_coord_dump.xyz" }, params, moleculeList, molTemplateList);
+                    write_xyz(params.output_path("error_coord_dump.xyz"), params, moleculeList, molTemplateList);
                     exit(1);
                 }
             }
 
             // Now make sure the Molecule is still inside the box in all dimensions
-            if (mol.comCoord.z > (membraneObject.waterBox.z / 2) || mol.comCoord.z + 1E-6 < -(membraneObject.waterBox.z / 2)) {
-                std::cout << "Molecule " << mol.index
+            if (!membraneObject.isPeriodic[2]
+                && (mol.comCoord.z > (membraneObject.waterBox.z / 2) || mol.comCoord.z + 1E-6 < -(membraneObject.waterBox.z / 2))) {
+                log << "Molecule " << mol.index
                           << " is outside simulation volume in the z-dimension, with center of mass coordinates ["
                           << mol.comCoord << "]. Attempting to fit back into box.\n";
-                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList);
+                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList, log);
                 // reset member search
                 molItr = 0;
                 for (auto& subBox : subCellList)
                     subBox.memberMolList.clear();
-            } else if (mol.comCoord.y > (membraneObject.waterBox.y / 2) || mol.comCoord.y + 1E-6 < -(membraneObject.waterBox.y / 2)) {
-                std::cout << "Molecule " << mol.index
+            } else if (!membraneObject.isPeriodic[1]
+                && (mol.comCoord.y > (membraneObject.waterBox.y / 2) || mol.comCoord.y + 1E-6 < -(membraneObject.waterBox.y / 2))) {
+                log << "Molecule " << mol.index
                           << " is outside simulation volume in the y-dimension, with center of mass coordinates ["
                           << mol.comCoord << "]. Attempting to fit back into box.\n";
-                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList);
+                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList, log);
                 // reset member search
                 molItr = 0;
                 for (auto& subBox : subCellList)
                     subBox.memberMolList.clear();
-            } else if (mol.comCoord.x > (membraneObject.waterBox.x / 2) || mol.comCoord.x + 1E-6 < -(membraneObject.waterBox.x / 2)) {
-                std::cout << "Molecule " << mol.index
+            } else if (!membraneObject.isPeriodic[0]
+                && (mol.comCoord.x > (membraneObject.waterBox.x / 2) || mol.comCoord.x + 1E-6 < -(membraneObject.waterBox.x / 2))) {
+                log << "Molecule " << mol.index
                           << " is outside simulation volume in the x-dimension, with center of mass coordinates ["
                           << mol.comCoord << "]. Attempting to fit back into box.\n";
-                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList);
+                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList, log);
                 // reset member search
                 molItr = 0;
                 for (auto& subBox : subCellList)
                     subBox.memberMolList.clear();
             } else if (currBin > (numSubCells.tot) || currBin < 0) {
-                std::cout << "Molecule " << mol.index << " is outside simulation volume with center of mass coordinates ["
+                log << "Molecule " << mol.index << " is outside simulation volume with center of mass coordinates ["
                           << mol.comCoord << "]. Attempting to fit back into box.\n";
-                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList);
+                complexList[mol.myComIndex].put_back_into_SimulVolume(itr, mol, membraneObject, moleculeList, molTemplateList, log);
                 // reset member search
                 molItr = 0;
                 for (auto& subBox : subCellList)
                     subBox.memberMolList.clear();
             } else {
                 // The Molecule is in the simulation volume, okay to proceed
+                int surfaceBin { find_surface_cell(mol, complexList) };
+                if (surfaceBin >= 0)
+                    currBin = surfaceBin;
                 mol.mySubVolIndex = currBin;
                 subCellList[currBin].memberMolList.push_back(mol.index);
             }
         } //loop over all molecules.
     } //check all boundary limits are OK.
 }
+
+void SimulVolume::build_verlet_list(const Parameters& params, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject)
+{
+    verletList.cutoff = params.rMaxLimit + params.verletSkin;
+    verletList.maxDisplace = params.verletSkin / 2.0;
+    ++verletList.numRebuilds;
+
+    verletList.targMolList.clear();
+    verletList.partnerList.resize(moleculeList.size());
+    for (auto& partners : verletList.partnerList)
+        partners.clear();
+    verletList.refCoordList.assign(moleculeList.size(), Coord {});
+    verletList.wasPresent.assign(moleculeList.size(), false);
+
+    // Bin the Molecules into cells at least as large as the cutoff, so only the 13 forward neighbors are needed.
+    // The SubVolumes are sized by rMaxLimit alone and can't be used directly.
+    int numX { std::max(1, int(floor(membraneObject.waterBox.x / verletList.cutoff))) };
+    int numY { std::max(1, int(floor(membraneObject.waterBox.y / verletList.cutoff))) };
+    int numZ { std::max(1, int(floor(membraneObject.waterBox.z / verletList.cutoff))) };
+    // as for the SubVolumes, a periodic axis wraps around if it has at least 3 cells, and is one cell otherwise
+    bool wrapsX { membraneObject.isPeriodic[0] && numX >= 3 };
+    bool wrapsY { membraneObject.isPeriodic[1] && numY >= 3 };
+    bool wrapsZ { membraneObject.isPeriodic[2] && numZ >= 3 };
+    if (membraneObject.isPeriodic[0] && !wrapsX)
+        numX = 1;
+    if (membraneObject.isPeriodic[1] && !wrapsY)
+        numY = 1;
+    if (membraneObject.isPeriodic[2] && !wrapsZ)
+        numZ = 1;
+    int numCells { numX * numY * numZ };
+    std::vector<int> molCellList(moleculeList.size(), -1);
+    std::vector<int> cellStart(numCells + 1, 0);
+    for (auto& mol : moleculeList) {
+        if (mol.isEmpty || mol.isImplicitLipid)
+            continue;
+        verletList.refCoordList[mol.index] = mol.comCoord;
+        verletList.wasPresent[mol.index] = true;
+
+        int xItr { std::min(numX - 1, std::max(0, int((mol.comCoord.x + membraneObject.waterBox.x / 2) / membraneObject.waterBox.x * numX))) };
+        int yItr { std::min(numY - 1, std::max(0, int((mol.comCoord.y + membraneObject.waterBox.y / 2) / membraneObject.waterBox.y * numY))) };
+        int zItr { 0 };
+        if (membraneObject.waterBox.z > 0)
+            zItr = std::min(numZ - 1, std::max(0, int((mol.comCoord.z + membraneObject.waterBox.z / 2) / membraneObject.waterBox.z * numZ)));
+        if (wrapsX)
+            xItr = periodic_cell_index(mol.comCoord.x + membraneObject.waterBox.x / 2, membraneObject.waterBox.x / numX, numX);
+        if (wrapsY)
+            yItr = periodic_cell_index(mol.comCoord.y + membraneObject.waterBox.y / 2, membraneObject.waterBox.y / numY, numY);
+        if (wrapsZ)
+            zItr = periodic_cell_index(mol.comCoord.z + membraneObject.waterBox.z / 2, membraneObject.waterBox.z / numZ, numZ);
+        molCellList[mol.index] = xItr + yItr * numX + zItr * numX * numY;
+        ++cellStart[molCellList[mol.index] + 1];
+    }
+    for (int cellItr { 0 }; cellItr < numCells; ++cellItr)
+        cellStart[cellItr + 1] += cellStart[cellItr];
+    std::vector<int> cellMemberList(cellStart[numCells]);
+    std::vector<int> cellFill(cellStart.begin(), cellStart.end() - 1);
+    for (auto& mol : moleculeList) {
+        if (molCellList[mol.index] >= 0)
+            cellMemberList[cellFill[molCellList[mol.index]]++] = mol.index;
+    }
+
+    double cutoff2 { verletList.cutoff * verletList.cutoff };
+    for (int zItr { 0 }; zItr < numZ; ++zItr) {
+        for (int yItr { 0 }; yItr < numY; ++yItr) {
+            for (int xItr { 0 }; xItr < numX; ++xItr) {
+                int cellIndex { xItr + yItr * numX + zItr * numX * numY };
+                if (cellStart[cellIndex] == cellStart[cellIndex + 1])
+                    continue;
+
+                // the cell itself plus the 13 neighbors that are ~forward and up, so each pair is visited once
+                std::vector<int> neighCellList {};
+                for (int dz { 0 }; dz <= 1; ++dz) {
+                    for (int dy { (dz == 0) ? 0 : -1 }; dy <= 1; ++dy) {
+                        for (int dx { (dz == 0 && dy == 0) ? 1 : -1 }; dx <= 1; ++dx) {
+                            int neighX { wrapsX ? (xItr + dx + numX) % numX : xItr + dx };
+                            int neighY { wrapsY ? (yItr + dy + numY) % numY : yItr + dy };
+                            int neighZ { wrapsZ ? (zItr + dz) % numZ : zItr + dz };
+                            if (neighX < 0 || neighX >= numX || neighY < 0 || neighY >= numY || neighZ >= numZ)
+                                continue;
+                            neighCellList.push_back(neighX + neighY * numX + neighZ * numX * numY);
+                        }
+                    }
+                }
+
+                for (int memItr { cellStart[cellIndex] }; memItr < cellStart[cellIndex + 1]; ++memItr) {
+                    int targMolIndex { cellMemberList[memItr] };
+                    verletList.targMolList.push_back(targMolIndex);
+                    std::vector<int>& partners { verletList.partnerList[targMolIndex] };
+                    const Coord& targCoord { moleculeList[targMolIndex].comCoord };
+
+                    // proteins in the same cell
+                    for (int memItr2 { memItr + 1 }; memItr2 < cellStart[cellIndex + 1]; ++memItr2) {
+                        Coord sep { targCoord - moleculeList[cellMemberList[memItr2]].comCoord };
+                        minimum_image(sep, membraneObject);
+                        if (sep.x * sep.x + sep.y * sep.y + sep.z * sep.z < cutoff2)
+                            partners.push_back(cellMemberList[memItr2]);
+                    }
+                    // proteins in the neighboring cells
+                    for (auto neighCellIndex : neighCellList) {
+                        for (int memItr2 { cellStart[neighCellIndex] }; memItr2 < cellStart[neighCellIndex + 1]; ++memItr2) {
+                            Coord sep { targCoord - moleculeList[cellMemberList[memItr2]].comCoord };
+                            minimum_image(sep, membraneObject);
+                            if (sep.x * sep.x + sep.y * sep.y + sep.z * sep.z < cutoff2)
+                                partners.push_back(cellMemberList[memItr2]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool SimulVolume::verlet_list_is_stale(const std::vector<Molecule>& moleculeList) const
+{
+    // Molecules were created past the end of the list, or the list was compacted after destruction
+    if (moleculeList.size() != verletList.refCoordList.size())
+        return true;
+
+    double maxDisplace2 { verletList.maxDisplace * verletList.maxDisplace };
+    for (auto& mol : moleculeList) {
+        if (mol.isEmpty || mol.isImplicitLipid)
+            continue;
+        // Molecule was created in an empty slot since the list was built
+        if (!verletList.wasPresent[mol.index])
+            return true;
+        Coord displace { mol.comCoord - verletList.refCoordList[mol.index] };
+        if (displace.x * displace.x + displace.y * displace.y + displace.z * displace.z > maxDisplace2)
+            return true;
+    }
+    return false;
+}
+
+void SimulVolume::build_adaptive_grid(const Parameters& params, const std::vector<Molecule>& moleculeList)
+{
+    AdaptiveGrid& grid = adaptiveGrid; // just for legibility
+
+    // SubVolume neighborLists only point forward, leaves need both directions since they're ordered differently
+    if (grid.cellAdjacencyList.size() != subCellList.size()) {
+        grid.cellAdjacencyList.assign(subCellList.size(), std::vector<int> {});
+        grid.cellLeafList.assign(subCellList.size(), std::vector<int> {});
+        grid.occupiedCellList.clear();
+        for (unsigned cellItr { 0 }; cellItr < subCellList.size(); ++cellItr) {
+            for (auto neighCellItr : subCellList[cellItr].neighborList) {
+                grid.cellAdjacencyList[cellItr].push_back(neighCellItr);
+                grid.cellAdjacencyList[neighCellItr].push_back(cellItr);
+            }
+        }
+    }
+
+    for (auto cellItr : grid.occupiedCellList)
+        grid.cellLeafList[cellItr].clear();
+    grid.occupiedCellList.clear();
+    grid.leafList.clear();
+    grid.lowerList.clear();
+    grid.upperList.clear();
+    grid.numSplitCells = 0;
+
+    for (auto& mol : moleculeList) {
+        if (mol.isEmpty || mol.isImplicitLipid || mol.mySubVolIndex < 0 || mol.mySubVolIndex >= int(subCellList.size()))
+            continue;
+        if (grid.cellLeafList[mol.mySubVolIndex].empty() && !subCellList[mol.mySubVolIndex].memberMolList.empty()) {
+            grid.cellLeafList[mol.mySubVolIndex].push_back(-1); // placeholder, so the SubVolume is only listed once
+            grid.occupiedCellList.push_back(mol.mySubVolIndex);
+        }
+    }
+    std::sort(grid.occupiedCellList.begin(), grid.occupiedCellList.end());
+
+    // split each occupied SubVolume, depth first, keeping the pieces that are small enough as leaves
+    std::vector<std::pair<std::vector<int>, int>> pieceStack {};
+    for (auto cellItr : grid.occupiedCellList) {
+        grid.cellLeafList[cellItr].clear();
+        pieceStack.emplace_back(subCellList[cellItr].memberMolList, 0);
+        while (!pieceStack.empty()) {
+            std::vector<int> memberList { std::move(pieceStack.back().first) };
+            int depth { pieceStack.back().second };
+            pieceStack.pop_back();
+
+            Coord lower { moleculeList[memberList.front()].comCoord };
+            Coord upper { lower };
+            for (auto molIndex : memberList) {
+                const Coord& com = moleculeList[molIndex].comCoord;
+                lower = Coord { std::min(lower.x, com.x), std::min(lower.y, com.y), std::min(lower.z, com.z) };
+                upper = Coord { std::max(upper.x, com.x), std::max(upper.y, com.y), std::max(upper.z, com.z) };
+            }
+
+            if (int(memberList.size()) > params.maxCellOccupancy && depth < grid.maxDepth) {
+                Coord middle { 0.5 * (lower.x + upper.x), 0.5 * (lower.y + upper.y), 0.5 * (lower.z + upper.z) };
+                std::vector<int> octantList[8];
+                for (auto molIndex : memberList) {
+                    const Coord& com = moleculeList[molIndex].comCoord;
+                    octantList[(com.x > middle.x) + 2 * (com.y > middle.y) + 4 * (com.z > middle.z)].push_back(molIndex);
+                }
+                // coincident COMs can't be split
+                if (octantList[0].size() < memberList.size()) {
+                    if (depth == 0)
+                        ++grid.numSplitCells;
+                    for (auto& octant : octantList) {
+                        if (!octant.empty())
+                            pieceStack.emplace_back(std::move(octant), depth + 1);
+                    }
+                    continue;
+                }
+            }
+
+            SubVolume leaf {};
+            leaf.absIndex = int(grid.leafList.size());
+            leaf.xIndex = subCellList[cellItr].xIndex;
+            leaf.yIndex = subCellList[cellItr].yIndex;
+            leaf.zIndex = subCellList[cellItr].zIndex;
+            leaf.memberMolList = std::move(memberList);
+            grid.cellLeafList[cellItr].push_back(leaf.absIndex);
+            grid.leafList.push_back(std::move(leaf));
+            grid.lowerList.push_back(lower);
+            grid.upperList.push_back(upper);
+        }
+    }
+
+    // a pair within rMaxLimit is in the same or neighboring SubVolumes, and in leaves no further apart than that
+    double rMaxLimit2 { params.rMaxLimit * params.rMaxLimit };
+    auto add_neighbor_leaves = [&](SubVolume& leaf, int cellItr) {
+        for (auto leafItr : grid.cellLeafList[cellItr]) {
+            if (leafItr <= leaf.absIndex)
+                continue;
+            double dx { std::max(0.0, std::max(grid.lowerList[leafItr].x - grid.upperList[leaf.absIndex].x,
+                                          grid.lowerList[leaf.absIndex].x - grid.upperList[leafItr].x)) };
+            double dy { std::max(0.0, std::max(grid.lowerList[leafItr].y - grid.upperList[leaf.absIndex].y,
+                                          grid.lowerList[leaf.absIndex].y - grid.upperList[leafItr].y)) };
+            double dz { std::max(0.0, std::max(grid.lowerList[leafItr].z - grid.upperList[leaf.absIndex].z,
+                                          grid.lowerList[leaf.absIndex].z - grid.upperList[leafItr].z)) };
+            if (dx * dx + dy * dy + dz * dz <= rMaxLimit2)
+                leaf.neighborList.push_back(leafItr);
+        }
+    };
+    for (auto cellItr : grid.occupiedCellList) {
+        for (auto leafItr : grid.cellLeafList[cellItr]) {
+            SubVolume& leaf = grid.leafList[leafItr];
+            add_neighbor_leaves(leaf, cellItr);
+            for (auto neighCellItr : grid.cellAdjacencyList[cellItr])
+                add_neighbor_leaves(leaf, neighCellItr);
+        }
+    }
+}
@@ -0,0 +1,1540 @@
+#include "classes/class_Simulation.hpp"
+#include "boundary_conditions/reflect_functions.hpp"
+#include "io/io.hpp"
+#include "math/constants.hpp"
+#include "math/matrix.hpp"
+#include "math/rand_gsl.hpp"
+#include "parser/parser_functions.hpp"
+#include "reactions/association/association.hpp"
+#include "reactions/bimolecular/bimolecular_reactions.hpp"
+#include "reactions/implicitlipid/implicitlipid_reactions.hpp"
+#include "reactions/shared_reaction_functions.hpp"
+#include "reactions/unimolecular/unimolecular_reactions.hpp"
+#include "system_setup/system_setup.hpp"
+#include "tracing.hpp"
+#include "trajectory_functions/trajectory_functions.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define NERDSS_HAS_POSIX
+#endif
+
+// easier to read timer
+using MDTimer = std::chrono::system_clock;
+
+namespace {
+/* The nerdss.log of a replica. Writes take a lock, since the threads a replica resolves its associations and overlaps
+ * on can log too */
+class LockedLogBuf : public std::streambuf {
+public:
+    explicit LockedLogBuf(std::streambuf* _fileBuf)
+        : fileBuf(_fileBuf)
+    {
+    }
+
+protected:
+    int overflow(int c) override
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof()))
+            return traits_type::not_eof(c);
+        std::lock_guard<std::mutex> lock { mutex };
+        return fileBuf->sputc(traits_type::to_char_type(c));
+    }
+
+    std::streamsize xsputn(const char* text, std::streamsize count) override
+    {
+        std::lock_guard<std::mutex> lock { mutex };
+        return fileBuf->sputn(text, count);
+    }
+
+    int sync() override
+    {
+        std::lock_guard<std::mutex> lock { mutex };
+        return fileBuf->pubsync();
+    }
+
+private:
+    std::streambuf* fileBuf { nullptr };
+    std::mutex mutex {};
+};
+
+// "%F %T" in local time. std::localtime isn't used, since its std::tm is shared by the threads
+std::string date_text(std::time_t time)
+{
+    std::tm localTime {};
+#ifdef NERDSS_HAS_POSIX
+    localtime_r(&time, &localTime);
+#else
+    localTime = *std::localtime(&time);
+#endif
+    char text[24];
+    if (strftime(text, sizeof(text), "%F %T", &localTime) == 0)
+        return "";
+    return text;
+}
+
+std::string current_dir()
+{
+#ifdef NERDSS_HAS_POSIX
+    char dirName[4096];
+    if (getcwd(dirName, sizeof(dirName)) != nullptr)
+        return dirName;
+#endif
+    std::cerr << "Error: Cannot get the working directory, exiting.\n";
+    exit(1);
+}
+}
+
+Simulation::ReactionTables::~ReactionTables()
+{
+    for (auto matrices : { &survMatrices, &normMatrices, &pirMatrices }) {
+        for (auto matrix : *matrices)
+            gsl_matrix_free(matrix);
+    }
+}
+
+Simulation::Simulation(bool _useClusterSweep, std::ostream& _log)
+    : useClusterSweep(_useClusterSweep)
+    , log(_log)
+{
+}
+
+Simulation::~Simulation()
+{
+    // the pending output jobs and checkpoint children are done before the tables and the RNG go away
+    inSituAnalysis.reset();
+    overlapClusters.reset();
+    associationBatch.reset();
+    workerPool.reset();
+    checkpointForker.reset();
+    checkpointChain.reset();
+    outputQueue.reset();
+
+    if (context.r != nullptr)
+        gsl_rng_free(context.r);
+}
+
+void Simulation::run_replicas(unsigned seed)
+{
+#ifdef NERDSS_HAS_POSIX
+    std::seed_seq seedSeq { seed };
+    std::vector<unsigned> replicaSeeds(params.numReplicas);
+    seedSeq.generate(replicaSeeds.begin(), replicaSeeds.end());
+    for (int replicaItr { 0 }; replicaItr < params.numReplicas; ++replicaItr)
+        log << "replica_" << replicaItr << " RNG Seed: " << replicaSeeds[replicaItr] << '\n';
+    log << std::flush;
+
+    // the replica directories and logs, with -o in the output directory. made before any replica starts, so a
+    // replica can't run without its log
+    std::vector<std::string> dirNameList {};
+    std::vector<std::ofstream> logFileList(params.numReplicas);
+    for (int replicaItr { 0 }; replicaItr < params.numReplicas; ++replicaItr) {
+        std::string dirName { params.output_path("replica_" + std::to_string(replicaItr)) };
+        if (mkdir(dirName.c_str(), 0755) != 0 && errno != EEXIST) {
+            std::cerr << "Error: Cannot create directory " << dirName << ": " << std::strerror(errno) << ", exiting.\n";
+            exit(1);
+        }
+        logFileList[replicaItr].open(dirName + "/nerdss.log");
+        if (!logFileList[replicaItr]) {
+            std::cerr << "Error: Cannot write to " << dirName << "/nerdss.log, exiting.\n";
+            exit(1);
+        }
+        dirNameList.push_back(dirName);
+    }
+
+    // replicas with numThreads > 1 use that many threads each
+    int numWorkers { std::max(1, int(std::thread::hardware_concurrency()) / std::max(1, params.numThreads)) };
+    numWorkers = std::min(params.numReplicas, numWorkers);
+    {
+        WorkerPool replicaPool { numWorkers };
+        replicaPool.run(params.numReplicas, [&](int replicaItr) {
+            LockedLogBuf logBuf { logFileList[replicaItr].rdbuf() };
+            std::ostream replicaLog { &logBuf };
+            replicaLog << "Replica " << replicaItr << " of " << params.numReplicas << std::endl;
+            {
+                Simulation replica { useClusterSweep, replicaLog };
+                replica.init(*this, replicaSeeds[replicaItr], dirNameList[replicaItr]);
+                replica.run();
+            }
+            replicaLog.flush();
+        });
+    }
+
+    log << "Ran " << params.numReplicas << " replicas on " << numWorkers << " threads.\n";
+#else
+    std::cerr << "Error: -n needs a POSIX platform. Exiting...\n";
+    exit(1);
+#endif
+}
+
+double Simulation::get_time() const
+{
+    return (simItr - params.itrRestartFrom) * params.timeStep * Constants::usToSeconds + params.timeRestartFrom;
+}
+
+void Simulation::init(int argc, char* argv[])
+{
+    if (isInitialized) {
+        std::cerr << "ERROR: A Simulation can only be initialized once. Exiting...\n";
+        exit(1);
+    }
+
+    // Get seed for random number generation
+    // use random_device instead of time so that multiple jobs started at the same time have more unique seeds
+    std::random_device rd {};
+    unsigned seed { rd() };
+
+    std::string paramFile {};
+    std::string addFileNameInput {}; // this is for restart with changed params or adding molecules and reactions
+    std::string restartFileNameInput; //if you read it in, allow it to have its own name.
+    params.rank = -1; //for serial jobs, this impacts the name of the restart file.
+
+    // command line flag parser
+    parse_command(argc, argv, params, paramFile, restartFileNameInput, addFileNameInput, seed, log);
+    set_output_dir();
+
+    setup(paramFile, restartFileNameInput, addFileNameInput, seed);
+}
+
+void Simulation::init(
+    const std::string& paramFile, unsigned seed, const std::vector<std::string>& paramOverrides, const std::string& outputDir)
+{
+    std::string seedText { std::to_string(seed) };
+    std::vector<std::string> args { "nerdss", "-f", paramFile, "-s", seedText };
+    if (!outputDir.empty())
+        args.insert(args.end(), { "-o", outputDir });
+    for (auto& overrideLine : paramOverrides)
+        args.insert(args.end(), { "-p", overrideLine });
+    std::vector<char*> argv {};
+    for (auto& arg : args)
+        argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+    init(int(args.size()), argv.data());
+}
+
+void Simulation::init(const Simulation& source, unsigned seed, const std::string& outputDir)
+{
+    if (isInitialized) {
+        std::cerr << "ERROR: A Simulation can only be initialized once. Exiting...\n";
+        exit(1);
+    }
+    if (!source.model) {
+        std::cerr << "ERROR: A Simulation can only be initialized from one that parsed an input file. Exiting...\n";
+        exit(1);
+    }
+
+    log << "Command: new run of the parsed model, RNG Seed: " << seed << std::endl;
+    model = source.model;
+    tables = source.tables;
+    params.rank = -1;
+    params.outputDir = outputDir;
+    set_output_dir();
+
+    setup("", "", "", seed);
+}
+
+void Simulation::set_output_dir()
+{
+    if (params.outputDir.empty())
+        return;
+#ifdef NERDSS_HAS_POSIX
+    if (params.outputDir[0] != '/')
+        params.outputDir = current_dir() + '/' + params.outputDir;
+    if (mkdir(params.outputDir.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Error: Cannot create directory " << params.outputDir << ": " << std::strerror(errno) << ", exiting.\n";
+        exit(1);
+    }
+#else
+    std::cerr << "Error: -o needs a POSIX platform. Exiting...\n";
+    exit(1);
+#endif
+}
+
+void Simulation::setup(
+    std::string paramFile, std::string restartFileNameInput, std::string addFileNameInput, unsigned seed)
+{
+    isInitialized = true;
+
+    /* SIMULATION SETUP */
+    // get time point for total simulation time
+    totalTimeStart = MDTimer::now();
+    forwardRxns.reserve(10);
+    backRxns.reserve(10);
+
+    auto startTime = MDTimer::to_time_t(totalTimeStart);
+    log << "\nStart date: ";
+    log << date_text(startTime) << '\n';
+    log << "RNG Seed: " << seed << std::endl;
+
+    //random generator
+    const gsl_rng_type* T;
+    T = gsl_rng_default;
+    context.r = gsl_rng_alloc(T);
+    gsl_rng_set(context.r, seed);
+
+    // the output files, in the output directory
+    observablesFileName = params.output_path(observablesFileName);
+    trajFileName = params.output_path(trajFileName);
+    restartFileName = params.output_path(restartFileName);
+
+    /* SET UP SOME IMPORTANT VARIABLES */
+    // 2D reaction probability tables
+    if (!tables) {
+        tables = std::make_shared<ReactionTables>();
+        tables->tableIDs.assign(params.max2DRxns * 2, 0); // TODO: Change this?
+    }
+
+    // some variables used for parsing add.inp
+
+    int numMolTemplateBeforeAdd { 0 }; // number of molTemp before add
+    int numDoubleBeforeAdd { 0 }; // number of double complex before add
+    int numForwardRxnBdeforeAdd { 0 }; //number of Forw React before add
+    int numBackRxnBdeforeAdd { 0 }; //number of Back React before add
+    int numCreatDestructRxnBdeforeAdd { 0 }; //num of creat and destruct react before add
+    int tempLastStateIndexBeforeAdd { 0 }; // the last state index before add
+    int tempLastStateIndexAfterAdd { 0 }; // the last state index after add
+    int numStateAdd { 0 }; // num of added states
+    int totalSpeciesNum { 0 }; //total species num after add
+    init_association_events(counterArrays); //initialize event counters to zero. Restart will update any non-zero values.
+
+    if (params.numReplicas > 1 && params.fromRestart) {
+        std::cerr << "Error: -n can't be combined with -r, restart each replica from its own directory. Exiting...\n";
+        exit(1);
+    }
+
+    log << "\nParsing Input: " << std::endl;
+    if (model) {
+        log << "This is a new simulation of the model parsed by another one" << std::endl;
+        std::string outputDir { params.outputDir };
+        params = model->params;
+        params.outputDir = outputDir;
+        params.numReplicas = 1;
+        observablesList = model->observablesList;
+        forwardRxns = model->forwardRxns;
+        backRxns = model->backRxns;
+        createDestructRxns = model->createDestructRxns;
+        molTemplateList = model->molTemplateList;
+        membraneObject = model->membraneObject;
+        context = model->context;
+    }
+    std::string savedAnalysis {}; // in-situ analysis samples of the restart file, see InSituAnalysis::read_state
+    if (!params.fromRestart && (paramFile != "" || model)) {
+        if (!model) {
+            log << "This is a new simulation with input file: " << paramFile << std::endl;
+            if (params.modelCacheDir.empty())
+                parse_input(paramFile, params, observablesList, forwardRxns, backRxns, createDestructRxns, molTemplateList, membraneObject, context);
+            else
+                parse_input_cached(params.modelCacheDir, paramFile, params, observablesList, forwardRxns, backRxns,
+                    createDestructRxns, molTemplateList, membraneObject, context);
+
+            // kept for the Simulations initialized from this one
+            std::shared_ptr<Model> parsedModel { std::make_shared<Model>() };
+            parsedModel->params = params;
+            parsedModel->observablesList = observablesList;
+            parsedModel->forwardRxns = forwardRxns;
+            parsedModel->backRxns = backRxns;
+            parsedModel->createDestructRxns = createDestructRxns;
+            parsedModel->molTemplateList = molTemplateList;
+            parsedModel->membraneObject = membraneObject;
+            parsedModel->context = context;
+            model = parsedModel;
+        }
+
+        // with -n, this Simulation only starts the replicas
+        if (params.numReplicas > 1) {
+            run_replicas(seed);
+            isFinished = true;
+            return;
+        }
+
+        // set the number of states of implicit lipid
+        for (auto& molTemplateTmp : molTemplateList) {
+            if (molTemplateTmp.isImplicitLipid == true) {
+                membraneObject.nStates = static_cast<int>(molTemplateTmp.interfaceList[0].stateList.size());
+                break;
+            }
+        }
+        // initialize numberOfFreeLipidsEachState & numberOfProteinEachState
+        for (int tmpStateIndex = 0; tmpStateIndex < membraneObject.nStates; tmpStateIndex++) {
+            membraneObject.numberOfFreeLipidsEachState.emplace_back(0);
+            membraneObject.numberOfProteinEachState.emplace_back(0);
+        }
+
+        // verify the implicit lipid is the first
+        for (auto& tempMolTemplate : molTemplateList) {
+            if (tempMolTemplate.isImplicitLipid == true && tempMolTemplate.molTypeIndex != 0) {
+                std::cerr << "Error: implicit Lipid must be the first molecule type, exiting.\n";
+                exit(1);
+            }
+        }
+
+        context.numMolTypes = molTemplateList.size();
+        log << "NUMBER OF MOLECULE TYPES: " << params.numMolTypes
+                  << "NUMBER OF INTERFACES PLUS STATES, including PRODUCTS: " << params.numTotalSpecies << std::endl;
+
+        // write the Observables file header and initial values
+        std::ofstream observablesFile { observablesFileName };
+        if (observablesList.size() == 1) {
+            observablesFile << "Time (s)," << observablesList.begin()->first << '\n';
+            observablesFile << "0,0\n";
+        } else if (observablesList.size() > 1) {
+            observablesFile << "Time (s)";
+            for (auto obsItr = observablesList.begin(); obsItr != observablesList.end(); ++obsItr)
+                observablesFile << ',' << obsItr->first;
+            log << "\n0";
+            for (auto obsItr = observablesList.begin(); obsItr != observablesList.end(); ++obsItr)
+                log << ',' << obsItr->second;
+            observablesFile << '\n'
+                            << std::flush;
+        }
+
+        observablesFile.close();
+
+        unsigned long reservation {};
+        for (auto& molTemp : molTemplateList)
+            reservation += molTemp.copies;
+        moleculeList.reserve(reservation);
+        complexList.reserve(reservation);
+
+        //create water box for sphere boundary
+        if (membraneObject.isSphere) {
+            membraneObject.create_water_box();
+            membraneObject.sphereVol = (4.0 * M_PI * pow(membraneObject.sphereR, 3.0)) / 3.0;
+        }
+
+        // generate the system coordinates, write out coordinate and topology files
+        generate_coordinates(params, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject, context);
+        write_psf(params, moleculeList, molTemplateList, context);
+
+        // set up some important parameters for implicit-lipid model;
+        initialize_paramters_for_implicitlipid_model(implicitlipidIndex, params, forwardRxns, backRxns,
+            moleculeList, molTemplateList, complexList, membraneObject);
+
+        // initialize the starting copy number for each state
+        initialize_states(moleculeList, molTemplateList, membraneObject);
+
+        /* CREATE SIMULATION BOX CELLS */
+        log << "\nPartitioning simulation box into sub-boxes..." << std::endl;
+        set_rMaxLimit(params, molTemplateList, forwardRxns, 0, 0, context.absToRelIface, log);
+        simulVolume.create_simulation_volume(params, membraneObject, context.numberOfMolecules, log);
+        simulVolume.update_memberMolLists(params, moleculeList, complexList, molTemplateList, membraneObject, simItr, log);
+        simulVolume.display(log);
+
+        // write beginning of trajectory
+        std::ofstream trajFile { trajFileName };
+        if (params.trajFilter.is_active())
+            write_traj(0, trajFile, params, select_output_molecules(params, moleculeList, complexList, molTemplateList),
+                molTemplateList, membraneObject);
+        else
+            write_traj(0, trajFile, params, moleculeList, molTemplateList, membraneObject);
+        trajFile.close();
+    } else if (params.fromRestart) { // && paramFile.empty()) {
+        log << "This is a restart simulation with restart file: " << restartFileNameInput << std::endl;
+        read_rng_state(context.r, params.output_path("rng_state")); // read the current RNG state
+        std::ifstream restartFileInput { params.output_path(restartFileNameInput) };
+        if (!restartFileInput) {
+            std::cerr << "Error, could not find restart file, exiting...\n";
+            exit(1);
+        }
+
+        log << "Reading restart file..." << std::endl;
+        read_restart(simItr, restartFileInput, params, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns,
+            backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+        InSituAnalysis::read_state(restartFileInput, params, savedAnalysis, log);
+        restartFileInput.close();
+        // without an add file, the parameters given with -p are read after those of the restart file
+        if (addFileNameInput == "")
+            params.apply_paramOverrides(log);
+
+        // initialize numberOfProteinEachState
+        for (int tmpStateIndex = 0; tmpStateIndex < membraneObject.nStates; tmpStateIndex++) {
+            membraneObject.numberOfProteinEachState.emplace_back(0);
+        }
+
+        //add moldecules and reactions, modify parms according to add.inp
+        if (addFileNameInput != "") {
+            log << "This is a restart simulation with add file: " << addFileNameInput << std::endl;
+            numMolTemplateBeforeAdd = molTemplateList.size();
+            numForwardRxnBdeforeAdd = static_cast<int>(forwardRxns.size());
+            numBackRxnBdeforeAdd = static_cast<int>(backRxns.size());
+            numCreatDestructRxnBdeforeAdd = static_cast<int>(createDestructRxns.size());
+
+            if (numMolTemplateBeforeAdd > 0) {
+                for (int forwardRxnIndex { 0 }; forwardRxnIndex < numForwardRxnBdeforeAdd; forwardRxnIndex++) {
+                    ForwardRxn oneRxn {};
+                    oneRxn = forwardRxns[forwardRxnIndex];
+                    if (oneRxn.rxnType == ReactionType::bimolecular) {
+                        numDoubleBeforeAdd++;
+                    }
+                }
+            }
+
+            tempLastStateIndexBeforeAdd = molTemplateList.back().interfaceList.back().stateList.back().index;
+
+            parse_input_for_add(addFileNameInput, params, observablesList, forwardRxns, backRxns, createDestructRxns, molTemplateList, membraneObject, numDoubleBeforeAdd, context);
+            //move the implicit lipid to the first, and unpdate mol.molTypeIndex
+            for (auto& tempMolTemplate : molTemplateList) {
+                if (tempMolTemplate.isImplicitLipid == true && tempMolTemplate.molTypeIndex != 0) {
+                    log << "Implicit Lipid must be the first molecule type!" << std::endl;
+                    exit(1);
+                }
+            }
+
+            tempLastStateIndexAfterAdd = molTemplateList.back().interfaceList.back().stateList.back().index;
+
+            numStateAdd = tempLastStateIndexAfterAdd - tempLastStateIndexBeforeAdd;
+
+            context.numMolTypes = molTemplateList.size();
+
+            unsigned long reservation {};
+            for (auto& molTemp : molTemplateList)
+                reservation += molTemp.copies;
+            moleculeList.reserve(reservation);
+            complexList.reserve(reservation);
+
+            //update the iface.index for all molecules that the index is larger than tempLastStateIndexBeforeAdd
+            for (auto& tempMol : moleculeList) {
+                for (auto& tempIface : tempMol.interfaceList) {
+                    if (tempIface.index > tempLastStateIndexBeforeAdd)
+                        tempIface.index += numStateAdd;
+                }
+            }
+
+            //update the index of reacts and products of forward reactions
+            for (int forwardReactIndex { 0 }; forwardReactIndex < forwardRxns.size(); forwardReactIndex++) {
+                if (forwardReactIndex < numForwardRxnBdeforeAdd) {
+                    if (forwardRxns[forwardReactIndex].rxnType == ReactionType::bimolecular) {
+                        //this is a old forward biomolecule react, update the products' index by + numStateAdd
+                        for (auto& tempProduct : forwardRxns[forwardReactIndex].productListNew) {
+                            tempProduct.absIfaceIndex += numStateAdd;
+                        }
+                    }
+                }
+                if (forwardReactIndex >= numForwardRxnBdeforeAdd) {
+                    if (forwardRxns[forwardReactIndex].rxnType == ReactionType::bimolecular) {
+                        //this is a new forward biomolecule react, update the products' index by + numDoubleBeforeAdd
+                        for (auto& tempProduct : forwardRxns[forwardReactIndex].productListNew) {
+                            tempProduct.absIfaceIndex += numDoubleBeforeAdd;
+                        }
+                    }
+                }
+            }
+
+            //update the index of reacts and products of back reactions
+            for (int backReactIndex { 0 }; backReactIndex < backRxns.size(); backReactIndex++) {
+                if (backReactIndex < numBackRxnBdeforeAdd) {
+                    //this is a old back react, update the reactants' index by + numStateAdd
+                    for (auto& tempReactant : backRxns[backReactIndex].reactantListNew) {
+                        tempReactant.absIfaceIndex += numStateAdd;
+                    }
+                } else {
+                    //this is a new back react, update the reactants' index by + numDoubleBeforeAdd
+                    for (auto& tempReactant : backRxns[backReactIndex].reactantListNew) {
+                        tempReactant.absIfaceIndex += numDoubleBeforeAdd;
+                    }
+                }
+            }
+
+            //create water box for sphere boundary
+            if (membraneObject.isSphere) {
+                membraneObject.create_water_box();
+                membraneObject.sphereVol = (4.0 * M_PI * pow(membraneObject.sphereR, 3.0)) / 3.0;
+            }
+
+            // generate the coordinates, write out coordinate and topology files for added molecules
+            generate_coordinates_for_restart(params, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject, numMolTemplateBeforeAdd, numForwardRxnBdeforeAdd, context);
+            for (auto& tmpComplex : complexList) {
+                tmpComplex.numEachMol.clear();
+                tmpComplex.numEachMol.resize(molTemplateList.size());
+                for (auto& memMol : tmpComplex.memberList)
+                    ++tmpComplex.numEachMol[moleculeList[memMol].molTypeIndex];
+            }
+
+            write_psf(params, moleculeList, molTemplateList, context);
+        }
+
+        log << " Total number of states (reactant and product)  in the system " << context.totRxnSpecies << std::endl;
+        params.numTotalSpecies = context.totRxnSpecies;
+        log << " Total number of molecules: " << context.numberOfMolecules << " Size of molecule list : " << moleculeList.size() << std::endl;
+        log << "Total number of complexes: " << context.numberOfComplexes << " size of list: " << complexList.size() << std::endl;
+
+        // set up some important parameters for implicit-lipid model;
+        initialize_paramters_for_implicitlipid_model(implicitlipidIndex, params, forwardRxns, backRxns,
+            moleculeList, molTemplateList, complexList, membraneObject);
+
+        // initialize the starting copy number for each state
+        initialize_states(moleculeList, molTemplateList, membraneObject);
+
+        /* CREATE SIMULATION BOX CELLS */
+        log << "Partitioning simulation box into sub-boxes..." << std::endl;
+        set_rMaxLimit(params, molTemplateList, forwardRxns, numDoubleBeforeAdd, numMolTemplateBeforeAdd, context.absToRelIface, log);
+        simulVolume.create_simulation_volume(params, membraneObject, context.numberOfMolecules, log);
+        simulVolume.update_memberMolLists(params, moleculeList, complexList, molTemplateList, membraneObject, simItr, log);
+        simulVolume.display(log);
+
+        // Check to make sure the trajectory length matches the restart file
+        log << " params.trajFile: " << params.trajFile << std::endl;
+        std::ifstream trajFile { params.output_path(params.trajFile) };
+        long long int trajItr { -1 };
+        if (trajFile) {
+            std::string line;
+            while (getline(trajFile, line)) {
+                auto headerItr = line.find(':');
+                if (headerItr != std::string::npos) {
+                    trajItr = std::stoi(line.substr(headerItr + 1, std::string::npos)); // + 1 to ignore the colon
+                }
+            }
+            if (trajItr == simItr) {
+                log << "Trajectory length matches provided restart file. Continuing...\n";
+            } else {
+                std::cerr << "ERROR: Trajectory length doesn't match provided restart file. Exiting...\n";
+                exit(1);
+            }
+            trajFile.close();
+        } else {
+            log << "WARNING: No trajectory found, writing new trajectory.\n";
+        }
+    } else {
+        std::cerr << "Please provide a parameter and/or restart file. Parameter file Syntax is : ./rd_executable.exe "
+                     "-f parameterfile.inp \n";
+        exit(1);
+    }
+
+    if (membraneObject.implicitLipid == true)
+        params.implicitLipid = true; //Created this parameter for convenience.
+    for (auto& oneReaction : forwardRxns) {
+        if (oneReaction.rxnType == ReactionType::uniMolStateChange) {
+            params.hasUniMolStateChange = true;
+            break;
+        }
+    }
+    if (createDestructRxns.empty() == false) {
+        params.hasCreationDestruction = true;
+        params.isNonEQ = true;
+
+        // set molTemp.canDestroy = ture
+        for (auto& oneReaction : createDestructRxns) {
+            if (oneReaction.rxnType == ReactionType::destruction) {
+                molTemplateList[oneReaction.reactantMolList.at(0).molTypeIndex].canDestroy = true;
+            }
+        }
+        for (auto& oneTemp : molTemplateList) {
+            if (oneTemp.canDestroy == false) {
+                oneTemp.monomerList.clear();
+            }
+        }
+    }
+
+    /* SETUP OUTPUT FILES */
+    /*output files reporting bound pairs, and histogram of complex components*/
+
+    // the variable params.numIfaces does not seem to be used anywhere for anything. It is also not correctly
+    // initialized anywhere. during a restart, it is read in, but previous sims would not have set to proper value.
+
+    assemblyfile.open(params.output_path("histogram_complexes_time.dat"));
+    dimerfile.open(params.output_path("mono_dimer_time.dat"));
+    // with timeSeriesBlock > 0, these three are written to binary files instead. nerdss_export converts them back
+    if (params.timeSeriesBlock <= 0) {
+        eventFile.open(params.output_path("event_counters_time.dat"));
+        pairOutfile.open(params.output_path("bound_pair_time.dat"));
+        speciesFile1.open(params.output_path("copy_numbers_time.dat"));
+    }
+
+    std::ostringstream speciesHeader;
+    totalSpeciesNum = init_speciesFile(speciesHeader, counterArrays, molTemplateList, forwardRxns, params);
+    init_counterCopyNums(counterArrays, moleculeList, complexList, molTemplateList, membraneObject, totalSpeciesNum, params); // works for default and restart
+
+    init_print_dimers(dimerfile, params, molTemplateList); // works for default and restart
+    std::ostringstream pairHeader;
+    init_NboundPairs(counterArrays, pairHeader, params, molTemplateList, moleculeList); // initializes to zero, re-calculated for a restart!!
+
+    if (params.timeSeriesBlock > 0) {
+        open_time_series(timeSeries, params, counterArrays, speciesHeader.str(), pairHeader.str());
+    } else {
+        speciesFile1 << speciesHeader.str();
+        pairOutfile << pairHeader.str();
+    }
+    write_counter_time_series(timeSeries, simItr, params, counterArrays, pairOutfile, eventFile, speciesFile1);
+    print_dimers(complexList, dimerfile, simItr, params, molTemplateList, context.numEachMolType);
+    int number_of_lipids = 0; //sum of all states of IL
+    for (int i = 0; i < membraneObject.numberOfFreeLipidsEachState.size(); i++) {
+        number_of_lipids += membraneObject.numberOfFreeLipidsEachState[i];
+    }
+    meanComplexSize = print_complex_hist(complexList, assemblyfile, simItr, params, molTemplateList, number_of_lipids, context.numEachMolType);
+
+    // with pdbStream, all pdb frames are appended to one file
+    if (params.pdbStream && params.pdbWrite != -1)
+        pdbStream.open(params.output_path("trajectory.pdb"), params.fromRestart, params.itrRestartFrom);
+
+    // output during the time loop is formatted and written on this queue's thread, if it has one
+    outputQueue.reset(new OutputQueue { params.outputQueueSize });
+
+    // with checkPointFullEvery > 1, it keeps the last full checkpoint to write the others as differences from it
+    checkpointChain.reset(new CheckpointChain { params.checkPointFullEvery });
+
+    // with checkPointForks > 0, full checkpoints are written by child processes while the simulation goes on
+    checkpointForker.reset(new CheckpointForker { params.checkPointForks, log });
+
+    // with analysisWrite > 0, complex sizes, RDFs and surface densities are averaged over the run
+    inSituAnalysis.reset(new InSituAnalysis { params, molTemplateList, simulVolume, membraneObject, log });
+    inSituAnalysis->resume(savedAnalysis, log);
+
+    // with numThreads > 1, the associations of a timestep are held back and placed in parallel, on at most one thread
+    // per hardware thread
+    int numThreads { std::min(params.numThreads, std::max(1, int(std::thread::hardware_concurrency()))) };
+    // the cluster sweep changes params.timeStep while it works, so its overlaps are always resolved in order
+    bool isOverlapParallel { params.parallelOverlap && !useClusterSweep };
+    if (numThreads > 1 || isOverlapParallel)
+        workerPool.reset(new WorkerPool { numThreads });
+    if (numThreads > 1)
+        associationBatch.reset(new AssociationBatch { *workerPool });
+
+    // with parallelOverlap, overlaps are resolved by independent clusters of complexes, on the same threads
+    if (isOverlapParallel)
+        overlapClusters.reset(new OverlapClusters { *workerPool });
+
+    // with closureIndexSize > 0, loops within large complexes are found from their own free interfaces
+    if (params.closureIndexSize > 0 && !membraneObject.isSphere)
+        closureIndex.reset(new ClosureIndex { params, forwardRxns });
+
+    //set some parameters
+    if (params.checkPoint == -1) {
+        params.checkPoint = params.nItr / 10;
+    }
+
+    // set the excludeVolumeBoundList for each molTemplate according to the reaction list
+    for (auto& oneReaction : forwardRxns) {
+        if (oneReaction.excludeVolumeBound == true) {
+            // this reaction declare that excludeVolumeBound, now add the partner's index to the excludeVolumeBoundList
+            int react1MolIndex = oneReaction.reactantListNew[0].molTypeIndex;
+            int react1InfIndex = oneReaction.reactantListNew[0].relIfaceIndex;
+            int react1InfAbsIndex = oneReaction.reactantListNew[0].absIfaceIndex;
+            int react2MolIndex = oneReaction.reactantListNew[1].molTypeIndex;
+            int react2InfIndex = oneReaction.reactantListNew[1].relIfaceIndex;
+            int react2InfAbsIndex = oneReaction.reactantListNew[1].absIfaceIndex;
+            molTemplateList[react1MolIndex].interfaceList[react1InfIndex].excludeVolumeBoundList.push_back(react2MolIndex);
+            molTemplateList[react2MolIndex].interfaceList[react2InfIndex].excludeVolumeBoundList.push_back(react1MolIndex);
+            molTemplateList[react1MolIndex].interfaceList[react1InfIndex].excludeVolumeBoundIfaceList.push_back(react2InfIndex);
+            molTemplateList[react2MolIndex].interfaceList[react2InfIndex].excludeVolumeBoundIfaceList.push_back(react1InfIndex);
+            molTemplateList[react1MolIndex].interfaceList[react1InfIndex].excludeRadiusList.push_back(oneReaction.bindRadius);
+            molTemplateList[react2MolIndex].interfaceList[react2InfIndex].excludeRadiusList.push_back(oneReaction.bindRadius);
+            molTemplateList[react1MolIndex].interfaceList[react1InfIndex].excludeVolumeBoundReactList.push_back(oneReaction.relRxnIndex);
+            molTemplateList[react2MolIndex].interfaceList[react2InfIndex].excludeVolumeBoundReactList.push_back(oneReaction.relRxnIndex);
+            molTemplateList[react1MolIndex].excludeVolumeBound = true;
+            molTemplateList[react2MolIndex].excludeVolumeBound = true;
+        }
+    }
+
+    for (auto& oneComplex : complexList) {
+        oneComplex.update_properties(moleculeList, molTemplateList);
+    }
+
+    /*Print out system information*/
+    log << "\nSimulation Parameters\n";
+    params.display(log);
+    membraneObject.display(log);
+    log << "\nMolecule Information\n";
+    display_all_MolTemplates(log, molTemplateList);
+    log << "\nReactions\n";
+    display_all_reactions(log, forwardRxns, backRxns, createDestructRxns);
+
+    log << "*************** BEGIN SIMULATION **************** " << std::endl;
+
+    // begin the timer
+    MDTimer::time_point simulTimeStart = MDTimer::now();
+    durationList.assign(numSavedDurations, std::chrono::duration<double>(simulTimeStart - totalTimeStart));
+
+    if (params.fromRestart == true) {
+        read_rng_state(context.r, params.output_path("rng_state"));
+        // auto endTime = MDTimer::now();
+        // auto endTimeFormat = MDTimer::to_time_t(endTime);
+        std::ofstream restartFile { restartFileName, std::ios::out }; // to show different from append
+        // std::cout << "Writing restart file at iteration " << simItr << " ";
+        // if (0 < strftime(charTime, sizeof(charTime), "%F %T", std::localtime(&endTimeFormat)))
+        // std::cout << charTime << '\n';
+        write_rng_state(context.r, params.output_path("rng_state")); // write the current RNG state
+        write_restart(simItr, restartFile, params, simulVolume, moleculeList, complexList, molTemplateList,
+            forwardRxns, backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+        inSituAnalysis->write_state(restartFile);
+        restartFile.close();
+    }
+}
+
+void Simulation::flush_associations()
+{
+    if (associationBatch)
+        associationBatch->flush(params, forwardRxns, backRxns, moleculeList, complexList, molTemplateList,
+            observablesList, counterArrays, membraneObject, context);
+}
+
+void Simulation::resolve_overlap(Molecule& mol, gsl_rng* r)
+{
+    //Now track each complex (ncrosscom), and test for overlap of all proteins in that complex before
+    //performing final position updates.
+    // determine RS3Dinput
+    double RS3Dinput { 0.0 };
+    for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
+        if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - mol.molTypeIndex) < 1E-2) {
+            RS3Dinput = membraneObject.RS3Dvect[RS3Dindex + 300];
+            break;
+        }
+    }
+
+    if (complexList[mol.myComIndex].ncross > 0) {
+        if (mol.trajStatus == TrajStatus::none || mol.trajStatus == TrajStatus::canBeResampled) {
+            // For any protein that overlapped and did not react, check whether it overlaps with its partners,
+            // do all proteins in the same complex at the same time.
+            // Also, if both proteins are stuck to membrane, only do xy displacement, ignore z
+            // TODO: Maybe do a boundary sphere overlap check first?
+
+            if (std::abs(complexList[mol.myComIndex].D.z) < 1E-10 && useClusterSweep) {
+                sweep_separation_complex_rot_memtest_cluster(
+                    simItr, mol.index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r, log);
+            } else if (std::abs(complexList[mol.myComIndex].D.z) < 1E-10) {
+                sweep_separation_complex_rot_memtest(
+                    simItr, mol.index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r, log);
+            } else {
+                sweep_separation_complex_rot(
+                    simItr, mol.index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r);
+            }
+            if (membraneObject.isSphere == true)
+                reflect_complex_rad_rot(membraneObject, complexList[mol.myComIndex], moleculeList, RS3Dinput);
+        }
+    } else {
+        if (mol.trajStatus == TrajStatus::none || mol.trajStatus == TrajStatus::canBeResampled) {
+            // For proteins with ncross=0, they either moved independently, or their displacements
+            // were selected based on the complex they were part of, and they may not yet been moved.
+            if (membraneObject.isSphere == true) {
+                if (mol.trajStatus == TrajStatus::none) {
+                    create_complex_propagation_vectors(params, complexList[mol.myComIndex], moleculeList,
+                        complexList, molTemplateList, membraneObject, r);
+                    for (auto& memMol : complexList[mol.myComIndex].memberList)
+                        moleculeList[memMol].trajStatus = TrajStatus::canBeResampled;
+                }
+                complexList[mol.myComIndex].propagate(moleculeList, membraneObject, molTemplateList);
+                reflect_complex_rad_rot(membraneObject, complexList[mol.myComIndex], moleculeList, RS3Dinput);
+            } else {
+                // reflect_traj_complex_rad_rot(params, moleculeList, complexList[mol.myComIndex], membraneObject, RS3Dinput);
+                if (mol.trajStatus == TrajStatus::none) {
+                    create_complex_propagation_vectors(params, complexList[mol.myComIndex], moleculeList,
+                        complexList, molTemplateList, membraneObject, r);
+                    for (auto& memMol : complexList[mol.myComIndex].memberList)
+                        moleculeList[memMol].trajStatus = TrajStatus::canBeResampled;
+                }
+                complexList[mol.myComIndex].propagate(moleculeList, membraneObject, molTemplateList);
+            }
+        }
+    }
+}
+
+bool Simulation::step()
+{
+    if (!isInitialized || isFinished || simItr + 1 >= params.nItr)
+        return false;
+    ++simItr;
+
+    MDTimer::time_point startStep = MDTimer::now();
+
+    // destruct, unimol create, and dissociation (explicit) based on population
+    check_for_unimolecular_reactions_population(simItr, params, moleculeList, complexList,
+        simulVolume, forwardRxns, backRxns, createDestructRxns, molTemplateList, observablesList, counterArrays,
+        membraneObject, context);
+
+    // Update member lists after creation and destruction
+    simulVolume.update_memberMolLists(params, moleculeList, complexList, molTemplateList, membraneObject, simItr, log);
+
+    // Zeroth order reactions (creation)
+    check_for_zeroth_order_creation(simItr, params, simulVolume, forwardRxns,
+        createDestructRxns, moleculeList, complexList, molTemplateList, observablesList, counterArrays, membraneObject, context);
+
+    // Update member lists after creation and destruction
+    simulVolume.update_memberMolLists(params, moleculeList, complexList, molTemplateList, membraneObject, simItr, log);
+
+    if (inSituAnalysis->is_active() && simItr % params.analysis.write == 0)
+        inSituAnalysis->sample(moleculeList, complexList, simulVolume, membraneObject);
+
+    // check for unimol state change reactions
+    if (params.hasUniMolStateChange == true) {
+        check_for_unimolstatechange_reactions(simItr, params, moleculeList, complexList,
+            simulVolume, forwardRxns, backRxns, createDestructRxns, molTemplateList, observablesList, counterArrays, membraneObject, context.r);
+    }
+
+    /*Skip this entire loop if the system has no implicit lipids. */
+    if (params.implicitLipid == true) {
+        // check dissociation (implicit)
+        for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+            // only do checks if the Molecule exists
+            if (moleculeList[molItr].isEmpty || moleculeList[molItr].isImplicitLipid == true || complexList[moleculeList[molItr].myComIndex].OnSurface == false || params.implicitLipid == false)
+                continue;
+            check_dissociation_implicitlipid(simItr, params, simulVolume, molTemplateList, observablesList, molItr, moleculeList, complexList, backRxns, forwardRxns, createDestructRxns, counterArrays, membraneObject, tables->IL2DbindingVec, tables->IL2DUnbindingVec, tables->ILTableIDs, context);
+        }
+    }
+
+    // Measure separations between proteins in neighboring cells to identify all possible reactions.
+    if (closureIndex)
+        closureIndex->build(moleculeList, complexList);
+    if (params.verletSkin > 0) {
+        // reuse the candidate pairs from the Verlet list until some molecule has moved more than skin/2
+        if (simulVolume.verlet_list_is_stale(moleculeList))
+            simulVolume.build_verlet_list(params, moleculeList, membraneObject);
+        for (auto targMolIndex : simulVolume.verletList.targMolList) {
+            if (moleculeList[targMolIndex].isEmpty || moleculeList[targMolIndex].isImplicitLipid)
+                continue;
+
+            //Test bimolecular reactions, and binding to implicit-lipids
+            if (moleculeList[targMolIndex].freelist.size() > 0 || molTemplateList[moleculeList[targMolIndex].molTypeIndex].excludeVolumeBound == true) {
+                // first, check for implicit-lipid binding
+                int protype = moleculeList[targMolIndex].molTypeIndex;
+                if (molTemplateList[protype].bindToSurface == true) {
+                    check_implicit_reactions(targMolIndex, implicitlipidIndex, simItr, params, moleculeList, complexList, molTemplateList,
+                        forwardRxns, backRxns, counterArrays, membraneObject, tables->IL2DbindingVec, tables->IL2DUnbindingVec, tables->ILTableIDs, tables->mutex, context);
+                }
+                // secondly, loop over all proteins within rMaxLimit + skin when the list was built
+                for (auto partMolIndex : simulVolume.verletList.partnerList[targMolIndex]) {
+                    if (moleculeList[partMolIndex].isEmpty)
+                        continue;
+                    check_bimolecular_reactions(targMolIndex, partMolIndex, simItr, tables->tableIDs.data(), tables->DDTableIndex, params,
+                        tables->normMatrices, tables->survMatrices, tables->pirMatrices, tables->mutex, moleculeList, complexList, molTemplateList,
+                        forwardRxns, backRxns, counterArrays, membraneObject, context);
+                } // loop over Verlet partners
+            } // if protein i is free to bind
+        } // End looping over all Verlet targets.
+    } else {
+        // crowded sub-volumes are split so no cell holds more than maxCellOccupancy molecules
+        if (params.maxCellOccupancy > 0)
+            simulVolume.build_adaptive_grid(params, moleculeList);
+        std::vector<SimulVolume::SubVolume>& searchCellList
+            = (params.maxCellOccupancy > 0) ? simulVolume.adaptiveGrid.leafList : simulVolume.subCellList;
+        for (unsigned cellItr { 0 }; cellItr < searchCellList.size(); ++cellItr) {
+            for (unsigned memItr { 0 }; memItr < searchCellList[cellItr].memberMolList.size(); ++memItr) {
+                int targMolIndex { searchCellList[cellItr].memberMolList[memItr] };
+                if (moleculeList[targMolIndex].isImplicitLipid)
+                    continue;
+
+                //Test bimolecular reactions, and binding to implicit-lipids
+                if (moleculeList[targMolIndex].freelist.size() > 0 || molTemplateList[moleculeList[targMolIndex].molTypeIndex].excludeVolumeBound == true) {
+                    // first, check for implicit-lipid binding
+                    int protype = moleculeList[targMolIndex].molTypeIndex;
+                    if (molTemplateList[protype].bindToSurface == true) {
+                        check_implicit_reactions(targMolIndex, implicitlipidIndex, simItr, params, moleculeList, complexList, molTemplateList,
+                            forwardRxns, backRxns, counterArrays, membraneObject, tables->IL2DbindingVec, tables->IL2DUnbindingVec, tables->ILTableIDs, tables->mutex, context);
+                    }
+                    // secondly, loop over proteins in your same cell.
+                    for (unsigned memItr2 { memItr + 1 }; memItr2 < searchCellList[cellItr].memberMolList.size(); ++memItr2) {
+                        int partMolIndex { searchCellList[cellItr].memberMolList[memItr2] };
+                        check_bimolecular_reactions(targMolIndex, partMolIndex, simItr, tables->tableIDs.data(), tables->DDTableIndex, params,
+                            tables->normMatrices, tables->survMatrices, tables->pirMatrices, tables->mutex, moleculeList, complexList, molTemplateList,
+                            forwardRxns, backRxns, counterArrays, membraneObject, context);
+                    } // loop over protein partners in your same cell
+                    // thirdly, loop over all neighboring cells, and all proteins in those cells.
+                    // for PBC, all cells have maxnbor neighbor cells. For reflecting, edge have fewer.
+                    for (auto& neighCellItr : searchCellList[cellItr].neighborList) {
+                        for (unsigned memItr2 { 0 }; memItr2 < searchCellList[neighCellItr].memberMolList.size(); ++memItr2) {
+                            int partMolIndex { searchCellList[neighCellItr].memberMolList[memItr2] };
+                            check_bimolecular_reactions(targMolIndex, partMolIndex, simItr, tables->tableIDs.data(), tables->DDTableIndex, params,
+                                tables->normMatrices, tables->survMatrices, tables->pirMatrices, tables->mutex, moleculeList, complexList, molTemplateList,
+                                forwardRxns, backRxns, counterArrays, membraneObject, context);
+                        } // loop over all proteins in this neighbor cell
+                    } // loop over all neighbor cells
+                } // if protein i is free to bind
+            } // loop over all proteins in initial cell
+        } // End looping over all cells.
+    }
+    if (closureIndex) {
+        for (auto& candidate : closureIndex->candidateList)
+            check_binding_within_complex(candidate.pro1Index, candidate.pro2Index, candidate.relIface1,
+                candidate.relIface2, params, moleculeList, complexList, molTemplateList, forwardRxns, backRxns,
+                counterArrays, membraneObject, context);
+    }
+
+    // isolated complexes that barely move, or are far from everything, skip propagation until a partner or a
+    // reaction wakes them up, or the steps they skipped are as many as is safe
+    if (params.dormantDisplace > 0 || params.maxStepMultiple > 1)
+        numDormantComplexes = update_dormant_complexes(params, simulVolume, membraneObject, moleculeList, complexList);
+
+    /*Now that separations and reaction probabilities are calculated, decide whether to perform reactions for each protein.*/
+    for (int molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+        // only continue if the molecule actually exists, and isn't implicit-lipid
+        if (moleculeList[molItr].isEmpty || moleculeList[molItr].isImplicitLipid)
+            continue;
+
+        // associations held back in the AssociationBatch are performed before anything that depends on them
+        if (associationBatch && associationBatch->pending(molItr, moleculeList))
+            flush_associations();
+
+        //Skip any proteins that just dissociated during this time step
+        if (moleculeList[molItr].crossbase.size() > 0) {
+            /* Evaluate whether to perform a reaction with protein i, and with whom. Flag=1 means
+             * reaction is performed. Returns correct ci1 and ci2 for this rxn.
+             * Loop over all reactions individually, instead of summing probabilities
+             */
+            // these are indices in crossbase/mycrossint/crossrxn of the reaction for molecules 1 and 2,
+            // should it occur
+            int crossIndex1 { 0 };
+            int crossIndex2 { 0 };
+            bool willReact { determine_if_reaction_occurs(crossIndex1, crossIndex2, Constants::iRandMax, moleculeList[molItr], moleculeList, forwardRxns, context.r) };
+            if (params.debugParams.forceAssoc) {
+                willReact = false; // we chose an association reaction
+                crossIndex1 = 0;
+                int molItr2 = moleculeList[molItr].crossbase[crossIndex1]; // crosspart[p1][ci1];
+                double pmatch = moleculeList[molItr].probvec[crossIndex1];
+                if (pmatch > 0)
+                    willReact = true;
+                if (!moleculeList[molItr].isImplicitLipid) {
+                    for (unsigned j = 0; j < moleculeList[molItr2].crossbase.size(); ++j) {
+                        if (moleculeList[molItr2].probvec[j] == pmatch) {
+                            crossIndex2 = j;
+                            if (moleculeList[molItr].crossrxn[crossIndex1]
+                                == moleculeList[molItr2].crossrxn[crossIndex2])
+                                break;
+                        }
+                    }
+                } else {
+                    crossIndex2 = 0;
+                }
+            }
+            if (willReact) {
+                /* This molecule will perform a bimolecular reaction
+                 * either physically associate two molecules into a complex (A+B->AB)
+                 * or change state of one (or both) reactants (A+B->A+B')
+                 */
+                int molItr2 { moleculeList[molItr].crossbase[crossIndex1] };
+                int ifaceIndex1 { moleculeList[molItr].mycrossint[crossIndex1] };
+                int ifaceIndex2;
+                if (moleculeList[molItr2].isImplicitLipid == false) {
+                    ifaceIndex2 = moleculeList[molItr2].mycrossint[crossIndex2];
+                } else {
+                    ifaceIndex2 = 0;
+                }
+                std::array<int, 3> rxnIndex = moleculeList[molItr].crossrxn[crossIndex1];
+
+                // the reaction places the reactants instead of moving them, so first move them by any skipped steps
+                catch_up_dormant_complex(params, complexList[moleculeList[molItr].myComIndex], moleculeList, complexList,
+                    molTemplateList, membraneObject, context.r);
+                if (moleculeList[molItr2].isImplicitLipid == false)
+                    catch_up_dormant_complex(params, complexList[moleculeList[molItr2].myComIndex], moleculeList,
+                        complexList, molTemplateList, membraneObject, context.r);
+
+                /*First if statement is to determine if reactants are physically associating*/
+                if (forwardRxns[rxnIndex[0]].rxnType == ReactionType::bimolecular) {
+                    if (moleculeList[molItr2].isImplicitLipid) {
+                        flush_associations();
+                        // std::cout << "Performing binding of molecules " << molItr << " to the membrane surface "
+                        //           << " ["
+                        //           << molTemplateList[moleculeList[molItr].molTypeIndex].molName << "("
+                        //           << molTemplateList[moleculeList[molItr].molTypeIndex].interfaceList[ifaceIndex1].name
+                        //           << ")] with [reaction, rate] = [" << rxnIndex[0] << ',' << rxnIndex[1]
+                        //           << "] Rate: " << forwardRxns[rxnIndex[0]].rateList[rxnIndex[1]].rate << " at iteration " << simItr << ".\n";
+                        // std::cout << " Complex 1 size: " << complexList[moleculeList[molItr].myComIndex].memberList.size() << "\n";
+                        // std::cout << "Implicit lipid, my Com Index: " << moleculeList[molItr2].myComIndex << " size of memberlist: " << complexList[moleculeList[molItr2].myComIndex].memberList.size() << std::endl;
+
+                        if (moleculeList[molItr].interfaceList[ifaceIndex1].index == forwardRxns[rxnIndex[0]].reactantListNew[0].absIfaceIndex) { //IL is listed second as the reactant.
+                            associate_implicitlipid(ifaceIndex1, ifaceIndex2, moleculeList[molItr], moleculeList[molItr2],
+                                complexList[moleculeList[molItr].myComIndex], complexList[moleculeList[molItr2].myComIndex], params, forwardRxns[rxnIndex[0]],
+                                moleculeList, molTemplateList, observablesList, counterArrays, complexList, membraneObject, forwardRxns, backRxns, context);
+                        } else { //IL is listed first as the reactant.
+                            associate_implicitlipid(ifaceIndex2, ifaceIndex1, moleculeList[molItr2], moleculeList[molItr],
+                                complexList[moleculeList[molItr2].myComIndex], complexList[moleculeList[molItr].myComIndex], params, forwardRxns[rxnIndex[0]],
+                                moleculeList, molTemplateList, observablesList, counterArrays, complexList, membraneObject, forwardRxns, backRxns, context);
+                        }
+                    }
+                    if (moleculeList[molItr2].isImplicitLipid == false) {
+                        // std::cout << "Performing association between molecules " << molItr << " and " << molItr2 << " ["
+                        //           << molTemplateList[moleculeList[molItr].molTypeIndex].molName << "("
+                        //           << molTemplateList[moleculeList[molItr].molTypeIndex].interfaceList[ifaceIndex1].name
+                        //           << ") and " << molTemplateList[moleculeList[molItr2].molTypeIndex].molName << "("
+                        //           << molTemplateList[moleculeList[molItr2].molTypeIndex].interfaceList[ifaceIndex2].name
+                        //           << ")] with [reaction, rate] = [" << rxnIndex[0] << ',' << rxnIndex[1]
+                        //           << "] Rate: " << forwardRxns[rxnIndex[0]].rateList[rxnIndex[1]].rate << " at iteration " << simItr << ".\n";
+                        // std::cout << " Complex 1 size: " << complexList[moleculeList[molItr].myComIndex].memberList.size() << "\n";
+                        // std::cout << " Complex 2 size: " << complexList[moleculeList[molItr2].myComIndex].memberList.size() << "\n";
+
+                        // For association, molecules must be read in in the order used to define the reaction parameters.
+                        AssociationBatch::Event event { ifaceIndex1, ifaceIndex2, molItr, molItr2, rxnIndex[0] };
+                        if (moleculeList[molItr].interfaceList[ifaceIndex1].index
+                            != forwardRxns[rxnIndex[0]].reactantListNew[0].absIfaceIndex)
+                            event = AssociationBatch::Event { ifaceIndex2, ifaceIndex1, molItr2, molItr, rxnIndex[0] };
+
+                        if (associationBatch && AssociationBatch::can_hold(event, moleculeList, membraneObject)) {
+                            associationBatch->hold(event, moleculeList, complexList);
+                        } else {
+                            flush_associations();
+                            Molecule& reactMol1 { moleculeList[event.molIndex1] };
+                            Molecule& reactMol2 { moleculeList[event.molIndex2] };
+                            associate(event.ifaceIndex1, event.ifaceIndex2, reactMol1, reactMol2,
+                                complexList[reactMol1.myComIndex], complexList[reactMol2.myComIndex], params, forwardRxns[rxnIndex[0]],
+                                moleculeList, molTemplateList, observablesList,
+                                counterArrays, complexList, membraneObject, forwardRxns, backRxns, context);
+                        }
+                    }
+                } else if (forwardRxns[rxnIndex[0]].rxnType == ReactionType::biMolStateChange) {
+                    flush_associations();
+                    if (moleculeList[molItr2].isImplicitLipid) {
+                        //In this case, one implicit lipid changes state.
+                        int facilMolIndex { molItr };
+                        int facilIfaceIndex { ifaceIndex1 };
+                        int facilComIndex { moleculeList[molItr].myComIndex };
+                        int stateMolIndex { molItr2 };
+                        int stateComIndex { moleculeList[molItr2].myComIndex };
+                        int stateIfaceIndex { ifaceIndex2 };
+                        // figure out if the current molecule is the facilitator molecule or the IL which has its
+                        // interface state changed
+                        if (moleculeList[molItr].molTypeIndex
+                            != forwardRxns[rxnIndex[0]].reactantListNew[0].molTypeIndex) {
+                            facilMolIndex = molItr2;
+                            facilIfaceIndex = ifaceIndex2;
+                            facilComIndex = moleculeList[molItr2].myComIndex;
+                            stateMolIndex = molItr;
+                            stateComIndex = moleculeList[molItr].myComIndex;
+                            stateIfaceIndex = ifaceIndex1;
+                        }
+                        // std::cout << "Performing bimolecular state change on molecule (IL) " << stateMolIndex
+                        //           << " as facilitated by molecule " << facilMolIndex << " at iteration " << simItr
+                        //           << '\n';
+                        perform_implicitlipid_state_change(stateIfaceIndex, facilIfaceIndex, rxnIndex,
+                            moleculeList[stateMolIndex], moleculeList[facilMolIndex], complexList[stateComIndex],
+                            complexList[facilComIndex], counterArrays, params, forwardRxns, backRxns, moleculeList,
+                            complexList, molTemplateList, observablesList, membraneObject, context);
+                    }
+                    if (moleculeList[molItr2].isImplicitLipid == false) {
+                        //In this case, after two molecules collide, at least one of them changes state, rather than forming a complex.
+                        int facilMolIndex { molItr };
+                        int facilIfaceIndex { ifaceIndex1 };
+                        int facilComIndex { moleculeList[molItr].myComIndex };
+                        int stateMolIndex { molItr2 };
+                        int stateComIndex { moleculeList[molItr2].myComIndex };
+                        int stateIfaceIndex { ifaceIndex2 };
+                        // figure out if the current molecule is the facilitator molecule or the molecule which has its
+                        // interface state changed
+                        if (moleculeList[molItr].molTypeIndex
+                            != forwardRxns[rxnIndex[0]].reactantListNew[0].molTypeIndex) {
+                            facilMolIndex = molItr2;
+                            facilIfaceIndex = ifaceIndex2;
+                            facilComIndex = moleculeList[molItr2].myComIndex;
+                            stateMolIndex = molItr;
+                            stateComIndex = moleculeList[molItr].myComIndex;
+                            stateIfaceIndex = ifaceIndex1;
+                        }
+
+                        // std::cout << "Performing bimolecular state change on molecule " << stateMolIndex
+                        //           << " as facilitated by molecule " << facilMolIndex << " at iteration " << simItr
+                        //           << '\n';
+                        perform_bimolecular_state_change(stateIfaceIndex, facilIfaceIndex, rxnIndex,
+                            moleculeList[stateMolIndex], moleculeList[facilMolIndex], complexList[stateComIndex],
+                            complexList[facilComIndex], counterArrays, params, forwardRxns, backRxns, moleculeList,
+                            complexList, molTemplateList, observablesList, membraneObject, context);
+                    }
+                } else {
+                    std::cerr << "ERROR: Attemping bimolecular reaction which has no reaction type. Exiting..\n";
+                    exit(1);
+                }
+            } else {
+                /*No reaction was chosen for this molecule*/
+                if (moleculeList[molItr].trajStatus == TrajStatus::none) {
+                    // Propagate complex with random translational and rotational motion
+                    create_complex_propagation_vectors(params, complexList[moleculeList[molItr].myComIndex], moleculeList,
+                        complexList, molTemplateList, membraneObject, context.r);
+                    for (auto& memMol : complexList[moleculeList[molItr].myComIndex].memberList)
+                        moleculeList[memMol].trajStatus = TrajStatus::canBeResampled;
+                }
+                // Set probability of this protein to zero in all reactions so it doesn't try to
+                // react again but the partners still will avoid overlapping.
+                for (unsigned crossItr { 0 }; crossItr < moleculeList[molItr].crossbase.size(); ++crossItr) {
+                    int skipMol { moleculeList[molItr].crossbase[crossItr] };
+                    for (unsigned crossItr2 { 0 }; crossItr2 < moleculeList[skipMol].crossbase.size();
+                         ++crossItr2) {
+                        if (moleculeList[skipMol].crossbase[crossItr2] == moleculeList[molItr].index)
+                            moleculeList[skipMol].probvec[crossItr2] = 0;
+                    }
+                }
+            }
+
+        } else if (moleculeList[molItr].crossbase.size() == 0) {
+            /* this protein has ncross=0,
+             * meaning it neither dissociated nor tried to associate.
+             * however, it could have movestat=2 if it is part of a multi-protein
+             * complex that already displaced.
+             */
+            if (moleculeList[molItr].trajStatus == TrajStatus::none) {
+                create_complex_propagation_vectors(params, complexList[moleculeList[molItr].myComIndex], moleculeList,
+                    complexList, molTemplateList, membraneObject, context.r);
+                for (auto& memMol : complexList[moleculeList[molItr].myComIndex].memberList)
+                    moleculeList[memMol].trajStatus = TrajStatus::canBeResampled;
+            }
+        }
+    } // done testing all molecules for bimolecular reactions
+    flush_associations();
+
+    // Now we have to check for overlap!!!
+    if (overlapClusters) {
+        overlapClusters->build(moleculeList, complexList);
+        overlapClusters->resolve(
+            context.r, [this](int molIndex, gsl_rng* clusterRng) { resolve_overlap(moleculeList[molIndex], clusterRng); });
+    } else {
+        for (auto& mol : moleculeList) {
+            if (mol.isEmpty || mol.isImplicitLipid || mol.trajStatus == TrajStatus::propagated)
+                continue;
+            resolve_overlap(mol, context.r);
+        }
+    }
+
+    if (simItr % params.trajWrite == 0) {
+        // std::cout << "Writing trajectory...\n";
+        queue_write_traj(*outputQueue, simItr, trajFileName, params, moleculeList, complexList, molTemplateList,
+            membraneObject);
+    }
+
+    if (params.pdbWrite != -1) {
+        if (simItr % params.pdbWrite == 0) {
+            // std::cout << "Writing PDB file for current frame...\n";
+            queue_write_pdb(*outputQueue, pdbStream, simItr, params, moleculeList, complexList, molTemplateList,
+                membraneObject);
+        }
+    }
+
+    //remove the empty complexes
+    //first remove the empty complexes in the tail
+    while (complexList.back().isEmpty == true) {
+        int tempIndex { complexList.back().index }; // the removed complex's index
+        complexList.pop_back();
+        //update context.emptyComList
+        for (auto& tempEmpty : context.emptyComList) {
+            if (tempEmpty == tempIndex) {
+                tempEmpty = context.emptyComList.back();
+                context.emptyComList.pop_back();
+                break;
+            }
+        }
+    }
+
+    // put the last non-empty complex in the list to the non-last empty slot
+    while (context.emptyComList.empty() == false) {
+        int slotIndex { context.emptyComList.back() };
+        int previousIndex { complexList.back().index };
+
+        complexList[slotIndex] = complexList.back();
+        complexList[slotIndex].index = slotIndex;
+        complexList.pop_back();
+
+        // change the mol.myComIndex with previousIndex to slotIndex
+        for (auto mp : complexList[slotIndex].memberList) {
+            moleculeList[mp].myComIndex = slotIndex;
+        }
+
+        //update context.emptyComList
+        context.emptyComList.pop_back();
+
+        //remove the empty complexes in the tail
+        while (complexList.back().isEmpty == true) {
+            int tempIndex { complexList.back().index }; // the removed complex's index
+            complexList.pop_back();
+            //update context.emptyComList
+            for (auto& tempEmpty : context.emptyComList) {
+                if (tempEmpty == tempIndex) {
+                    tempEmpty = context.emptyComList.back();
+                    context.emptyComList.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------------
+    //remove the empty molecules
+    //first remove the empty molecule in the tail
+    while (moleculeList.back().isEmpty == true) {
+        int tempIndex { moleculeList.back().index }; // the removed molecule's index
+        moleculeList.pop_back();
+        //update context.emptyMolList
+        for (auto& tempEmpty : context.emptyMolList) {
+            if (tempEmpty == tempIndex) {
+                tempEmpty = context.emptyMolList.back();
+                context.emptyMolList.pop_back();
+                break;
+            }
+        }
+    }
+
+    // put the last non-empty molecule in the list to the non-last empty slot
+    while (context.emptyMolList.empty() == false) {
+        int slotIndex { context.emptyMolList.back() };
+        int previousIndex { moleculeList.back().index };
+
+        moleculeList[slotIndex] = moleculeList.back();
+        moleculeList[slotIndex].index = slotIndex;
+        moleculeList.pop_back();
+
+        // change the mol.index with previousIndex to slotIndex, include complex.memberlist; interface.interaction.partnerIndex;mol.bndpartner
+        int tmpComIndex { moleculeList[slotIndex].myComIndex };
+        for (auto& tmpMember : complexList[tmpComIndex].memberList) {
+            if (tmpMember == previousIndex)
+                tmpMember = slotIndex;
+        }
+
+        for (auto& tmpPartner : moleculeList[slotIndex].bndpartner) {
+            for (auto& partner : moleculeList[tmpPartner].bndpartner) {
+                if (partner == previousIndex)
+                    partner = slotIndex;
+            }
+            for (auto& tmpIface : moleculeList[tmpPartner].interfaceList) {
+                if (tmpIface.interaction.partnerIndex == previousIndex)
+                    tmpIface.interaction.partnerIndex = slotIndex;
+            }
+        }
+
+        // update the oneTemp.monomerList if it is necessary
+        MolTemplate& oneTemp { molTemplateList[moleculeList[slotIndex].molTypeIndex] };
+        if (oneTemp.canDestroy == true) {
+            std::vector<int>& oneList { oneTemp.monomerList };
+            std::vector<int>::iterator result { std::find(std::begin(oneList), std::end(oneList), previousIndex) }; //check whether previousIndex in oneTemp.monomerList
+            if (result != std::end(oneList)) {
+                oneList.erase(result);
+                oneList.emplace_back(slotIndex);
+            }
+        }
+
+        // update the countArrays.bindPairList
+        // check whether previousIndex in countArrays.bindPairList
+        for (auto& oneSpecie : counterArrays.bindPairList) {
+            for (auto& oneIndex : oneSpecie) {
+                if (oneIndex == previousIndex) {
+                    oneIndex = slotIndex;
+                }
+            }
+        }
+        // for (auto& oneSpecie : counterArrays.bindPairListIL2D) {
+        //     for (auto& oneIndex : oneSpecie) {
+        //         if (oneIndex == previousIndex) {
+        //             oneIndex = slotIndex;
+        //         }
+        //     }
+        // }
+        // for (auto& oneSpecie : counterArrays.bindPairListIL3D) {
+        //     for (auto& oneIndex : oneSpecie) {
+        //         if (oneIndex == previousIndex) {
+        //             oneIndex = slotIndex;
+        //         }
+        //     }
+        // }
+
+        //update context.emptyMolList
+        context.emptyMolList.pop_back();
+
+        //remove the empty molecules in the tail
+        while (moleculeList.back().isEmpty == true) {
+            int tempIndex { moleculeList.back().index }; // the removed molecule's index
+            moleculeList.pop_back();
+            //update context.emptyMolList
+            for (auto& tempEmpty : context.emptyMolList) {
+                if (tempEmpty == tempIndex) {
+                    tempEmpty = context.emptyMolList.back();
+                    context.emptyMolList.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+    //------------------------------------------------------------------------------------
+
+    // Clear lists used for reweighting and encounter tracking
+    for (auto& oneMol : moleculeList) {
+        if (oneMol.isEmpty || oneMol.isImplicitLipid)
+            continue;
+
+        clear_reweight_vecs(oneMol);
+        oneMol.trajStatus = TrajStatus::none;
+        oneMol.crossbase.clear();
+        oneMol.mycrossint.clear();
+        oneMol.crossrxn.clear();
+        oneMol.probvec.clear();
+
+        // update complexes. if the complex has more than one member, it'll be updated
+        // more than once, but this is probably more efficient than iterating over the complexes afterwards
+        complexList[oneMol.myComIndex].ncross = 0;
+        complexList[oneMol.myComIndex].trajStatus = TrajStatus::none;
+    }
+
+    //write restart
+    if (simItr % params.restartWrite == 0) {
+        // the output files must be complete up to the restart point
+        outputQueue->flush();
+        pdbStream.flush();
+        timeSeries.flush();
+        if (inSituAnalysis->is_active())
+            inSituAnalysis->write(molTemplateList, membraneObject);
+        auto endTime = MDTimer::now();
+        auto endTimeFormat = MDTimer::to_time_t(endTime);
+        std::ofstream restartFile { restartFileName, std::ios::out }; // to show different from append
+        // std::cout << "Writing restart file at iteration " << simItr;
+        //                      << ", system time: " << std::put_time(std::localtime(&endTimeFormat), "%F %T") << '\n';
+        // if (0 < strftime(charTime, sizeof(charTime), "%F %T", std::localtime(&endTimeFormat)))
+        // std::cout << charTime << '\n';
+        write_rng_state(context.r, params.output_path("rng_state")); // write the current RNG state
+        write_restart(simItr, restartFile, params, simulVolume, moleculeList, complexList, molTemplateList,
+            forwardRxns, backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+        inSituAnalysis->write_state(restartFile);
+        restartFile.close();
+    }
+
+    //write check point
+    if (simItr % params.checkPoint == 0) {
+        outputQueue->flush();
+        write_rng_state(context.r, params.output_path("rng_state" + std::to_string(simItr))); // write the current RNG state
+        if (params.checkPointFullEvery > 1) {
+            // between full checkpoints, only what changed since the last one is written
+            std::ostringstream analysisState;
+            inSituAnalysis->write_state(analysisState);
+            checkpointChain->write(simItr, params, moleculeList, complexList, molTemplateList, observablesList,
+                membraneObject, counterArrays, context, analysisState.str(), [&](std::ostream& restartFile) {
+                    write_restart(simItr, restartFile, params, simulVolume, moleculeList, complexList, molTemplateList,
+                        forwardRxns, backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+                });
+        } else {
+            char fnameProXYZ[100];
+            sprintf(fnameProXYZ, "restart%lld.dat", simItr);
+            checkpointForker->write(params.output_path(fnameProXYZ), [&](std::ostream& restartFile) {
+                write_restart(simItr, restartFile, params, simulVolume, moleculeList, complexList, molTemplateList,
+                    forwardRxns, backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+                inSituAnalysis->write_state(restartFile);
+            });
+        }
+    }
+
+    using duration = std::chrono::duration<double>;
+    durationList.erase(durationList.begin());
+    durationList.emplace_back(MDTimer::now() - startStep);
+    if (simItr % params.timeWrite == 0) {
+        double timeSimulated { (simItr - params.itrRestartFrom) * params.timeStep * Constants::usToSeconds + params.timeRestartFrom };
+        log << linebreak;
+        log << "End iteration: " << simItr << ", simulation time: ";
+        log << std::scientific << timeSimulated << " seconds.\n";
+        // Write out N bound pairs, histogram of complex compositions, monomer/dimer counts, observables and species.
+        queue_write_time_series(*outputQueue, simItr, params, complexList, molTemplateList, context.numEachMolType, counterArrays,
+            observablesList, observablesFileName, membraneObject, timeSeries, pairOutfile, dimerfile, eventFile, assemblyfile,
+            speciesFile1);
+        auto endTime = MDTimer::now();
+        auto endTimeFormat = MDTimer::to_time_t(endTime);
+        log << "System time: ";
+        log << date_text(endTimeFormat) << '\n';
+        log << "Elapsed time: "
+                  << std::chrono::duration_cast<std::chrono::minutes>(MDTimer::now() - totalTimeStart).count()
+                  << " minutes\n";
+
+        log << "Number of molecules: " << context.numberOfMolecules << '\n';
+        log << "Number of complexes: " << context.numberOfComplexes << '\n';
+        log << "Total reaction matches: " << context.totMatches << '\n';
+        if (params.verletSkin > 0)
+            log << "Verlet list rebuilds: " << simulVolume.verletList.numRebuilds << '\n';
+        if (params.dormantDisplace > 0 || params.maxStepMultiple > 1)
+            log << "Dormant complexes: " << numDormantComplexes << '\n';
+        if (params.debugParams.printSystemInfo) {
+            log << "Printing full system information...\n";
+            std::ofstream systemInfoFile { params.output_path("system_information.dat"), std::ios::app };
+            print_system_information(simItr, systemInfoFile, moleculeList, complexList, molTemplateList);
+            systemInfoFile.close();
+        }
+        // Estimate time remaining
+        duration avgTimeStepDuration
+            = std::accumulate(durationList.begin(), durationList.end(), duration { 0 }) / numSavedDurations;
+        duration timeLeft = (params.nItr - simItr) * avgTimeStepDuration;
+        log << "Avg timestep duration: " << avgTimeStepDuration.count()
+                  << ", iterations remaining: " << params.nItr - simItr
+                  << ", Time left: " << std::chrono::duration_cast<std::chrono::minutes>(timeLeft).count()
+                  << " minutes\n";
+        auto estTimeLeft = std::chrono::time_point_cast<std::chrono::seconds>(MDTimer::now() + timeLeft);
+        auto estTimeEnd = std::chrono::system_clock::to_time_t(estTimeLeft);
+        log << "Estimated end time: ";
+        //<< std::put_time(std::localtime(&estTimeEnd), "%F %T") << '\n';
+        log << date_text(estTimeEnd) << '\n';
+        log << llinebreak;
+    }
+    return true;
+}
+
+void Simulation::finish()
+{
+    if (!isInitialized || isFinished)
+        return;
+    isFinished = true;
+
+    outputQueue->flush();
+    if (inSituAnalysis->is_active())
+        inSituAnalysis->write(molTemplateList, membraneObject);
+    // std::cout << "Writing restart file at final iteration\n.";
+    std::ofstream restartFile { restartFileName, std::ios::out }; // to show different from append
+    write_rng_state(context.r, params.output_path("rng_state")); // write the current RNG state
+    write_restart(simItr, restartFile, params, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns,
+        backRxns, createDestructRxns, observablesList, membraneObject, counterArrays, context);
+    inSituAnalysis->write_state(restartFile);
+    restartFile.close();
+
+    // std::cout << "Writing trajectory..." << '\n';
+    queue_write_traj(*outputQueue, simItr, trajFileName, params, moleculeList, complexList, molTemplateList,
+        membraneObject);
+
+    // std::cout << "Writing final configuration...\n";
+    write_xyz(params.output_path("final_coords.xyz"), params, moleculeList, molTemplateList);
+
+    if (params.pdbWrite != -1) {
+        // std::cout << "Writing PDB file for current frame.\n";
+        if (pdbStream.is_open() == false || simItr % params.pdbWrite != 0) // otherwise already in the stream
+            queue_write_pdb(*outputQueue, pdbStream, simItr, params, moleculeList, complexList, molTemplateList,
+                membraneObject);
+    }
+
+    if (params.debugParams.printSystemInfo) {
+        // std::cout << "Printing full system information...\n";
+        std::ofstream systemInfoFile { params.output_path("system_information.dat"), std::ios::app };
+        print_system_information(simItr, systemInfoFile, moleculeList, complexList, molTemplateList);
+        systemInfoFile.close();
+    }
+
+    // write observables
+    if (!observablesList.empty()) {
+        // std::cout << "Writing observables to file...\n";
+        std::ofstream observablesFile { observablesFileName, std::ios::app };
+        write_observables((simItr - params.itrRestartFrom) * params.timeStep * Constants::usToSeconds + params.timeRestartFrom, observablesFile, observablesList);
+        observablesFile.close();
+    }
+
+    // Write out species, N bound pairs, association events, histogram of complex compositions, and monomer/dimer counts.
+    write_counter_time_series(timeSeries, simItr, params, counterArrays, pairOutfile, eventFile, speciesFile1);
+    timeSeries.flush();
+    print_dimers(complexList, dimerfile, simItr, params, molTemplateList, context.numEachMolType);
+
+    int number_of_lipids = 0; //sum of all states of IL
+    for (int i = 0; i < membraneObject.numberOfFreeLipidsEachState.size(); i++) {
+        number_of_lipids += membraneObject.numberOfFreeLipidsEachState[i];
+    }
+    meanComplexSize = print_complex_hist(complexList, assemblyfile, simItr, params, molTemplateList, number_of_lipids, context.numEachMolType);
+
+    /*Write out final result*/
+    log << llinebreak << "End simulation\n";
+    auto endTime = MDTimer::now();
+    auto endTimeFormat = MDTimer::to_time_t(endTime);
+    log << "End date: ";
+    //<< std::put_time(std::localtime(&endTimeFormat), "%F %T") << '\n';
+    log << date_text(endTimeFormat) << '\n';
+    std::chrono::duration<double> wallTime = endTime - totalTimeStart;
+    log << "\tWall Time: ";
+    log << wallTime.count() << " seconds\n";
+}
+
+void Simulation::run()
+{
+    while (step()) { }
+    finish();
+}
@@ -0,0 +1,151 @@
+#include "classes/class_TimeSeriesFile.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+const char magicString[8] { 'N', 'E', 'R', 'D', 'S', 'S', 'T', 'S' };
+const int32_t formatVersion { 1 };
+
+template <typename T> void write_value(std::ofstream& file, T value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T> bool read_value(std::ifstream& file, T& value)
+{
+    return bool(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+template <typename T> void write_column(std::ofstream& file, const std::vector<T>& column)
+{
+    file.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+}
+
+template <typename T> bool read_column(std::ifstream& file, std::vector<T>& column, int numRows)
+{
+    column.resize(numRows);
+    return bool(file.read(reinterpret_cast<char*>(column.data()), numRows * sizeof(T)));
+}
+}
+
+TimeSeriesFile::~TimeSeriesFile() { flush(); }
+
+void TimeSeriesFile::open(const std::string& fileName, const Header& _header, int _blockSize)
+{
+    header = _header;
+    blockSize = std::max(1, _blockSize);
+    itrColumn.clear();
+    timeColumn.clear();
+    valueColumns.assign(header.numColumns, std::vector<int> {});
+
+    seriesFile.open(fileName, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!seriesFile) {
+        std::cerr << "ERROR: Cannot open " << fileName << " for writing. Exiting...\n";
+        exit(1);
+    }
+    seriesFile.write(magicString, sizeof(magicString));
+    write_value<int32_t>(seriesFile, formatVersion);
+    write_value<int32_t>(seriesFile, static_cast<int32_t>(header.kind));
+    write_value<int32_t>(seriesFile, header.numColumns);
+    write_value<double>(seriesFile, header.timeStep);
+    write_value<int64_t>(seriesFile, header.itrRestartFrom);
+    write_value<double>(seriesFile, header.timeRestartFrom);
+    write_value<int32_t>(seriesFile, header.textHeader.size());
+    seriesFile.write(header.textHeader.data(), header.textHeader.size());
+}
+
+void TimeSeriesFile::append_row(long long int simItr, double simTime, const std::vector<int>& values)
+{
+    itrColumn.push_back(simItr);
+    timeColumn.push_back(simTime);
+    for (int col { 0 }; col < header.numColumns; ++col)
+        valueColumns[col].push_back(values[col]);
+    if (int(itrColumn.size()) >= blockSize)
+        write_block();
+}
+
+void TimeSeriesFile::write_block()
+{
+    if (itrColumn.empty())
+        return;
+
+    write_value<int32_t>(seriesFile, itrColumn.size());
+    std::vector<int64_t> itrs(itrColumn.begin(), itrColumn.end());
+    write_column(seriesFile, itrs);
+    write_column(seriesFile, timeColumn);
+    for (auto& column : valueColumns) {
+        std::vector<int32_t> values(column.begin(), column.end());
+        write_column(seriesFile, values);
+        column.clear();
+    }
+    itrColumn.clear();
+    timeColumn.clear();
+}
+
+void TimeSeriesFile::flush()
+{
+    if (!is_open())
+        return;
+    write_block();
+    seriesFile.flush();
+}
+
+bool TimeSeriesFile::read(const std::string& fileName, Header& header,
+    const std::function<void(long long int simItr, double simTime, const std::vector<int>& values)>& onRow)
+{
+    std::ifstream seriesFile { fileName, std::ios::binary };
+    char magic[sizeof(magicString)];
+    int32_t version {};
+    if (!seriesFile.read(magic, sizeof(magic)) || std::memcmp(magic, magicString, sizeof(magic)) != 0
+        || !read_value(seriesFile, version) || version != formatVersion)
+        return false;
+
+    int32_t kind {};
+    int32_t numColumns {};
+    int64_t itrRestartFrom {};
+    int32_t headerLength {};
+    if (!read_value(seriesFile, kind) || !read_value(seriesFile, numColumns) || !read_value(seriesFile, header.timeStep)
+        || !read_value(seriesFile, itrRestartFrom) || !read_value(seriesFile, header.timeRestartFrom)
+        || !read_value(seriesFile, headerLength))
+        return false;
+    header.kind = static_cast<TimeSeriesKind>(kind);
+    header.numColumns = numColumns;
+    header.itrRestartFrom = itrRestartFrom;
+    header.textHeader.resize(headerLength);
+    if (!seriesFile.read(&header.textHeader[0], headerLength))
+        return false;
+
+    // a block cut short by a crash ends the file
+    int32_t numRows {};
+    std::vector<int64_t> itrs;
+    std::vector<double> times;
+    std::vector<std::vector<int32_t>> columns(numColumns);
+    std::vector<int> row(numColumns);
+    while (read_value(seriesFile, numRows)) {
+        if (!read_column(seriesFile, itrs, numRows) || !read_column(seriesFile, times, numRows))
+            break;
+        bool isComplete { true };
+        for (auto& column : columns)
+            isComplete = isComplete && read_column(seriesFile, column, numRows);
+        if (!isComplete)
+            break;
+
+        for (int rowIndex { 0 }; rowIndex < numRows; ++rowIndex) {
+            for (int col { 0 }; col < numColumns; ++col)
+                row[col] = columns[col][rowIndex];
+            onRow(itrs[rowIndex], times[rowIndex], row);
+        }
+    }
+    return true;
+}
+
+void TimeSeriesSet::flush()
+{
+    copyNumbers.flush();
+    boundPairs.flush();
+    eventCounters.flush();
+}
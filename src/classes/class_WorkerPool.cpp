@@ -0,0 +1,68 @@
+#include "classes/class_WorkerPool.hpp"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(int _numThreads)
+    : numThreads(std::max(1, _numThreads))
+{
+    for (int threadItr { 1 }; threadItr < numThreads; ++threadItr)
+        threadList.emplace_back(&WorkerPool::work, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        isStopping = true;
+    }
+    callStarted.notify_all();
+    for (auto& oneThread : threadList)
+        oneThread.join();
+}
+
+void WorkerPool::run(int _numTasks, const std::function<void(int)>& _task)
+{
+    if (threadList.empty() || _numTasks < 2) {
+        for (int taskItr { 0 }; taskItr < _numTasks; ++taskItr)
+            _task(taskItr);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(poolMutex);
+    task = &_task;
+    numTasks = _numTasks;
+    nextTask = 0;
+    numRunning = int(threadList.size());
+    ++callItr;
+    callStarted.notify_all();
+
+    run_tasks(lock);
+    callDone.wait(lock, [this] { return numRunning == 0; });
+    task = nullptr;
+}
+
+void WorkerPool::run_tasks(std::unique_lock<std::mutex>& lock)
+{
+    while (nextTask < numTasks) {
+        int taskItr { nextTask++ };
+        lock.unlock();
+        (*task)(taskItr);
+        lock.lock();
+    }
+}
+
+void WorkerPool::work()
+{
+    long long lastCallItr { 0 };
+    std::unique_lock<std::mutex> lock(poolMutex);
+    while (true) {
+        callStarted.wait(lock, [&] { return isStopping || callItr != lastCallItr; });
+        if (isStopping)
+            return;
+        lastCallItr = callItr;
+
+        run_tasks(lock);
+        if (--numRunning == 0)
+            callDone.notify_one();
+    }
+}
@@ -75,7 +75,7 @@ std::ostream& operator<<(std::ostream& os, const ReactionType& rxnType)
             throw std::invalid_argument("Invalid reaction type");
         }
     } catch (const std::invalid_argument& e) {
-        std::cout << e.what() << '\n';
+        std::cerr << e.what() << '\n';
         exit(1);
     }
 }
@@ -225,11 +225,11 @@ std::ostream& ParsedMol::display_full_name(std::ostream& os) const
     return os;
 }
 
-void ParsedMol::display() const
+void ParsedMol::display(std::ostream& os) const
 {
-    std::cout << "Parsed Mol: " << molName << '\n';
+    os << "Parsed Mol: " << molName << '\n';
     for (auto& iface : interfaceList)
-        std::cout << '[' << iface.ifaceName << ":{" << iface << "}]\n";
+        os << '[' << iface.ifaceName << ":{" << iface << "}]\n";
 }
 
 void ParsedMol::set_molTypeIndex(const std::vector<MolTemplate>& molTemplateList)
@@ -248,23 +248,24 @@ void ParsedMol::set_molTypeIndex(const std::vector<MolTemplate>& molTemplateList
 }
 
 void ParsedRxn::assemble_reactions(std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-    std::vector<CreateDestructRxn>& createDestructRxns, const std::vector<MolTemplate>& molTemplateList)
+    std::vector<CreateDestructRxn>& createDestructRxns, const std::vector<MolTemplate>& molTemplateList,
+    unsigned& numberOfRxns)
 {
 
     if (this->rxnType == ReactionType::bimolecular || this->rxnType == ReactionType::uniMolStateChange
         || this->rxnType == ReactionType::biMolStateChange) {
-        forwardRxns.emplace_back(*this, molTemplateList);
+        forwardRxns.emplace_back(*this, molTemplateList, numberOfRxns);
         forwardRxns.back().relRxnIndex = forwardRxns.size() - 1;
         // if the reaction is reversible, create the conjugate BackRxn
         if (forwardRxns.back().isReversible) {
-            backRxns.emplace_back(this->offRatekb, forwardRxns.back());
+            backRxns.emplace_back(this->offRatekb, forwardRxns.back(), numberOfRxns);
             backRxns.back().relRxnIndex = backRxns.size() - 1;
             create_conjugate_reaction_itrs(forwardRxns, backRxns);
         } else {
             forwardRxns.back().conjBackRxnIndex = -1;
         }
     } else {
-        createDestructRxns.emplace_back(*this, molTemplateList);
+        createDestructRxns.emplace_back(*this, molTemplateList, numberOfRxns);
         createDestructRxns.back().relRxnIndex = createDestructRxns.size() - 1;
     }
 }
@@ -295,60 +296,60 @@ std::pair<bool, std::string> ParsedRxn::isComplete(const std::vector<MolTemplate
     return std::make_pair(true, "Parameter set complete for reaction");
 }
 
-void ParsedRxn::display_angles() const
+void ParsedRxn::display_angles(std::ostream& os) const
 {
-    std::cout << std::setw(10) << std::left << "Theta 1" << std::setw(7) << std::right << assocAngles.theta1 << '\n';
-    std::cout << std::setw(10) << std::left << "Theta 2" << std::setw(7) << std::right << assocAngles.theta2 << '\n';
-    std::cout << std::setw(10) << std::left << "Phi 1" << std::setw(7) << std::right << assocAngles.phi1 << '\n';
-    std::cout << std::setw(10) << std::left << "Phi 2" << std::setw(7) << std::right << assocAngles.phi2 << '\n';
-    std::cout << std::setw(10) << std::left << "Omega" << std::setw(7) << std::right << assocAngles.omega << '\n';
+    os << std::setw(10) << std::left << "Theta 1" << std::setw(7) << std::right << assocAngles.theta1 << '\n';
+    os << std::setw(10) << std::left << "Theta 2" << std::setw(7) << std::right << assocAngles.theta2 << '\n';
+    os << std::setw(10) << std::left << "Phi 1" << std::setw(7) << std::right << assocAngles.phi1 << '\n';
+    os << std::setw(10) << std::left << "Phi 2" << std::setw(7) << std::right << assocAngles.phi2 << '\n';
+    os << std::setw(10) << std::left << "Omega" << std::setw(7) << std::right << assocAngles.omega << '\n';
 }
 
-void ParsedRxn::set_value(std::string& line, RxnKeyword rxnKeyword)
+void ParsedRxn::set_value(std::string& line, RxnKeyword rxnKeyword, std::ostream& log)
 {
     int key = static_cast<std::underlying_type<RxnKeyword>::type>(rxnKeyword);
     try {
         switch (key) {
         case 0: {
             onRate3Dka = std::stod(line);
-            std::cout << "Read in value of onRate3Dka: " << onRate3Dka << "nm^3us^-1\n";
+            log << "Read in value of onRate3Dka: " << onRate3Dka << "nm^3us^-1\n";
             break;
         }
         case 1: {
             onRate3DMacro = std::stod(line);
-            std::cout << "Read in value of onRate3DMacro: " << onRate3DMacro << "uM^-1us^-1\n";
+            log << "Read in value of onRate3DMacro: " << onRate3DMacro << "uM^-1us^-1\n";
             break;
         }
         case 2: {
             offRatekb = std::stod(line);
-            std::cout << "Read in value of offRatekb: " << offRatekb << "s^-1\n";
+            log << "Read in value of offRatekb: " << offRatekb << "s^-1\n";
             break;
         }
         case 3: {
             offRateMacro = std::stod(line);
-            std::cout << "Read in value of offRateMacro: " << offRateMacro << "s^-1\n";
+            log << "Read in value of offRateMacro: " << offRateMacro << "s^-1\n";
             break;
         }
         case 4: {
             norm1 = Vector { parse_input_array(line) };
             norm1.calc_magnitude();
-            std::cout << "Read in value of norm1: " << norm1 << '\n';
+            log << "Read in value of norm1: " << norm1 << '\n';
             break;
         }
         case 5: {
             norm2 = Vector { parse_input_array(line) };
             norm2.calc_magnitude();
-            std::cout << "Read in value of norm2: " << norm2 << '\n';
+            log << "Read in value of norm2: " << norm2 << '\n';
             break;
         }
         case 6: {
             bindRadius = std::stod(line);
-            std::cout << "Read in value of sigma: " << bindRadius << "nm\n";
+            log << "Read in value of sigma: " << bindRadius << "nm\n";
             break;
         }
         case 7: {
             assocAngles = Angles { parse_input_array(line) };
-            std::cout << "Read in value of assocAngles: [theta1: " << assocAngles.theta1 << ", theta2: " << assocAngles.theta2 << ", phi1: " << assocAngles.phi1 << ", phi2: " << assocAngles.phi2 << ", omega: " << assocAngles.omega << "]" << '\n';
+            log << "Read in value of assocAngles: [theta1: " << assocAngles.theta1 << ", theta2: " << assocAngles.theta2 << ", phi1: " << assocAngles.phi1 << ", phi2: " << assocAngles.phi2 << ", omega: " << assocAngles.omega << "]" << '\n';
             break;
         }
         case 8: {
@@ -357,13 +358,13 @@ void ParsedRxn::set_value(std::string& line, RxnKeyword rxnKeyword)
         }
         case 9: {
             onRate3Dka = std::stod(line);
-            std::cout << "Read in value of rate: " << onRate3Dka << '\n';
+            log << "Read in value of rate: " << onRate3Dka << '\n';
             break;
         }
         case 10: {
             isCoupled = true;
             coupledRxn = CoupledRxn { std::stoi(line) };
-            std::cout << "Read in value of coupledRxn: absRxnIndex, " << coupledRxn.absRxnIndex << '\n';
+            log << "Read in value of coupledRxn: absRxnIndex, " << coupledRxn.absRxnIndex << '\n';
             break;
         }
         case 11: {
@@ -373,12 +374,12 @@ void ParsedRxn::set_value(std::string& line, RxnKeyword rxnKeyword)
         case 12: {
             isObserved = true;
             observeLabel = line;
-            std::cout << "Read in value of observeLabel: " << observeLabel << '\n';
+            log << "Read in value of observeLabel: " << observeLabel << '\n';
             break;
         }
         case 13: {
             bindRadSameCom = std::stod(line);
-            std::cout << "Read in value of bindRadSameCom: " << bindRadSameCom << '\n';
+            log << "Read in value of bindRadSameCom: " << bindRadSameCom << '\n';
             break;
         }
         case 14: {
@@ -391,28 +392,28 @@ void ParsedRxn::set_value(std::string& line, RxnKeyword rxnKeyword)
         }
         case 16: {
             loopCoopFactor = std::stod(line);
-            std::cout << "Read in value of loopCoopFactor: " << loopCoopFactor << '\n';
+            log << "Read in value of loopCoopFactor: " << loopCoopFactor << '\n';
             break;
         }
         case 17: {
             length3Dto2D = std::stod(line);
-            std::cout << "Read in value of length3Dto2D: " << length3Dto2D << "nm\n";
+            log << "Read in value of length3Dto2D: " << length3Dto2D << "nm\n";
             break;
         }
         case 18: {
             rxnLabel = line;
-            std::cout << "Read in value of rxnLabel: " << rxnLabel << '\n';
+            log << "Read in value of rxnLabel: " << rxnLabel << '\n';
             break;
         }
         case 19: {
             isCoupled = true;
             coupledRxn = CoupledRxn { line };
-            std::cout << "Read in value of coupledRxn: label, " << coupledRxn.label << '\n';
+            log << "Read in value of coupledRxn: label, " << coupledRxn.label << '\n';
             break;
         }
         case 20: {
             kcat = std::stod(line);
-            std::cout << "Read in value of kcat: " << kcat << '\n';
+            log << "Read in value of kcat: " << kcat << '\n';
             break;
         }
         case 21: {
@@ -424,54 +425,54 @@ void ParsedRxn::set_value(std::string& line, RxnKeyword rxnKeyword)
         }
         }
     } catch (std::invalid_argument& e) {
-        std::cout << e.what() << '\n';
+        std::cerr << e.what() << '\n';
         exit(1);
     }
 }
 
-void ParsedRxn::display() const
+void ParsedRxn::display(std::ostream& os) const
 {
     /*THIS ROUTINE IS DUPLICATED IN CLASS_RXNS>CPP, FORWARDRXN::DISPLAY, and OTHER RXN TYPES, THIS IS NOT CALLED!*/
-    std::cout << "reactantList:\n"
+    os << "reactantList:\n"
               << std::setw(10) << std::setfill('-') << ' ' << std::setfill(' ') << '\n';
     for (auto& oneReactant : reactantList) {
-        oneReactant.display();
+        oneReactant.display(os);
     }
-    std::cout << "productList:\n"
+    os << "productList:\n"
               << std::setw(10) << std::setfill('-') << ' ' << std::setfill(' ') << '\n';
     for (auto& oneProduct : productList) {
-        oneProduct.display();
+        oneProduct.display(os);
     }
 
     if (hasStateChange) {
-        std::cout << "Interface " << stateChangeIface.first.ifaceName << " on molecule "
+        os << "Interface " << stateChangeIface.first.ifaceName << " on molecule "
                   << stateChangeIface.first.molTypeIndex << " changes state from "
                   << stateChangeIface.first.requiresState << " to " << stateChangeIface.second.requiresState << '\n';
     }
 
     if (rxnType == ReactionType::bimolecular) {
-        std::cout << std::setw(10) << std::setfill('-') << ' ' << std::setfill(' ') << "\nAssociation Angles:\n";
-        display_angles();
-        std::cout << "Association sigma vector:\n";
-        std::cout << "Sigma: " << bindRadius << '\n';
-        std::cout << "Reactant 1 normal: " << norm1 << '\n';
-        std::cout << "Reactant 2 normal: " << norm2 << '\n';
+        os << std::setw(10) << std::setfill('-') << ' ' << std::setfill(' ') << "\nAssociation Angles:\n";
+        display_angles(os);
+        os << "Association sigma vector:\n";
+        os << "Sigma: " << bindRadius << '\n';
+        os << "Reactant 1 normal: " << norm1 << '\n';
+        os << "Reactant 2 normal: " << norm2 << '\n';
     }
-    std::cout << "\nOn membrane? " << std::boolalpha << isOnMem << '\n';
-    std::cout << "bindRadSameCom " << bindRadSameCom << '\n';
-    std::cout << "loopCoopFactor " << loopCoopFactor << '\n';
-    std::cout << "length3Dto2D " << length3Dto2D << '\n';
-    std::cout << "isCoupled? " << isCoupled << '\n';
+    os << "\nOn membrane? " << std::boolalpha << isOnMem << '\n';
+    os << "bindRadSameCom " << bindRadSameCom << '\n';
+    os << "loopCoopFactor " << loopCoopFactor << '\n';
+    os << "length3Dto2D " << length3Dto2D << '\n';
+    os << "isCoupled? " << isCoupled << '\n';
     if (isCoupled)
-        std::cout << " coupledRxn Number: " << coupledRxn.absRxnIndex << " type: " << coupledRxn.rxnType << '\n';
-    std::cout << "microRate3D: " << onRate3Dka << '\n';
-    std::cout << "macroRate3D: " << onRate3DMacro << '\n';
+        os << " coupledRxn Number: " << coupledRxn.absRxnIndex << " type: " << coupledRxn.rxnType << '\n';
+    os << "microRate3D: " << onRate3Dka << '\n';
+    os << "macroRate3D: " << onRate3DMacro << '\n';
     if (isReversible)
-        std::cout << "micro Off Rate: " << offRatekb << '\n';
-    std::cout << "macro Off Rate: " << offRateMacro << '\n';
+        os << "micro Off Rate: " << offRatekb << '\n';
+    os << "macro Off Rate: " << offRateMacro << '\n';
 }
 
-void ParsedRxn::check_previous_bound_states(int& totSpecies, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList)
+void ParsedRxn::check_previous_bound_states(int& totSpecies, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, std::ostream& log)
 {
     for (auto& oneRxn : forwardRxns) {
         if (oneRxn.rxnType == ReactionType::bimolecular) {
@@ -490,10 +491,10 @@ void ParsedRxn::check_previous_bound_states(int& totSpecies, const std::vector<F
         }
     }
 
-    std::cout << "Warning: must declare association reaction before declaring a state change of its product.\n";
+    log << "Warning: must declare association reaction before declaring a state change of its product.\n";
 }
 
-void ParsedRxn::determine_reactants()
+void ParsedRxn::determine_reactants(std::ostream& log)
 {
     // TODO: My god, I need to fix this. It's so bad.
 
@@ -565,7 +566,7 @@ void ParsedRxn::determine_reactants()
                                 });
 
                             if (reactIfaceItr != reactant.interfaceList.end()) {
-                                std::cout << "Found corresponding interfaces: React: " << reactant.molName << '('
+                                log << "Found corresponding interfaces: React: " << reactant.molName << '('
                                           << reactIfaceItr->ifaceName << ')' << " -- Prod: " << product.molName << '('
                                           << prodIface.ifaceName << ')' << '\n';
 
@@ -612,7 +613,7 @@ void ParsedRxn::determine_reactants()
                                         == speciesUsed.end();
                                 });
                             if (reactIfaceItr != reactant.interfaceList.end()) {
-                                std::cout << "Found corresponding interfaces: React: " << reactant.molName << '('
+                                log << "Found corresponding interfaces: React: " << reactant.molName << '('
                                           << reactIfaceItr->ifaceName << ") -- Prod: " << product.molName << '('
                                           << prodIface.ifaceName << ')' << '\n';
 
@@ -670,7 +671,7 @@ void ParsedRxn::determine_creation_products(const std::vector<MolTemplate>& molT
             }
         } catch (std::out_of_range& e) {
             // TODO: write this
-            std::cout << e.what() << '\n';
+            std::cerr << e.what() << '\n';
             exit(1);
         }
     }
@@ -689,7 +690,7 @@ void ParsedRxn::determine_creation_products(const std::vector<MolTemplate>& molT
             }
         } catch (std::out_of_range& e) {
             // TODO: write this
-            std::cout << e.what() << '\n';
+            std::cerr << e.what() << '\n';
             exit(1);
         }
     }
@@ -713,7 +714,7 @@ void ParsedRxn::create_other_iface_lists(const std::vector<MolTemplate>& molTemp
 }
 
 bool ParsedRxn::check_for_conditional_rates(
-    int& totSpecies, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns)
+    int& totSpecies, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns, std::ostream& log)
 {
     // sort the reactants in order according to their iface index, to make comparing reactions easier
     // don't do this for bimolecular state changes, since we put the facilitator first, regardless of its index
@@ -754,15 +755,15 @@ bool ParsedRxn::check_for_conditional_rates(
                 backRxns[oneRxn.conjBackRxnIndex].rateList.emplace_back(this->offRatekb, otherIfaceLists);
             }
             --totSpecies; // since it's not a new reaction, reduce the number of total species...
-            std::cout << "Forward Reaction " << &oneRxn - &forwardRxns[0]
+            log << "Forward Reaction " << &oneRxn - &forwardRxns[0]
                       << " has been updated with a new rate:\nRate:" << onRate3Dka << '\n';
-            std::cout << "Reactant 1 requires interfaces:\n";
+            log << "Reactant 1 requires interfaces:\n";
             for (auto& iface : otherIfaceLists[0])
-                std::cout << iface << '\n';
+                log << iface << '\n';
             if (rxnType == ReactionType::bimolecular || rxnType == ReactionType::biMolStateChange) {
-                std::cout << "Reactant 2 requires interfaces:\n";
+                log << "Reactant 2 requires interfaces:\n";
                 for (auto& iface : otherIfaceLists[1])
-                    std::cout << iface << '\n';
+                    log << iface << '\n';
             }
             return true;
         }
@@ -8,7 +8,7 @@ using namespace std;
 may also be bound to other proteins does not matter, so it counts all A-B bonds that exist in the system*/
 
 void init_NboundPairs(
-    copyCounters& counterArrays, ofstream& outfile, Parameters params, std::vector<MolTemplate>& molTemplateList, std::vector<Molecule>& moleculeList)
+    copyCounters& counterArrays, ostream& outfile, Parameters params, std::vector<MolTemplate>& molTemplateList, std::vector<Molecule>& moleculeList)
 {
     // TRACE();
     int i, j;
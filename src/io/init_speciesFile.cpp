@@ -6,7 +6,7 @@
 using namespace std;
 
 // write the header for file tracking all species
-int init_speciesFile(ofstream& speciesFile, copyCounters& counterArrays, std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns, Parameters& params)
+int init_speciesFile(ostream& speciesFile, copyCounters& counterArrays, std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns, Parameters& params)
 {
     // TRACE();
     int nSpecies = 0;
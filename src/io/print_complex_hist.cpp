@@ -4,7 +4,7 @@
 #include <iostream>
 
 double print_complex_hist(std::vector<Complex>& complexList, std::ofstream& outfile, int it, Parameters params,
-    std::vector<MolTemplate>& molTemplateList, int nImplicitLipids)
+    std::vector<MolTemplate>& molTemplateList, int nImplicitLipids, const std::vector<int>& numEachMolType)
 {
     // TRACE();
     int i { 0 };
@@ -27,14 +27,14 @@ double print_complex_hist(std::vector<Complex>& complexList, std::ofstream& outf
     for (j = 0; j < nTypes; j++) {
         mult[j] = 1;
         for (i = 0; i < j; i++)
-            mult[j] = mult[j] * (MolTemplate::numEachMolType[i] + 1);
+            mult[j] = mult[j] * (numEachMolType[i] + 1);
         // cout <<"mult factor for type: "<<j<<" is: "<<mult[j]<<std::endl;
     }
     int jend = nTypes;
     mult[jend] = 1;
     for (i = 0; i < jend; i++)
         mult[jend] = mult[jend]
-            * (MolTemplate::numEachMolType[i] + 1); // add this in for possible surface interactions, linksToSurface
+            * (numEachMolType[i] + 1); // add this in for possible surface interactions, linksToSurface
 
     assemblylist.reserve(nTypes);
     complexrep.reserve(nTypes);
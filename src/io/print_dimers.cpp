@@ -6,7 +6,7 @@
 using namespace std;
 
 void print_dimers(std::vector<Complex>& complexList, std::ofstream& outfile, int it, Parameters params,
-    std::vector<MolTemplate>& molTemplateList)
+    std::vector<MolTemplate>& molTemplateList, const std::vector<int>& numEachMolType)
 {
     // TRACE();
     int i, j;
@@ -26,7 +26,7 @@ void print_dimers(std::vector<Complex>& complexList, std::ofstream& outfile, int
     for (j = 0; j < nTypes; j++) {
         mult[j] = 1;
         for (i = 0; i < j; i++)
-            mult[j] = mult[j] * (MolTemplate::numEachMolType[i] + 1);
+            mult[j] = mult[j] * (numEachMolType[i] + 1);
         // cout <<"mult factor for type: "<<j<<" is: "<<mult[j]<<endl;
     }
     assemblylist.reserve(nTypes);
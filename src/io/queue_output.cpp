@@ -0,0 +1,110 @@
+#include "io/io.hpp"
+#include "math/constants.hpp"
+#include "reactions/association/association.hpp"
+
+#include <memory>
+
+namespace {
+// the Molecules selected by params.trajFilter. without a filter, moleculeList itself, or a copy of it for the writer
+// thread
+std::shared_ptr<const std::vector<Molecule>> output_molecules(const Parameters& params,
+    const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, bool isAsync)
+{
+    if (params.trajFilter.is_active())
+        return std::make_shared<std::vector<Molecule>>(
+            select_output_molecules(params, moleculeList, complexList, molTemplateList));
+    if (isAsync)
+        return std::make_shared<std::vector<Molecule>>(snapshot_molecules(moleculeList));
+    return std::shared_ptr<const std::vector<Molecule>>(&moleculeList, [](const std::vector<Molecule>*) {});
+}
+}
+
+void queue_write_traj(OutputQueue& outputQueue, long long int simItr, const std::string& trajFileName,
+    const Parameters& params, const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+{
+    auto molSnapshot = output_molecules(params, moleculeList, complexList, molTemplateList, outputQueue.is_async());
+    if (outputQueue.is_async() == false) {
+        std::ofstream trajFile { trajFileName, std::ios::app }; // for append
+        write_traj(simItr, trajFile, params, *molSnapshot, molTemplateList, membraneObject);
+        trajFile.close();
+        return;
+    }
+
+    // molTemplateList and the waterBox don't change during the simulation and are read in place
+    auto paramSnapshot = std::make_shared<Parameters>(params);
+    outputQueue.push([=, &molTemplateList, &membraneObject]() {
+        std::ofstream trajFile { trajFileName, std::ios::app }; // for append
+        write_traj(simItr, trajFile, *paramSnapshot, *molSnapshot, molTemplateList, membraneObject);
+        trajFile.close();
+    });
+}
+
+void queue_write_pdb(OutputQueue& outputQueue, PdbStream& pdbStream, long long int simItr, const Parameters& params,
+    const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+{
+    auto molSnapshot = output_molecules(params, moleculeList, complexList, molTemplateList, outputQueue.is_async());
+    if (outputQueue.is_async() == false) {
+        if (pdbStream.is_open())
+            write_pdb_model(pdbStream, simItr, *molSnapshot, molTemplateList, membraneObject);
+        else
+            write_pdb(simItr, simItr, params, *molSnapshot, molTemplateList, membraneObject);
+        return;
+    }
+
+    // pdbStream is only written on the OutputQueue thread until the queue is flushed
+    auto paramSnapshot = std::make_shared<Parameters>(params);
+    outputQueue.push([=, &pdbStream, &molTemplateList, &membraneObject]() {
+        if (pdbStream.is_open())
+            write_pdb_model(pdbStream, simItr, *molSnapshot, molTemplateList, membraneObject);
+        else
+            write_pdb(simItr, simItr, *paramSnapshot, *molSnapshot, molTemplateList, membraneObject);
+    });
+}
+
+void queue_write_time_series(OutputQueue& outputQueue, long long int simItr, const Parameters& params,
+    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, const std::vector<int>& numEachMolType,
+    copyCounters& counterArrays, const std::map<std::string, int>& observablesList, const std::string& observablesFileName,
+    const Membrane& membraneObject, TimeSeriesSet& timeSeries, std::ofstream& pairOutfile, std::ofstream& dimerfile,
+    std::ofstream& eventFile, std::ofstream& assemblyfile, std::ofstream& speciesFile)
+{
+    int number_of_lipids = 0; //sum of all states of IL
+    for (unsigned i = 0; i < membraneObject.numberOfFreeLipidsEachState.size(); i++) {
+        number_of_lipids += membraneObject.numberOfFreeLipidsEachState[i];
+    }
+    double simTime { (simItr - params.itrRestartFrom) * params.timeStep * Constants::usToSeconds + params.timeRestartFrom };
+
+    if (outputQueue.is_async() == false) {
+        // Write out N bound pairs, histogram of complex compositions, and monomer/dimer counts.
+        write_counter_time_series(timeSeries, simItr, params, counterArrays, pairOutfile, eventFile, speciesFile);
+        print_dimers(complexList, dimerfile, simItr, params, molTemplateList, numEachMolType);
+        print_complex_hist(complexList, assemblyfile, simItr, params, molTemplateList, number_of_lipids, numEachMolType);
+        // write observables
+        if (!observablesList.empty()) {
+            std::ofstream observablesFile { observablesFileName, std::ios::app };
+            write_observables(simTime, observablesFile, observablesList);
+            observablesFile.close();
+        }
+        return;
+    }
+
+    // the counters don't need the Molecules, so they aren't copied
+    auto paramSnapshot = std::make_shared<Parameters>(params);
+    auto comSnapshot = std::make_shared<std::vector<Complex>>(snapshot_complexes(complexList));
+    auto counterSnapshot = std::make_shared<copyCounters>(counterArrays);
+    auto observablesSnapshot = std::make_shared<std::map<std::string, int>>(observablesList);
+    auto molTypeSnapshot = std::make_shared<std::vector<int>>(numEachMolType);
+    outputQueue.push([=, &molTemplateList, &timeSeries, &pairOutfile, &dimerfile, &eventFile, &assemblyfile,
+                         &speciesFile]() {
+        write_counter_time_series(timeSeries, simItr, *paramSnapshot, *counterSnapshot, pairOutfile, eventFile, speciesFile);
+        print_dimers(*comSnapshot, dimerfile, simItr, *paramSnapshot, molTemplateList, *molTypeSnapshot);
+        print_complex_hist(*comSnapshot, assemblyfile, simItr, *paramSnapshot, molTemplateList, number_of_lipids, *molTypeSnapshot);
+        if (!observablesSnapshot->empty()) {
+            std::ofstream observablesFile { observablesFileName, std::ios::app };
+            write_observables(simTime, observablesFile, *observablesSnapshot);
+            observablesFile.close();
+        }
+    });
+}
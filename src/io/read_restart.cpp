@@ -2,17 +2,19 @@
 #include "tracing.hpp"
 #include <chrono>
 #include <ctime>
+#include <sstream>
 
 void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters& params, SimulVolume& simulVolume,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<CreateDestructRxn>& createDestructRxns,
-    std::map<std::string, int>& observablesList, Membrane& membraneObject, copyCounters& counterArrays)
+    std::map<std::string, int>& observablesList, Membrane& membraneObject, copyCounters& counterArrays,
+    SimulContext& context)
 {
     // TRACE();
     try {
         // Read parameters
-        std::cout << "READ IN PARMATERS from restart file" << std::endl;
+        context.log << "READ IN PARMATERS from restart file" << std::endl;
         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         {
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
@@ -22,13 +24,13 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> simItr;
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            std::cout << "Restarting simulation from iteration " << simItr << '\n';
+            context.log << "Restarting simulation from iteration " << simItr << '\n';
             params.itrRestartFrom = simItr;
 
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> params.timeRestartFrom;
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            std::cout << "Current simulation time (s): " << params.timeRestartFrom << '\n';
+            context.log << "Current simulation time (s): " << params.timeRestartFrom << '\n';
 
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> params.numMolTypes;
@@ -74,6 +76,15 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
 
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> membraneObject.implicitLipid >> membraneObject.TwoD >> membraneObject.isBox >> membraneObject.isSphere >> membraneObject.sphereR;
+            {
+                // boundary types follow only if one is periodic
+                std::string bcLine {};
+                std::getline(restartFile, bcLine);
+                std::istringstream bcStream { bcLine };
+                std::string bcType {};
+                for (int axis { 0 }; axis < 3 && bcStream >> bcType; ++axis)
+                    membraneObject.set_BCtype(axis, bcType);
+            }
 
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> params.overlapSepLimit;
@@ -97,7 +108,13 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
 
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> params.pdbWrite;
-            restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            {
+                // pdbStream follows only if it is on
+                std::string pdbLine {};
+                std::getline(restartFile, pdbLine);
+                std::istringstream pdbFields { pdbLine };
+                pdbFields >> params.pdbStream;
+            }
 
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '=');
             restartFile >> params.checkPoint;
@@ -107,8 +124,8 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
             restartFile >> params.scaleMaxDisplace;
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         }
-        std::cout << "restart write, pdbWrite: " << params.restartWrite << ' ' << params.pdbWrite << std::endl;
-        /*	std::cout<<"READ IN SUB volume PARTITIONING from restart file"<<std::endl;
+        context.log << "restart write, pdbWrite: " << params.restartWrite << ' ' << params.pdbWrite << std::endl;
+        /*	context.log<<"READ IN SUB volume PARTITIONING from restart file"<<std::endl;
         // Read Simulation Volume
         {
             restartFile >> simulVolume.numSubCells.x >> simulVolume.numSubCells.y >> simulVolume.numSubCells.z
@@ -145,33 +162,33 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
             }
         }
 	*/
-        std::cout << "READ IN MOL TEMPLATE from restart file" << std::endl;
+        context.log << "READ IN MOL TEMPLATE from restart file" << std::endl;
         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         // Read MolTemplates
         {
-            restartFile >> MolTemplate::numMolTypes;
-            for (unsigned itr { 0 }; itr < MolTemplate::numMolTypes; ++itr) {
+            restartFile >> context.numMolTypes;
+            for (unsigned itr { 0 }; itr < context.numMolTypes; ++itr) {
                 unsigned num { 0 };
                 restartFile >> num;
-                MolTemplate::numEachMolType.push_back(num);
+                context.numEachMolType.push_back(num);
             }
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            std::cout << " Num moltypes: " << MolTemplate::numMolTypes << '\n';
+            context.log << " Num moltypes: " << context.numMolTypes << '\n';
             unsigned absToRelIfaceSize { 0 };
             restartFile >> absToRelIfaceSize;
             for (unsigned itr { 0 }; itr < absToRelIfaceSize; ++itr) {
                 unsigned iface { 0 };
                 restartFile >> iface;
-                MolTemplate::absToRelIface.push_back(iface);
+                context.absToRelIface.push_back(iface);
             }
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-            restartFile >> Interface::State::totalNumOfStates;
+            restartFile >> context.totalNumOfStates;
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            for (unsigned itr { 0 }; itr < MolTemplate::numMolTypes; ++itr) {
+            for (unsigned itr { 0 }; itr < context.numMolTypes; ++itr) {
                 MolTemplate oneTemp {};
                 restartFile >> oneTemp.molTypeIndex >> oneTemp.molName;
-                std::cout << " protein index, name: " << oneTemp.molTypeIndex << ' ' << oneTemp.molName << '\n';
+                context.log << " protein index, name: " << oneTemp.molTypeIndex << ' ' << oneTemp.molName << '\n';
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
                 restartFile >> oneTemp.copies >> oneTemp.mass >> oneTemp.radius;
@@ -224,7 +241,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 for (unsigned ifaceItr { 0 }; ifaceItr < oneTempIfaceSize; ++ifaceItr) {
                     Interface tmpIface {};
                     restartFile >> tmpIface.index >> tmpIface.name;
-                    std::cout << " iface index, name: " << tmpIface.index << ' ' << tmpIface.name << '\n';
+                    context.log << " iface index, name: " << tmpIface.index << ' ' << tmpIface.name << '\n';
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     restartFile >> tmpIface.iCoord.x >> tmpIface.iCoord.y >> tmpIface.iCoord.z;
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -307,26 +324,26 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 molTemplateList.emplace_back(oneTemp);
             }
         }
-        std::cout << "READ IN REACTIONs from restart file" << std::endl;
+        context.log << "READ IN REACTIONs from restart file" << std::endl;
         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         // write Reactions
         {
             unsigned forwardRxnsSize { 0 };
             unsigned backRxnsSize { 0 };
             unsigned createDestructRxnsSize { 0 };
-            restartFile >> RxnBase::numberOfRxns >> forwardRxnsSize >> backRxnsSize >> createDestructRxnsSize
-                >> RxnBase::totRxnSpecies;
+            restartFile >> context.numberOfRxns >> forwardRxnsSize >> backRxnsSize >> createDestructRxnsSize
+                >> context.totRxnSpecies;
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            std::cout << " Num rxns: " << RxnBase::numberOfRxns << " forwardRxns: " << forwardRxnsSize << '\n';
+            context.log << " Num rxns: " << context.numberOfRxns << " forwardRxns: " << forwardRxnsSize << '\n';
             // forward reactions
             for (unsigned rxnItr { 0 }; rxnItr < forwardRxnsSize; ++rxnItr) {
                 ForwardRxn tmpRxn;
                 restartFile >> tmpRxn.absRxnIndex >> tmpRxn.relRxnIndex >> tmpRxn.rxnLabel;
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                std::cout << " itr: " << rxnItr << " abs index, relindex: " << tmpRxn.absRxnIndex << ' ' << tmpRxn.relRxnIndex << '\n';
+                context.log << " itr: " << rxnItr << " abs index, relindex: " << tmpRxn.absRxnIndex << ' ' << tmpRxn.relRxnIndex << '\n';
                 int rxnType { -1 };
                 restartFile >> rxnType >> tmpRxn.isSymmetric >> tmpRxn.isOnMem >> tmpRxn.hasStateChange;
-                std::cout << "Rxntype: " << rxnType << '\n';
+                context.log << "Rxntype: " << rxnType << '\n';
                 if (rxnType != -1) {
                     tmpRxn.rxnType = static_cast<ReactionType>(rxnType); // turn the int rxnType into ReactionType
                 } else {
@@ -339,7 +356,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 if (tmpRxn.isObserved)
                     restartFile >> tmpRxn.observeLabel;
                 restartFile >> tmpRxn.productName;
-                std::cout << "Product name: " << tmpRxn.productName << std::endl;
+                context.log << "Product name: " << tmpRxn.productName << std::endl;
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 restartFile >> tmpRxn.isReversible >> tmpRxn.conjBackRxnIndex >> tmpRxn.irrevRingClosure >> tmpRxn.bindRadSameCom >> tmpRxn.loopCoopFactor >> tmpRxn.length3Dto2D;
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -364,7 +381,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                     tmpRxn.assocAngles.omega = std::numeric_limits<double>::quiet_NaN();
                 //>> tmpRxn.assocAngles.theta1 >> tmpRxn.assocAngles.theta2
                 //>> tmpRxn.assocAngles.phi1 >> tmpRxn.assocAngles.phi2 >> tmpRxn.assocAngles.omega;
-                std::cout << "RXN angles " << tmpRxn.bindRadius << ' ' << tmpRxn.assocAngles.theta1 << ' ' << tmpRxn.assocAngles.theta2
+                context.log << "RXN angles " << tmpRxn.bindRadius << ' ' << tmpRxn.assocAngles.theta1 << ' ' << tmpRxn.assocAngles.theta2
                           << ' ' << tmpRxn.assocAngles.phi1 << ' ' << tmpRxn.assocAngles.phi2 << ' ' << tmpRxn.assocAngles.omega << '\n';
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
@@ -372,15 +389,15 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
                 restartFile >> tmpRxn.norm2.x >> tmpRxn.norm2.y >> tmpRxn.norm2.z;
-                std::cout << " norm 2: " << tmpRxn.norm2.x << ' ' << tmpRxn.norm2.y << ' ' << tmpRxn.norm2.z << '\n';
+                context.log << " norm 2: " << tmpRxn.norm2.x << ' ' << tmpRxn.norm2.y << ' ' << tmpRxn.norm2.z << '\n';
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 restartFile >> tmpRxn.excludeVolumeBound;
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 restartFile >> tmpRxn.isCoupled;
-                std::cout << " reaction is coupled? " << tmpRxn.isCoupled << std::endl;
+                context.log << " reaction is coupled? " << tmpRxn.isCoupled << std::endl;
                 if (tmpRxn.isCoupled) {
                     rxnType = -1;
-                    std::cout << "did not enter iscoupled loop " << '\n';
+                    context.log << "did not enter iscoupled loop " << '\n';
                     restartFile >> tmpRxn.coupledRxn.absRxnIndex >> tmpRxn.coupledRxn.relRxnIndex >> rxnType >> tmpRxn.coupledRxn.label >> tmpRxn.coupledRxn.probCoupled;
                     if (rxnType != -1) {
                         tmpRxn.coupledRxn.rxnType = static_cast<ReactionType>(rxnType);
@@ -395,12 +412,12 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 // integer reactants
                 unsigned intReactantListSize { 0 };
                 restartFile >> intReactantListSize;
-                std::cout << "Nreactant first round " << intReactantListSize << '\n';
+                context.log << "Nreactant first round " << intReactantListSize << '\n';
                 for (unsigned itr { 0 }; itr < intReactantListSize; ++itr) {
                     int reactant { -1 };
                     restartFile >> reactant;
                     tmpRxn.intReactantList.push_back(reactant);
-                    std::cout << " reactant: " << reactant << '\n';
+                    context.log << " reactant: " << reactant << '\n';
                 }
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
@@ -417,19 +434,19 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 // reactant list
                 unsigned reactantListNewSize { 0 };
                 restartFile >> reactantListNewSize;
-                std::cout << "N reactants: " << reactantListNewSize << '\n';
+                context.log << "N reactants: " << reactantListNewSize << '\n';
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 for (unsigned itr { 0 }; itr < reactantListNewSize; ++itr) {
                     RxnIface oneReact {};
                     restartFile >> oneReact.molTypeIndex;
-                    std::cout << " molTypeIndex: " << oneReact.molTypeIndex << '\n';
+                    context.log << " molTypeIndex: " << oneReact.molTypeIndex << '\n';
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     restartFile >> oneReact.ifaceName >> oneReact.absIfaceIndex >> oneReact.relIfaceIndex;
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     restartFile >> oneReact.requiresState >> oneReact.requiresInteraction;
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     tmpRxn.reactantListNew.emplace_back(oneReact);
-                    std::cout << " requiresState, requiresInteraction: " << oneReact.requiresState << ' ' << oneReact.requiresInteraction << '\n';
+                    context.log << " requiresState, requiresInteraction: " << oneReact.requiresState << ' ' << oneReact.requiresInteraction << '\n';
                 }
 
                 // product list
@@ -450,12 +467,12 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 // rate list
                 unsigned rateListSize { 0 };
                 restartFile >> rateListSize;
-                std::cout << "Nrates: " << rateListSize << '\n';
+                context.log << "Nrates: " << rateListSize << '\n';
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 for (unsigned itr { 0 }; itr < rateListSize; ++itr) {
                     RxnBase::RateState oneRate {};
                     restartFile >> oneRate.rate;
-                    std::cout << " rate: " << oneRate.rate << '\n';
+                    context.log << " rate: " << oneRate.rate << '\n';
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
                     unsigned otherIfaceListsSize { 0 };
@@ -466,7 +483,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                         unsigned oneListSize { 0 };
                         std::vector<RxnIface> tmpIfaceVec {};
                         restartFile >> oneListSize;
-                        std::cout << "onelistsize: " << oneListSize << '\n';
+                        context.log << "onelistsize: " << oneListSize << '\n';
                         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                         for (unsigned anccIfaceItr { 0 }; anccIfaceItr < oneListSize; ++anccIfaceItr) {
                             RxnIface otherIface {};
@@ -480,10 +497,10 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                     }
                     tmpRxn.rateList.emplace_back(oneRate);
                 }
-                tmpRxn.display();
+                tmpRxn.display(context.log);
                 forwardRxns.emplace_back(tmpRxn);
             }
-            std::cout << " Done with forward reactions " << '\n';
+            context.log << " Done with forward reactions " << '\n';
             // backRxns
             for (unsigned rxnItr { 0 }; rxnItr < backRxnsSize; ++rxnItr) {
                 BackRxn tmpRxn;
@@ -504,10 +521,10 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
                 restartFile >> tmpRxn.isCoupled;
-                std::cout << " reaction is coupled? " << tmpRxn.isCoupled << std::endl;
+                context.log << " reaction is coupled? " << tmpRxn.isCoupled << std::endl;
                 if (tmpRxn.isCoupled) {
                     rxnType = -1;
-                    std::cout << "did not enter iscoupled loop " << '\n';
+                    context.log << "did not enter iscoupled loop " << '\n';
                     restartFile >> tmpRxn.coupledRxn.absRxnIndex >> tmpRxn.coupledRxn.relRxnIndex >> rxnType >> tmpRxn.coupledRxn.label >> tmpRxn.coupledRxn.probCoupled;
                     if (rxnType != -1) {
                         tmpRxn.coupledRxn.rxnType = static_cast<ReactionType>(rxnType);
@@ -600,9 +617,9 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 }
                 backRxns.emplace_back(tmpRxn);
             }
-            std::cout << "Done with back reactions " << '\n';
+            context.log << "Done with back reactions " << '\n';
             // creation and destruction reactions
-            std::cout << "Now creation and destruction " << '\n';
+            context.log << "Now creation and destruction " << '\n';
             for (unsigned rxnItr { 0 }; rxnItr < createDestructRxnsSize; ++rxnItr) {
                 CreateDestructRxn tmpRxn {};
                 restartFile >> tmpRxn.absRxnIndex >> tmpRxn.relRxnIndex;
@@ -647,7 +664,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                     CreateDestructRxn::CreateDestructMol oneMol {};
                     unsigned interfaceListSize { 0 };
                     restartFile >> oneMol.molTypeIndex >> oneMol.molName >> interfaceListSize;
-                    std::cout << " Destroy molecule: " << oneMol.molName << std::endl;
+                    context.log << " Destroy molecule: " << oneMol.molName << std::endl;
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     for (unsigned ifaceItr { 0 }; ifaceItr < interfaceListSize; ++ifaceItr) {
                         RxnIface tmpIface {};
@@ -670,7 +687,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                     CreateDestructRxn::CreateDestructMol oneMol {};
                     unsigned interfaceListSize { 0 };
                     restartFile >> oneMol.molTypeIndex >> oneMol.molName >> interfaceListSize;
-                    std::cout << " CREATION OF MOL: " << oneMol.molName << std::endl;
+                    context.log << " CREATION OF MOL: " << oneMol.molName << std::endl;
                     restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     for (unsigned ifaceItr { 0 }; ifaceItr < interfaceListSize; ++ifaceItr) {
                         RxnIface tmpIface {};
@@ -710,7 +727,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                         unsigned oneListSize { 0 };
                         std::vector<RxnIface> tmpIfaceVec {};
                         restartFile >> oneListSize;
-                        std::cout << "onelistsize: " << oneListSize << '\n';
+                        context.log << "onelistsize: " << oneListSize << '\n';
                         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                         for (unsigned anccIfaceItr { 0 }; anccIfaceItr < oneListSize; ++anccIfaceItr) {
                             RxnIface otherIface {};
@@ -728,14 +745,14 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
                 createDestructRxns.emplace_back(tmpRxn);
             }
         }
-        std::cout << "Now read in coordinates " << std::endl;
+        context.log << "Now read in coordinates " << std::endl;
         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         // write Molecules
         {
             int molListSize { 0 };
 
-            restartFile >> molListSize >> Molecule::numberOfMolecules;
-            std::cout << "Mol list size and molecule.numberofMolecules: " << molListSize << ' ' << Molecule::numberOfMolecules << std::endl;
+            restartFile >> molListSize >> context.numberOfMolecules;
+            context.log << "Mol list size and molecule.numberofMolecules: " << molListSize << ' ' << context.numberOfMolecules << std::endl;
             for (unsigned molItr { 0 }; molItr < molListSize; ++molItr) {
                 Molecule tmpMol {};
                 restartFile >> tmpMol.index >> tmpMol.isEmpty >> tmpMol.myComIndex >> tmpMol.molTypeIndex
@@ -746,6 +763,8 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
 
                 // center of mass
                 restartFile >> std::fixed >> tmpMol.comCoord.x >> tmpMol.comCoord.y >> tmpMol.comCoord.z;
+                if (membraneObject.hasPeriodic && restartFile.peek() == ' ')
+                    restartFile >> tmpMol.imageOffset.x >> tmpMol.imageOffset.y >> tmpMol.imageOffset.z;
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
                 // interface lists
@@ -856,18 +875,18 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
             for (unsigned itr { 0 }; itr < emptyMolListSize; ++itr) {
                 int index { 0 };
                 restartFile >> index;
-                Molecule::emptyMolList.push_back(index);
+                context.emptyMolList.push_back(index);
             }
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            std::cout << "N empty molecules: " << emptyMolListSize << std::endl;
+            context.log << "N empty molecules: " << emptyMolListSize << std::endl;
         }
-        std::cout << "Now read in complexes from RESTART " << '\n';
+        context.log << "Now read in complexes from RESTART " << '\n';
         restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         // read Complexes
         {
             int comListSize { 0 };
-            restartFile >> comListSize >> Complex::numberOfComplexes;
-            std::cout << " Ncomplexes including empties: " << comListSize << " N actual complexes: " << Complex::numberOfComplexes << std::endl;
+            restartFile >> comListSize >> context.numberOfComplexes;
+            context.log << " Ncomplexes including empties: " << comListSize << " N actual complexes: " << context.numberOfComplexes << std::endl;
             for (unsigned comItr { 0 }; comItr < comListSize; ++comItr) {
                 Complex tmpCom {};
                 restartFile >> tmpCom.index >> tmpCom.isEmpty >> tmpCom.radius >> tmpCom.mass;
@@ -904,11 +923,11 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
 
             unsigned long emptyComListSize { 0 };
             restartFile >> emptyComListSize;
-            std::cout << "N empty complexes " << emptyComListSize << '\t';
+            context.log << "N empty complexes " << emptyComListSize << '\t';
             for (unsigned itr { 0 }; itr < emptyComListSize; ++itr) {
                 int index { 0 };
                 restartFile >> index;
-                Complex::emptyComList.push_back(index);
+                context.emptyComList.push_back(index);
             }
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         } //done reading complexes
@@ -917,7 +936,7 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
         {
             int numObs { 0 };
             restartFile >> numObs;
-            std::cout << "N observables " << numObs << '\t';
+            context.log << "N observables " << numObs << '\t';
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             for (unsigned itr { 0 }; itr < numObs; ++itr) {
                 std::string obsName;
@@ -946,14 +965,14 @@ void read_restart(long long int& simItr, std::ifstream& restartFile, Parameters&
             int numSpecies { 0 };
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             restartFile >> numSpecies;
-            std::cout << "N species " << numSpecies << '\t';
+            context.log << "N species " << numSpecies << '\t';
             restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             for (unsigned itr { 0 }; itr < numSpecies; ++itr) {
                 unsigned long listSize { 0 };
                 restartFile >> listSize;
                 restartFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 counterArrays.bindPairList.emplace_back();
-                std::cout << "Specie " << itr << " N bindPairs " << listSize << '\t';
+                context.log << "Specie " << itr << " N bindPairs " << listSize << '\t';
                 for (unsigned itr2 { 0 }; itr2 < listSize; ++itr2) {
                     int index { 0 };
                     restartFile >> index;
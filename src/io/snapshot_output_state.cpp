@@ -0,0 +1,86 @@
+#include "io/io.hpp"
+
+std::vector<Molecule> snapshot_molecules(const std::vector<Molecule>& moleculeList)
+{
+    std::vector<Molecule> snapshot(moleculeList.size());
+    for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+        const Molecule& mol = moleculeList[molItr];
+        Molecule& copy = snapshot[molItr];
+        copy.index = mol.index;
+        copy.molTypeIndex = mol.molTypeIndex;
+        copy.isEmpty = mol.isEmpty;
+        copy.isImplicitLipid = mol.isImplicitLipid;
+        if (mol.isEmpty || mol.isImplicitLipid)
+            continue;
+        copy.comCoord = mol.comCoord;
+        copy.imageOffset = mol.imageOffset;
+        copy.interfaceList = mol.interfaceList;
+    }
+    return snapshot;
+}
+
+std::vector<Complex> snapshot_complexes(const std::vector<Complex>& complexList)
+{
+    std::vector<Complex> snapshot(complexList.size());
+    for (unsigned comItr { 0 }; comItr < complexList.size(); ++comItr) {
+        const Complex& com = complexList[comItr];
+        Complex& copy = snapshot[comItr];
+        copy.index = com.index;
+        copy.isEmpty = com.isEmpty;
+        copy.memberList = com.memberList;
+        copy.numEachMol = com.numEachMol;
+        copy.linksToSurface = com.linksToSurface;
+    }
+    return snapshot;
+}
+
+std::vector<Molecule> select_output_molecules(const Parameters& params, const std::vector<Molecule>& moleculeList,
+    const std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList)
+{
+    const Parameters::TrajFilter& filter = params.trajFilter;
+    std::vector<bool> isTypeSelected(molTemplateList.size(), filter.molTypeNames.empty());
+    for (auto& molTypeName : filter.molTypeNames) {
+        for (unsigned molType { 0 }; molType < molTemplateList.size(); ++molType) {
+            if (molTemplateList[molType].molName == molTypeName)
+                isTypeSelected[molType] = true;
+        }
+    }
+
+    auto is_selected = [&](const Molecule& mol) {
+        if (!isTypeSelected[mol.molTypeIndex])
+            return false;
+        if (filter.stride > 1 && mol.index % filter.stride != 0)
+            return false;
+        if (filter.minComplexSize > 1 && int(complexList[mol.myComIndex].memberList.size()) < filter.minComplexSize)
+            return false;
+        if (!filter.box.empty()
+            && (mol.comCoord.x < filter.box[0] || mol.comCoord.y < filter.box[1] || mol.comCoord.z < filter.box[2]
+                || mol.comCoord.x > filter.box[3] || mol.comCoord.y > filter.box[4] || mol.comCoord.z > filter.box[5]))
+            return false;
+        if (!filter.sphere.empty()) {
+            double dx { mol.comCoord.x - filter.sphere[0] };
+            double dy { mol.comCoord.y - filter.sphere[1] };
+            double dz { mol.comCoord.z - filter.sphere[2] };
+            if (dx * dx + dy * dy + dz * dz > filter.sphere[3] * filter.sphere[3])
+                return false;
+        }
+        return true;
+    };
+
+    // the Molecules that aren't selected are copied as empty, so they are skipped like removed Molecules
+    std::vector<Molecule> snapshot(moleculeList.size());
+    for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
+        const Molecule& mol = moleculeList[molItr];
+        Molecule& copy = snapshot[molItr];
+        copy.index = mol.index;
+        copy.molTypeIndex = mol.molTypeIndex;
+        copy.isImplicitLipid = mol.isImplicitLipid;
+        copy.isEmpty = mol.isEmpty || (!mol.isImplicitLipid && !is_selected(mol));
+        if (copy.isEmpty || mol.isImplicitLipid)
+            continue;
+        copy.comCoord = mol.comCoord;
+        copy.imageOffset = mol.imageOffset;
+        copy.interfaceList = mol.interfaceList;
+    }
+    return snapshot;
+}
@@ -0,0 +1,128 @@
+#include "io/io.hpp"
+#include "math/constants.hpp"
+#include "reactions/association/association.hpp"
+
+namespace {
+// association counters written after the bound pairs, in the order of write_NboundPairs
+const int numAssocCounters { 8 };
+
+TimeSeriesFile::Header make_header(TimeSeriesKind kind, int numColumns, const Parameters& params, const std::string& textHeader)
+{
+    TimeSeriesFile::Header header {};
+    header.kind = kind;
+    header.numColumns = numColumns;
+    header.timeStep = params.timeStep;
+    header.itrRestartFrom = params.itrRestartFrom;
+    header.timeRestartFrom = params.timeRestartFrom;
+    header.textHeader = textHeader;
+    return header;
+}
+}
+
+void open_time_series(TimeSeriesSet& timeSeries, const Parameters& params, const copyCounters& counterArrays,
+    const std::string& speciesHeader, const std::string& pairHeader)
+{
+    timeSeries.copyNumbers.open(params.output_path("copy_numbers_time.bin"),
+        make_header(TimeSeriesKind::copyNumbers, counterArrays.copyNumSpecies.size(), params, speciesHeader),
+        params.timeSeriesBlock);
+    timeSeries.boundPairs.open(params.output_path("bound_pair_time.bin"),
+        make_header(TimeSeriesKind::boundPairs, counterArrays.proPairlist.size() + numAssocCounters, params, pairHeader),
+        params.timeSeriesBlock);
+    timeSeries.eventCounters.open(params.output_path("event_counters_time.bin"),
+        make_header(TimeSeriesKind::eventCounters, 3 * counterArrays.eventArraySize, params, std::string {}),
+        params.timeSeriesBlock);
+}
+
+void write_counter_time_series(TimeSeriesSet& timeSeries, long long int simItr, const Parameters& params,
+    copyCounters& counterArrays, std::ofstream& pairOutfile, std::ofstream& eventFile, std::ofstream& speciesFile)
+{
+    double simTime { (simItr - params.itrRestartFrom) * params.timeStep * Constants::usToSeconds + params.timeRestartFrom };
+
+    if (timeSeries.is_open() == false) {
+        // write_NboundPairs doesn't read the Molecules
+        std::vector<Molecule> noMolecules {};
+        write_NboundPairs(counterArrays, pairOutfile, simItr, params, noMolecules);
+        print_association_events(counterArrays, eventFile, simItr, params);
+        write_all_species(simTime, speciesFile, counterArrays);
+        return;
+    }
+
+    timeSeries.copyNumbers.append_row(simItr, simTime, counterArrays.copyNumSpecies);
+
+    std::vector<int> pairRow {};
+    pairRow.reserve(counterArrays.proPairlist.size() + numAssocCounters);
+    for (auto index : counterArrays.proPairlist)
+        pairRow.push_back(counterArrays.nBoundPairs[index]);
+    pairRow.insert(pairRow.end(),
+        { counterArrays.nLoops, counterArrays.nCancelOverlapPartner, counterArrays.nCancelOverlapSystem,
+            counterArrays.nCancelSpanBox, counterArrays.nCancelDisplace2D, counterArrays.nCancelDisplace3D,
+            counterArrays.nCancelDisplace3Dto2D, counterArrays.nAssocSuccess });
+    timeSeries.boundPairs.append_row(simItr, simTime, pairRow);
+
+    std::vector<int> eventRow { counterArrays.events3D };
+    eventRow.insert(eventRow.end(), counterArrays.events3Dto2D.begin(), counterArrays.events3Dto2D.end());
+    eventRow.insert(eventRow.end(), counterArrays.events2D.begin(), counterArrays.events2D.end());
+    timeSeries.eventCounters.append_row(simItr, simTime, eventRow);
+}
+
+bool export_time_series(const std::string& seriesFileName, const std::string& textFileName)
+{
+    // the rows are written with the functions a text run uses, from the counters and time parameters they read
+    TimeSeriesFile::Header header {};
+    Parameters params {};
+    copyCounters counterArrays {};
+    std::vector<Molecule> noMolecules {};
+    std::ofstream textFile;
+
+    bool isRead { TimeSeriesFile::read(seriesFileName, header,
+        [&](long long int simItr, double simTime, const std::vector<int>& values) {
+            if (textFile.is_open() == false) {
+                params.timeStep = header.timeStep;
+                params.itrRestartFrom = header.itrRestartFrom;
+                params.timeRestartFrom = header.timeRestartFrom;
+                textFile.open(textFileName);
+                textFile << header.textHeader;
+            }
+
+            switch (header.kind) {
+            case TimeSeriesKind::copyNumbers:
+                counterArrays.copyNumSpecies = values;
+                write_all_species(simTime, textFile, counterArrays);
+                break;
+            case TimeSeriesKind::boundPairs: {
+                int numPairs { header.numColumns - numAssocCounters };
+                counterArrays.proPairlist.resize(numPairs);
+                for (int pair { 0 }; pair < numPairs; ++pair)
+                    counterArrays.proPairlist[pair] = pair;
+                counterArrays.nBoundPairs.assign(values.begin(), values.begin() + numPairs);
+                auto counter = values.begin() + numPairs;
+                counterArrays.nLoops = *counter++;
+                counterArrays.nCancelOverlapPartner = *counter++;
+                counterArrays.nCancelOverlapSystem = *counter++;
+                counterArrays.nCancelSpanBox = *counter++;
+                counterArrays.nCancelDisplace2D = *counter++;
+                counterArrays.nCancelDisplace3D = *counter++;
+                counterArrays.nCancelDisplace3Dto2D = *counter++;
+                counterArrays.nAssocSuccess = *counter++;
+                write_NboundPairs(counterArrays, textFile, simItr, params, noMolecules);
+                break;
+            }
+            case TimeSeriesKind::eventCounters: {
+                int arraySize { header.numColumns / 3 };
+                counterArrays.eventArraySize = arraySize;
+                counterArrays.events3D.assign(values.begin(), values.begin() + arraySize);
+                counterArrays.events3Dto2D.assign(values.begin() + arraySize, values.begin() + 2 * arraySize);
+                counterArrays.events2D.assign(values.begin() + 2 * arraySize, values.end());
+                print_association_events(counterArrays, textFile, simItr, params);
+                break;
+            }
+            }
+        }) };
+
+    // a run that stopped before writing any row still gets the header
+    if (isRead && textFile.is_open() == false) {
+        textFile.open(textFileName);
+        textFile << header.textHeader;
+    }
+    return isRead;
+}
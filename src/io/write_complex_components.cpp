@@ -5,10 +5,10 @@
 
 void write_complex_components(long long int simItr, std::ofstream& complexFile, const Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    const std::vector<MolTemplate>& molTemplateList)
+    const std::vector<MolTemplate>& molTemplateList, const SimulContext& context)
 {
     // TRACE();
-    complexFile << "iter: " << simItr << " Ncomplexes: " << Complex::numberOfComplexes << '\n';
+    complexFile << "iter: " << simItr << " Ncomplexes: " << context.numberOfComplexes << '\n';
     int totMols { 0 };
     for (auto& complex : complexList) {
         if (!complex.isEmpty) {
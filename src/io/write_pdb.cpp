@@ -4,22 +4,18 @@
 #include <ctime>
 #include <iomanip>
 
-void write_pdb(long long int simItr, unsigned frameNum, const Parameters& params, const std::vector<Molecule>& moleculeList,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+static void write_pdb_cryst1(std::ofstream& pdbFile, const Membrane& membraneObject)
 {
-    // TRACE();
-    long long int totFrames { params.nItr / params.trajWrite };
-    //    std::ofstream pdbFile { "pdb/" + std::to_string(frameNum) + ".pdb" };
-    // if (!pdbFile) {
-    std::ofstream pdbFile { std::to_string(frameNum) + ".pdb" };
-    //}
-    auto printTime = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-    pdbFile << std::left << std::setw(6) << "TITLE" << ' ' << std::left << std::setw(70) << "PDB TIMESTEP " << simItr
-            << " CREATED " << std::ctime(&printTime);
     pdbFile << std::left << std::setw(6) << "CRYST1  " << std::setw(9) << membraneObject.waterBox.x << std::setw(9)
             << membraneObject.waterBox.y << std::setw(9) << membraneObject.waterBox.z << std::setw(7) << 90 << std::setw(7) << 90
-            << std::setw(7) << 90 << ' ' << 'P' << std::setw(4) << 1 << std::endl;
+            << std::setw(7) << 90 << ' ' << 'P' << std::setw(4) << 1 << '\n';
+}
 
+// ATOM records of one frame: a placeholder per species, so visualization software colors them the same in every
+// frame, then the COM and interfaces of each Molecule, unwrapped across the periodic sides
+static void write_pdb_atoms(std::ofstream& pdbFile, const std::vector<Molecule>& moleculeList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+{
     int i { 0 };
     for (const auto& oneTemp : molTemplateList) {
         // this is just so visualization software reads species in at the same color whether or not they're in the
@@ -30,7 +26,7 @@ void write_pdb(long long int simItr, unsigned frameNum, const Parameters& params
                 << molTemplateList[i].molName.substr(0, 3) << ' ' << std::right << std::setw(4) << i << "     "
                 << std::setw(8) << membraneObject.waterBox.x << std::setw(8) << membraneObject.waterBox.y << std::setw(8)
                 << membraneObject.waterBox.z << std::setw(6) << 0.00 << std::setw(6) << 0.00 << std::left << std::setw(2)
-                << "CL" << std::endl;
+                << "CL" << '\n';
         ++i;
     }
     int molCounter { 0 };
@@ -40,29 +36,69 @@ void write_pdb(long long int simItr, unsigned frameNum, const Parameters& params
 
         if (!mol.isEmpty) {
             const MolTemplate& oneTemp = molTemplateList[mol.molTypeIndex];
+            Coord comCoord { mol.comCoord + mol.imageOffset };
             pdbFile << std::right << "ATOM  " << std::setw(5) << i << ' ' << std::setw(4) << " COM" << ' '
                     << std::setw(3) << oneTemp.molName.substr(0, 3) << ' ' << std::right << std::setw(4) << molCounter << "     "
-                    << std::setw(8) << std::fixed << std::setprecision(3) << (mol.comCoord.x + membraneObject.waterBox.x / 2) << std::setw(8)
-                    << (mol.comCoord.y + membraneObject.waterBox.y / 2) << std::setw(8)
-                    << (mol.comCoord.z + membraneObject.waterBox.z / 2);
+                    << std::setw(8) << std::fixed << std::setprecision(3) << (comCoord.x + membraneObject.waterBox.x / 2) << std::setw(8)
+                    << (comCoord.y + membraneObject.waterBox.y / 2) << std::setw(8)
+                    << (comCoord.z + membraneObject.waterBox.z / 2);
             pdbFile.unsetf(std::ios_base::fixed);
             pdbFile << std::setw(6) << 0.00 << std::setw(6) << 0.00
-                    << std::left << std::setw(2) << "CL" << std::endl;
+                    << std::left << std::setw(2) << "CL" << '\n';
             ++i;
 
             for (unsigned j { 0 }; j < mol.interfaceList.size(); ++j) {
+                Coord ifaceCoord { mol.interfaceList[j].coord + mol.imageOffset };
                 pdbFile << std::right << "ATOM  " << std::setw(5) << i << ' ' << std::setw(4) // << ' '
                         << oneTemp.interfaceList[j].name.substr(0, 3) << ' ' << std::setw(3)
                         << oneTemp.molName.substr(0, 3) << ' ' << std::right << std::setw(4) << molCounter << "     "
-                        << std::setw(8) << std::fixed << std::setprecision(3) << (mol.interfaceList[j].coord.x + membraneObject.waterBox.x / 2) << std::setw(8)
-                        << (mol.interfaceList[j].coord.y + membraneObject.waterBox.y / 2) << std::setw(8)
-                        << (mol.interfaceList[j].coord.z + membraneObject.waterBox.z / 2);
+                        << std::setw(8) << std::fixed << std::setprecision(3) << (ifaceCoord.x + membraneObject.waterBox.x / 2) << std::setw(8)
+                        << (ifaceCoord.y + membraneObject.waterBox.y / 2) << std::setw(8)
+                        << (ifaceCoord.z + membraneObject.waterBox.z / 2);
                 pdbFile.unsetf(std::ios_base::fixed);
                 pdbFile << std::setw(6) << 0.00
-                        << std::setw(6) << 0.00 << std::left << std::setw(2) << "CL" << std::endl;
+                        << std::setw(6) << 0.00 << std::left << std::setw(2) << "CL" << '\n';
                 ++i;
             }
             ++molCounter;
         }
     }
 }
+
+void write_pdb(long long int simItr, unsigned frameNum, const Parameters& params, const std::vector<Molecule>& moleculeList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+{
+    // TRACE();
+    long long int totFrames { params.nItr / params.trajWrite };
+    //    std::ofstream pdbFile { "pdb/" + std::to_string(frameNum) + ".pdb" };
+    // if (!pdbFile) {
+    std::ofstream pdbFile { params.output_path(std::to_string(frameNum) + ".pdb") };
+    //}
+    // as std::ctime would write it, which shares its text between threads
+    auto printTime = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm printLocalTime {};
+#if defined(__APPLE__) || defined(__linux__)
+    localtime_r(&printTime, &printLocalTime);
+#else
+    printLocalTime = *std::localtime(&printTime);
+#endif
+    char printTimeText[32];
+    strftime(printTimeText, sizeof(printTimeText), "%a %b %e %H:%M:%S %Y\n", &printLocalTime);
+    pdbFile << std::left << std::setw(6) << "TITLE" << ' ' << std::left << std::setw(70) << "PDB TIMESTEP " << simItr
+            << " CREATED " << printTimeText;
+    write_pdb_cryst1(pdbFile, membraneObject);
+
+    write_pdb_atoms(pdbFile, moleculeList, molTemplateList, membraneObject);
+}
+
+void write_pdb_model(PdbStream& pdbStream, long long int simItr, const std::vector<Molecule>& moleculeList,
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+{
+    // TRACE();
+    // the box doesn't change, so the whole file has one unit cell record
+    if (pdbStream.get_num_frames() == 0)
+        write_pdb_cryst1(pdbStream.get_file(), membraneObject);
+    std::ofstream& pdbFile = pdbStream.begin_model(simItr);
+    write_pdb_atoms(pdbFile, moleculeList, molTemplateList, membraneObject);
+    pdbStream.end_model();
+}
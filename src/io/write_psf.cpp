@@ -5,19 +5,19 @@
 #include <iomanip>
 
 void write_psf(const Parameters& params, const std::vector<Molecule>& moleculeList,
-    const std::vector<MolTemplate>& molTemplateList)
+    const std::vector<MolTemplate>& molTemplateList, const SimulContext& context)
 {
     // TODO: Not currently working properly
 
     // std::cout << "Writing system PSF to system.psf...\n";
-    std::ofstream outFile("system.psf");
+    std::ofstream outFile(params.output_path("system.psf"));
     // Write PSF Header
     outFile << "PSF CMAP CHEQ\n\n";
     outFile << std::setw(8) << "2"
             << " !NTITLE\n";
     outFile << "REMARKS PSF for entire system\n";
-    outFile << "REMARKS total molecules: " << Molecule::numberOfMolecules << '\n';
-    outFile << "REMARKS total complexes: " << Complex::numberOfComplexes << '\n';
+    outFile << "REMARKS total molecules: " << context.numberOfMolecules << '\n';
+    outFile << "REMARKS total complexes: " << context.numberOfComplexes << '\n';
     /*Exclude Implicit lipids HERE*/
 
     //add up the number of sites to print
@@ -4,11 +4,12 @@
 #include <ctime>
 #include <iomanip>
 
-void write_restart(long long int simItr, std::ofstream& restartFile, const Parameters& params, const SimulVolume& simulVolume,
+void write_restart(long long int simItr, std::ostream& restartFile, const Parameters& params, const SimulVolume& simulVolume,
     const std::vector<Molecule>& moleculeList, const std::vector<Complex>& complexList,
     const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
     const std::vector<BackRxn>& backRxns, const std::vector<CreateDestructRxn>& createDestructRxns,
-    const std::map<std::string, int>& observablesList, const Membrane& membraneObject, const copyCounters& counterArrays)
+    const std::map<std::string, int>& observablesList, const Membrane& membraneObject, const copyCounters& counterArrays,
+    const SimulContext& context)
 {
     // TRACE();
     // Write parameters
@@ -36,13 +37,19 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
             }
         }
         restartFile << '\n';
-        restartFile << "implicitLipidsParams = " << membraneObject.implicitLipid << ' ' << membraneObject.TwoD << ' ' << membraneObject.isBox << ' ' << membraneObject.isSphere << ' ' << membraneObject.sphereR << '\n';
+        restartFile << "implicitLipidsParams = " << membraneObject.implicitLipid << ' ' << membraneObject.TwoD << ' ' << membraneObject.isBox << ' ' << membraneObject.isSphere << ' ' << membraneObject.sphereR;
+        if (membraneObject.hasPeriodic) // only then, so restart files without pbc stay as they were
+            restartFile << ' ' << membraneObject.xBCtype << ' ' << membraneObject.yBCtype << ' ' << membraneObject.zBCtype;
+        restartFile << '\n';
         restartFile << "ifaceOverlapSepLimit = " << params.overlapSepLimit << '\n';
         restartFile << "rMaxLimit = " << params.rMaxLimit << '\n';
         restartFile << "timeWrite = " << params.timeWrite << '\n';
         restartFile << "trajWrite = " << params.trajWrite << '\n';
         restartFile << "restartWrite = " << params.restartWrite << '\n';
-        restartFile << "pdbWrite = " << params.pdbWrite << '\n';
+        restartFile << "pdbWrite = " << params.pdbWrite;
+        if (params.pdbStream) // only then, so restart files without it stay as they were
+            restartFile << ' ' << params.pdbStream;
+        restartFile << '\n';
         restartFile << "checkPoint = " << params.checkPoint << '\n';
         restartFile << "scaleMaxDisplace = " << params.scaleMaxDisplace << '\n';
     }
@@ -71,15 +78,15 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
     // write MolTemplates
     {
         restartFile << "#MolTemplates \n";
-        restartFile << MolTemplate::numMolTypes;
-        for (auto& num : MolTemplate::numEachMolType)
+        restartFile << context.numMolTypes;
+        for (auto& num : context.numEachMolType)
             restartFile << ' ' << num;
         restartFile << '\n';
-        restartFile << MolTemplate::absToRelIface.size();
-        for (auto& iface : MolTemplate::absToRelIface)
+        restartFile << context.absToRelIface.size();
+        for (auto& iface : context.absToRelIface)
             restartFile << ' ' << iface;
         restartFile << '\n';
-        restartFile << Interface::State::totalNumOfStates << '\n';
+        restartFile << context.totalNumOfStates << '\n';
 
         for (const auto& oneTemp : molTemplateList) {
             restartFile << oneTemp.molTypeIndex << ' ' << oneTemp.molName << '\n';
@@ -153,8 +160,8 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
     // write Reactions
     {
         restartFile << "#Reactions \n";
-        restartFile << RxnBase::numberOfRxns << ' ' << forwardRxns.size() << ' ' << backRxns.size() << ' '
-                    << createDestructRxns.size() << ' ' << RxnBase::totRxnSpecies << '\n';
+        restartFile << context.numberOfRxns << ' ' << forwardRxns.size() << ' ' << backRxns.size() << ' '
+                    << createDestructRxns.size() << ' ' << context.totRxnSpecies << '\n';
 
         // forward reactions
         for (const auto& oneRxn : forwardRxns) {
@@ -353,15 +360,17 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
     // write Molecules
     {
         restartFile << "#All Molecules and coordinates \n";
-        restartFile << moleculeList.size() << ' ' << Molecule::numberOfMolecules << '\n';
+        restartFile << moleculeList.size() << ' ' << context.numberOfMolecules << '\n';
         for (auto& oneMol : moleculeList) {
             restartFile << oneMol.index << ' ' << oneMol.isEmpty << ' ' << oneMol.myComIndex << ' '
                         << oneMol.molTypeIndex << ' ' << oneMol.mySubVolIndex << '\n';
             restartFile << oneMol.mass << ' ' << oneMol.isLipid << ' ' << oneMol.isImplicitLipid << ' ' << oneMol.linksToSurface << ' ' << oneMol.isEmpty << '\n';
 
-            // center of mass
-            restartFile << std::fixed << oneMol.comCoord.x << ' ' << oneMol.comCoord.y << ' ' << oneMol.comCoord.z
-                        << '\n';
+            // center of mass, and how far the periodic sides moved it
+            restartFile << std::fixed << oneMol.comCoord.x << ' ' << oneMol.comCoord.y << ' ' << oneMol.comCoord.z;
+            if (membraneObject.hasPeriodic)
+                restartFile << ' ' << oneMol.imageOffset.x << ' ' << oneMol.imageOffset.y << ' ' << oneMol.imageOffset.z;
+            restartFile << '\n';
 
             // interface lists
             restartFile << oneMol.freelist.size();
@@ -419,8 +428,8 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
             restartFile << '\n';
         }
 
-        restartFile << Molecule::emptyMolList.size();
-        for (auto& index : Molecule::emptyMolList)
+        restartFile << context.emptyMolList.size();
+        for (auto& index : context.emptyMolList)
             restartFile << ' ' << index;
         restartFile << '\n';
     }
@@ -428,7 +437,7 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
     // write Complexes
     {
         restartFile << "#All Complexes and their components \n";
-        restartFile << complexList.size() << ' ' << Complex::numberOfComplexes << '\n';
+        restartFile << complexList.size() << ' ' << context.numberOfComplexes << '\n';
         for (const auto& oneCom : complexList) {
             restartFile << oneCom.index << ' ' << oneCom.isEmpty << ' ' << oneCom.radius << ' ' << oneCom.mass << '\n';
             restartFile << oneCom.linksToSurface << ' ' << oneCom.iLipidIndex << ' ' << oneCom.OnSurface << '\n';
@@ -448,8 +457,8 @@ void write_restart(long long int simItr, std::ofstream& restartFile, const Param
             restartFile << '\n';
         }
 
-        restartFile << Complex::emptyComList.size();
-        for (auto& index : Complex::emptyComList)
+        restartFile << context.emptyComList.size();
+        for (auto& index : context.emptyComList)
             restartFile << ' ' << index;
         restartFile << '\n';
     }
@@ -5,11 +5,12 @@
 
 void write_timestep_information(long long int simItr, std::ofstream& outFile, std::ofstream& molecTypesFile,
     std::ofstream& textTimeStatFile, const Parameters& params, std::vector<std::vector<int>>& molecTypesList,
-    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList)
+    int& currNumberMolTypes, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
+    std::vector<MolTemplate>& molTemplateList, const SimulContext& context)
 {
     // TRACE();
-    Complex::currNumberComTypes = 0; // reset and then recount complex types
-    int HEIGHT { Complex::numberOfComplexes };
+    int currNumberComTypes { 0 }; // recount complex types
+    int HEIGHT { context.numberOfComplexes };
     int WIDTH = 2 + 2 * molTemplateList.size(); // max number of different molecules in a complex is Nprotypes
 
     int** adjmat;
@@ -25,11 +26,11 @@ void write_timestep_information(long long int simItr, std::ofstream& outFile, st
     }
 
     int** complexstat; // define and allocate unique complex ids/positions
-    complexstat = new int*[Complex::numberOfComplexes];
-    for (int i = 0; i < Complex::numberOfComplexes; i++)
+    complexstat = new int*[context.numberOfComplexes];
+    for (int i = 0; i < context.numberOfComplexes; i++)
         complexstat[i] = new int[2];
 
-    for (int i = 0; i < Complex::numberOfComplexes; i++) {
+    for (int i = 0; i < context.numberOfComplexes; i++) {
         for (int j = 0; j < 2; j++) {
             complexstat[i][j] = 0;
         }
@@ -37,9 +38,9 @@ void write_timestep_information(long long int simItr, std::ofstream& outFile, st
 
     for (int i = 0; i < HEIGHT; i++) {
         bool isDupeComplex { false };
-        if (Complex::currNumberComTypes == 0) {
-            complexstat[Complex::currNumberComTypes][0] = i;
-            Complex::currNumberComTypes += 1;
+        if (currNumberComTypes == 0) {
+            complexstat[currNumberComTypes][0] = i;
+            currNumberComTypes += 1;
         }
 
         int numUniqueMols { 0 };
@@ -71,27 +72,27 @@ void write_timestep_information(long long int simItr, std::ofstream& outFile, st
         adjmat[i][0] = uniqueComID;
 
         isDupeComplex = false;
-        for (int j = 0; j < Complex::currNumberComTypes; j++) {
+        for (int j = 0; j < currNumberComTypes; j++) {
             if (adjmat[i][0] == adjmat[complexstat[j][0]][0]) {
                 isDupeComplex = true;
                 break;
             }
         }
         if (!isDupeComplex) {
-            complexstat[Complex::currNumberComTypes][0] = i;
-            Complex::currNumberComTypes += 1;
+            complexstat[currNumberComTypes][0] = i;
+            currNumberComTypes += 1;
         }
     }
 
     outFile << simItr << "\t" << simItr * params.timeStep * 1e-6 << "\t";
 
-    for (int i = 0; i < Complex::currNumberComTypes; i++) {
+    for (int i = 0; i < currNumberComTypes; i++) {
 
         bool uniqmolexists { false };
         int compindex = complexstat[i][0];
         int numuniqmol = adjmat[compindex][1];
 
-        for (int j = 0; j < Complex::currNumberMolTypes; j++) {
+        for (int j = 0; j < currNumberMolTypes; j++) {
             if (adjmat[compindex][0] == molecTypesList[j][0]) {
                 uniqmolexists = 1;
                 break;
@@ -101,7 +102,7 @@ void write_timestep_information(long long int simItr, std::ofstream& outFile, st
         if (uniqmolexists == 0) { // this is for keeping track of unique types of molecules produced
 
             for (int k = 0; k < 2 * adjmat[compindex][1] + 2; k++) {
-                molecTypesList[Complex::currNumberMolTypes][k] = adjmat[compindex][k];
+                molecTypesList[currNumberMolTypes][k] = adjmat[compindex][k];
             }
             for (int k = 1; k < numuniqmol + 1; k++) {
                 molecTypesFile << "P";
@@ -110,7 +111,7 @@ void write_timestep_information(long long int simItr, std::ofstream& outFile, st
                 molecTypesFile << adjmat[compindex][2 * k + 1];
             }
             molecTypesFile << '\n';
-            Complex::currNumberMolTypes += 1;
+            currNumberMolTypes += 1;
         }
 
         for (int j = 0; j < HEIGHT; j++) {
@@ -143,7 +144,7 @@ void write_timestep_information(long long int simItr, std::ofstream& outFile, st
         delete[] adjmat[i];
     delete[] adjmat;
 
-    for (int i = 0; i < Complex::numberOfComplexes; i++)
+    for (int i = 0; i < context.numberOfComplexes; i++)
         delete[] complexstat[i];
     delete[] complexstat;
 }
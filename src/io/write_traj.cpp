@@ -15,27 +15,37 @@ void write_traj(long long int iter, std::ofstream& trajFile, const Parameters& p
     for (auto& molTemp : molTemplateList)
         molTypeNames.push_back(molTemp.molName.substr(0, 2));
 
-    trajFile << params.numTotalUnits << '\n';
+    // filtered frames only hold the selected Molecules, and aren't padded
+    unsigned numUnits { params.numTotalUnits };
+    if (params.trajFilter.is_active()) {
+        numUnits = 0;
+        for (auto& mol : moleculeList) {
+            if (!mol.isEmpty && !mol.isImplicitLipid)
+                numUnits += 1 + mol.interfaceList.size();
+        }
+    }
+
+    trajFile << numUnits << '\n';
     trajFile << "iteration: " << iter << std::endl;
-    int numWritten { 0 };
+    // with periodic sides, the coordinates are unwrapped, so Molecules don't jump across the box between frames
+    unsigned numWritten { 0 };
     for (auto& mol : moleculeList) {
         if (mol.isEmpty || mol.isImplicitLipid)
             continue;
         {
-            trajFile << std::setw(4) << molTypeNames[mol.molTypeIndex] << ' ' << std::fixed << mol.comCoord << '\n';
+            trajFile << std::setw(4) << molTypeNames[mol.molTypeIndex] << ' ' << std::fixed << mol.comCoord + mol.imageOffset << '\n';
             ++numWritten;
             for (auto& iface : mol.interfaceList) {
-                trajFile << std::setw(4) << molTypeNames[mol.molTypeIndex] << ' ' << std::fixed << iface.coord << '\n';
+                trajFile << std::setw(4) << molTypeNames[mol.molTypeIndex] << ' ' << std::fixed << iface.coord + mol.imageOffset << '\n';
                 ++numWritten;
             }
-            trajFile << std::flush;
         }
     }
 
-    while (numWritten < params.numTotalUnits) {
+    while (numWritten < numUnits) {
         trajFile << std::setw(4) << "EMTY" << ' ' << std::fixed << membraneObject.waterBox.x / 2.0 << std::fixed
                  << membraneObject.waterBox.y / 2.0 << std::fixed << membraneObject.waterBox.z / 2.0 << '\n';
         ++numWritten;
-        trajFile << std::flush;
     }
+    trajFile << std::flush;
 }
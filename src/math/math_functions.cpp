@@ -2,6 +2,7 @@
  * ### Created on 2019-02-06 by Matthew Varga
  */
 #include "math/math_functions.hpp"
+#include <array>
 #include <cmath>
 #include <iostream>
 
@@ -17,7 +18,7 @@ double MathFuncs::gammln(double n)
     double y { 0 };
     double tmp { 0 };
     double ser { 0 };
-    static double cof[6] = { 76.18009172947146, -86.50532032941677, 24.01409824083091, -1.231739572450155,
+    static const double cof[6] = { 76.18009172947146, -86.50532032941677, 24.01409824083091, -1.231739572450155,
         0.1208650973866179e-2, -0.5395239384953e-5 };
     int j { 0 };
     y = x = n;
@@ -29,11 +30,22 @@ double MathFuncs::gammln(double n)
     return -tmp + log(2.5066282746310005 * ser / x);
 }
 
+namespace {
+// 0! to 32! in single precision, each the product of the last one, as they were first cached
+std::array<float, 33> make_factorial_table()
+{
+    std::array<float, 33> a {};
+    a[0] = 1.0;
+    for (int ntop { 1 }; ntop < 33; ++ntop)
+        a[ntop] = a[ntop - 1] * ntop;
+    return a;
+}
+}
+
 double MathFuncs::gammFactorial(int n)
 {
-    static int ntop = 4;
-    static float a[33] = { 1.0, 1.0, 2.0, 6.0, 24.0 };
-    int j { 0 };
+    // filled in once, so the replica threads only read it
+    static const std::array<float, 33> a { make_factorial_table() };
 
     if (n < 0) {
         std::cerr << "Error, computing factorial for negative number.\n";
@@ -43,10 +55,5 @@ double MathFuncs::gammFactorial(int n)
     if (n > 32)
         return exp(gammln(n + 1.0));
 
-    while (ntop < n) {
-        j = ntop++;
-        a[ntop] = a[j] * ntop;
-    }
-
     return a[n];
 }
\ No newline at end of file
@@ -13,7 +13,7 @@
 #include "math/matrix.hpp"
 #include <cmath>
 
-Vector matrix_rotate(Vector& vec, std::array<double, 9>& M)
+Vector matrix_rotate(const Vector& vec, const std::array<double, 9>& M)
 {
     return { M[0] * vec.x + M[1] * vec.y + M[2] * vec.z,
              M[3] * vec.x + M[4] * vec.y + M[5] * vec.z,
@@ -3,45 +3,15 @@
 #include <cmath>
 #include <iostream>
 
-//static gsl_rng* the_generator = nullptr;
-
-double rand_gsl()
+double rand_gsl(gsl_rng* r)
 {
-    //++randNum;
-    //if (!the_generator)
-    //    the_generator = gsl_rng_alloc(gsl_rng_taus);
     return gsl_rng_uniform(r) + 1.0 / (gsl_rng_max(r) + 1.0) * gsl_rng_uniform(r);
 }
 
-void srand_gsl(int num)
-{
-    //if (!the_generator)
-    //    the_generator = gsl_rng_alloc(gsl_rng_taus);
-    gsl_rng_set(r, num);
-}
-
-void write_rng_state()
-{
-    FILE* stateOut = fopen("rng_state", "w");
-    if (ferror(stateOut)) {
-        std::cerr << "ERROR: Could not open RNG state file for writing. Exiting.\n";
-        exit(1);
-    }
-
-    int stateWriteState = gsl_rng_fwrite(stateOut, r);
-    if (stateWriteState == GSL_EFAILED) {
-        std::cerr << "ERROR: Could not write RNG state file. Exiting.\n";
-        exit(1);
-    }
-    fclose(stateOut);
-}
-
-void write_rng_state_simItr(int simItr)
+void write_rng_state(const gsl_rng* r, const std::string& fileName)
 {
-    char fnameProXYZ[100];
-    sprintf(fnameProXYZ, "rng_state%d", simItr);
-    FILE* stateOut = fopen(fnameProXYZ, "w");
-    if (ferror(stateOut)) {
+    FILE* stateOut = fopen(fileName.c_str(), "w");
+    if (stateOut == nullptr || ferror(stateOut)) {
         std::cerr << "ERROR: Could not open RNG state file for writing. Exiting.\n";
         exit(1);
     }
@@ -54,10 +24,10 @@ void write_rng_state_simItr(int simItr)
     fclose(stateOut);
 }
 
-void read_rng_state()
+void read_rng_state(gsl_rng* r, const std::string& fileName)
 {
     //std::cout << "Reading RNG state file.\n";
-    FILE* stateIn = fopen("rng_state", "r");
+    FILE* stateIn = fopen(fileName.c_str(), "r");
     if (stateIn == nullptr || ferror(stateIn)) {
         std::cerr << "Could not find RNG state file, initializing new RNG..\n";
         fclose(stateIn);
@@ -73,7 +43,7 @@ void read_rng_state()
     fclose(stateIn);
 }
 
-double GaussV()
+double GaussV(gsl_rng* r)
 {
     double R { 2.0 };
     double V1 {};
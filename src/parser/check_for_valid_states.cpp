@@ -1,10 +1,10 @@
 #include "parser/parser_functions.hpp"
 
-void check_for_valid_states( size_t parsedMolIndex, ParsedMol& targMol, ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList)
+void check_for_valid_states( size_t parsedMolIndex, ParsedMol& targMol, ParsedRxn& parsedRxn, const std::vector<MolTemplate>& molTemplateList, std::ostream& log)
 {
 
     // find the template which corresponds to the reactant molName
-    std::cout << "Checking for valid states for reactant " << targMol.molName << '\n';
+    log << "Checking for valid states for reactant " << targMol.molName << '\n';
     auto tempNameItr = std::find_if(molTemplateList.begin(), molTemplateList.end(),
         [&](const MolTemplate& oneTemp) -> bool { return oneTemp.molName == targMol.molName; });
 
@@ -22,7 +22,7 @@ void check_for_valid_states( size_t parsedMolIndex, ParsedMol& targMol, ParsedRx
             [&](const Interface& oneTempIface) -> bool { return oneTempIface.name == ifaceItr->ifaceName; });
 
         if (tempIfaceItr == tempNameItr->interfaceList.end()) {
-            std::cout << ifaceItr->ifaceName << " is not a valid interface for molecule template "
+            std::cerr << ifaceItr->ifaceName << " is not a valid interface for molecule template "
                       << tempNameItr->molName << '\n';
             exit(120);
         }
@@ -32,7 +32,7 @@ void check_for_valid_states( size_t parsedMolIndex, ParsedMol& targMol, ParsedRx
         if (tempIfaceItr->stateList.size() != 1 && ifaceItr->state == '\0') {
             // if no state is explicitly provided, but the iface has specific states, we need to create separate
             // reactions for each state
-            std::cout << "No interface state provided for reactant "
+            log << "No interface state provided for reactant "
                       << write_mol_iface(targMol.molName, ifaceItr->ifaceName)
                       << ". Will create separate reactions for each possible interface." << '\n';
             parsedRxn.noStateList.insert({ parsedMolIndex, *ifaceItr });
@@ -43,17 +43,17 @@ void check_for_valid_states( size_t parsedMolIndex, ParsedMol& targMol, ParsedRx
 
             if (tempStateItr == tempIfaceItr->stateList.end()) {
                 // if it doesn't exist, exit
-                std::cout << ifaceItr->state << " is not a valid state for interface "
+                std::cerr << ifaceItr->state << " is not a valid state for interface "
                           << write_mol_iface(targMol.molName, ifaceItr->ifaceName) << '\n';
                 exit(1);
             }
 
             // if the state does exist, look for a state change
             if (parsedRxn.rxnType != ReactionType::destruction) {
-                std::cout << "Found state, looking for state change..." << '\n';
-                check_for_state_change(*ifaceItr, targMol, parsedRxn);
+                log << "Found state, looking for state change..." << '\n';
+                check_for_state_change(*ifaceItr, targMol, parsedRxn, log);
             } else
-                std::cout << "Found state for reactant " << write_mol_iface(targMol.molName, ifaceItr->ifaceName)
+                log << "Found state for reactant " << write_mol_iface(targMol.molName, ifaceItr->ifaceName)
                           << '\n';
         }
     }
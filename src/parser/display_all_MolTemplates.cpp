@@ -1,10 +1,10 @@
 #include "io/io.hpp"
 #include "parser/parser_functions.hpp"
 
-void display_all_MolTemplates(const std::vector<MolTemplate>& molTemplates)
+void display_all_MolTemplates(std::ostream& os, const std::vector<MolTemplate>& molTemplates)
 {
     for (auto& oneTemp : molTemplates) {
-        oneTemp.display();
+        oneTemp.display(os);
         // if (&oneTemp - &molTemplates[0] + 1 != molTemplates.size())
         //     std::cout << linebreak;
     }
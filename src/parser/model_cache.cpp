@@ -0,0 +1,526 @@
+#include "parser/parser_functions.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+const char cacheMagic[8] { 'N', 'E', 'R', 'D', 'S', 'S', 'M', 'C' };
+const int32_t cacheVersion { 1 };
+
+// largest list a compiled model is expected to hold. a larger size means the file is damaged
+const uint64_t maxListSize { uint64_t(1) << 32 };
+
+uint64_t fnv1a(const std::string& text, uint64_t hash = 14695981039346656037ULL)
+{
+    for (unsigned char character : text) {
+        hash ^= character;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string read_file(const std::string& fileName, bool& isRead)
+{
+    std::ifstream file { fileName, std::ios::binary };
+    std::ostringstream text;
+    text << file.rdbuf();
+    isRead = bool(file);
+    return text.str();
+}
+
+// hash of everything but the parameters block, so runs that only change parameters share a model
+uint64_t hash_model_input(const std::string& fileName)
+{
+    std::ifstream inputFile { fileName };
+    if (!inputFile) {
+        std::cerr << "Reaction file cannot be opened. Exiting..." << std::endl;
+        exit(1);
+    }
+    uint64_t hash { fnv1a(std::to_string(cacheVersion)) };
+    bool isInParameters { false };
+    std::string line;
+    while (getline(inputFile, line)) {
+        std::string tmpLine { line };
+        tmpLine.erase(std::remove_if(tmpLine.begin(), tmpLine.end(), [](unsigned char x) { return std::isspace(x); }),
+            tmpLine.end());
+        std::transform(tmpLine.begin(), tmpLine.end(), tmpLine.begin(), ::tolower);
+        if (tmpLine == "startparameters")
+            isInParameters = true;
+        if (!isInParameters)
+            hash = fnv1a(line + '\n', hash);
+        if (tmpLine == "endparameters")
+            isInParameters = false;
+    }
+    return hash;
+}
+
+class CacheWriter {
+public:
+    explicit CacheWriter(std::ostream& _file)
+        : file(_file)
+    {
+    }
+
+    template <typename T> typename std::enable_if<std::is_arithmetic<T>::value>::type operator()(T& value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void operator()(ReactionType& rxnType)
+    {
+        int32_t value { static_cast<int32_t>(rxnType) };
+        (*this)(value);
+    }
+    void operator()(std::string& text)
+    {
+        uint64_t size { text.size() };
+        (*this)(size);
+        file.write(text.data(), size);
+    }
+    template <typename T> void operator()(std::vector<T>& list)
+    {
+        uint64_t size { list.size() };
+        (*this)(size);
+        for (auto& elem : list)
+            (*this)(elem);
+    }
+    template <typename T, std::size_t N> void operator()(std::array<T, N>& list)
+    {
+        for (auto& elem : list)
+            (*this)(elem);
+    }
+    template <typename T, typename U> void operator()(std::pair<T, U>& elem)
+    {
+        (*this)(elem.first);
+        (*this)(elem.second);
+    }
+    void operator()(std::map<std::string, int>& list)
+    {
+        std::vector<std::pair<std::string, int>> elems(list.begin(), list.end());
+        (*this)(elems);
+    }
+    template <typename T> typename std::enable_if<std::is_class<T>::value>::type operator()(T& elem)
+    {
+        transfer(*this, elem);
+    }
+
+    bool is_good() const { return bool(file); }
+
+private:
+    std::ostream& file;
+};
+
+class CacheReader {
+public:
+    explicit CacheReader(std::istream& _file)
+        : file(_file)
+    {
+    }
+
+    template <typename T> typename std::enable_if<std::is_arithmetic<T>::value>::type operator()(T& value)
+    {
+        file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+    void operator()(ReactionType& rxnType)
+    {
+        int32_t value { 0 };
+        (*this)(value);
+        rxnType = static_cast<ReactionType>(value);
+    }
+    void operator()(std::string& text)
+    {
+        uint64_t size { read_size() };
+        text.resize(size);
+        if (size > 0)
+            file.read(&text[0], size);
+    }
+    template <typename T> void operator()(std::vector<T>& list)
+    {
+        uint64_t size { read_size() };
+        list.resize(size);
+        for (auto& elem : list)
+            (*this)(elem);
+    }
+    template <typename T, std::size_t N> void operator()(std::array<T, N>& list)
+    {
+        for (auto& elem : list)
+            (*this)(elem);
+    }
+    template <typename T, typename U> void operator()(std::pair<T, U>& elem)
+    {
+        (*this)(elem.first);
+        (*this)(elem.second);
+    }
+    void operator()(std::map<std::string, int>& list)
+    {
+        std::vector<std::pair<std::string, int>> elems {};
+        (*this)(elems);
+        list = std::map<std::string, int>(elems.begin(), elems.end());
+    }
+    template <typename T> typename std::enable_if<std::is_class<T>::value>::type operator()(T& elem)
+    {
+        transfer(*this, elem);
+    }
+
+    bool is_good() const { return bool(file); }
+
+private:
+    std::istream& file;
+
+    uint64_t read_size()
+    {
+        uint64_t size { 0 };
+        (*this)(size);
+        if (!file || size > maxListSize) {
+            file.setstate(std::ios::failbit);
+            return 0;
+        }
+        return size;
+    }
+};
+}
+
+/* Every member parse_input() sets is listed once here, and the same list is used to write and to read a compiled
+ * model. A member added to these classes has to be added here too.
+ */
+template <typename Archive> void transfer(Archive& archive, Coord& coord)
+{
+    archive(coord.x);
+    archive(coord.y);
+    archive(coord.z);
+}
+
+template <typename Archive> void transfer(Archive& archive, Vector& vec)
+{
+    transfer(archive, static_cast<Coord&>(vec));
+    archive(vec.magnitude);
+}
+
+template <typename Archive> void transfer(Archive& archive, Interface::State& state)
+{
+    archive(state.ifaceAndStateName);
+    archive(state.iden);
+    archive(state.index);
+    archive(state.myForwardRxns);
+    archive(state.myCreateDestructRxns);
+    archive(state.rxnPartners);
+    archive(state.stateChangeRxns);
+}
+
+template <typename Archive> void transfer(Archive& archive, Interface& iface)
+{
+    archive(iface.index);
+    archive(iface.iCoord);
+    archive(iface.name);
+    archive(iface.stateList);
+    archive(iface.excludeVolumeBoundList);
+    archive(iface.excludeVolumeBoundIfaceList);
+    archive(iface.excludeVolumeBoundReactList);
+    archive(iface.excludeRadiusList);
+}
+
+template <typename Archive> void transfer(Archive& archive, ParsedMolNumState& numState)
+{
+    archive(numState.totalCopyNumbers);
+    archive(numState.numberEachState);
+    archive(numState.nameEachState);
+}
+
+template <typename Archive> void transfer(Archive& archive, MolTemplate& oneTemp)
+{
+    archive(oneTemp.comCoord);
+    archive(oneTemp.checkOverlap);
+    archive(oneTemp.copies);
+    archive(oneTemp.molTypeIndex);
+    archive(oneTemp.mass);
+    archive(oneTemp.radius);
+    archive(oneTemp.D);
+    archive(oneTemp.Dr);
+    archive(oneTemp.molName);
+    archive(oneTemp.interfaceList);
+    archive(oneTemp.rxnPartners);
+    archive(oneTemp.bondList);
+    archive(oneTemp.ifacesWithStates);
+    archive(oneTemp.startingNumState);
+    archive(oneTemp.canDestroy);
+    archive(oneTemp.excludeVolumeBound);
+    archive(oneTemp.monomerList);
+    archive(oneTemp.isRod);
+    archive(oneTemp.isLipid);
+    archive(oneTemp.isPoint);
+    archive(oneTemp.isImplicitLipid);
+    archive(oneTemp.bindToSurface);
+}
+
+template <typename Archive> void transfer(Archive& archive, RxnIface& rxnIface)
+{
+    archive(rxnIface.ifaceName);
+    archive(rxnIface.molTypeIndex);
+    archive(rxnIface.absIfaceIndex);
+    archive(rxnIface.relIfaceIndex);
+    archive(rxnIface.requiresState);
+    archive(rxnIface.requiresInteraction);
+}
+
+template <typename Archive> void transfer(Archive& archive, RxnBase::RateState& rateState)
+{
+    archive(rateState.rate);
+    archive(rateState.prob);
+    archive(rateState.otherIfaceLists);
+}
+
+template <typename Archive> void transfer(Archive& archive, RxnBase::CoupledRxn& coupledRxn)
+{
+    archive(coupledRxn.absRxnIndex);
+    archive(coupledRxn.relRxnIndex);
+    archive(coupledRxn.rxnType);
+    archive(coupledRxn.label);
+    archive(coupledRxn.probCoupled);
+}
+
+template <typename Archive> void transfer(Archive& archive, RxnBase& rxn)
+{
+    archive(rxn.isObserved);
+    archive(rxn.observeLabel);
+    archive(rxn.loopCoopFactor);
+    archive(rxn.bindRadSameCom);
+    archive(rxn.isSymmetric);
+    archive(rxn.isOnMem);
+    archive(rxn.hasStateChange);
+    archive(rxn.rxnType);
+    archive(rxn.absRxnIndex);
+    archive(rxn.relRxnIndex);
+    archive(rxn.isCoupled);
+    archive(rxn.length3Dto2D);
+    archive(rxn.rxnLabel);
+    archive(rxn.coupledRxnLabel);
+    archive(rxn.coupledRxn);
+    archive(rxn.excludeVolumeBound);
+    archive(rxn.intProductList);
+    archive(rxn.intReactantList);
+    archive(rxn.productListNew);
+    archive(rxn.reactantListNew);
+    archive(rxn.rateList);
+    archive(rxn.stateChangeIface);
+}
+
+template <typename Archive> void transfer(Archive& archive, ForwardRxn::Angles& angles)
+{
+    archive(angles.theta1);
+    archive(angles.theta2);
+    archive(angles.phi1);
+    archive(angles.phi2);
+    archive(angles.omega);
+}
+
+template <typename Archive> void transfer(Archive& archive, ForwardRxn& rxn)
+{
+    transfer(archive, static_cast<RxnBase&>(rxn));
+    archive(rxn.isReversible);
+    archive(rxn.conjBackRxnIndex);
+    archive(rxn.irrevRingClosure);
+    archive(rxn.productName);
+    archive(rxn.bindRadius);
+    archive(rxn.bindRadius2D);
+    archive(rxn.norm1);
+    archive(rxn.norm2);
+    archive(rxn.assocAngles);
+}
+
+template <typename Archive> void transfer(Archive& archive, BackRxn& rxn)
+{
+    transfer(archive, static_cast<RxnBase&>(rxn));
+    uint64_t conjForwardRxnIndex { rxn.conjForwardRxnIndex };
+    archive(conjForwardRxnIndex);
+    rxn.conjForwardRxnIndex = conjForwardRxnIndex;
+}
+
+template <typename Archive> void transfer(Archive& archive, CreateDestructRxn::CreateDestructMol& mol)
+{
+    archive(mol.molTypeIndex);
+    archive(mol.molName);
+    archive(mol.interfaceList);
+}
+
+template <typename Archive> void transfer(Archive& archive, CreateDestructRxn& rxn)
+{
+    transfer(archive, static_cast<RxnBase&>(rxn));
+    archive(rxn.reactantMolList);
+    archive(rxn.productMolList);
+    archive(rxn.conjBackRxnIndex);
+    archive(rxn.creationRadius);
+}
+
+/*! \brief What parse_input() builds from the molecules, reactions and observables blocks and the .mol files.
+ *
+ * The parameters and boundaries blocks are cheap to read, and are read from the input file every time.
+ */
+struct CompiledModel {
+    std::vector<std::pair<std::string, uint64_t>> molFileHashes {}; //!< name and hash of each .mol file that was read
+    std::map<std::string, int> observableList {};
+    std::vector<ForwardRxn> forwardRxns {};
+    std::vector<BackRxn> backRxns {};
+    std::vector<CreateDestructRxn> createDestructRxns {};
+    std::vector<MolTemplate> molTemplateList {};
+
+    // Parameters that parse_input() counts from the molecules and reactions
+    int numTotalComplex { 0 };
+    int numTotalUnits { 0 };
+    int numLipids { 0 };
+    int numMolTypes { 0 };
+    int numTotalSpecies { 0 };
+    bool isNonEQ { false };
+
+    // SimulContext members set while parsing
+    std::vector<int> absToRelIface {};
+    std::vector<int> numEachMolType {};
+    unsigned numMolTemplates { 0 };
+    int totalNumOfStates { 0 };
+    unsigned numberOfRxns { 0 };
+    int totRxnSpecies { 0 };
+};
+
+template <typename Archive> void transfer(Archive& archive, CompiledModel& model)
+{
+    archive(model.molFileHashes);
+    archive(model.observableList);
+    archive(model.forwardRxns);
+    archive(model.backRxns);
+    archive(model.createDestructRxns);
+    archive(model.molTemplateList);
+    archive(model.numTotalComplex);
+    archive(model.numTotalUnits);
+    archive(model.numLipids);
+    archive(model.numMolTypes);
+    archive(model.numTotalSpecies);
+    archive(model.isNonEQ);
+    archive(model.absToRelIface);
+    archive(model.numEachMolType);
+    archive(model.numMolTemplates);
+    archive(model.totalNumOfStates);
+    archive(model.numberOfRxns);
+    archive(model.totRxnSpecies);
+}
+
+namespace {
+std::string model_file_name(const std::string& modelCacheDir, uint64_t key)
+{
+    char keyText[17];
+    sprintf(keyText, "%016llx", static_cast<unsigned long long>(key));
+    return modelCacheDir + '/' + keyText + ".model";
+}
+
+bool mol_files_match(const CompiledModel& model)
+{
+    for (auto& molFileHash : model.molFileHashes) {
+        bool isRead { false };
+        std::string text { read_file(molFileHash.first, isRead) };
+        if (!isRead || fnv1a(text) != molFileHash.second)
+            return false;
+    }
+    return true;
+}
+
+bool read_model(const std::string& modelFileName, CompiledModel& model)
+{
+    std::ifstream modelFile { modelFileName, std::ios::binary };
+    char magic[sizeof(cacheMagic)];
+    int32_t version { 0 };
+    if (!modelFile.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), cacheMagic)
+        || !modelFile.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != cacheVersion)
+        return false;
+
+    CacheReader reader { modelFile };
+    reader(model);
+    return reader.is_good();
+}
+
+void write_model(const std::string& modelFileName, CompiledModel& model, std::ostream& log)
+{
+    // runs of a sweep may write the same model at once, so each writes its own file and renames it
+    std::random_device randomDevice;
+    std::string partFileName { modelFileName + '.' + std::to_string(randomDevice()) + ".part" };
+    {
+        std::ofstream modelFile { partFileName, std::ios::binary };
+        modelFile.write(cacheMagic, sizeof(cacheMagic));
+        modelFile.write(reinterpret_cast<const char*>(&cacheVersion), sizeof(cacheVersion));
+        CacheWriter writer { modelFile };
+        writer(model);
+        if (!writer.is_good()) {
+            log << "WARNING: Cannot write the compiled model " << modelFileName << ", continuing without it.\n";
+            modelFile.close();
+            std::remove(partFileName.c_str());
+            return;
+        }
+    }
+    if (std::rename(partFileName.c_str(), modelFileName.c_str()) != 0) {
+        log << "WARNING: Cannot write the compiled model " << modelFileName << ", continuing without it.\n";
+        std::remove(partFileName.c_str());
+    }
+}
+}
+
+void parse_input_cached(const std::string& modelCacheDir, std::string& fileName, Parameters& params,
+    std::map<std::string, int>& observableList, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
+    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject, SimulContext& context)
+{
+    std::string modelFileName { model_file_name(modelCacheDir, hash_model_input(fileName)) };
+
+    CompiledModel model {};
+    if (read_model(modelFileName, model) && mol_files_match(model)) {
+        context.log << "Using the compiled model " << modelFileName << '\n';
+        parse_input(fileName, params, observableList, forwardRxns, backRxns, createDestructRxns, molTemplateList,
+            membraneObject, context, true);
+
+        observableList = std::move(model.observableList);
+        forwardRxns = std::move(model.forwardRxns);
+        backRxns = std::move(model.backRxns);
+        createDestructRxns = std::move(model.createDestructRxns);
+        molTemplateList = std::move(model.molTemplateList);
+        params.numTotalComplex = model.numTotalComplex;
+        params.numTotalUnits = model.numTotalUnits;
+        params.numLipids = model.numLipids;
+        params.numMolTypes = model.numMolTypes;
+        params.numTotalSpecies = model.numTotalSpecies;
+        params.isNonEQ = model.isNonEQ;
+        context.absToRelIface = model.absToRelIface;
+        context.numEachMolType = model.numEachMolType;
+        context.numMolTypes = model.numMolTemplates;
+        context.totalNumOfStates = model.totalNumOfStates;
+        context.numberOfRxns = model.numberOfRxns;
+        context.totRxnSpecies = model.totRxnSpecies;
+        context.log << "Input file parsing complete\n";
+        return;
+    }
+
+    parse_input(fileName, params, observableList, forwardRxns, backRxns, createDestructRxns, molTemplateList, membraneObject, context);
+
+    model = CompiledModel {};
+    for (auto& oneTemp : molTemplateList) {
+        bool isRead { false };
+        std::string molFileName { oneTemp.molName + ".mol" };
+        std::string text { read_file(molFileName, isRead) };
+        model.molFileHashes.emplace_back(molFileName, fnv1a(text));
+    }
+    model.observableList = observableList;
+    model.forwardRxns = forwardRxns;
+    model.backRxns = backRxns;
+    model.createDestructRxns = createDestructRxns;
+    model.molTemplateList = molTemplateList;
+    model.numTotalComplex = params.numTotalComplex;
+    model.numTotalUnits = params.numTotalUnits;
+    model.numLipids = params.numLipids;
+    model.numMolTypes = params.numMolTypes;
+    model.numTotalSpecies = params.numTotalSpecies;
+    model.isNonEQ = params.isNonEQ;
+    model.absToRelIface = context.absToRelIface;
+    model.numEachMolType = context.numEachMolType;
+    model.numMolTemplates = context.numMolTypes;
+    model.totalNumOfStates = context.totalNumOfStates;
+    model.numberOfRxns = context.numberOfRxns;
+    model.totRxnSpecies = context.totRxnSpecies;
+    write_model(modelFileName, model, context.log);
+    context.log << "Wrote the compiled model " << modelFileName << '\n';
+}
@@ -10,7 +10,7 @@ std::map<const std::string, BoundaryKeyword> bcKeywords = {
     { "zbctype", BoundaryKeyword::zBCtype }, { "issphere", BoundaryKeyword::isSphere }, { "spherer", BoundaryKeyword::sphereR }
 };
 
-void Membrane::set_value_BC(std::string value, BoundaryKeyword keywords)
+void Membrane::set_value_BC(std::string value, BoundaryKeyword keywords, std::ostream& log)
 {
     try {
         auto key = static_cast<std::underlying_type<BoundaryKeyword>::type>(keywords);
@@ -21,51 +21,65 @@ void Membrane::set_value_BC(std::string value, BoundaryKeyword keywords)
         case 1:
             this->waterBox = WaterBox(parse_input_array(value));
             this->isBox = true;
-            std::cout << "Read in waterBox: "
+            log << "Read in waterBox: "
                       << "[" << waterBox.x << " nm, " << waterBox.y << " nm, " << waterBox.z << " nm]" << std::endl;
             break;
         case 2:
-            this->xBCtype = value;
-            std::cout << "Read in xBCtype: "
+            this->set_BCtype(0, value);
+            log << "Read in xBCtype: "
                       << value << std::endl;
             break;
         case 3:
-            this->yBCtype = value;
-            std::cout << "Read in yBCtype: "
+            this->set_BCtype(1, value);
+            log << "Read in yBCtype: "
                       << value << std::endl;
             break;
         case 4:
-            this->zBCtype = value;
-            std::cout << "Read in zBCtype: "
+            this->set_BCtype(2, value);
+            log << "Read in zBCtype: "
                       << value << std::endl;
             break;
         case 5:
             this->isSphere = read_boolean(value);
-            std::cout << "Read in isSphere: " << std::boolalpha << this->isSphere << std::endl;
+            log << "Read in isSphere: " << std::boolalpha << this->isSphere << std::endl;
             break;
         case 6:
             this->sphereR = std::stod(value);
-            std::cout << "Read in sphereR: " << this->sphereR << " nm" << std::endl;
+            log << "Read in sphereR: " << this->sphereR << " nm" << std::endl;
             this->isSphere = true;
             break;
         default:
             throw std::invalid_argument("Not a valid keyword.");
         }
     } catch (std::invalid_argument& e) {
-        std::cout << e.what() << '\n';
+        std::cerr << e.what() << '\n';
         exit(1);
     }
 }
 
-void Membrane::display()
+void Membrane::set_BCtype(int axis, const std::string& value)
 {
-    std::cout << " isSphere? " << std::boolalpha << isSphere << std::endl;
-    std::cout << " sphere Radius " << sphereR << std::endl;
+    bool isPbc { value == "pbc" || value == "periodic" };
+    if (!isPbc && !value.empty() && value != "reflect") {
+        std::cerr << "ERROR: boundary type " << value << " is not known, use reflect or pbc. Exiting..." << std::endl;
+        exit(1);
+    }
+    (axis == 0 ? xBCtype : (axis == 1 ? yBCtype : zBCtype)) = value;
+    isPeriodic[axis] = isPbc;
+    hasPeriodic = isPeriodic[0] || isPeriodic[1] || isPeriodic[2];
+}
+
+void Membrane::display(std::ostream& os)
+{
+    os << " isSphere? " << std::boolalpha << isSphere << std::endl;
+    os << " sphere Radius " << sphereR << std::endl;
     if (isBox == true) {
-        std::cout << " BOX geometry, dimensions: " << std::endl;
-        std::cout << waterBox.x << ' ' << waterBox.y << ' ' << waterBox.z << std::endl;
+        os << " BOX geometry, dimensions: " << std::endl;
+        os << waterBox.x << ' ' << waterBox.y << ' ' << waterBox.z << std::endl;
     }
-    std::cout << " hasImplicitLipid? " << std::boolalpha << implicitLipid << std::endl;
+    os << " hasImplicitLipid? " << std::boolalpha << implicitLipid << std::endl;
+    if (hasPeriodic)
+        os << " boundaries x, y, z: " << xBCtype << ' ' << yBCtype << ' ' << zBCtype << std::endl;
 }
 
 void Membrane::create_water_box()
@@ -85,9 +99,32 @@ std::string create_tmp_line(const std::string& line)
     return tmpLine;
 }
 
+namespace {
+void align_restart_write(Parameters& params)
+{
+    // Make sure the writing of restart file and timestep information is in unison
+    if (params.restartWrite % params.timeWrite != 0) {
+        int tmp = int(params.restartWrite / params.timeWrite);
+        if (tmp == 0)
+            tmp = 1;
+        params.restartWrite = tmp * params.timeWrite;
+    }
+}
+
+void skip_block(std::ifstream& inputFile, const std::string& endLine)
+{
+    std::string line;
+    while (getline(inputFile, line)) {
+        if (create_tmp_line(line) == endLine)
+            break;
+    }
+}
+}
+
 void parse_input(std::string& fileName, Parameters& params, std::map<std::string, int>& observableList,
     std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject)
+    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject,
+    SimulContext& context, bool onlySettings)
 {
     bool hasParsedMol = false;
     std::ifstream inputFile { fileName };
@@ -108,11 +145,11 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
             continue;
         } else if (tmpLine == "startparameters") {
             // read in parameters
-            std::cout << "Parsing simulation parameters..." << '\n';
-            params.parse_paramFile(inputFile);
+            context.log << "Parsing simulation parameters..." << '\n';
+            params.parse_paramFile(inputFile, context.log);
         } else if (tmpLine == "startboundaries") {
             // read in boundaries
-            std::cout << "Parsing simulation boundary conditions..." << '\n';
+            context.log << "Parsing simulation boundary conditions..." << '\n';
             while (getline(inputFile, line)) {
                 tmpLine = create_tmp_line(line);
                 if (skipLine(tmpLine))
@@ -140,21 +177,26 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
                             // find the value type from the keyword and then set that parameter
                             if (keyFind != bcKeywords.end()) {
                                 // std::cout << "Keyword found: " << keyFind->first << '\n';
-                                membraneObject.set_value_BC(line, keyFind->second);
+                                membraneObject.set_value_BC(line, keyFind->second, context.log);
                                 gotValue = true;
                                 break;
                             } else {
-                                std::cout << "Warning, ignoring unknown keyword " << buffer << '\n';
+                                context.log << "Warning, ignoring unknown keyword " << buffer << '\n';
                                 break;
                             }
                         }
                     }
                 }
             }
+        } else if (onlySettings && tmpLine == "startmolecules") {
+            skip_block(inputFile, "endmolecules");
+            align_restart_write(params);
+        } else if (onlySettings && (tmpLine == "startreactions" || tmpLine == "startobservables")) {
+            skip_block(inputFile, tmpLine == "startreactions" ? "endreactions" : "endobservables");
         } else if (tmpLine == "startmolecules") {
             hasParsedMol = true;
             // get the molecule names and copy numbers from the parameter input file
-            std::cout << "Parsing mol file information..." << '\n';
+            context.log << "Parsing mol file information..." << '\n';
             std::vector<std::string> providedMols {};
             std::vector<std::string> providedMols_temp {};
             std::vector<MolTemplate> molTemplateList_temp {};
@@ -187,7 +229,7 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
                         }
                     }
                     if (gotValue == false) {
-                        std::cout << "Please provide the copy number of each molecule in INP file in this format-- molName:100" << std::endl;
+                        context.log << "Please provide the copy number of each molecule in INP file in this format-- molName:100" << std::endl;
                         exit(0);
                     }
                 }
@@ -195,11 +237,11 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
 
             // parse the .mol files for each molecule
             for (int providedMolIndex = 0; providedMolIndex < providedMols.size(); providedMolIndex++) {
-                molTemplateList.emplace_back(parse_molFile(providedMols[providedMolIndex])); // do the actual parsing
+                molTemplateList.emplace_back(parse_molFile(providedMols[providedMolIndex], context)); // do the actual parsing
                 molTemplateList.back().molTypeIndex = &providedMols[providedMolIndex] - &providedMols[0];
                 molTemplateList.back().copies = providedNums[providedMolIndex];
                 molTemplateList.back().startingNumState = providedNumState[providedMolIndex];
-                ++MolTemplate::numMolTypes;
+                ++context.numMolTypes;
                 if (molTemplateList.back().isImplicitLipid == false) {
                     params.numTotalComplex += molTemplateList.back().copies;
                     params.numTotalUnits
@@ -210,21 +252,15 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
                 }
             }
 
-            MolTemplate::numEachMolType = std::vector<int>(MolTemplate::numMolTypes);
-            params.numMolTypes = MolTemplate::numMolTypes;
+            context.numEachMolType = std::vector<int>(context.numMolTypes);
+            params.numMolTypes = context.numMolTypes;
 
             // Give a buffer for the trajectory file (since VMD can't understand trajectories with frames that have
             // different numbers of atoms)
             // TODO: Think about the size of buffer
             //            params.numTotalUnits += params.numTotalUnits / 100;
 
-            // Make sure the writing of restart file and timestep information is in unison
-            if (params.restartWrite % params.timeWrite != 0) {
-                int tmp = int(params.restartWrite / params.timeWrite);
-                if (tmp == 0)
-                    tmp = 1;
-                params.restartWrite = tmp * params.timeWrite;
-            }
+            align_restart_write(params);
 
             // set the isPoint and isRod for molecule
             determine_shape_molecule(molTemplateList);
@@ -238,7 +274,7 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
             int numProvidedRxns { 0 };
 
             auto linePos = inputFile.tellg();
-            std::cout << "Parsing reactions...\n";
+            context.log << "Parsing reactions...\n";
             while (getline(inputFile, line)) {
                 tmpLine = create_tmp_line(line);
                 // if the line is an ignored line, ignore it. if it's an end of block line, break
@@ -251,17 +287,17 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
                     // if it's neither, parse the line
                     inputFile.seekg(linePos);
                     parse_reaction(inputFile, totSpecies, numProvidedRxns, molTemplateList, forwardRxns, backRxns,
-                        createDestructRxns, observableList, membraneObject);
+                        createDestructRxns, observableList, membraneObject, context.numberOfRxns, context.log);
                 }
                 linePos = inputFile.tellg();
             }
 
-            RxnBase::totRxnSpecies = totSpecies + 1; // had to increment this by 1, it was not correct!
+            context.totRxnSpecies = totSpecies + 1; // had to increment this by 1, it was not correct!
 
         } else if (tmpLine == "startobservables") {
             // TODO: make this use parse_molecule_bngl() and create a vector of ParsedMol
             // Need to change the function to allow for molecules with no explicit interfaces
-            std::cout << "Gathering observables...\n";
+            context.log << "Gathering observables...\n";
             while (getline(inputFile, line)) {
                 tmpLine = create_tmp_line(line);
                 tmpLine.erase(
@@ -281,6 +317,12 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
         }
     }
 
+    // the molecules, reactions and observables come from a compiled model, see parse_input_cached in
+    // src/parser/model_cache.cpp. The model is keyed by a hash of the input file without its parameters block, and is
+    // only used if the hashes of the .mol files it stores still match.
+    if (onlySettings)
+        return;
+
     // TODO: TEMPORARY COUPLED RXN
     for (unsigned rxnItr { 0 }; rxnItr < forwardRxns.size(); ++rxnItr) {
         if (forwardRxns[rxnItr].isCoupled) {
@@ -354,13 +396,13 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
         }
     }
 
-    params.numTotalSpecies = RxnBase::totRxnSpecies; // total number of all species possible in the system (includes
+    params.numTotalSpecies = context.totRxnSpecies; // total number of all species possible in the system (includes
         // reactant and product states).
 
     // TODO TEMPORARY
     params.isNonEQ = createDestructRxns.size() > 0;
 
-    std::cout << '\n'
+    context.log << '\n'
               << "Input file parsing complete\n";
     // std::cout << "Simulation Parameters\n";
     // params.display();
@@ -372,7 +414,7 @@ void parse_input(std::string& fileName, Parameters& params, std::map<std::string
 
 void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std::string, int>& observableList,
     std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject, int numDoubleBeforeAdd)
+    std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, Membrane& membraneObject, int numDoubleBeforeAdd, SimulContext& context)
 {
     bool hasParsedMol = false;
     int addForwardRxnNum { static_cast<int>(forwardRxns.size()) }; //this is the origin number of forwardRxns for add case
@@ -398,12 +440,12 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
             continue;
         } else if (tmpLine == "startparameters") {
             // read in parameters
-            std::cout << "Parsing simulation parameters..." << '\n';
-            params.parse_paramFile(inputFile);
+            context.log << "Parsing simulation parameters..." << '\n';
+            params.parse_paramFile(inputFile, context.log);
         } else if (tmpLine == "startboundaries") {
             // read in boundaries
-            std::cout << "Parsing simulation boundary conditions..." << '\n';
-            //params.parse_paramFile(inputFile);
+            context.log << "Parsing simulation boundary conditions..." << '\n';
+            //params.parse_paramFile(inputFile, context.log);
             while (getline(inputFile, line)) {
                 tmpLine = create_tmp_line(line);
                 if (skipLine(tmpLine))
@@ -432,11 +474,11 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
                             if (keyFind != bcKeywords.end()) {
                                 // std::cout << "Keyword found: " << keyFind->first << '\n';
                                 //this->set_value(line, keyFind->second);
-                                membraneObject.set_value_BC(line, keyFind->second);
+                                membraneObject.set_value_BC(line, keyFind->second, context.log);
                                 gotValue = true;
                                 break;
                             } else {
-                                std::cout << "Warning, ignoring unknown keyword " << buffer << '\n';
+                                context.log << "Warning, ignoring unknown keyword " << buffer << '\n';
                                 break;
                             }
                         }
@@ -445,7 +487,7 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
             }
         } else if (tmpLine == "startmolecules") {
             // get the molecule names from the parameter input file
-            std::cout << "Parsing mol file information..." << '\n';
+            context.log << "Parsing mol file information..." << '\n';
             std::vector<std::string> providedMols {};
             std::vector<std::string> providedMols_temp {};
             std::vector<MolTemplate> molTemplateList_temp {};
@@ -478,7 +520,7 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
                         }
                     }
                     if (gotValue == false) {
-                        std::cout << "Please provide the copy number of each molecule in INP file in this format-- molName:100" << std::endl;
+                        context.log << "Please provide the copy number of each molecule in INP file in this format-- molName:100" << std::endl;
                         exit(0);
                     }
                 }
@@ -486,11 +528,11 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
 
             // parse the .mol files for each molecule
             for (int providedMolIndex = 0; providedMolIndex < providedMols.size(); providedMolIndex++) {
-                molTemplateList.emplace_back(parse_molFile(providedMols[providedMolIndex])); // do the actual parsing
+                molTemplateList.emplace_back(parse_molFile(providedMols[providedMolIndex], context)); // do the actual parsing
                 molTemplateList.back().molTypeIndex = &providedMols[providedMolIndex] - &providedMols[0] + addMolTemplateListNum;
                 molTemplateList.back().copies = providedNums[providedMolIndex];
                 molTemplateList.back().startingNumState = providedNumState[providedMolIndex];
-                ++MolTemplate::numMolTypes;
+                ++context.numMolTypes;
                 if (molTemplateList.back().isImplicitLipid == false) {
                     params.numTotalComplex += molTemplateList.back().copies;
                     params.numTotalUnits
@@ -499,10 +541,10 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
                         params.numLipids += molTemplateList.back().copies;
                 } else {
                 }
-                MolTemplate::numEachMolType.emplace_back(0);
+                context.numEachMolType.emplace_back(0);
             }
 
-            params.numMolTypes = MolTemplate::numMolTypes;
+            params.numMolTypes = context.numMolTypes;
 
             // Give a buffer for the trajectory file (since VMD can't understand trajectories with frames that have
             // different numbers of atoms)
@@ -524,7 +566,7 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
             int numProvidedRxns { 0 };
 
             auto linePos = inputFile.tellg();
-            std::cout << "Parsing reactions...\n";
+            context.log << "Parsing reactions...\n";
             while (getline(inputFile, line)) {
                 tmpLine = create_tmp_line(line);
                 // if the line is an ignored line, ignore it. if it's an end of block line, break
@@ -538,17 +580,17 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
                     inputFile.seekg(linePos);
 
                     parse_reaction(inputFile, totSpecies, numProvidedRxns, molTemplateList, forwardRxns, backRxns,
-                        createDestructRxns, observableList, membraneObject);
+                        createDestructRxns, observableList, membraneObject, context.numberOfRxns, context.log);
                 }
                 linePos = inputFile.tellg();
             }
 
-            RxnBase::totRxnSpecies = totSpecies + 1; // had to increment this by 1, it was not correct!
+            context.totRxnSpecies = totSpecies + 1; // had to increment this by 1, it was not correct!
 
         } else if (tmpLine == "startobservables") {
             // TODO: make this use parse_molecule_bngl() and create a vector of ParsedMol
             // Need to change the function to allow for molecules with no explicit interfaces
-            std::cout << "Gathering observables...\n";
+            context.log << "Gathering observables...\n";
             while (getline(inputFile, line)) {
                 tmpLine = create_tmp_line(line);
                 tmpLine.erase(
@@ -626,7 +668,7 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
     }
 
     //here wew need to add three new inputs for pop_react_lists
-    populate_reaction_lists_for_add(forwardRxns, backRxns, createDestructRxns, molTemplateList, addForwardRxnNum, addBackRxnNum, addCreateDestructRxnNum);
+    populate_reaction_lists_for_add(forwardRxns, backRxns, createDestructRxns, molTemplateList, addForwardRxnNum, addBackRxnNum, addCreateDestructRxnNum, context.log);
 
     for (auto& oneTemp : molTemplateList) {
         // here's where we remove duplicate reaction partners
@@ -643,13 +685,13 @@ void parse_input_for_add(std::string& fileName, Parameters& params, std::map<std
         }
     }
 
-    params.numTotalSpecies = RxnBase::totRxnSpecies; // total number of all species possible in the system (includes
+    params.numTotalSpecies = context.totRxnSpecies; // total number of all species possible in the system (includes
         // reactant and product states).
 
     // TODO TEMPORARY
     params.isNonEQ = createDestructRxns.size() > 0;
 
-    std::cout << '\n'
+    context.log << '\n'
               << "Add input file parsing complete\n";
     // std::cout << "Simulation Parameters\n";
     // params.display();
@@ -35,7 +35,7 @@ std::vector<double> parse_input_array(std::string& line)
             else
                 throw "Error, cannot read angles value " + value;
         } catch (const std::string& msg) {
-            std::cout << msg << '\n';
+            std::cerr << msg << '\n';
             exit(1);
         }
     }
@@ -1,6 +1,6 @@
 #include "parser/parser_functions.hpp"
 
-MolTemplate parse_molFile(std::string& mol)
+MolTemplate parse_molFile(std::string& mol, SimulContext& context)
 {
     /* NOTE: need to edit both this and enum class MolKeyword if you want to add keywords  */
     std::map<const std::string, MolKeyword> molKeywords = { { "name", MolKeyword::name },
@@ -9,10 +9,10 @@ MolTemplate parse_molFile(std::string& mol)
         { "mass", MolKeyword::mass }, { "checkoverlap", MolKeyword::checkOverlap }, { "bonds", MolKeyword::bonds }, { "isimplicitlipid", MolKeyword::isImplicitLipid },
         { "ispoint", MolKeyword::isPoint } };
 
-    std::cout << mol + ".mol" << '\n';
+    context.log << mol + ".mol" << '\n';
     std::ifstream molFile { mol + ".mol" };
     if (!molFile) {
-        std::cout << "Cannot open molecule config file for molecule " << mol << '\n';
+        context.log << "Cannot open molecule config file for molecule " << mol << '\n';
         exit(1);
     }
 
@@ -36,8 +36,8 @@ MolTemplate parse_molFile(std::string& mol)
             // if the line starts with com, it's the beginning of the coordinates block
             if (std::isdigit(*lineItr) && molKeywords.find(buffer)->second == MolKeyword::com) {
                 molFile.seekg(initialPos);
-                std::cout << "Coordinates: " << std::endl;
-                read_internal_coordinates(molFile, tmpTemplate);
+                context.log << "Coordinates: " << std::endl;
+                read_internal_coordinates(molFile, tmpTemplate, context.log);
                 break;
             }
 
@@ -46,7 +46,7 @@ MolTemplate parse_molFile(std::string& mol)
             else if (*lineItr == '=') {
                 auto keyFind = molKeywords.find(buffer);
                 if (keyFind == molKeywords.end()) {
-                    std::cout << buffer + " is an invalid argument.";
+                    context.log << buffer + " is an invalid argument.";
                     exit(1);
                 }
 
@@ -54,17 +54,17 @@ MolTemplate parse_molFile(std::string& mol)
 
                 // find the value type from the keyword and then set that parameter
                 if (keyFind->second == MolKeyword::state) {
-                    std::cout << "States: " << std::endl;
-                    parse_states(line, tmpTemplate);
+                    context.log << "States: " << std::endl;
+                    parse_states(line, tmpTemplate, context.log);
                     break;
                 } else if (keyFind->second == MolKeyword::bonds) {
                     // std::cout << "Found bonds for molecule " << tmpTemplate.molName << ".\n";
-                    std::cout << "Bonds: " << std::endl;
+                    context.log << "Bonds: " << std::endl;
                     int numBonds = std::stoi(line);
-                    read_bonds(numBonds, molFile, tmpTemplate);
+                    read_bonds(numBonds, molFile, tmpTemplate, context.log);
                     break;
                 } else {
-                    tmpTemplate.set_value(line, keyFind->second);
+                    tmpTemplate.set_value(line, keyFind->second, context.log);
                     break;
                 }
             }
@@ -83,16 +83,16 @@ MolTemplate parse_molFile(std::string& mol)
         /*initialize values of the molecule templates interfaces, including if it can be in multiple states
          stored in molTemplate.interfaceList[].stateList[].index*/
         if (iface.stateList.empty()) {
-            MolTemplate::absToRelIface.push_back(ifaceItr);
-            iface.stateList.emplace_back(iface.name, Interface::State::totalNumOfStates);
-            ++Interface::State::totalNumOfStates;
+            context.absToRelIface.push_back(ifaceItr);
+            iface.stateList.emplace_back(iface.name, context.totalNumOfStates);
+            ++context.totalNumOfStates;
         } else {
             tmpTemplate.ifacesWithStates.push_back(&iface - &tmpTemplate.interfaceList[0]);
             for (auto& state : iface.stateList) {
-                MolTemplate::absToRelIface.push_back(ifaceItr);
-                state.index = Interface::State::totalNumOfStates;
+                context.absToRelIface.push_back(ifaceItr);
+                state.index = context.totalNumOfStates;
                 state.ifaceAndStateName = iface.name + "~" + state.iden;
-                ++Interface::State::totalNumOfStates;
+                ++context.totalNumOfStates;
             }
         }
         ++ifaceItr;
@@ -105,13 +105,13 @@ MolTemplate parse_molFile(std::string& mol)
         if (tmpVec.magnitude > tmpTemplate.radius)
             tmpTemplate.radius = tmpVec.magnitude;
     }
-    std::cout << "radius calculated from the ifacesCoord: " << tmpTemplate.radius << " nm" << std::endl;
+    context.log << "radius calculated from the ifacesCoord: " << tmpTemplate.radius << " nm" << std::endl;
     // set mass to radius
     if (tmpTemplate.mass < 0) {
         tmpTemplate.mass = tmpTemplate.radius;
-        std::cout << "mass auto calculated from the radius: " << tmpTemplate.mass << std::endl;
+        context.log << "mass auto calculated from the radius: " << tmpTemplate.mass << std::endl;
     }
 
-    std::cout << std::endl;
+    context.log << std::endl;
     return tmpTemplate;
 }
@@ -5,7 +5,8 @@
 
 void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvidedRxns,
     std::vector<MolTemplate>& molTemplateList, std::vector<ForwardRxn>& forwardRxns, std::vector<BackRxn>& backRxns,
-    std::vector<CreateDestructRxn>& createDestructRxns, std::map<std::string, int>& observablesList, Membrane& membraneObject)
+    std::vector<CreateDestructRxn>& createDestructRxns, std::map<std::string, int>& observablesList, Membrane& membraneObject,
+    unsigned& numberOfRxns, std::ostream& log)
 {
     /* NOTE: need to edit both this and enum class RxnKeyword if you want to add keywords  */
     std::map<const std::string, RxnKeyword> rxnKeywords = { { "onrate3dka", RxnKeyword::onRate3Dka }, { "onrate3dmacro", RxnKeyword::onRate3DMacro },
@@ -24,7 +25,7 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
     std::string reaction;
     getline(reactionFile, reaction);
     remove_comment(reaction);
-    std::cout << "Parsing new reaction with form:\n"
+    log << "Parsing new reaction with form:\n"
               << reaction << '\n';
 
     // temporary storage containers
@@ -39,13 +40,13 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
             std::remove_if(reaction.begin(), reaction.end(), [](unsigned char x) { return std::isspace(x); }),
             reaction.end());
         if (reaction.find("<->") != std::string::npos) {
-            std::cout << "Reversible reaction." << std::endl;
+            log << "Reversible reaction." << std::endl;
             size_t position = reaction.find("<->");
             reactantSide = reaction.substr(0, position);
             productSide = reaction.substr(position + 3, std::string::npos); // +1 is to remove the delimiter
             parsedRxn.isReversible = true;
         } else if (reaction.find("->") != std::string::npos) {
-            std::cout << "Irreversible reaction." << std::endl;
+            log << "Irreversible reaction." << std::endl;
             size_t position = reaction.find("->");
             reactantSide = reaction.substr(0, position);
             productSide = reaction.substr(position + 2, std::string::npos); // +2 is to remove delimiter
@@ -93,32 +94,32 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
         bool rside { tmpRSide == "0" || tmpRSide == "null" };
         if (!lside && !rside) {
             parsedRxn.rxnType = ReactionType::uniMolStateChange;
-            std::cout << "UniMolStateChange reaction detected\n";
+            log << "UniMolStateChange reaction detected\n";
         } else if (lside && !rside) {
             // Creation reaction
             parsedRxn.rxnType = ReactionType::zerothOrderCreation;
-            std::cout << "ZerothOrderCreation reaction detected\n";
+            log << "ZerothOrderCreation reaction detected\n";
         } else if (rside && !lside) {
             // Destruction reaction
             parsedRxn.rxnType = ReactionType::destruction;
-            std::cout << "Destruction reaction detected\n";
+            log << "Destruction reaction detected\n";
         } else {
             std::cerr << "FATAL ERROR: Ccannot determine reaction type. Please check before moving on.\n";
             exit(1);
         }
     } else if ((reactantSpecies.size()) == 1 && (productSpecies.size() == 2)) {
         parsedRxn.rxnType = ReactionType::uniMolCreation;
-        std::cout << "UniMolCreation reaction detected.\n";
+        log << "UniMolCreation reaction detected.\n";
     } else {
         parsedRxn.rxnType = ReactionType::bimolecular;
-        std::cout << "Bimolecular reaction detected.\n";
+        log << "Bimolecular reaction detected.\n";
     }
 
     // the following two large blocks of text parsing can't be split off into one subroutine, because of the use of
     // the local structs ParsedMol and ParsedRxn
     if (parsedRxn.rxnType != ReactionType::zerothOrderCreation) {
         // TODO: need to pass some integer to tell ParsedMol which species the molecule is in (via speciesIndex)
-        std::cout << "Parsing reactants...\n";
+        log << "Parsing reactants...\n";
         std::vector<std::pair<std::string, int>> reactantMols;
         for (auto& specie : reactantSpecies) {
             size_t position { 0 };
@@ -141,7 +142,7 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
     }
 
     if (parsedRxn.rxnType != ReactionType::destruction) {
-        std::cout << "Parsing products...\n";
+        log << "Parsing products...\n";
         std::vector<std::pair<std::string, int>> productMols;
         int speciesIndex { 0 };
         for (auto& specie : productSpecies) {
@@ -191,7 +192,7 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
             // if the next line contains a reaction, seek back to where you started in the file and stop looking for
             // parameter keywords
             reactionFile.seekg(initialPos);
-            std::cout << "Finished reading reaction parameters, constructing reaction.\n";
+            log << "Finished reading reaction parameters, constructing reaction.\n";
             break;
         }
 
@@ -207,7 +208,7 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
                 }
 
                 line.erase(line.begin(), lineItr + 1); // hard coded for character length '='
-                parsedRxn.set_value(line, keyFind->second);
+                parsedRxn.set_value(line, keyFind->second, log);
                 break;
             }
         }
@@ -220,7 +221,7 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
     for (auto& reactant : parsedRxn.reactantList) {
         determine_iface_indices(
             &reactant - &parsedRxn.reactantList[0], totSpecies, reactant, parsedRxn, forwardRxns, molTemplateList);
-        check_for_valid_states(&reactant - &parsedRxn.reactantList[0], reactant, parsedRxn, molTemplateList);
+        check_for_valid_states(&reactant - &parsedRxn.reactantList[0], reactant, parsedRxn, molTemplateList, log);
     }
 
     for (auto& product : parsedRxn.productList)
@@ -229,13 +230,13 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
 
     // determine the indices for the reactants and products of the real reaction here
     if (parsedRxn.rxnType == ReactionType::bimolecular) {
-        parsedRxn.determine_reactants();
+        parsedRxn.determine_reactants(log);
 
         if (parsedRxn.rxnProducts[0].speciesIndex != 0 && parsedRxn.rxnProducts[1].speciesIndex != 1) {
             std::swap(parsedRxn.rxnProducts[0], parsedRxn.rxnProducts[1]);
         }
     } else if (parsedRxn.rxnType == ReactionType::uniMolStateChange) {
-        parsedRxn.determine_reactants();
+        parsedRxn.determine_reactants(log);
     } else if (parsedRxn.rxnType == ReactionType::zerothOrderCreation) {
         parsedRxn.determine_creation_products(molTemplateList);
     } else if (parsedRxn.rxnType == ReactionType::uniMolCreation) {
@@ -364,7 +365,7 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
                         double b { 0.0 };
                         double sigma { parsedRxn.bindRadius };
                         b = 2.0 * pow(area / (M_PI * maxN) + parsedRxn.bindRadius * parsedRxn.bindRadius, 0.5);
-                        tempVariable = 4.0 * log(b / sigma) / pow(1.0 - pow(sigma / b, 2.0), 2.0) - 2.0 / (1.0 - pow(sigma / b, 2.0)) - 1.0;
+                        tempVariable = 4.0 * std::log(b / sigma) / pow(1.0 - pow(sigma / b, 2.0), 2.0) - 2.0 / (1.0 - pow(sigma / b, 2.0)) - 1.0;
                         parsedRxn.onRate3Dka = 2.0 * parsedRxn.bindRadius / (1.0 / (1.0 * parsedRxn.onRate3DMacro / 0.602214076) - 1.0 / (8.0 * M_PI * Dtot) * tempVariable);
                     }
                     if (std::isnan(parsedRxn.offRatekb) == true && parsedRxn.isReversible == true) {
@@ -419,9 +420,9 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
                 parsedRxn.offRatekb = 0; //set this to zero, so dissociation occurs with rate kcat, and coupled Rxn always occurs.
             parsedRxn.coupledRxn.probCoupled = kcat / (kcat + parsedRxn.offRatekb);
             parsedRxn.offRatekb += kcat; // the rate that the bound complex undergoes reaction is due to both catalysis and unbinding. Will then choose which one to perform based on probCoupled.
-            std::cout << "Allow Michaelis-Menten for this reaction. Probability of catalysis: kcat/(kcat+offRatekb): " << parsedRxn.coupledRxn.probCoupled << " total rate: " << parsedRxn.offRatekb << std::endl;
+            log << "Allow Michaelis-Menten for this reaction. Probability of catalysis: kcat/(kcat+offRatekb): " << parsedRxn.coupledRxn.probCoupled << " total rate: " << parsedRxn.offRatekb << std::endl;
         } else {
-            std::cout << " No kcat rate specified, will NOT perform coupled reaction! Must specify rate using kcat " << std::endl;
+            log << " No kcat rate specified, will NOT perform coupled reaction! Must specify rate using kcat " << std::endl;
         }
     }
     // Done parsing, set up the reaction(s) and place into their correct vectors
@@ -437,18 +438,18 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
                 std::cerr << status.second << " [" << reaction << "].\n";
                 exit(1);
             } else
-                std::cout << status.second << " [" << reaction << "].\n";
+                log << status.second << " [" << reaction << "].\n";
 
             oneRxn.create_other_iface_lists(molTemplateList);
             // check if this is a repeat reaction and create new RateState if so
-            if (!oneRxn.check_for_conditional_rates(totSpecies, forwardRxns, backRxns))
-                oneRxn.assemble_reactions(forwardRxns, backRxns, createDestructRxns, molTemplateList);
+            if (!oneRxn.check_for_conditional_rates(totSpecies, forwardRxns, backRxns, log))
+                oneRxn.assemble_reactions(forwardRxns, backRxns, createDestructRxns, molTemplateList, numberOfRxns);
         }
     } else {
         // if all states are explicit, create the lists of ancillary ifaces
         parsedRxn.create_other_iface_lists(molTemplateList);
         // check if this is a repeat reaction and create new RateState if so
-        if (!parsedRxn.check_for_conditional_rates(totSpecies, forwardRxns, backRxns)) {
+        if (!parsedRxn.check_for_conditional_rates(totSpecies, forwardRxns, backRxns, log)) {
             // otherwise, just make the one reaction (or two, if its reversible)
             // Make sure everything that we need to be defined was provided
             auto status = parsedRxn.isComplete(molTemplateList);
@@ -456,8 +457,8 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
                 std::cerr << "Error, " << status.second << " [" << reaction << "].\n";
                 exit(1);
             } else
-                std::cout << status.second << " [" << reaction << "].\n";
-            parsedRxn.assemble_reactions(forwardRxns, backRxns, createDestructRxns, molTemplateList);
+                log << status.second << " [" << reaction << "].\n";
+            parsedRxn.assemble_reactions(forwardRxns, backRxns, createDestructRxns, molTemplateList, numberOfRxns);
         }
     }
 
@@ -469,5 +470,5 @@ void parse_reaction(std::ifstream& reactionFile, int& totSpecies, int& numProvid
         reactTemp1.rxnPartners.push_back(reactTemp2.molTypeIndex);
         reactTemp2.rxnPartners.push_back(reactTemp1.molTypeIndex);
     }
-    std::cout << std::endl;
+    log << std::endl;
 }
@@ -1,6 +1,6 @@
 #include "parser/parser_functions.hpp"
 
-void parse_states(std::string& line, MolTemplate& molTemplate)
+void parse_states(std::string& line, MolTemplate& molTemplate, std::ostream& log)
 {
     auto statePos = line.find('~');
 
@@ -21,16 +21,16 @@ void parse_states(std::string& line, MolTemplate& molTemplate)
         [&](const Interface& oneIface) -> bool { return oneIface.name == ifaceName; });
 
     if (ifaceNameItr == molTemplate.interfaceList.end()) {
-        std::cout << ifaceName << " is not a valid interface for molecule " << molTemplate.molName << ".\n";
+        std::cerr << ifaceName << " is not a valid interface for molecule " << molTemplate.molName << ".\n";
         exit(1);
     } else {
         // TODO: replace the placeholder integer
         for (auto& oneState : states)
             ifaceNameItr->stateList.emplace_back(static_cast<char>(std::toupper(oneState[0])), -1);
 
-        std::cout << ifaceName << " has " << states.size() << " state(s): ";
+        log << ifaceName << " has " << states.size() << " state(s): ";
         for (auto oneState : states)
-            std::cout << oneState << "\t";
-        std::cout << std::endl;
+            log << oneState << "\t";
+        log << std::endl;
     }
 }
@@ -115,7 +115,7 @@ void populate_reaction_lists(const std::vector<ForwardRxn>& forwardRxns, const s
 }
 
 void populate_reaction_lists_for_add(const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
-    const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, int addForwardRxnNum, int addBackRxnNum, int addCreateDestructRxnNum)
+    const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList, int addForwardRxnNum, int addBackRxnNum, int addCreateDestructRxnNum, std::ostream& log)
 {
     for (int forwardRxnsIndex { addForwardRxnNum }; forwardRxnsIndex < forwardRxns.size(); forwardRxnsIndex++) {
         ForwardRxn forwardRxn {};
@@ -129,7 +129,7 @@ void populate_reaction_lists_for_add(const std::vector<ForwardRxn>& forwardRxns,
             unsigned stateIndex1 { 0 };
 
             for (unsigned index { 0 }; index < reactIface1.stateList[0].myForwardRxns.size(); index++) {
-                std::cout << forwardRxns[reactIface1.stateList[0].myForwardRxns[index]].rateList[0].rate << "\t";
+                log << forwardRxns[reactIface1.stateList[0].myForwardRxns[index]].rateList[0].rate << "\t";
             }
 
             if (reactIface1.stateList.size() > 1) {
@@ -1,6 +1,6 @@
 #include "parser/parser_functions.hpp"
 
-void read_bonds(int numBonds, std::ifstream& molFile, MolTemplate& molTemplate)
+void read_bonds(int numBonds, std::ifstream& molFile, MolTemplate& molTemplate, std::ostream& log)
 {
     for (unsigned bondItr { 0 }; bondItr < numBonds; ++bondItr) {
         std::string atom1 {};
@@ -28,14 +28,14 @@ void read_bonds(int numBonds, std::ifstream& molFile, MolTemplate& molTemplate)
         }
 
         if (tmpBond[0] == -1 || tmpBond[1] == -1) {
-            std::cout << "Invalid atom in " << molTemplate.molName << " mol file. Ignoring bonds...\n";
+            log << "Invalid atom in " << molTemplate.molName << " mol file. Ignoring bonds...\n";
             molTemplate.bondList.clear();
             return;
         } else {
             std::sort(tmpBond.begin(), tmpBond.end());
             molTemplate.bondList.emplace_back(tmpBond);
-            std::cout << atom1 << "-" << atom2 << ", ";
+            log << atom1 << "-" << atom2 << ", ";
         }
     }
-    std::cout << std::endl;
+    log << std::endl;
 }
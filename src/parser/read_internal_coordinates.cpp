@@ -1,6 +1,6 @@
 #include "parser/parser_functions.hpp"
 
-void read_internal_coordinates(std::ifstream& molFile, MolTemplate& molTemplate)
+void read_internal_coordinates(std::ifstream& molFile, MolTemplate& molTemplate, std::ostream& log)
 {
     std::string iface;
     double x { 0 };
@@ -16,7 +16,7 @@ void read_internal_coordinates(std::ifstream& molFile, MolTemplate& molTemplate)
         else {
             molTemplate.interfaceList.emplace_back(iface, Coord { x, y, z });
         }
-        std::cout << iface << ": [" << x << "nm, " << y << "nm, " << z << "nm]" << std::endl;
+        log << iface << ": [" << x << "nm, " << y << "nm, " << z << "nm]" << std::endl;
         molFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // ignore the comment
 
         initialPos = molFile.tellg();
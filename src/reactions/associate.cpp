@@ -14,15 +14,15 @@ void associate(
     std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList,
     copyCounters& counterArrays, std::vector<Complex>& complexList,
     Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns)
+    const std::vector<BackRxn>& backRxns, SimulContext& context)
 {
     if (membraneObject.isSphere == true) {
         associate_sphere(ifaceIndex1, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, params,
             currRxn, moleculeList, molTemplateList, observablesList,
-            counterArrays, complexList, membraneObject, forwardRxns, backRxns);
+            counterArrays, complexList, membraneObject, forwardRxns, backRxns, context);
     } else {
         associate_box(ifaceIndex1, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, params,
             currRxn, moleculeList, molTemplateList, observablesList,
-            counterArrays, complexList, membraneObject, forwardRxns, backRxns);
+            counterArrays, complexList, membraneObject, forwardRxns, backRxns, context);
     }
 }
\ No newline at end of file
@@ -11,7 +11,7 @@
 void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
     Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
     std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns)
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context)
 {
     double RS3D { -1.0 };
     for (int RS3Di = 0; RS3Di < 100; RS3Di++) {
@@ -61,12 +61,10 @@ void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& rea
         Coord& reactIface2 = reactMol2.tmpICoords[ifaceIndex2];
         Vector sigma { reactIface1 - reactIface2 };
         // orientation corrections for membrane bound components
-        Molecule memProtein = reactMol2;
         int slowPro = reactMol2.index;
 
         if (reactCom1.D.x < reactCom2.D.x) {
-            slowPro = reactMol1.index;
-            memProtein = reactMol1; // rotate relative to the slower protein. Clat + IL, IL is slower; Clat-IL + IL, Clat-IL is slower
+            slowPro = reactMol1.index; // rotate relative to the slower protein. Clat + IL, IL is slower; Clat-IL + IL, Clat-IL is slower
         }
 
         double tol = 1E-14;
@@ -159,11 +157,11 @@ void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& rea
                 Quat memRot;
                 Coord pivot;
                 if (slowPro == reactMol1.index) {
-                    memRot = save_mem_orientation(memProtein, reactMol1, molTemplateList[reactMol1.molTypeIndex]);
+                    memRot = save_mem_orientation(reactMol1, reactMol1, molTemplateList[reactMol1.molTypeIndex]);
                     pivot = reactMol1.tmpComCoord;
 
                 } else {
-                    memRot = save_mem_orientation(memProtein, reactMol2, molTemplateList[reactMol2.molTypeIndex]);
+                    memRot = save_mem_orientation(reactMol2, reactMol2, molTemplateList[reactMol2.molTypeIndex]);
                     pivot = reactMol2.tmpComCoord;
                 }
                 rotate(pivot, memRot, reactCom1, moleculeList);
@@ -261,7 +259,7 @@ void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& rea
          * also requires updating the COM of this temporary new position 
          * */
         update_complex_tmp_com_crds(reactCom1, moleculeList);
-        reflect_traj_tmp_crds(params, moleculeList, reactCom1, traj, membraneObject, RS3D); // uses tmpCoords to calculate traj.
+        reflect_traj_tmp_crds_box(params, moleculeList, reactCom1, traj, membraneObject, RS3D); // uses tmpCoords to calculate traj.
         if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-50) {
             // update the temporary coordinates for both complexes
             Vector vtraj { traj[0], traj[1], traj[2] };
@@ -282,12 +280,12 @@ void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& rea
             counterArrays.nCancelSpanBox++;
 
         if (cancelAssoc == false) {
-            check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
+            check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
             if (cancelAssoc == true)
                 counterArrays.nCancelOverlapSystem++;
         }
         if (cancelAssoc == false) {
-            measure_complex_displacement(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList);
+            measure_complex_displacement(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, membraneObject);
             if (cancelAssoc == true) {
                 if (isOnMembrane)
                     counterArrays.nCancelDisplace2D++;
@@ -339,7 +337,7 @@ void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& rea
         // std::cout << " Size of IL's complex:" << reactCom2.memberList.size() << " Interfaces on IL: " << moleculeList[reactMol2.index].interfaceList.size() << std::endl;
         reactCom2.update_properties(moleculeList, molTemplateList); // recalculate the properties of the second complex
         //Enforce boundary conditions
-        reflect_complex_rad_rot(membraneObject, reactCom1, moleculeList, RS3D);
+        reflect_complex_rad_rot_box(membraneObject, reactCom1, moleculeList, RS3D);
         //------------------------START UPDATE MONOMERLIST-------------------------
         // update oneTemp.monomerList when oneTemp.canDestroy is true and mol is monomer
         // reactMol1
@@ -424,7 +422,7 @@ void associate_implicitlipid_box(int ifaceIndex1, int ifaceIndex2, Molecule& rea
         reactCom1.update_properties(moleculeList, molTemplateList); // recalculate the properties of the second complex
 
         //Enforce boundary conditions
-        reflect_complex_rad_rot(membraneObject, reactCom2, moleculeList, RS3D);
+        reflect_complex_rad_rot_box(membraneObject, reactCom2, moleculeList, RS3D);
         //------------------------START UPDATE MONOMERLIST-------------------------
         // update oneTemp.monomerList when oneTemp.canDestroy is true and mol is monomer
         // reactMol2
@@ -18,7 +18,7 @@ void associate_implicitlipid_sphere(
     std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList,
     copyCounters& counterArrays, std::vector<Complex>& complexList,
     Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns)
+    const std::vector<BackRxn>& backRxns, SimulContext& context)
 {
     // TRACE();
     double RS3D { -1.0 };
@@ -170,7 +170,7 @@ void associate_implicitlipid_sphere(
   */
     update_complex_tmp_com_crds(reactCom1, moleculeList);
     reactCom1.tmpOnSurface = true;
-    reflect_traj_tmp_crds(params, moleculeList, reactCom1, traj, membraneObject, RS3D); // uses tmpCoords to calculate traj.
+    reflect_traj_tmp_crds_sphere(params, moleculeList, reactCom1, traj, membraneObject, RS3D); // uses tmpCoords to calculate traj.
 
     if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-14) {
         // update the temporary coordinates for both complexes
@@ -189,12 +189,12 @@ void associate_implicitlipid_sphere(
     if (cancelAssoc == true)
         counterArrays.nCancelSpanBox++;
     if (cancelAssoc == false) {
-        check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
+        check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
         if (cancelAssoc == true)
             counterArrays.nCancelOverlapSystem++;
     }
     if (cancelAssoc == false) {
-        measure_complex_displacement(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList);
+        measure_complex_displacement(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, membraneObject);
         if (cancelAssoc == true) {
             if (isOnMembrane)
                 counterArrays.nCancelDisplace2D++;
@@ -250,7 +250,7 @@ void associate_implicitlipid_sphere(
 
         // Enforce boundary conditions
         // For the sphere system, many times of reflections may need to move the complex back inside the sphere!!
-        reflect_complex_rad_rot(membraneObject, reactCom1, moleculeList, RS3D);
+        reflect_complex_rad_rot_sphere(membraneObject, reactCom1, moleculeList, RS3D);
         //------------------------START UPDATE MONOMERLIST-------------------------
         // update oneTemp.monomerList when oneTemp.canDestroy is true and mol is monomer
         // reactMol1
@@ -8,491 +8,497 @@
 #include <cmath>
 #include <iomanip>
 
-void associate_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
-    Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
-    std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns)
+namespace {
+void count_association_cancel(AssocCancel cancelReason, copyCounters& counterArrays)
 {
-    if (reactCom1.index == reactCom2.index) {
-        // skip to protein interation updates
-        // std::cout << "Closing a loop, no rotations performed.\n";
-        counterArrays.nLoops++;
-        // update the Molecule's TrajStatus (this is done in the else, when Molecules are rotated but not otherwise)
-        for (auto& memMol : reactCom1.memberList)
-            moleculeList[memMol].trajStatus = TrajStatus::associated;
-    } else { //not in the same complex
-        // set up temporary coordinates
+    switch (cancelReason) {
+    case AssocCancel::overlapPartner:
+        counterArrays.nCancelOverlapPartner++;
+        break;
+    case AssocCancel::overlapSystem:
+        counterArrays.nCancelOverlapSystem++;
+        break;
+    case AssocCancel::spanBox:
+        counterArrays.nCancelSpanBox++;
+        break;
+    case AssocCancel::displace2D:
+        counterArrays.nCancelDisplace2D++;
+        break;
+    case AssocCancel::displace3D:
+        counterArrays.nCancelDisplace3D++;
+        break;
+    case AssocCancel::displace3Dto2D:
+        counterArrays.nCancelDisplace3Dto2D++;
+        break;
+    case AssocCancel::none:
+        break;
+    }
+}
+}
+
+AssocPlacement place_association_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2,
+    Complex& reactCom1, Complex& reactCom2, const Parameters& params, const ForwardRxn& currRxn,
+    std::vector<Molecule>& moleculeList, const std::vector<MolTemplate>& molTemplateList,
+    const std::vector<Complex>& complexList, const Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns,
+    const std::vector<BackRxn>& backRxns, SimulContext& context)
+{
+    AssocPlacement placement {};
+    double tol = 1E-14;
+
+    /* set up temporary coordinates. In 3D, only the reacting proteins are moved into place at first, so that most
+       associations that will be canceled are found before the rest of the complexes are moved, see below*/
+    bool defersMoves { reactCom1.D.z >= tol && reactCom2.D.z >= tol };
+    if (defersMoves) {
+        defer_tmp_crds(reactCom1, reactMol1, moleculeList);
+        defer_tmp_crds(reactCom2, reactMol2, moleculeList);
+    } else {
         for (auto& memMol : reactCom1.memberList)
             moleculeList[memMol].set_tmp_association_coords();
 
         for (auto& mol : reactCom2.memberList)
             moleculeList[mol].set_tmp_association_coords();
+    }
 
-        // create references to reacting interfaces
-        Coord& reactIface1 = reactMol1.tmpICoords[ifaceIndex1];
-        Coord& reactIface2 = reactMol2.tmpICoords[ifaceIndex2];
+    // create references to reacting interfaces
+    Coord& reactIface1 = reactMol1.tmpICoords[ifaceIndex1];
+    Coord& reactIface2 = reactMol2.tmpICoords[ifaceIndex2];
+    if (reactCom1.index != reactCom2.index)
+        placement.imageShift2 = move_to_nearest_image(reactIface1, reactIface2, reactCom2, moleculeList, membraneObject);
 
-        // orientation corrections for membrane bound components
-        bool isOnMembrane = false;
-        bool transitionToSurface = false;
-        Molecule memProtein;
+    // orientation corrections for membrane bound components
+    bool& isOnMembrane = placement.isOnMembrane;
+    bool& transitionToSurface = placement.transitionToSurface;
 
-        int slowPro = reactMol2.index;
+    int slowPro = reactMol2.index;
 
-        if (reactCom1.D.x < reactCom2.D.x) {
-            slowPro = reactMol1.index;
-            memProtein = reactMol1; // rotate relative to the slower protein.
-        } else
-            memProtein = reactMol2;
+    if (reactCom1.D.x < reactCom2.D.x)
+        slowPro = reactMol1.index; // rotate relative to the slower protein.
 
-        double tol = 1E-14;
-        /* Calculate COM of the two complexes pre-association. The COM of the new complex after should be close to this
-         * Here, we will force it back, as rotation can cause large displacements*/
-        Coord startCOM;
-        com_of_two_tmp_complexes(reactCom1, reactCom2, startCOM, moleculeList);
+    /* Calculate the COM of the 2D complexes pre-association, to keep them at the same height*/
+    double zCom1Temp {};
+    double zCom2Temp {};
+    if (reactCom1.D.z < tol) {
+        // com1 is the 2D complex
         Coord startCOM1;
         com_of_two_tmp_complexes(reactCom1, reactCom1, startCOM1, moleculeList);
+        zCom1Temp = startCOM1.z;
+    }
+    if (reactCom2.D.z < tol) {
+        // com2 is the 2D complex
         Coord startCOM2;
         com_of_two_tmp_complexes(reactCom2, reactCom2, startCOM2, moleculeList);
+        zCom2Temp = startCOM2.z;
+    }
 
-        double zCom1Temp {};
-        double zCom2Temp {};
-        if (reactCom1.D.z < tol) {
-            // com1 is the 2D complex
-            zCom1Temp = startCOM1.z;
-        }
-        if (reactCom2.D.z < tol) {
-            // com2 is the 2D complex
-            zCom2Temp = startCOM2.z;
-        }
-
-        /* MOVE PROTEIN TO SIGMA */
-        {
-            double DxSum { reactCom1.D.x + reactCom2.D.x };
-            double DySum { reactCom1.D.y + reactCom2.D.y };
-            double DzSum { reactCom1.D.z + reactCom2.D.z };
-
-            Vector sigma { reactIface1 - reactIface2 };
-            Vector transVec1 {};
-            Vector transVec2 {};
-            double displaceFrac {};
-
-            // if both in 2D, ignore the z-component
-            if (DzSum < 1E-14) {
-                isOnMembrane = true;
-                /*Store coordinates of one protein to recover membrane-bound orientation*/
-
-                DzSum = 1; // to prevent divide by 0
-                if (std::abs(std::abs(sigma.z) - currRxn.bindRadius) < 1E-3) {
-                    // if entirety of sigma is in z-component, ignore x and y
-                    displaceFrac = 1;
-                } else {
-                    double sigmaMag = sqrt((sigma.x * sigma.x) + (sigma.y * sigma.y));
-                    displaceFrac = (sigmaMag - currRxn.bindRadius) / sigmaMag;
-                }
-            } else { //note
-                //Not in 2D
-                double sigmaMag = sqrt((sigma.x * sigma.x) + (sigma.y * sigma.y) + (sigma.z * sigma.z));
-                // sigma.calc_magnitude();
+    /* MOVE PROTEIN TO SIGMA */
+    {
+        double DxSum { reactCom1.D.x + reactCom2.D.x };
+        double DySum { reactCom1.D.y + reactCom2.D.y };
+        double DzSum { reactCom1.D.z + reactCom2.D.z };
+
+        Vector sigma { reactIface1 - reactIface2 };
+        Vector transVec1 {};
+        Vector transVec2 {};
+        double displaceFrac {};
+
+        // if both in 2D, ignore the z-component
+        if (DzSum < 1E-14) {
+            isOnMembrane = true;
+            /*Store coordinates of one protein to recover membrane-bound orientation*/
+
+            DzSum = 1; // to prevent divide by 0
+            if (std::abs(std::abs(sigma.z) - currRxn.bindRadius) < 1E-3) {
+                // if entirety of sigma is in z-component, ignore x and y
+                displaceFrac = 1;
+            } else {
+                double sigmaMag = sqrt((sigma.x * sigma.x) + (sigma.y * sigma.y));
                 displaceFrac = (sigmaMag - currRxn.bindRadius) / sigmaMag;
-                /*At least one protein is in 3D*/
-                if (reactCom1.D.z < tol || reactCom2.D.z < tol) {
-                    transitionToSurface = true; // both can't be less than tol, or would not be in this loop.
-                    // std::cout << "TRANSITIONING FROM 3D->2D " << std::endl;
-                }
             }
+        } else { //note
+            //Not in 2D
+            double sigmaMag = sqrt((sigma.x * sigma.x) + (sigma.y * sigma.y) + (sigma.z * sigma.z));
+            // sigma.calc_magnitude();
+            displaceFrac = (sigmaMag - currRxn.bindRadius) / sigmaMag;
+            /*At least one protein is in 3D*/
+            if (reactCom1.D.z < tol || reactCom2.D.z < tol) {
+                transitionToSurface = true; // both can't be less than tol, or would not be in this loop.
+                // std::cout << "TRANSITIONING FROM 3D->2D " << std::endl;
+            }
+        }
+
+        transVec1.x = -sigma.x * (reactCom1.D.x / DxSum) * displaceFrac;
+        transVec1.y = -sigma.y * (reactCom1.D.y / DySum) * displaceFrac;
+        transVec1.z = -sigma.z * (reactCom1.D.z / DzSum) * displaceFrac;
 
-            transVec1.x = -sigma.x * (reactCom1.D.x / DxSum) * displaceFrac;
-            transVec1.y = -sigma.y * (reactCom1.D.y / DySum) * displaceFrac;
-            transVec1.z = -sigma.z * (reactCom1.D.z / DzSum) * displaceFrac;
-
-            transVec2.x = sigma.x * (reactCom2.D.x / DxSum) * displaceFrac;
-            transVec2.y = sigma.y * (reactCom2.D.y / DySum) * displaceFrac;
-            transVec2.z = sigma.z * (reactCom2.D.z / DzSum) * displaceFrac;
-
-            // std::cout << "Initial Position before any association movements: " << std::endl;
-            // reactMol1.display_assoc_icoords("mol1");
-            // reactMol2.display_assoc_icoords("mol2");
-            // update the temporary coordinates
-            for (auto& mp : reactCom1.memberList)
-                moleculeList[mp].update_association_coords(transVec1);
-            for (auto& mp : reactCom2.memberList)
-                moleculeList[mp].update_association_coords(transVec2);
-            // std::cout << "Position after pushed to sigma: " << std::endl;
-            // reactMol1.display_assoc_icoords("mol1");
-            // reactMol2.display_assoc_icoords("mol2");
-        } //matches move protein to sigma
-
-        Coord afterSigmaCOM1;
-        com_of_two_tmp_complexes(reactCom1, reactCom1, afterSigmaCOM1, moleculeList);
-        Coord afterSigmaCOM2;
-        com_of_two_tmp_complexes(reactCom2, reactCom2, afterSigmaCOM2, moleculeList);
-
-        // std::cout << "Diplace during pushing to sigma: " << std::endl;
-        // std::cout << "COM1: " << std::endl;
-        // std::cout << sqrt((afterSigmaCOM1.x - startCOM1.x) * (afterSigmaCOM1.x - startCOM1.x) + (afterSigmaCOM1.y - startCOM1.y) * (afterSigmaCOM1.y - startCOM1.y) + (afterSigmaCOM1.z - startCOM1.z) * (afterSigmaCOM1.z - startCOM1.z)) << std::endl;
-        // std::cout << "COM2: " << std::endl;
-        // std::cout << sqrt((afterSigmaCOM2.x - startCOM2.x) * (afterSigmaCOM2.x - startCOM2.x) + (afterSigmaCOM2.y - startCOM2.y) * (afterSigmaCOM2.y - startCOM2.y) + (afterSigmaCOM2.z - startCOM2.z) * (afterSigmaCOM2.z - startCOM2.z)) << std::endl;
-
-        if (molTemplateList[reactMol1.molTypeIndex].isPoint && molTemplateList[reactMol2.molTypeIndex].isPoint) {
-            /*If both molecules are points, no orientations to specify*/
-            //   std::cout << " Move two point particles to contact along current separation vector, NO ORIENTATION \n";
-        } else { //both are not points
-            /* THETA */
-            // std::cout << std::setw(8) << std::setfill('-') << ' ' << std::endl
-            //           << "THETA 1" << std::endl
-            //           << std::setw(8) << ' ' << std::setfill(' ') << std::endl;
-            if (!std::isnan(currRxn.assocAngles.theta1))
-                theta_rotation(reactIface1, reactIface2, reactMol1, reactMol2, currRxn.assocAngles.theta1, reactCom1, reactCom2, moleculeList);
-            // else
-            //   std::cout <<"No THETA1 !"<<std::endl;
-            //     std::cout << std::setw(30) << std::setfill('-') << ' ' << std::setfill(' ') << std::endl;
-            //     std::cout << "THETA 2" << std::endl
-            //               << std::setw(8) << std::setfill('-') << ' ' << std::setfill(' ') << std::endl;
-            if (!std::isnan(currRxn.assocAngles.theta2))
-                theta_rotation(reactIface2, reactIface1, reactMol2, reactMol1, currRxn.assocAngles.theta2, reactCom2, reactCom1, moleculeList);
-            // else
-            //   std::cout <<" NO THETA 2 "<<std::endl;
-            /* OMEGA */
-            // if protein has theta M_PI, uses protein norm instead of com_iface vector
-            // std::cout << std::setw(6) << std::setfill('-') << ' ' << std::endl
-            //           << "OMEGA" << std::endl
-            //           << std::setw(6) << ' ' << std::setfill(' ') << std::endl;
-            if (!std::isnan(currRxn.assocAngles.omega)) {
-                omega_rotation(reactIface1, reactIface2, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, currRxn.assocAngles.omega, currRxn, moleculeList, molTemplateList);
-            } //else
-            // std::cout << "P1 or P2 is a rod-type protein, no dihedral for associated complex." << std::endl;
-
-            /* PHI */
-            // PHI 1
-            // std::cout << std::setw(6) << std::setfill('-') << ' ' << std::endl
-            //           << "PHI 1" << std::endl
-            //           << std::setw(6) << ' ' << std::setfill(' ') << std::endl;
-            if (!std::isnan(currRxn.assocAngles.phi1)) {
-                phi_rotation(reactIface1, reactIface2, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, currRxn.norm1, currRxn.assocAngles.phi1, currRxn, moleculeList, molTemplateList);
-            } //else
-            // std::cout << "P1 has no valid phi angle." << std::endl;
-
-            // PHI 2
-            // std::cout << std::setw(6) << std::setfill('-') << ' ' << std::endl
-            //           << "PHI 2" << std::endl
-            //           << std::setw(6) << ' ' << std::setfill(' ') << std::endl;
-            if (!std::isnan(currRxn.assocAngles.phi2)) {
-                phi_rotation(reactIface2, reactIface1, ifaceIndex1, reactMol2, reactMol1, reactCom2, reactCom1, currRxn.norm2, currRxn.assocAngles.phi2, currRxn, moleculeList, molTemplateList);
-            } //else
-            // std::cout << "P2 has no valid phi angle." << std::endl;
-        } //end of if points.
-
-        Coord afterRotateCOM1;
-        com_of_two_tmp_complexes(reactCom1, reactCom1, afterRotateCOM1, moleculeList);
-        Coord afterRotateCOM2;
-        com_of_two_tmp_complexes(reactCom2, reactCom2, afterRotateCOM2, moleculeList);
-
-        // std::cout << "Diplace during rotating: " << std::endl;
-        // std::cout << "COM1: " << std::endl;
-        // std::cout << sqrt((afterSigmaCOM1.x - afterRotateCOM1.x) * (afterSigmaCOM1.x - afterRotateCOM1.x) + (afterSigmaCOM1.y - afterRotateCOM1.y) * (afterSigmaCOM1.y - afterRotateCOM1.y) + (afterSigmaCOM1.z - afterRotateCOM1.z) * (afterSigmaCOM1.z - afterRotateCOM1.z)) << std::endl;
-        // std::cout << "COM2: " << std::endl;
-        // std::cout << sqrt((afterSigmaCOM2.x - afterRotateCOM2.x) * (afterSigmaCOM2.x - afterRotateCOM2.x) + (afterSigmaCOM2.y - afterRotateCOM2.y) * (afterSigmaCOM2.y - afterRotateCOM2.y) + (afterSigmaCOM2.z - afterRotateCOM2.z) * (afterSigmaCOM2.z - afterRotateCOM2.z)) << std::endl;
-
-        /*FINISHED ROTATING, NO CONSTRAINTS APPLIED TO SURFACE REACTIONS*/
-        Coord finalCOM;
-        com_of_two_tmp_complexes(reactCom1, reactCom2, finalCOM, moleculeList); // com of c1+c2 (final (tmp) coordinates).
-        // std::cout << "Pre-MEMBRANE ROT: COMPLEX PAIR COM: " << finalCOM.x << ' ' << finalCOM.y << ' ' << finalCOM.z << std::endl;
+        transVec2.x = sigma.x * (reactCom2.D.x / DxSum) * displaceFrac;
+        transVec2.y = sigma.y * (reactCom2.D.y / DySum) * displaceFrac;
+        transVec2.z = sigma.z * (reactCom2.D.z / DzSum) * displaceFrac;
+
+        // std::cout << "Initial Position before any association movements: " << std::endl;
         // reactMol1.display_assoc_icoords("mol1");
         // reactMol2.display_assoc_icoords("mol2");
-        Coord preCOM;
-        if (isOnMembrane == true || transitionToSurface == true) {
-            /*return orientation of normal back to starting position*/
-            // std::cout << " IS ON MEMBRANE, CORRECT ORIENTATION ! " << std::endl;
-            Quat memRot;
-            Coord pivot;
-            //also translate the slowPro back to its same COM.
-
-            if (slowPro == reactMol1.index) {
-                memRot = save_mem_orientation(memProtein, reactMol1, molTemplateList[reactMol1.molTypeIndex]);
-                pivot = reactMol1.tmpComCoord;
-                preCOM = afterSigmaCOM1;
-            } else {
-                memRot = save_mem_orientation(memProtein, reactMol2, molTemplateList[reactMol2.molTypeIndex]);
-                pivot = reactMol2.tmpComCoord;
-                preCOM = afterSigmaCOM2;
-            }
+        // update the temporary coordinates
+        translate_tmp_crds(transVec1, reactCom1, moleculeList);
+        translate_tmp_crds(transVec2, reactCom2, moleculeList);
+        // std::cout << "Position after pushed to sigma: " << std::endl;
+        // reactMol1.display_assoc_icoords("mol1");
+        // reactMol2.display_assoc_icoords("mol2");
+    } //matches move protein to sigma
+
+    /* On the membrane, the slower complex is put back at its COM after sigma, once it's been oriented*/
+    Coord preCOM;
+    if (isOnMembrane == true || transitionToSurface == true) {
+        if (slowPro == reactMol1.index)
+            com_of_two_tmp_complexes(reactCom1, reactCom1, preCOM, moleculeList);
+        else
+            com_of_two_tmp_complexes(reactCom2, reactCom2, preCOM, moleculeList);
+    }
 
-            rotate(pivot, memRot, reactCom1, moleculeList);
-            rotate(pivot, memRot, reactCom2, moleculeList);
-        }
-        com_of_two_tmp_complexes(reactCom1, reactCom2, finalCOM, moleculeList);
-        Vector dtrans {};
-        // std::cout << "POST-MEMBRANE ROT: COMPLEX PAIR COM: " << finalCOM.x << ' ' << finalCOM.y << ' ' << finalCOM.z << std::endl;
-        //     reactMol1.display_assoc_icoords("mol1");
-        //     reactMol2.display_assoc_icoords("mol2");
+    if (molTemplateList[reactMol1.molTypeIndex].isPoint && molTemplateList[reactMol2.molTypeIndex].isPoint) {
+        /*If both molecules are points, no orientations to specify*/
+        //   std::cout << " Move two point particles to contact along current separation vector, NO ORIENTATION \n";
+    } else { //both are not points
+        /* THETA */
+        // std::cout << std::setw(8) << std::setfill('-') << ' ' << std::endl
+        //           << "THETA 1" << std::endl
+        //           << std::setw(8) << ' ' << std::setfill(' ') << std::endl;
+        if (!std::isnan(currRxn.assocAngles.theta1))
+            theta_rotation(reactIface1, reactIface2, reactMol1, reactMol2, currRxn.assocAngles.theta1, reactCom1, reactCom2, moleculeList);
+        // else
+        //   std::cout <<"No THETA1 !"<<std::endl;
+        //     std::cout << std::setw(30) << std::setfill('-') << ' ' << std::setfill(' ') << std::endl;
+        //     std::cout << "THETA 2" << std::endl
+        //               << std::setw(8) << std::setfill('-') << ' ' << std::setfill(' ') << std::endl;
+        if (!std::isnan(currRxn.assocAngles.theta2))
+            theta_rotation(reactIface2, reactIface1, reactMol2, reactMol1, currRxn.assocAngles.theta2, reactCom2, reactCom1, moleculeList);
+        // else
+        //   std::cout <<" NO THETA 2 "<<std::endl;
+        /* OMEGA */
+        // if protein has theta M_PI, uses protein norm instead of com_iface vector
+        // std::cout << std::setw(6) << std::setfill('-') << ' ' << std::endl
+        //           << "OMEGA" << std::endl
+        //           << std::setw(6) << ' ' << std::setfill(' ') << std::endl;
+        if (!std::isnan(currRxn.assocAngles.omega)) {
+            omega_rotation(reactIface1, reactIface2, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, currRxn.assocAngles.omega, currRxn, moleculeList, molTemplateList);
+        } //else
+        // std::cout << "P1 or P2 is a rod-type protein, no dihedral for associated complex." << std::endl;
+
+        /* PHI */
+        // PHI 1
+        // std::cout << std::setw(6) << std::setfill('-') << ' ' << std::endl
+        //           << "PHI 1" << std::endl
+        //           << std::setw(6) << ' ' << std::setfill(' ') << std::endl;
+        if (!std::isnan(currRxn.assocAngles.phi1)) {
+            phi_rotation(reactIface1, reactIface2, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, currRxn.norm1, currRxn.assocAngles.phi1, currRxn, moleculeList, molTemplateList);
+        } //else
+        // std::cout << "P1 has no valid phi angle." << std::endl;
+
+        // PHI 2
+        // std::cout << std::setw(6) << std::setfill('-') << ' ' << std::endl
+        //           << "PHI 2" << std::endl
+        //           << std::setw(6) << ' ' << std::setfill(' ') << std::endl;
+        if (!std::isnan(currRxn.assocAngles.phi2)) {
+            phi_rotation(reactIface2, reactIface1, ifaceIndex1, reactMol2, reactMol1, reactCom2, reactCom1, currRxn.norm2, currRxn.assocAngles.phi2, currRxn, moleculeList, molTemplateList);
+        } //else
+        // std::cout << "P2 has no valid phi angle." << std::endl;
+    } //end of if points.
+
+    /*FINISHED ROTATING, NO CONSTRAINTS APPLIED TO SURFACE REACTIONS*/
+    if (isOnMembrane == true || transitionToSurface == true) {
+        /*return orientation of normal back to starting position*/
+        // std::cout << " IS ON MEMBRANE, CORRECT ORIENTATION ! " << std::endl;
+        Quat memRot;
+        Coord pivot;
+        //also translate the slowPro back to its same COM.
 
-        Coord afterOrientationCOM1;
-        com_of_two_tmp_complexes(reactCom1, reactCom1, afterOrientationCOM1, moleculeList);
-        Coord afterOrientationCOM2;
-        com_of_two_tmp_complexes(reactCom2, reactCom2, afterOrientationCOM2, moleculeList);
+        if (slowPro == reactMol1.index) {
+            memRot = save_mem_orientation(reactMol1, reactMol1, molTemplateList[reactMol1.molTypeIndex]);
+            pivot = reactMol1.tmpComCoord;
+        } else {
+            memRot = save_mem_orientation(reactMol2, reactMol2, molTemplateList[reactMol2.molTypeIndex]);
+            pivot = reactMol2.tmpComCoord;
+        }
 
+        rotate(pivot, memRot, reactCom1, moleculeList);
+        rotate(pivot, memRot, reactCom2, moleculeList);
+    }
+    Vector dtrans {};
+    if (isOnMembrane == true || transitionToSurface == true) {
+        /*
+	    Force the COM of the slowPro back to its COM after sigma.
+	  */
         Coord postCOM;
         if (slowPro == reactMol1.index) {
-            postCOM = afterOrientationCOM1;
+            com_of_two_tmp_complexes(reactCom1, reactCom1, postCOM, moleculeList);
         } else {
-            postCOM = afterOrientationCOM2;
+            com_of_two_tmp_complexes(reactCom2, reactCom2, postCOM, moleculeList);
         }
-        // std::cout << "Diplace during orientation to the membrane: " << std::endl;
-        // std::cout << "COM1: " << std::endl;
-        // std::cout << sqrt((afterOrientationCOM1.x - afterRotateCOM1.x) * (afterOrientationCOM1.x - afterRotateCOM1.x) + (afterOrientationCOM1.y - afterRotateCOM1.y) * (afterOrientationCOM1.y - afterRotateCOM1.y) + (afterOrientationCOM1.z - afterRotateCOM1.z) * (afterOrientationCOM1.z - afterRotateCOM1.z)) << std::endl;
-        // std::cout << "COM2: " << std::endl;
-        // std::cout << sqrt((afterOrientationCOM2.x - afterRotateCOM2.x) * (afterOrientationCOM2.x - afterRotateCOM2.x) + (afterOrientationCOM2.y - afterRotateCOM2.y) * (afterOrientationCOM2.y - afterRotateCOM2.y) + (afterOrientationCOM2.z - afterRotateCOM2.z) * (afterOrientationCOM2.z - afterRotateCOM2.z)) << std::endl;
-
-        if (isOnMembrane == true || transitionToSurface == true) {
-            /*
-	    Force finalCOM to afterSigmaCOM, just for the slowPro.
-	  */
 
-            dtrans.x = preCOM.x - postCOM.x;
-            dtrans.y = preCOM.y - postCOM.y;
-            // dtrans.z = (float)preCOM.z - (float)postCOM.z;
+        dtrans.x = preCOM.x - postCOM.x;
+        dtrans.y = preCOM.y - postCOM.y;
+        // dtrans.z = (float)preCOM.z - (float)postCOM.z;
 
-            dtrans.z = 0.0; // don't move in z, now they are both on membrane
+        dtrans.z = 0.0; // don't move in z, now they are both on membrane
 
-            //   std::cout << "TRANSLATE SLOWPRO TO ORIG SIGMA COM BY SHIFTING: " << dtrans.x << ' ' << dtrans.y << ' ' << dtrans.z << std::endl; // update the temporary coordinates for both complexes
-            for (auto& mp : reactCom1.memberList)
-                moleculeList[mp].update_association_coords(dtrans);
-            for (auto& mp : reactCom2.memberList)
-                moleculeList[mp].update_association_coords(dtrans);
+        //   std::cout << "TRANSLATE SLOWPRO TO ORIG SIGMA COM BY SHIFTING: " << dtrans.x << ' ' << dtrans.y << ' ' << dtrans.z << std::endl; // update the temporary coordinates for both complexes
+        for (auto& mp : reactCom1.memberList)
+            moleculeList[mp].update_association_coords(dtrans);
+        for (auto& mp : reactCom2.memberList)
+            moleculeList[mp].update_association_coords(dtrans);
 
-            //   std::cout << "NEW AFTER TRANSLATIONAL SHIFT: " << std::endl;
-            //   reactMol1.display_assoc_icoords("mol1");
-            //   reactMol2.display_assoc_icoords("mol2");
-            Coord afterTranShiftCOM1;
-            com_of_two_tmp_complexes(reactCom1, reactCom1, afterTranShiftCOM1, moleculeList);
-            Coord afterTranShiftCOM2;
-            com_of_two_tmp_complexes(reactCom2, reactCom2, afterTranShiftCOM2, moleculeList);
+        //   std::cout << "NEW AFTER TRANSLATIONAL SHIFT: " << std::endl;
+        //   reactMol1.display_assoc_icoords("mol1");
+        //   reactMol2.display_assoc_icoords("mol2");
 
-            /*
+        /*
 	    FOR 2D AND 3D->2D, the SLOWPRO IS NOW BACK TO ITS ORIGINAL POSITION, MEANING THE OTHER PROTEIN DID ALL THE DISPLACING. 
 	    BASED ON THE AMOUNT THAT PRO2 HAD TO REORIENT, USE FRACTIONS OF DR TO ROTATE IT A BIT BACK.
 	    SINCE THEY ARE BOTH NOW IN 2D, ONLY WANT TO EVALUATE THE DISPLACEMENT THAT HAS OCCURED IN 2D.
 	  */
-            double dispAngle, rotAng, skip;
-            if (slowPro == reactMol1.index) {
-                dispAngle = calc_one_angular_displacement(ifaceIndex2, reactMol2, reactCom2); //pro2 is the one that moved.
-                determine_rotation_angles(dispAngle, 0, rotAng, skip, reactCom1, reactCom2); //positive angle
+        double dispAngle, rotAng, skip;
+        if (slowPro == reactMol1.index) {
+            dispAngle = calc_one_angular_displacement(ifaceIndex2, reactMol2, reactCom2); //pro2 is the one that moved.
+            determine_rotation_angles(dispAngle, 0, rotAng, skip, reactCom1, reactCom2); //positive angle
 
-            } else {
-                dispAngle = calc_one_angular_displacement(ifaceIndex1, reactMol1, reactCom1); //pro1 is the one that moved
-                determine_rotation_angles(0, dispAngle, skip, rotAng, reactCom1, reactCom2); //positive angle
-            }
-            Coord origin { 0.5 * (reactIface1 + reactIface2) }; //halfway along the sigma vector, or midway between the interfaces.
-            /*axis of rotation is the normal to the plane, at the origin position*/
-            Vector rotAxis { 0, 0, 1 }; //For a Box, we can just use the z-axis.
-            Quat rotQuatPos(cos(rotAng / 2), sin(rotAng / 2) * rotAxis.x, sin(rotAng / 2) * rotAxis.y, sin(rotAng / 2) * rotAxis.z);
-            rotQuatPos = rotQuatPos.unit();
-
-            // rotate the two complexes, using same angle here, so no orientations should change!
-            rotate(origin, rotQuatPos, reactCom1, moleculeList);
-            rotate(origin, rotQuatPos, reactCom2, moleculeList);
-            Coord afterRotShiftCOM1;
-            com_of_two_tmp_complexes(reactCom1, reactCom1, afterRotShiftCOM1, moleculeList);
-            Coord afterRotShiftCOM2;
-            com_of_two_tmp_complexes(reactCom2, reactCom2, afterRotShiftCOM2, moleculeList);
-
-            //   std::cout << "Displace during rotation shift to move COM1: " << std::endl;
-            //   std::cout << "COM1: " << std::endl;
-            Vector d1 { afterRotShiftCOM1 - afterTranShiftCOM1 };
-            d1.calc_magnitude();
-            //   std::cout <<d1.magnitude<<std::endl;
-            //   std::cout << "COM2: " << std::endl;
-            Vector d2 { afterRotShiftCOM2 - afterTranShiftCOM2 };
-            d2.calc_magnitude();
-            //   std::cout <<d2.magnitude<<std::endl;
-            //   std::cout << "NEW AFTER ROTATIONAL ALIGN: " << std::endl;
-            //   reactMol1.display_assoc_icoords("mol1");
-            //   reactMol2.display_assoc_icoords("mol2");
+        } else {
+            dispAngle = calc_one_angular_displacement(ifaceIndex1, reactMol1, reactCom1); //pro1 is the one that moved
+            determine_rotation_angles(0, dispAngle, skip, rotAng, reactCom1, reactCom2); //positive angle
         }
+        Coord origin { 0.5 * (reactIface1 + reactIface2) }; //halfway along the sigma vector, or midway between the interfaces.
+        /*axis of rotation is the normal to the plane, at the origin position*/
+        Vector rotAxis { 0, 0, 1 }; //For a Box, we can just use the z-axis.
+        Quat rotQuatPos(cos(rotAng / 2), sin(rotAng / 2) * rotAxis.x, sin(rotAng / 2) * rotAxis.y, sin(rotAng / 2) * rotAxis.z);
+        rotQuatPos = rotQuatPos.unit();
+
+        // rotate the two complexes, using same angle here, so no orientations should change!
+        rotate(origin, rotQuatPos, reactCom1, moleculeList);
+        rotate(origin, rotQuatPos, reactCom2, moleculeList);
+        //   std::cout << "NEW AFTER ROTATIONAL ALIGN: " << std::endl;
+        //   reactMol1.display_assoc_icoords("mol1");
+        //   reactMol2.display_assoc_icoords("mol2");
+    }
+
+    /*
+	  CHECK IF BELOW BOX
+	 */
+    double zchg = 0;
+    bool isBelowBottom = false;
+    bool isAboveBottom = false;
+    if (isOnMembrane == true || transitionToSurface == true) {
+        /* RECHECK HERE IF ANY OF THE LIPIDS ARE SLIGHTLY BELOW THE MEMBRANE. THIS CAN HAPPEN DUE TO PRECISION ISSUES
+	           always use tmpCoords in this associate routine. */
         Coord currCOM1;
         com_of_two_tmp_complexes(reactCom1, reactCom1, currCOM1, moleculeList);
         Coord currCOM2;
         com_of_two_tmp_complexes(reactCom2, reactCom2, currCOM2, moleculeList);
 
-        /*
-	  CHECK IF BELOW BOX
-	 */
-        double zchg = 0;
-        bool isBelowBottom = false;
-        bool isAboveBottom = false;
-        if (isOnMembrane == true || transitionToSurface == true) {
-            /* RECHECK HERE IF ANY OF THE LIPIDS ARE SLIGHTLY BELOW THE MEMBRANE. THIS CAN HAPPEN DUE TO PRECISION ISSUES
-	           always use tmpCoords in this associate routine. */
-            dtrans.x = 0;
-            dtrans.y = 0;
-            for (auto& mp : reactCom1.memberList) {
-                if (moleculeList[mp].isLipid == true) {
-                    if (moleculeList[mp].tmpComCoord.z < -membraneObject.waterBox.z / 2.0) {
-                        double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is below box bottom, here ztmp is positive
-                        if (ztmp > zchg) {
-                            zchg = ztmp; // largest dip below membrane
-                            isBelowBottom = true;
-                        }
-                    }
-                    if (moleculeList[mp].tmpComCoord.z - 0.01 > -membraneObject.waterBox.z / 2.0) {
-                        double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is ABOVE box bottom, here ztmp is negtive
-                        // std::cout << "WARNING, during associate, LIPID IS ABOVE MEMBRANE BY " << -ztmp << '\n';
-                        // move the lipid back to the bottom
-                        if (-ztmp > zchg) {
-                            zchg = -ztmp;
-                            isAboveBottom = true;
-                        }
+        dtrans.x = 0;
+        dtrans.y = 0;
+        for (auto& mp : reactCom1.memberList) {
+            if (moleculeList[mp].isLipid == true) {
+                if (moleculeList[mp].tmpComCoord.z < -membraneObject.waterBox.z / 2.0) {
+                    double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is below box bottom, here ztmp is positive
+                    if (ztmp > zchg) {
+                        zchg = ztmp; // largest dip below membrane
+                        isBelowBottom = true;
                     }
-                } //this is a lipid
-            }
-            if (reactCom1.D.z < tol) { // for the implicit case, we need to compare the z-value of the 2D complex to keep it unchanged
-                //Use the molecule crds, since the tmpComCoord is not updated
-                if (currCOM1.z - zCom1Temp > 0.0) {
-                    if (currCOM1.z - zCom1Temp > zchg) {
-                        zchg = currCOM1.z - zCom1Temp;
+                }
+                if (moleculeList[mp].tmpComCoord.z - 0.01 > -membraneObject.waterBox.z / 2.0) {
+                    double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is ABOVE box bottom, here ztmp is negtive
+                    // std::cout << "WARNING, during associate, LIPID IS ABOVE MEMBRANE BY " << -ztmp << '\n';
+                    // move the lipid back to the bottom
+                    if (-ztmp > zchg) {
+                        zchg = -ztmp;
                         isAboveBottom = true;
                     }
                 }
-                if (currCOM1.z - zCom1Temp < 0.0) {
-                    if (-currCOM1.z + zCom1Temp > zchg) {
-                        zchg = -currCOM1.z + zCom1Temp;
-                        isBelowBottom = true;
-                    }
+            } //this is a lipid
+        }
+        if (reactCom1.D.z < tol) { // for the implicit case, we need to compare the z-value of the 2D complex to keep it unchanged
+            //Use the molecule crds, since the tmpComCoord is not updated
+            if (currCOM1.z - zCom1Temp > 0.0) {
+                if (currCOM1.z - zCom1Temp > zchg) {
+                    zchg = currCOM1.z - zCom1Temp;
+                    isAboveBottom = true;
                 }
             }
-            for (auto& mp : reactCom2.memberList) {
-                if (moleculeList[mp].isLipid == true) {
-                    if (moleculeList[mp].tmpComCoord.z < -membraneObject.waterBox.z / 2.0) {
-                        double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is below box bottom
-                        if (ztmp > zchg) {
-                            zchg = ztmp; // largest dip below membrane
-                            isBelowBottom = true;
-                        }
-                    }
-                    if (moleculeList[mp].tmpComCoord.z - 0.01 > -membraneObject.waterBox.z / 2.0) {
-                        double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is ABOVE box bottom, here ztmp is negtive
-                        // std::cout << "WARNING, during associate, LIPID IS ABOVE MEMBRANE BY " << -ztmp << '\n';
-                        // move the lipid back to the bottom
-                        if (-ztmp > zchg) {
-                            zchg = -ztmp;
-                            isAboveBottom = true;
-                        }
-                    }
-                } //this is a lipid
+            if (currCOM1.z - zCom1Temp < 0.0) {
+                if (-currCOM1.z + zCom1Temp > zchg) {
+                    zchg = -currCOM1.z + zCom1Temp;
+                    isBelowBottom = true;
+                }
             }
-            if (reactCom2.D.z < tol) { // for the implicit case, we need to compare the z-value of the 2D complex to keep it unchanged
-                if (currCOM2.z - zCom2Temp > 0.0) {
-                    if (currCOM2.z - zCom2Temp > zchg) {
-                        zchg = currCOM2.z - zCom2Temp;
-                        isAboveBottom = true;
+        }
+        for (auto& mp : reactCom2.memberList) {
+            if (moleculeList[mp].isLipid == true) {
+                if (moleculeList[mp].tmpComCoord.z < -membraneObject.waterBox.z / 2.0) {
+                    double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is below box bottom
+                    if (ztmp > zchg) {
+                        zchg = ztmp; // largest dip below membrane
+                        isBelowBottom = true;
                     }
                 }
-                if (currCOM2.z - zCom2Temp < 0.0) {
-                    if (-currCOM2.z + zCom2Temp > zchg) {
-                        zchg = -currCOM2.z + zCom2Temp;
-                        isBelowBottom = true;
+                if (moleculeList[mp].tmpComCoord.z - 0.01 > -membraneObject.waterBox.z / 2.0) {
+                    double ztmp = (-membraneObject.waterBox.z / 2.0) - moleculeList[mp].tmpComCoord.z; // lipid COM is ABOVE box bottom, here ztmp is negtive
+                    // std::cout << "WARNING, during associate, LIPID IS ABOVE MEMBRANE BY " << -ztmp << '\n';
+                    // move the lipid back to the bottom
+                    if (-ztmp > zchg) {
+                        zchg = -ztmp;
+                        isAboveBottom = true;
                     }
                 }
+            } //this is a lipid
+        }
+        if (reactCom2.D.z < tol) { // for the implicit case, we need to compare the z-value of the 2D complex to keep it unchanged
+            if (currCOM2.z - zCom2Temp > 0.0) {
+                if (currCOM2.z - zCom2Temp > zchg) {
+                    zchg = currCOM2.z - zCom2Temp;
+                    isAboveBottom = true;
+                }
             }
-            if (isBelowBottom == true) {
-                dtrans.z = zchg;
-                // std::cout << " Lipid is below membrane, shift up by: " << zchg << std::endl;
+            if (currCOM2.z - zCom2Temp < 0.0) {
+                if (-currCOM2.z + zCom2Temp > zchg) {
+                    zchg = -currCOM2.z + zCom2Temp;
+                    isBelowBottom = true;
+                }
             }
-            if (isAboveBottom == true) {
-                dtrans.z = -zchg;
-                // std::cout << " Lipid is above membrane, shift down by: " << zchg << std::endl;
+        }
+        if (isBelowBottom == true) {
+            dtrans.z = zchg;
+            // std::cout << " Lipid is below membrane, shift up by: " << zchg << std::endl;
+        }
+        if (isAboveBottom == true) {
+            dtrans.z = -zchg;
+            // std::cout << " Lipid is above membrane, shift down by: " << zchg << std::endl;
+        }
+        // update the temporary coordinates for both complexes
+        for (auto& mp : reactCom1.memberList)
+            moleculeList[mp].update_association_coords(dtrans);
+        for (auto& mp : reactCom2.memberList)
+            moleculeList[mp].update_association_coords(dtrans);
+    } //is on membrane
+
+    bool cancelAssoc { false };
+    bool checkedOverlap { false };
+    if (defersMoves) {
+        /* CHEAP CHECKS FIRST. If neither complex can reach the walls, the reacting proteins are already at their
+           final positions, and the complex COMs are known from the moves. Then associations that move too far are
+           canceled without moving any other protein, and overlaps are looked for with the protein COMs moved,
+           and only the interfaces of proteins that come close to another. Only associations that pass are moved
+           in full, and go through the rest of the checks below*/
+        if (deferred_crds_stay_in_box(reactCom1, moleculeList, membraneObject)
+            && deferred_crds_stay_in_box(reactCom2, moleculeList, membraneObject)) {
+            measure_deferred_displacement(cancelAssoc, reactMol1, reactMol2, reactCom1, reactCom2, params, membraneObject);
+            if (cancelAssoc == true) {
+                placement.cancelReason = AssocCancel::displace3D;
+            } else {
+                update_deferred_tmp_com_crds(reactCom1, moleculeList);
+                update_deferred_tmp_com_crds(reactCom2, moleculeList);
+                check_for_structure_overlap(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList);
+                checkedOverlap = true;
+                if (cancelAssoc == true) {
+                    placement.cancelReason = AssocCancel::overlapPartner;
+                } else {
+                    placement.checkedSystem = true;
+                    check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
+                    if (cancelAssoc == true)
+                        placement.cancelReason = AssocCancel::overlapSystem;
+                }
             }
-            // update the temporary coordinates for both complexes
-            for (auto& mp : reactCom1.memberList)
-                moleculeList[mp].update_association_coords(dtrans);
-            for (auto& mp : reactCom2.memberList)
-                moleculeList[mp].update_association_coords(dtrans);
-        } //is on membrane
-
-        Coord afterBackCOM1;
-        com_of_two_tmp_complexes(reactCom1, reactCom1, afterBackCOM1, moleculeList);
-        Coord afterBackCOM2;
-        com_of_two_tmp_complexes(reactCom2, reactCom2, afterBackCOM2, moleculeList);
-
-        // std::cout << "Diplace during back to membrane, ignoring trans and rot shift: " << std::endl;
-        // std::cout << "COM1: " << std::endl;
-        // std::cout << sqrt((afterOrientationCOM1.x - afterBackCOM1.x) * (afterOrientationCOM1.x - afterBackCOM1.x) + (afterOrientationCOM1.y - afterBackCOM1.y) * (afterOrientationCOM1.y - afterBackCOM1.y) + (afterOrientationCOM1.z - afterBackCOM1.z) * (afterOrientationCOM1.z - afterBackCOM1.z)) << std::endl;
-        // std::cout << "COM2: " << std::endl;
-        // std::cout << sqrt((afterOrientationCOM2.x - afterBackCOM2.x) * (afterOrientationCOM2.x - afterBackCOM2.x) + (afterOrientationCOM2.y - afterBackCOM2.y) * (afterOrientationCOM2.y - afterBackCOM2.y) + (afterOrientationCOM2.z - afterBackCOM2.z) * (afterOrientationCOM2.z - afterBackCOM2.z)) << std::endl;
-
-        // std::cout << " FINAL COORDS PRIOR TO OVERLAP CHECK  AND REFLECT OFF BOX: " << std::endl;
+        }
+        if (cancelAssoc)
+            return placement;
+        update_deferred_tmp_crds(reactCom1, moleculeList);
+        update_deferred_tmp_crds(reactCom2, moleculeList);
+    }
+
+    // std::cout << " FINAL COORDS PRIOR TO OVERLAP CHECK  AND REFLECT OFF BOX: " << std::endl;
+    // reactMol1.display_assoc_icoords("mol1");
+    // reactMol2.display_assoc_icoords("mol2");
+
+    std::array<double, 3> traj; //=new double[3];
+    for (int mm = 0; mm < 3; mm++)
+        traj[mm] = 0;
+
+    /* This needs to evaluate the traj update, based on it initially being zero.
+       And here, it should be called based on the tmpCoords, not the full coordinates.
+       also requires updating the COM of this temporary new position */
+    update_complex_tmp_com_crds(reactCom1, moleculeList);
+    update_complex_tmp_com_crds(reactCom2, moleculeList);
+
+    reflect_traj_tmp_crds_box(params, moleculeList, reactCom1, traj, membraneObject, 0.0); // uses tmpCoords to calculate traj.
+    reflect_traj_tmp_crds_box(params, moleculeList, reactCom2, traj, membraneObject, 0.0);
+
+    if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-15) {
+        // update the temporary coordinates for both complexes
+        Vector vtraj { traj[0], traj[1], traj[2] };
+        for (auto& mp : reactCom1.memberList)
+            moleculeList[mp].update_association_coords(vtraj);
+        for (auto& mp : reactCom2.memberList)
+            moleculeList[mp].update_association_coords(vtraj);
+
+        // std::cout << "CRDS after reflecting off of the BOX by " << traj[0] << ' ' << traj[1] << ' ' << traj[2]
+        //           << std::endl;
         // reactMol1.display_assoc_icoords("mol1");
         // reactMol2.display_assoc_icoords("mol2");
+    }
+    /*Calculate the angles swept out by the interface to COM vectors as a result of the displacement*/
+    calc_angular_displacement(ifaceIndex1, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, moleculeList);
 
-        std::array<double, 3> traj; //=new double[3];
-        for (int mm = 0; mm < 3; mm++)
-            traj[mm] = 0;
-
-        /* This needs to evaluate the traj update, based on it initially being zero.
-           And here, it should be called based on the tmpCoords, not the full coordinates.
-           also requires updating the COM of this temporary new position */
-        update_complex_tmp_com_crds(reactCom1, moleculeList);
-        update_complex_tmp_com_crds(reactCom2, moleculeList);
-
-        reflect_traj_tmp_crds(params, moleculeList, reactCom1, traj, membraneObject, 0.0); // uses tmpCoords to calculate traj.
-        reflect_traj_tmp_crds(params, moleculeList, reactCom2, traj, membraneObject, 0.0);
-
-        if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-15) {
-            // update the temporary coordinates for both complexes
-            Vector vtraj { traj[0], traj[1], traj[2] };
-            for (auto& mp : reactCom1.memberList)
-                moleculeList[mp].update_association_coords(vtraj);
-            for (auto& mp : reactCom2.memberList)
-                moleculeList[mp].update_association_coords(vtraj);
-
-            // std::cout << "CRDS after reflecting off of the BOX by " << traj[0] << ' ' << traj[1] << ' ' << traj[2]
-            //           << std::endl;
-            // reactMol1.display_assoc_icoords("mol1");
-            // reactMol2.display_assoc_icoords("mol2");
-        }
-        /*Calculate the angles swept out by the interface to COM vectors as a result of the displacement*/
-        calc_angular_displacement(ifaceIndex1, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, moleculeList);
-
-        /* CHECKS AFTER ASSOCIATION FOR STERIC COLLISIONS, FOR EXPANDING BEYOND THE BOX SIZE
-           OR FOR MOVING PROTEINS A LARGE DISTANCE DUE TO SNAPPING INTO PLACE */
-        bool cancelAssoc { false };
+    /* CHECKS AFTER ASSOCIATION FOR STERIC COLLISIONS, FOR EXPANDING BEYOND THE BOX SIZE
+       OR FOR MOVING PROTEINS A LARGE DISTANCE DUE TO SNAPPING INTO PLACE */
+    if (checkedOverlap == false)
         check_for_structure_overlap(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList);
-        if (cancelAssoc == false) {
-            check_if_spans_box(cancelAssoc, params, reactCom1, reactCom2, moleculeList, membraneObject);
-            if (cancelAssoc == true)
-                counterArrays.nCancelSpanBox++;
-        } else
-            counterArrays.nCancelOverlapPartner++; //true for structure overlap check.
-        if (cancelAssoc == false) {
-            check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
-            if (cancelAssoc == true)
-                counterArrays.nCancelOverlapSystem++;
-        }
-        if (cancelAssoc == false) {
-            measure_complex_displacement(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList);
-            if (cancelAssoc == true) {
-                if (isOnMembrane)
-                    counterArrays.nCancelDisplace2D++;
-                else if (transitionToSurface)
-                    counterArrays.nCancelDisplace3Dto2D++;
-                else
-                    counterArrays.nCancelDisplace3D++;
-            }
+    if (cancelAssoc == false) {
+        check_if_spans_box(cancelAssoc, params, reactCom1, reactCom2, moleculeList, membraneObject);
+        if (cancelAssoc == true)
+            placement.cancelReason = AssocCancel::spanBox;
+    } else
+        placement.cancelReason = AssocCancel::overlapPartner; //true for structure overlap check.
+    if (cancelAssoc == false && checkedOverlap == false) {
+        placement.checkedSystem = true;
+        check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
+        if (cancelAssoc == true)
+            placement.cancelReason = AssocCancel::overlapSystem;
+    }
+    if (cancelAssoc == false) {
+        measure_complex_displacement(cancelAssoc, reactCom1, reactCom2, moleculeList, params, molTemplateList, complexList, membraneObject);
+        if (cancelAssoc == true) {
+            if (isOnMembrane)
+                placement.cancelReason = AssocCancel::displace2D;
+            else if (transitionToSurface)
+                placement.cancelReason = AssocCancel::displace3Dto2D;
+            else
+                placement.cancelReason = AssocCancel::displace3D;
         }
+    }
+    return placement;
+}
 
-        if (cancelAssoc) {
+void commit_association_box(const AssocPlacement& placement, int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1,
+    Molecule& reactMol2, Complex& reactCom1, Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn,
+    std::vector<Molecule>& moleculeList, std::vector<MolTemplate>& molTemplateList,
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, SimulContext& context)
+{
+    if (reactCom1.index == reactCom2.index) {
+        // skip to protein interation updates
+        // std::cout << "Closing a loop, no rotations performed.\n";
+        counterArrays.nLoops++;
+        // update the Molecule's TrajStatus (this is done in the else, when Molecules are rotated but not otherwise)
+        for (auto& memMol : reactCom1.memberList)
+            moleculeList[memMol].trajStatus = TrajStatus::associated;
+    } else { //not in the same complex
+        if (placement.cancelReason != AssocCancel::none) {
             // std::cout << "Canceling association, returning complexes to original state.\n";
-            for (auto memMol : reactCom1.memberList)
-                moleculeList[memMol].clear_tmp_association_coords();
-            for (auto memMol : reactCom2.memberList)
-                moleculeList[memMol].clear_tmp_association_coords();
+            count_association_cancel(placement.cancelReason, counterArrays);
+            clear_tmp_crds(reactCom1, moleculeList);
+            clear_tmp_crds(reactCom2, moleculeList);
             //end routine here!
             return;
         }
         counterArrays.nAssocSuccess++; //keep track of total number of successful association moves.
         /*Keep track of the sizes of complexes that associated*/
-        track_association_events(reactCom1, reactCom2, transitionToSurface, isOnMembrane, counterArrays);
+        track_association_events(reactCom1, reactCom2, placement.transitionToSurface, placement.isOnMembrane, counterArrays);
 
         //else if cancelAssoc==false, write temporary to real coords and clear temporary coordinates
         for (auto memMol : reactCom1.memberList) {
@@ -508,6 +514,7 @@ void associate_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecu
             for (unsigned int i { 0 }; i < moleculeList[memMol].interfaceList.size(); ++i)
                 moleculeList[memMol].interfaceList[i].coord = moleculeList[memMol].tmpICoords[i];
             moleculeList[memMol].clear_tmp_association_coords();
+            moleculeList[memMol].imageOffset = moleculeList[memMol].imageOffset - placement.imageShift2;
             if (currRxn.rxnType != ReactionType::biMolStateChange) {
                 moleculeList[memMol].myComIndex = reactCom1.index; // update their complex index
                 reactCom1.memberList.push_back(memMol);
@@ -517,11 +524,11 @@ void associate_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecu
 
         // update complexes
         reactCom2.memberList.clear(); // clear the member list so the molecules don't get destroyed
-        reactCom2.destroy(moleculeList, complexList); // destroy the complex
+        reactCom2.destroy(moleculeList, complexList, context); // destroy the complex
         reactCom1.update_properties(moleculeList, molTemplateList); // recalculate the properties of the first complex
 
         // Enforce boundary conditions
-        reflect_complex_rad_rot(membraneObject, reactCom1, moleculeList, 0.0);
+        reflect_complex_rad_rot_box(membraneObject, reactCom1, moleculeList, 0.0);
     } // end of if these molecules are closing a loop or not.
 
     //------------------------START UPDATE MONOMERLIST-------------------------
@@ -658,3 +665,16 @@ void associate_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecu
             ++obsItr->second;
     }
 }
+
+void associate_box(int ifaceIndex1, int ifaceIndex2, Molecule& reactMol1, Molecule& reactMol2, Complex& reactCom1,
+    Complex& reactCom2, const Parameters& params, ForwardRxn& currRxn, std::vector<Molecule>& moleculeList,
+    std::vector<MolTemplate>& molTemplateList,
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, std::vector<Complex>& complexList, Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, SimulContext& context)
+{
+    AssocPlacement placement {};
+    if (reactCom1.index != reactCom2.index)
+        placement = place_association_box(ifaceIndex1, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, params,
+            currRxn, moleculeList, molTemplateList, complexList, membraneObject, forwardRxns, backRxns, context);
+    commit_association_box(placement, ifaceIndex1, ifaceIndex2, reactMol1, reactMol2, reactCom1, reactCom2, params,
+        currRxn, moleculeList, molTemplateList, observablesList, counterArrays, complexList, membraneObject, context);
+}
@@ -15,7 +15,7 @@ void associate_sphere(
     std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList,
     copyCounters& counterArrays, std::vector<Complex>& complexList,
     Membrane& membraneObject, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns)
+    const std::vector<BackRxn>& backRxns, SimulContext& context)
 {
     // TRACE();
     if (reactCom1.index == reactCom2.index) {
@@ -28,7 +28,7 @@ void associate_sphere(
             moleculeList[memMol].trajStatus = TrajStatus::associated;
     } else { // not in the same complex
         if (reactMol2.isImplicitLipid == true || reactMol1.isImplicitLipid == true) {
-            std::cout << "WRONG: implicit-lipid binding involves wrong function file. associate_ImplicitLipid_sphere should be called instead of associate_sphere!" << std::endl;
+            context.log << "WRONG: implicit-lipid binding involves wrong function file. associate_ImplicitLipid_sphere should be called instead of associate_sphere!" << std::endl;
             exit(1);
         }
         // set up temporary coordinates
@@ -297,7 +297,7 @@ void associate_sphere(
             dtrans.x = startCOM.x - finalCOM.x;
             dtrans.y = startCOM.y - finalCOM.y;
             dtrans.z = startCOM.z - finalCOM.z;
-            std::cout << "TRANSLATE COMPLEX PAIR TO ORIG COM BY SHIFTING: "
+            context.log << "TRANSLATE COMPLEX PAIR TO ORIG COM BY SHIFTING: "
                       << dtrans.x << ' ' << dtrans.y << ' ' << dtrans.z
                       << std::endl; // update the temporary coordinates for both complexes
             for (auto& mp : reactCom1.memberList)
@@ -324,8 +324,8 @@ void associate_sphere(
         update_complex_tmp_com_crds(reactCom1, moleculeList);
         update_complex_tmp_com_crds(reactCom2, moleculeList);
 
-        reflect_traj_tmp_crds(params, moleculeList, reactCom1, traj, membraneObject, 0.0); // uses tmpCoords to calculate traj.
-        reflect_traj_tmp_crds(params, moleculeList, reactCom2, traj, membraneObject, 0.0);
+        reflect_traj_tmp_crds_sphere(params, moleculeList, reactCom1, traj, membraneObject, 0.0); // uses tmpCoords to calculate traj.
+        reflect_traj_tmp_crds_sphere(params, moleculeList, reactCom2, traj, membraneObject, 0.0);
 
         if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-15) {
             // update the temporary coordinates for both complexes
@@ -360,14 +360,14 @@ void associate_sphere(
         if (cancelAssoc == false) {
             check_for_structure_overlap_system(cancelAssoc, reactCom1, reactCom2,
                 moleculeList, params, molTemplateList,
-                complexList, forwardRxns, backRxns);
+                complexList, forwardRxns, backRxns, membraneObject, context);
             if (cancelAssoc == true)
                 counterArrays.nCancelOverlapSystem++;
         }
         if (cancelAssoc == false) {
             measure_complex_displacement(cancelAssoc, reactCom1, reactCom2,
                 moleculeList, params, molTemplateList,
-                complexList);
+                complexList, membraneObject);
             if (cancelAssoc == true) {
                 if (isOnMembrane)
                     counterArrays.nCancelDisplace2D++;
@@ -415,11 +415,11 @@ void associate_sphere(
 
         // update complexes
         reactCom2.memberList.clear(); // clear the member list so the molecules don't get destroyed
-        reactCom2.destroy(moleculeList, complexList); // destroy the complex
+        reactCom2.destroy(moleculeList, complexList, context); // destroy the complex
         reactCom1.update_properties(moleculeList, molTemplateList); // recalculate the properties of the first complex
 
         // Enforce boundary conditions
-        reflect_complex_rad_rot(membraneObject, reactCom1, moleculeList, 0.0);
+        reflect_complex_rad_rot_sphere(membraneObject, reactCom1, moleculeList, 0.0);
 
     } // end of if these molecules are closing a loop or not.
     //------------------------START UPDATE MONOMERLIST-------------------------
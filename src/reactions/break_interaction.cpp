@@ -3,19 +3,19 @@
 
 bool break_interaction(size_t relIface1, size_t relIface2, Molecule& reactMol1, Molecule& reactMol2,
     const BackRxn& currRxn, std::vector<Molecule>& moleculeList,
-    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, int ILindexMol)
+    std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList, int ILindexMol, SimulContext& context)
 {
     // TRACE();
     bool breakLinkComplex { false };
     unsigned newComIndex = complexList.size();
-    // std::cout << "empty complexes: " << Complex::emptyComList.size() << "\nMembers:";
-    // for (auto com : Complex::emptyComList)
+    // std::cout << "empty complexes: " << context.emptyComList.size() << "\nMembers:";
+    // for (auto com : context.emptyComList)
     //     std::cout << ' ' << com;
     // std::cout << '\n';
-    if (Complex::emptyComList.size() != 0 && complexList[Complex::emptyComList.back()].isEmpty) {
+    if (context.emptyComList.size() != 0 && complexList[context.emptyComList.back()].isEmpty) {
         // if there is an empty complex slot, make the new Complex in it
-        newComIndex = Complex::emptyComList.back();
-        Complex::emptyComList.pop_back(); // remove the index from the list
+        newComIndex = context.emptyComList.back();
+        context.emptyComList.pop_back(); // remove the index from the list
     } else {
         // if we're making a new Complex, create an empty one at the end (index complexList.size())
         complexList.emplace_back();
@@ -48,22 +48,22 @@ bool break_interaction(size_t relIface1, size_t relIface2, Molecule& reactMol1,
             absIface2 = currRxn.productListNew[0].absIfaceIndex;
             absIface1 = currRxn.productListNew[1].absIfaceIndex;
         } else {
-            std::cout << " IN BREAK INTERACTION, DID NOT MATCH protein, interface, and state of a product to Mol1 " << reactMol1.index << std::endl;
-            std::cout << "reactMol1.molTypeIndex: " << reactMol1.molTypeIndex << std::endl;
-            std::cout << "currRxn.productListNew[0].molTypeIndex: " << currRxn.productListNew[0].molTypeIndex << std::endl;
-            std::cout << "currRxn.productListNew[1].molTypeIndex: " << currRxn.productListNew[1].molTypeIndex << std::endl;
-            std::cout << "reactMol1.molTypeIndex == currRxn.productListNew[0].molTypeIndex: " << (reactMol1.molTypeIndex == currRxn.productListNew[0].molTypeIndex) << std::endl;
-            std::cout << "reactMol1.molTypeIndex == currRxn.productListNew[1].molTypeIndex: " << (reactMol1.molTypeIndex == currRxn.productListNew[1].molTypeIndex) << std::endl;
-            std::cout << "relIface1: " << relIface1 << std::endl;
-            std::cout << "currRxn.productListNew[0].relIfaceIndex: " << currRxn.productListNew[0].relIfaceIndex << std::endl;
-            std::cout << "currRxn.productListNew[1].relIfaceIndex: " << currRxn.productListNew[1].relIfaceIndex << std::endl;
-            std::cout << "relIface1 == currRxn.productListNew[0].relIfaceIndex: " << (relIface1 == currRxn.productListNew[0].relIfaceIndex) << std::endl;
-            std::cout << "relIface1 == currRxn.productListNew[1].relIfaceIndex: " << (relIface1 == currRxn.productListNew[1].relIfaceIndex) << std::endl;
-            std::cout << "currRxn.productListNew[0].requiresState: " << currRxn.productListNew[0].requiresState << std::endl;
-            std::cout << "currRxn.productListNew[1].requiresState: " << currRxn.productListNew[1].requiresState << std::endl;
-            std::cout << "reactMol1.interfaceList[relIface1].stateIden: " << reactMol1.interfaceList[relIface1].stateIden << std::endl;
-            std::cout << "currRxn.productListNew[0].requiresState == reactMol1.interfaceList[relIface1].stateIden: " << (currRxn.productListNew[0].requiresState == reactMol1.interfaceList[relIface1].stateIden) << std::endl;
-            std::cout << "currRxn.productListNew[1].requiresState == reactMol1.interfaceList[relIface1].stateIden: " << (currRxn.productListNew[1].requiresState == reactMol1.interfaceList[relIface1].stateIden) << std::endl;
+            context.log << " IN BREAK INTERACTION, DID NOT MATCH protein, interface, and state of a product to Mol1 " << reactMol1.index << std::endl;
+            context.log << "reactMol1.molTypeIndex: " << reactMol1.molTypeIndex << std::endl;
+            context.log << "currRxn.productListNew[0].molTypeIndex: " << currRxn.productListNew[0].molTypeIndex << std::endl;
+            context.log << "currRxn.productListNew[1].molTypeIndex: " << currRxn.productListNew[1].molTypeIndex << std::endl;
+            context.log << "reactMol1.molTypeIndex == currRxn.productListNew[0].molTypeIndex: " << (reactMol1.molTypeIndex == currRxn.productListNew[0].molTypeIndex) << std::endl;
+            context.log << "reactMol1.molTypeIndex == currRxn.productListNew[1].molTypeIndex: " << (reactMol1.molTypeIndex == currRxn.productListNew[1].molTypeIndex) << std::endl;
+            context.log << "relIface1: " << relIface1 << std::endl;
+            context.log << "currRxn.productListNew[0].relIfaceIndex: " << currRxn.productListNew[0].relIfaceIndex << std::endl;
+            context.log << "currRxn.productListNew[1].relIfaceIndex: " << currRxn.productListNew[1].relIfaceIndex << std::endl;
+            context.log << "relIface1 == currRxn.productListNew[0].relIfaceIndex: " << (relIface1 == currRxn.productListNew[0].relIfaceIndex) << std::endl;
+            context.log << "relIface1 == currRxn.productListNew[1].relIfaceIndex: " << (relIface1 == currRxn.productListNew[1].relIfaceIndex) << std::endl;
+            context.log << "currRxn.productListNew[0].requiresState: " << currRxn.productListNew[0].requiresState << std::endl;
+            context.log << "currRxn.productListNew[1].requiresState: " << currRxn.productListNew[1].requiresState << std::endl;
+            context.log << "reactMol1.interfaceList[relIface1].stateIden: " << reactMol1.interfaceList[relIface1].stateIden << std::endl;
+            context.log << "currRxn.productListNew[0].requiresState == reactMol1.interfaceList[relIface1].stateIden: " << (currRxn.productListNew[0].requiresState == reactMol1.interfaceList[relIface1].stateIden) << std::endl;
+            context.log << "currRxn.productListNew[1].requiresState == reactMol1.interfaceList[relIface1].stateIden: " << (currRxn.productListNew[1].requiresState == reactMol1.interfaceList[relIface1].stateIden) << std::endl;
             exit(1);
         }
     }
@@ -117,10 +117,12 @@ bool break_interaction(size_t relIface1, size_t relIface2, Molecule& reactMol1,
         if (reactMol2.isImplicitLipid == false) {
             complexList[reactMol2.myComIndex].update_properties(moleculeList, molTemplateList);
             complexList[reactMol2.myComIndex].isEmpty = false;
+            // the released part skipped the same steps as the rest of the Complex
+            complexList[reactMol2.myComIndex].numDormantSteps = complexList[reactMol1.myComIndex].numDormantSteps;
         }
 
-        ++Complex::numberOfComplexes;
-        // std::cout << "new number of complexes: " << Complex::numberOfComplexes << '\n';
+        ++context.numberOfComplexes;
+        // std::cout << "new number of complexes: " << context.numberOfComplexes << '\n';
         // std::cout << "New Complexes:\n";
         // std::cout << "\tComplex " << reactMol1.myComIndex << " of " << complexList[reactMol1.myComIndex].memberList.size() << " molecules.\n";
         // std::cout << "\t\tMembers:";
@@ -149,7 +151,7 @@ bool break_interaction(size_t relIface1, size_t relIface2, Molecule& reactMol1,
         if (newComIndex + 1 == complexList.size())
             complexList.pop_back();
         else
-            Complex::emptyComList.push_back(newComIndex);
+            context.emptyComList.push_back(newComIndex);
     }
     //------------------------START UPDATE MONOMERLIST-------------------------
     // update oneTemp.monomerList when oneTemp.canDestroy is true and mol is monomer, add to monomerList if new monomer produced
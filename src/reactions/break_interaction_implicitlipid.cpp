@@ -28,7 +28,7 @@ void break_interaction_implicitlipid(size_t relIface1, size_t relIface2, Molecul
             absIface2 = currRxn.productListNew[0].absIfaceIndex;
             absIface1 = currRxn.productListNew[1].absIfaceIndex;
         } else {
-            std::cout << " IN BREAK INTERACTION, DID NOT MATCH protein, interface, and state of a product to Mol1 " << reactMol1.index << std::endl;
+            std::cerr << " IN BREAK INTERACTION, DID NOT MATCH protein, interface, and state of a product to Mol1 " << reactMol1.index << std::endl;
             exit(1);
         }
     }
@@ -2,22 +2,24 @@
 #include "tracing.hpp"
 
 double calculate_omega(Coord reactIface1, int reactIface2, Vector& sigma,
-    const ForwardRxn& currRxn, Molecule reactMol1, Molecule reactMol2, const std::vector<MolTemplate>& molTemplateList)
+    const ForwardRxn& currRxn, const Molecule& reactMol1, const Molecule& reactMol2, const std::vector<MolTemplate>& molTemplateList)
 {
     // TRACE();
     /*Re-aligns the molecules so that Sigma faces purely along the z-axis. 
      */
-    transform(reactIface1, reactMol1, reactMol2, sigma);
+    MolGeometry mol1 { tmp_geometry(reactMol1) };
+    MolGeometry mol2 { tmp_geometry(reactMol2) };
+    transform(reactIface1, mol1, mol2, sigma);
 
     Vector v1 {};
     Vector v2 {};
 
     if (areSameAngle(currRxn.assocAngles.theta1, M_PI) || areSameAngle(currRxn.assocAngles.theta2, M_PI)) {
-        v1 = determine_normal(currRxn.norm1, molTemplateList[reactMol1.molTypeIndex], reactMol1);
-        v2 = determine_normal(currRxn.norm2, molTemplateList[reactMol2.molTypeIndex], reactMol2);
+        v1 = determine_normal(currRxn.norm1, molTemplateList[reactMol1.molTypeIndex], std::move(mol1));
+        v2 = determine_normal(currRxn.norm2, molTemplateList[reactMol2.molTypeIndex], std::move(mol2));
     } else {
-        v1 = Vector(reactIface1 - reactMol1.tmpComCoord);
-        v2 = Vector(reactMol2.tmpICoords[reactIface2] - reactMol2.tmpComCoord);
+        v1 = Vector(reactIface1 - mol1.comCoord);
+        v2 = Vector(mol2.iCoords[reactIface2] - mol2.comCoord);
     }
 
     Vector projVec1 { v1.x, v1.y, 0 };
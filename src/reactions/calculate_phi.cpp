@@ -1,16 +1,18 @@
 #include "reactions/association/association.hpp"
 #include "tracing.hpp"
 
-double calculate_phi(Coord reactIface1, int ifaceIndex2, Molecule reactMol1, Molecule reactMol2, const Vector& normal,
+double calculate_phi(Coord reactIface1, int ifaceIndex2, const Molecule& reactMol1, const Molecule& reactMol2, const Vector& normal,
     Vector axis, const ForwardRxn& currRxn, const std::vector<MolTemplate>& molTemplateList)
 {
     // TRACE();
     // coordinate transform along com-iface vector
-    transform(reactIface1, reactMol1, reactMol2, axis);
+    MolGeometry mol1 { tmp_geometry(reactMol1) };
+    MolGeometry mol2 { tmp_geometry(reactMol2) };
+    transform(reactIface1, mol1, mol2, axis);
 
     // orthographic projection onto xy-plane
-    Vector vec1 { reactIface1 - reactMol2.tmpICoords[ifaceIndex2] }; //iface1-iface2= sigma
-    Vector vec2 { determine_normal(normal, molTemplateList[reactMol1.molTypeIndex], reactMol1) };
+    Vector vec1 { reactIface1 - mol2.iCoords[ifaceIndex2] }; //iface1-iface2= sigma
+    Vector vec2 { determine_normal(normal, molTemplateList[reactMol1.molTypeIndex], std::move(mol1)) };
 
     // remove z coordinates
     Vector projVec1 { vec1.x, vec1.y, 0 }; //sigma vector
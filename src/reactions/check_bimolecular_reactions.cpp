@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "math/rand_gsl.hpp"
 #include "reactions/bimolecular/bimolecular_reactions.hpp"
 #include "reactions/implicitlipid/implicitlipid_reactions.hpp"
@@ -8,18 +9,19 @@
 
 void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, double* tableIDs, unsigned& DDTableIndex,
     const Parameters& params, std::vector<gsl_matrix*>& normMatrices, std::vector<gsl_matrix*>& survMatrices,
-    std::vector<gsl_matrix*>& pirMatrices, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject)
+    std::vector<gsl_matrix*>& pirMatrices, std::mutex& tableMutex, std::vector<Molecule>& moleculeList,
+    std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList,
+    const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns, copyCounters& counterArrays,
+    Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     //  int track1 = 143;
     //int track2= 182;
     int pro1MolType = moleculeList[pro1Index].molTypeIndex;
     /* if(pro1Index== track1)
-       std::cout <<"In check bimolecular Reaction for protein track1 !"<<track1<<" to  "<<pro2Index<<"mytype: "<<pro1MolType<<" pro2type: "<<moleculeList[pro2Index].molTypeIndex<<std::endl;
+       context.log <<"In check bimolecular Reaction for protein track1 !"<<track1<<" to  "<<pro2Index<<"mytype: "<<pro1MolType<<" pro2type: "<<moleculeList[pro2Index].molTypeIndex<<std::endl;
      if(pro1Index== track2)
-       std::cout <<"In check bimolecular Reaction for protein track2 !" <<track2<< " to "<<pro2Index<<" mytype: "<<pro1MolType<<" pro2type: "<<moleculeList[pro2Index].molTypeIndex<<std::endl;
+       context.log <<"In check bimolecular Reaction for protein track2 !" <<track2<< " to "<<pro2Index<<" mytype: "<<pro1MolType<<" pro2type: "<<moleculeList[pro2Index].molTypeIndex<<std::endl;
     */
     bool canInteract { false };
     for (auto partner : molTemplateList[pro1MolType].rxnPartners) {
@@ -35,12 +37,21 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
             canInteract = false;
     }
 
+    // loops within a Complex with a ClosureIndex are found from its free interfaces, see check_binding_within_complex
+    if (canInteract && moleculeList[pro1Index].myComIndex == moleculeList[pro2Index].myComIndex
+        && complexList[moleculeList[pro1Index].myComIndex].hasClosureIndex)
+        canInteract = false;
+
     bool canExclude { false };
     if ((moleculeList[pro1Index].bndlist.size() > 0 && molTemplateList[moleculeList[pro1Index].molTypeIndex].excludeVolumeBound == true)
         || (moleculeList[pro2Index].bndlist.size() > 0 && molTemplateList[moleculeList[pro2Index].molTypeIndex].excludeVolumeBound == true)) {
         canExclude = true;
     }
 
+    // a fully bound Molecule has nothing to bind, and nothing to keep apart unless its bound interfaces exclude volume
+    if ((moleculeList[pro1Index].freelist.empty() || moleculeList[pro2Index].freelist.empty()) && canExclude == false)
+        return;
+
     // If this pair of proteins are already bound together, don't test for binding OR overlap
     if (canInteract) {
         /*If this pair of proteins are already bound together, don't test for binding OR overlap, set canInteract=0*/
@@ -68,9 +79,9 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
     if (canInteract) {
         /* CALCULATE ASSOCIATION PROBABILITIES */
         /* if(pro1Index== track1)
- 	    std::cout <<" calculate Association prob to ! "<<pro2Index<<std::endl;
+ 	    context.log <<" calculate Association prob to ! "<<pro2Index<<std::endl;
  	if(pro1Index== track2)
- 	    std::cout <<" calculate Association prob to ! "<<pro2Index<<std::endl;
+ 	    context.log <<" calculate Association prob to ! "<<pro2Index<<std::endl;
       */
         for (int relIface1Itr { 0 }; relIface1Itr < moleculeList[pro1Index].freelist.size(); ++relIface1Itr) {
             /*test all of i1's binding partners to see whether they are on protein pro2 */
@@ -91,9 +102,9 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
 
                     if (absIface2 == statePartner) { // both binding interfaces are available!
                         /*if(pro1Index== track1)
-			std::cout <<" Both Ifaces available! "<<pro2Index<<" abs1: "<<absIface1<<" abs2: "<<absIface2<<std::endl;
+			context.log <<" Both Ifaces available! "<<pro2Index<<" abs1: "<<absIface1<<" abs2: "<<absIface2<<std::endl;
 		      if(pro1Index== track2)
-			std::cout <<" Both Ifaces available!! "<<pro2Index<<" abs1: "<<absIface1<<" abs2: "<<absIface2<<std::endl;
+			context.log <<" Both Ifaces available!! "<<pro2Index<<" abs1: "<<absIface1<<" abs2: "<<absIface2<<std::endl;
 		      */
                         /*Here now we evaluate the probability of binding*/
                         /*Different interfaces can have different diffusion constants if they
@@ -109,7 +120,7 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
                         bool isStateChangeBackRxn { false };
 
                         find_which_reaction(relIface1, relIface2, rxnIndex, rateIndex, isStateChangeBackRxn, state,
-                            moleculeList[pro1Index], moleculeList[pro2Index], forwardRxns, backRxns, molTemplateList);
+                            moleculeList[pro1Index], moleculeList[pro2Index], forwardRxns, backRxns, molTemplateList, context);
                         if (rxnIndex != -1 && rateIndex != -1) {
                             //int com1Index { moleculeList[pro1Index].myComIndex };
                             //int com2Index { moleculeList[pro2Index].myComIndex };
@@ -141,7 +152,8 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
 
                                     determine_2D_bimolecular_reaction_probability(simItr, rxnIndex, rateIndex,
                                         isStateChangeBackRxn, DDTableIndex, tableIDs, biMolData, params, moleculeList,
-                                        complexList, forwardRxns, backRxns, membraneObject, normMatrices, survMatrices, pirMatrices);
+                                        complexList, forwardRxns, backRxns, membraneObject, normMatrices, survMatrices, pirMatrices,
+                                        tableMutex);
                                 } else {
                                     //3D reaction
                                     double Dtot = 1.0 / 3.0 * (complexList[moleculeList[pro1Index].myComIndex].D.x + complexList[moleculeList[pro2Index].myComIndex].D.x)
@@ -263,6 +275,8 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
                                                             && std::abs(complexList[moleculeList[pro2Index].myComIndex].D.z - 0) < 1E-10)
                                                     ? 0
                                                     : moleculeList[pro1Index].interfaceList[relIface1].coord.z - moleculeList[pro2Index].interfaceList[relIface2].coord.z };
+                                            if (moleculeList[pro1Index].myComIndex != moleculeList[pro2Index].myComIndex) // a Complex is kept whole
+                                                minimum_image(dx, dy, dz, membraneObject);
                                             R1 = sqrt((dx * dx) + (dy * dy) + (dz * dz));
                                         }
                                         if (R1 < RMax * 10.0) {
@@ -318,6 +332,8 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
                                                         && std::abs(complexList[moleculeList[pro2Index].myComIndex].D.z - 0) < 1E-10)
                                                 ? 0
                                                 : moleculeList[pro1Index].interfaceList[relIface1].coord.z - moleculeList[pro2Index].interfaceList[relIface2].coord.z };
+                                        if (moleculeList[pro1Index].myComIndex != moleculeList[pro2Index].myComIndex) // a Complex is kept whole
+                                            minimum_image(dx, dy, dz, membraneObject);
                                         R1 = sqrt((dx * dx) + (dy * dy) + (dz * dz));
                                         if (R1 < RMax) {
                                             moleculeList[pro1Index].crossbase.push_back(pro2Index);
@@ -440,6 +456,8 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
                                                             && std::abs(complexList[moleculeList[pro2Index].myComIndex].D.z - 0) < 1E-10)
                                                     ? 0
                                                     : moleculeList[pro1Index].interfaceList[relIface1].coord.z - moleculeList[pro2Index].interfaceList[relIface2].coord.z };
+                                            if (moleculeList[pro1Index].myComIndex != moleculeList[pro2Index].myComIndex) // a Complex is kept whole
+                                                minimum_image(dx, dy, dz, membraneObject);
                                             R1 = sqrt((dx * dx) + (dy * dy) + (dz * dz));
                                         }
                                         if (R1 < RMax * 10.0) {
@@ -495,6 +513,8 @@ void check_bimolecular_reactions(int pro1Index, int pro2Index, int simItr, doubl
                                                         && std::abs(complexList[moleculeList[pro2Index].myComIndex].D.z - 0) < 1E-10)
                                                 ? 0
                                                 : moleculeList[pro1Index].interfaceList[relIface1].coord.z - moleculeList[pro2Index].interfaceList[relIface2].coord.z };
+                                        if (moleculeList[pro1Index].myComIndex != moleculeList[pro2Index].myComIndex) // a Complex is kept whole
+                                            minimum_image(dx, dy, dz, membraneObject);
                                         R1 = sqrt((dx * dx) + (dy * dy) + (dz * dz));
                                         if (R1 < RMax) {
                                             moleculeList[pro1Index].crossbase.push_back(pro2Index);
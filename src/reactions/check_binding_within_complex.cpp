@@ -0,0 +1,42 @@
+#include "reactions/bimolecular/bimolecular_reactions.hpp"
+#include "reactions/shared_reaction_functions.hpp"
+
+#include <algorithm>
+
+void check_binding_within_complex(int pro1Index, int pro2Index, int relIface1, int relIface2, const Parameters& params,
+    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
+    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context)
+{
+    Molecule& pro1 = moleculeList[pro1Index];
+    Molecule& pro2 = moleculeList[pro2Index];
+    const MolTemplate& pro1Template = molTemplateList[pro1.molTypeIndex];
+
+    // the same tests as check_bimolecular_reactions, for whether the two Molecules can interact
+    if (pro2.isImplicitLipid
+        || std::find(pro1Template.rxnPartners.begin(), pro1Template.rxnPartners.end(), pro2.molTypeIndex)
+            == pro1Template.rxnPartners.end())
+        return;
+    if (std::find(pro1.bndpartner.begin(), pro1.bndpartner.end(), pro2Index) != pro1.bndpartner.end()
+        && std::find(pro2.bndpartner.begin(), pro2.bndpartner.end(), pro1Index) != pro2.bndpartner.end())
+        return;
+
+    unsigned absIface2 { static_cast<unsigned>(pro2.interfaceList[relIface2].index) };
+    int stateIndex1 { pro1.interfaceList[relIface1].stateIndex };
+    const Interface::State& state { pro1Template.interfaceList[relIface1].stateList[stateIndex1] };
+    for (auto statePartner : state.rxnPartners) {
+        if (statePartner != absIface2)
+            continue;
+
+        int rxnIndex { -1 };
+        int rateIndex { -1 };
+        bool isStateChangeBackRxn { false };
+        find_which_reaction(relIface1, relIface2, rxnIndex, rateIndex, isStateChangeBackRxn, state, pro1, pro2,
+            forwardRxns, backRxns, molTemplateList, context);
+        if (rxnIndex != -1 && rateIndex != -1) {
+            evaluate_binding_within_complex(pro1Index, pro2Index, relIface1, relIface2, rxnIndex, rateIndex,
+                isStateChangeBackRxn, params, moleculeList, complexList, molTemplateList, forwardRxns[rxnIndex],
+                backRxns, membraneObject, counterArrays);
+        }
+    }
+}
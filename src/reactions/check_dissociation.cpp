@@ -11,7 +11,7 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
     std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, unsigned int molItr,
     std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, const std::vector<BackRxn>& backRxns, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<CreateDestructRxn>& createDestructRxns, copyCounters& counterArrays, const Membrane& membraneObject)
+    const std::vector<CreateDestructRxn>& createDestructRxns, copyCounters& counterArrays, const Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     for (int relIface1Itr { 0 }; relIface1Itr < moleculeList[molItr].bndlist.size(); ++relIface1Itr) {
@@ -62,9 +62,9 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                 if (params.debugParams.forceDissoc)
                     prob = 1.0;
 
-                double rnum = gsl_rng_uniform(r);
+                double rnum = gsl_rng_uniform(context.r);
                 if (prob > rnum) {
-                    double rnum2 { rnum + gsl_rng_uniform(r) * 1.0 / (gsl_rng_max(r) + 1.0) }; // to get higher resolution
+                    double rnum2 { rnum + gsl_rng_uniform(context.r) * 1.0 / (gsl_rng_max(context.r) + 1.0) }; // to get higher resolution
 
                     if (prob > rnum2) {
                         // std::cout << "Dissociation at iteration: " << simItr << " protein: " << molItr
@@ -76,10 +76,10 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                         the two interfaces are part of the same complex
                         */
 
-                        /*std::cout << "Complex members:";
+                        /*context.log << "Complex members:";
                         for (const auto& memMol : complexList[moleculeList[molItr].myComIndex].memberList)
-                            std::cout << ' ' << memMol;
-                        std::cout << '\n';
+                            context.log << ' ' << memMol;
+                        context.log << '\n';
 			*/
                         if (moleculeList[molItr].myComIndex != moleculeList[pro2Index].myComIndex) {
                             std::cerr << "ERROR: Molecules in different complexes are attempting to dissociate.\n";
@@ -87,7 +87,7 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                         }
                         bool breakLinkComplex
                             = break_interaction(relIface1, relIface2, moleculeList[molItr], moleculeList[pro2Index],
-                                backRxns[mu], moleculeList, complexList, molTemplateList, membraneObject.implicitlipidIndex);
+                                backRxns[mu], moleculeList, complexList, molTemplateList, membraneObject.implicitlipidIndex, context);
 
                         if (breakLinkComplex)
                             counterArrays.nLoops--;
@@ -128,9 +128,9 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                           Find out if A or B is being destroyed. or being state changed
                          */
                         if (backRxns[mu].isCoupled) {
-                            // double rnum = rand_gsl();
-                            // double rNum2 { rnum + rand_gsl() * Constants::iRandMax }; // to get higher resolution
-                            if (backRxns[mu].coupledRxn.probCoupled > rand_gsl()) {
+                            // double rnum = rand_gsl(context.r);
+                            // double rNum2 { rnum + rand_gsl(context.r) * Constants::iRandMax }; // to get higher resolution
+                            if (backRxns[mu].coupledRxn.probCoupled > rand_gsl(context.r)) {
                                 // std::cout << "PERFORMING Coupled RXN after Dissociation! probability: " << backRxns[mu].coupledRxn.probCoupled << "\n";
                                 if (backRxns[mu].coupledRxn.rxnType == ReactionType::destruction) {
                                     int destroyProIndex { -1 };
@@ -151,7 +151,7 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                                         }
                                     }
                                     complexList[moleculeList[destroyProIndex].myComIndex].destroy(moleculeList,
-                                        complexList); // destroying the entire complex that this molecule is a part of.
+                                        complexList, context); // destroying the entire complex that this molecule is a part of.
 
                                     // remove the molecule from the SimulVolume subsCellList
                                     // have this here to avoid circular header calls with SimulVolume and
@@ -217,7 +217,7 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                                         }
                                     }
                                     /*				if(stateChangeProIndex== 84 || stateChangeProIndex == 27){
-								std::cout <<"changing state on pro: "<<stateChangeProIndex<<" from relIndex: "<< relIndex<<" from state: "<<moleculeList[stateChangeProIndex].interfaceList[relIndex].stateIndex<<" identity: "<<moleculeList[stateChangeProIndex].interfaceList[relIndex].stateIden<<" size of stateList: "<<stateList.size()<<" New absIfaceIndex: "<<newState.absIfaceIndex<<" relStateIndex: "<<relStateIndex<<std::endl;
+								context.log <<"changing state on pro: "<<stateChangeProIndex<<" from relIndex: "<< relIndex<<" from state: "<<moleculeList[stateChangeProIndex].interfaceList[relIndex].stateIndex<<" identity: "<<moleculeList[stateChangeProIndex].interfaceList[relIndex].stateIden<<" size of stateList: "<<stateList.size()<<" New absIfaceIndex: "<<newState.absIfaceIndex<<" relStateIndex: "<<relStateIndex<<std::endl;
 								}*/
 
                                     // check observables
@@ -244,7 +244,7 @@ void check_dissociation(unsigned int simItr, const Parameters& params, SimulVolu
                                         relStateIndex, newState.absIfaceIndex, newState.requiresState);
 
                                     /*if(stateChangeProIndex== 21 || stateChangeProIndex == 27){
-				      std::cout <<" after state change: stateIndex "<<relStateIndex<<" index: "<<newState.absIfaceIndex<<" stateIden: "<<newState.requiresState<<std::endl;
+				      context.log <<" after state change: stateIndex "<<relStateIndex<<" index: "<<newState.absIfaceIndex<<" stateIden: "<<newState.requiresState<<std::endl;
 				      }*/
                                     moleculeList[stateChangeProIndex].trajStatus = TrajStatus::propagated;
                                     complexList[moleculeList[stateChangeProIndex].myComIndex].trajStatus = TrajStatus::propagated;
@@ -11,7 +11,7 @@ void check_dissociation_implicitlipid(unsigned int simItr, const Parameters& par
     std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, unsigned int molItr,
     std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, const std::vector<BackRxn>& backRxns, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<CreateDestructRxn>& createDestructRxns, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs)
+    const std::vector<CreateDestructRxn>& createDestructRxns, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs, SimulContext& context)
 {
     // TRACE();
     double Dtot;
@@ -177,9 +177,9 @@ void check_dissociation_implicitlipid(unsigned int simItr, const Parameters& par
                 }
             }
 
-            double rnum { gsl_rng_uniform(r) };
+            double rnum { gsl_rng_uniform(context.r) };
             if (prob > rnum) {
-                double rnum2 { rnum + gsl_rng_uniform(r) * 1.0 / (gsl_rng_max(r) + 1.0) }; // to get higher resolution
+                double rnum2 { rnum + gsl_rng_uniform(context.r) * 1.0 / (gsl_rng_max(context.r) + 1.0) }; // to get higher resolution
                 if (prob > rnum2) {
                     // std::cout << "Dissociation at iteration: " << simItr << " protein: " << molItr
                     //           << " from the membrane, with probability: " << prob << '\n';
@@ -187,10 +187,10 @@ void check_dissociation_implicitlipid(unsigned int simItr, const Parameters& par
                     //           << complexList[moleculeList[molItr].myComIndex].memberList.size() << " molecules\n";
                     // std::cout << " protein coords for : " << molItr << std::endl;
                     // moleculeList[molItr].display_my_coords("proteinonsurface");
-                    /*std::cout << "Complex members:";
+                    /*context.log << "Complex members:";
                         for (const auto& memMol : complexList[moleculeList[molItr].myComIndex].memberList)
-                            std::cout << ' ' << memMol;
-                        std::cout << '\n';
+                            context.log << ' ' << memMol;
+                        context.log << '\n';
 			*/
 
                     // 'break_interaction' frees certain protein and its interface
@@ -309,7 +309,7 @@ void check_dissociation_implicitlipid(unsigned int simItr, const Parameters& par
                                     }
                                 }
                                 complexList[moleculeList[destroyProIndex].myComIndex].destroy(moleculeList,
-                                    complexList); // destroying the entire complex that this molecule is a part of.
+                                    complexList, context); // destroying the entire complex that this molecule is a part of.
 
                                 // remove the molecule from the SimulVolume subsCellList
                                 // have this here to avoid circular header calls with SimulVolume and
@@ -1,8 +1,35 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "classes/class_Rxns.hpp"
 #include "reactions/association/association.hpp"
 #include "reactions/shared_reaction_functions.hpp"
 #include "tracing.hpp"
 
+namespace {
+/*Members whose interfaces haven't been moved yet, while associate_box defers their moves (see defer_tmp_crds), are
+  moved once they come close enough for their interfaces to be compared*/
+void ensure_tmp_ifaces(const Complex& reactCom, Molecule& oneMol)
+{
+    if (reactCom.deferredMolIndex != -1 && oneMol.tmpICoords.size() != oneMol.interfaceList.size())
+        update_deferred_tmp_crds(reactCom, oneMol);
+}
+}
+
+void tmp_bounding_sphere(const Complex& reactCom, const std::vector<Molecule>& moleculeList,
+    const std::vector<MolTemplate>& molTemplateList, Coord& center, double& radius)
+{
+    center.zero_crds();
+    for (auto& memMol : reactCom.memberList)
+        center += moleculeList[memMol].tmpComCoord;
+    double numMembers { double(reactCom.memberList.size()) };
+    center /= numMembers;
+    radius = 0;
+    for (auto& memMol : reactCom.memberList) {
+        Vector distVec { moleculeList[memMol].tmpComCoord - center };
+        distVec.calc_magnitude();
+        radius = std::max(radius, distVec.magnitude + molTemplateList[moleculeList[memMol].molTypeIndex].radius);
+    }
+}
+
 /*  Checks to see if the centers of masses of any of the molecules that are undergoing physical association
  * overlap with any of the other molecules in the system! Only checks molecules that are flagged with checkOverlap=1
  *
@@ -13,7 +40,8 @@
  */
 void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, const Complex& reactCom2,
     std::vector<Molecule>& moleculeList, const Parameters& params,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns)
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
+    const Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
 
@@ -36,6 +64,17 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
      the one it binds to.
     */
 
+    /*Bounding spheres of the two complexes at their new positions. A protein in complex c can only come within
+      overlapSepLimit, or within the sum of the two proteins' radii, of a protein in reactCom1 if the bounding
+      spheres of c and reactCom1 are no further apart than c.radius + radius1 + overlapSepLimit, so most complexes
+      are skipped without looking at their proteins*/
+    Coord center1 {};
+    Coord center2 {};
+    double radius1 { 0 };
+    double radius2 { 0 };
+    tmp_bounding_sphere(reactCom1, moleculeList, molTemplateList, center1, radius1);
+    tmp_bounding_sphere(reactCom2, moleculeList, molTemplateList, center2, radius2);
+
     /*No overlap between the two complexes found. But, now evaluate whether the new structure overlaps significantly
       with other structures that are in the simulation, as a result of large orientational changes*/
     for (int c = 0; c < complexList.size(); c++) {
@@ -44,6 +83,16 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
         if (!complexList[c].isEmpty) {
             if (c != reactCom1.index && c != reactCom2.index) {
                 // no self, and c1 vs c2 was done in check_for_structure_overlap()
+                Vector comVec1 { complexList[c].comCoord - center1 };
+                Vector comVec2 { complexList[c].comCoord - center2 };
+                minimum_image(comVec1, membraneObject);
+                minimum_image(comVec2, membraneObject);
+                comVec1.calc_magnitude();
+                comVec2.calc_magnitude();
+                bool nearCom1 { comVec1.magnitude < complexList[c].radius + radius1 + params.overlapSepLimit };
+                bool nearCom2 { comVec2.magnitude < complexList[c].radius + radius2 + params.overlapSepLimit };
+                if (!nearCom1 && !nearCom2)
+                    continue;
 
                 int sAll = complexList[c].memberList.size();
                 for (int i = 0; i < sAll; i++) {
@@ -58,7 +107,7 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
 
                         /*measure distance between the proteins in complex c and proteins in reactCom1 */
 
-                        for (j = 0; j < s1; j++) {
+                        for (j = 0; j < s1 && nearCom1; j++) {
                             mp = reactCom1.memberList[j]; // these are the newly rotated proteins.
                             if (molTemplateList[moleculeList[mp].molTypeIndex].checkOverlap) {
 
@@ -68,6 +117,7 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
                                     - ym; // for proteins that just associated, still use tmp coords
                                 dz = moleculeList[mp].tmpComCoord.z
                                     - zm; // for proteins that just associated, still use tmp coords
+                                minimum_image(dx, dy, dz, membraneObject);
                                 r2 = dx * dx + dy * dy + dz * dz;
                                 if (r2 < tol2) {
                                     flag = true;
@@ -90,8 +140,9 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
                                 if (r2 < molRadSq) {
                                     // The COMs are not close, but the binding interfaces might be. Check if these two
                                     // proteins have overlapping interfaces, not just COMs.
+                                    ensure_tmp_ifaces(reactCom1, moleculeList[mp]);
                                     //measure_overlap_free_protein_interfaces(moleculeList[pp], moleculeList[mp], flag, molTemplateList, forwardRxns, backRxns);
-                                    measure_overlap_protein_interfaces(moleculeList[pp], moleculeList[mp], flag); // first one is actual coords, second one is tempCoords.
+                                    measure_overlap_protein_interfaces(moleculeList[pp], moleculeList[mp], flag, membraneObject); // first one is actual coords, second one is tempCoords.
                                     if (flag == true) {
                                         // std::cout << " WARNING, CANCEL ASSOC: Protein iface in association overlaps protein in SYSTEM! " << mp
                                         //           << ' ' << pp << std::endl;
@@ -109,7 +160,7 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
 
                         /*measure distance between the proteins in complex c and proteins in reactCom2 */
 
-                        for (j = 0; j < s2; j++) {
+                        for (j = 0; j < s2 && nearCom2; j++) {
                             mp = reactCom2.memberList[j]; // these are the newly rotated proteins.
                             if (molTemplateList[moleculeList[mp].molTypeIndex].checkOverlap == 1) {
 
@@ -119,6 +170,7 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
                                     - ym; // for proteins that just associated, still use tmp coords
                                 dz = moleculeList[mp].tmpComCoord.z
                                     - zm; // for proteins that just associated, still use tmp coords
+                                minimum_image(dx, dy, dz, membraneObject);
                                 r2 = dx * dx + dy * dy + dz * dz;
                                 if (r2 < tol2) {
                                     flag = true;
@@ -142,7 +194,8 @@ void check_for_structure_overlap_system(bool& flag, const Complex& reactCom1, co
                                 if (r2 < molRadSq) {
                                     // The COMs are not close, but the binding interfaces might be. Check if these two
                                     // proteins have overlapping interfaces, not just COMs.
-                                    measure_overlap_free_protein_interfaces(moleculeList[pp], moleculeList[mp], flag, molTemplateList, forwardRxns, backRxns);
+                                    ensure_tmp_ifaces(reactCom2, moleculeList[mp]);
+                                    measure_overlap_free_protein_interfaces(moleculeList[pp], moleculeList[mp], flag, molTemplateList, forwardRxns, backRxns, membraneObject, context);
                                     //measure_overlap_protein_interfaces(moleculeList[pp], moleculeList[mp],flag); // first one is actual coords, second one is tempCoords.
                                     if (flag == true) {
                                         // std::cout << " WARNING, CANCEL ASSOC: Protein iface in association overlaps protein in SYSTEM! " << mp
@@ -9,7 +9,7 @@
 void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs)
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs, SimulContext& context)
 {
     // TRACE();
     // Note: cannot use a for-range or vector iterator loop here, since we are changing the moleculeList vector
@@ -55,9 +55,9 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                                             // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                                         }
 
-                                        if (prob > rand_gsl()) {
+                                        if (prob > rand_gsl(context.r)) {
                                             // to get higher resolution random numbers
-                                            // double rnum2 { rnum + rand_gsl() * Constants::iRandMax };
+                                            // double rnum2 { rnum + rand_gsl(context.r) * Constants::iRandMax };
 
                                             // if (prob > rnum2) {
                                             // std::cout << "State change at iteration " << simItr << ". Molecule "
@@ -139,9 +139,9 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                                         // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                                     }
 
-                                    if (prob > rand_gsl()) {
+                                    if (prob > rand_gsl(context.r)) {
                                         // to get higher resolution random numbers
-                                        // double rnum2 { rnum + rand_gsl() * Constants::iRandMax };
+                                        // double rnum2 { rnum + rand_gsl(context.r) * Constants::iRandMax };
 
                                         // if (prob > rnum2) {
                                         // std::cout << "State change at iteration " << simItr << ". Molecule "
@@ -223,8 +223,8 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                                     // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                                 }
 
-                                if (prob > rand_gsl()) {
-                                    // double rNum2 { rNum + rand_gsl() * Constants::iRandMax }; // to get higher resolution
+                                if (prob > rand_gsl(context.r)) {
+                                    // double rNum2 { rNum + rand_gsl(context.r) * Constants::iRandMax }; // to get higher resolution
                                     // if (prob > rNum2) {
                                     // std::cout << "Destroying molecule of type IL"
                                     //           << " with reaction "
@@ -252,7 +252,7 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                             // creation of IL, IL only can have one inerface and must be the first mol type
                             int tmpOneStateLipid = membraneObject.numberOfFreeLipidsEachState[tmpImplicitLipidStateIndex];
                             for (int tmpItr = 0; tmpItr < tmpOneStateLipid; tmpItr++) {
-                                // double rNum { 1.0 * rand_gsl() };
+                                // double rNum { 1.0 * rand_gsl(context.r) };
                                 long double lambda { oneRxn.rateList.at(0).rate * params.timeStep * Constants::usToSeconds };
                                 long double prob { 1 - exp(-lambda) };
 
@@ -265,7 +265,7 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                                     // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                                 }
 
-                                if (prob > rand_gsl()) {
+                                if (prob > rand_gsl(context.r)) {
                                     // std::cout << "Creating molecule of type IL"
                                     //           << " from reaction " << oneRxn.absRxnIndex << '\n';
 
@@ -305,8 +305,8 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                         // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                     }
 
-                    if (prob > rand_gsl()) {
-                        // double rNum2 { rNum + rand_gsl() * Constants::iRandMax }; // to get higher resolution
+                    if (prob > rand_gsl(context.r)) {
+                        // double rNum2 { rNum + rand_gsl(context.r) * Constants::iRandMax }; // to get higher resolution
                         // if (prob > rNum2) {
                         // std::cout << "Destroying molecule of type "
                         //           << molTemplateList[moleculeList[molItr].molTypeIndex].molName << " with reaction "
@@ -319,7 +319,7 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                             }
                         }
 
-                        complexList[moleculeList[molItr].myComIndex].destroy(moleculeList, complexList);
+                        complexList[moleculeList[molItr].myComIndex].destroy(moleculeList, complexList, context);
                         // remove the molecule from the SimulVolume subsCellList
                         // have this here to avoid circular header calls with SimulVolume and Molecule_Complex
                         for (auto itr
@@ -347,7 +347,7 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                     }
                 } else if (oneRxn.rxnType == ReactionType::uniMolCreation && moleculeList[molItr].trajStatus == TrajStatus::none
                     && isReactant(moleculeList[molItr], complexList[moleculeList[molItr].myComIndex], oneRxn, moleculeList)) {
-                    // double rNum { 1.0 * rand_gsl() };
+                    // double rNum { 1.0 * rand_gsl(context.r) };
                     long double lambda { oneRxn.rateList.at(0).rate * params.timeStep * Constants::usToSeconds };
                     long double prob { 1 - exp(-lambda) };
 
@@ -360,7 +360,7 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
                         // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                     }
 
-                    if (prob > rand_gsl()) {
+                    if (prob > rand_gsl(context.r)) {
                         int newMolIndex { 0 };
                         int newComIndex { 0 };
                         // std::cout << "Creating molecule of type " << oneRxn.productMolList.back().molName
@@ -368,7 +368,7 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
 
                         create_molecule_and_complex_from_rxn(molItr, newMolIndex, newComIndex, true,
                             molTemplateList[oneRxn.productMolList.back().molTypeIndex], params,
-                            oneRxn, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject);
+                            oneRxn, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject, context);
                         moleculeList[molItr].trajStatus = TrajStatus::propagated;
                         complexList[moleculeList[molItr].myComIndex].trajStatus = TrajStatus::propagated;
 
@@ -397,9 +397,9 @@ void check_for_unimolecular_reactions(unsigned simItr, Parameters& params, std::
             continue;
 
         // now check for dissociation
-        check_dissociation(simItr, params, simulVolume, molTemplateList, observablesList, molItr, moleculeList, complexList, backRxns, forwardRxns, createDestructRxns, counterArrays, membraneObject);
+        check_dissociation(simItr, params, simulVolume, molTemplateList, observablesList, molItr, moleculeList, complexList, backRxns, forwardRxns, createDestructRxns, counterArrays, membraneObject, context);
 
         if (complexList[moleculeList[molItr].myComIndex].OnSurface == true && params.implicitLipid == true)
-            check_dissociation_implicitlipid(simItr, params, simulVolume, molTemplateList, observablesList, molItr, moleculeList, complexList, backRxns, forwardRxns, createDestructRxns, counterArrays, membraneObject, IL2DbindingVec, IL2DUnbindingVec, ILTableIDs);
+            check_dissociation_implicitlipid(simItr, params, simulVolume, molTemplateList, observablesList, molItr, moleculeList, complexList, backRxns, forwardRxns, createDestructRxns, counterArrays, membraneObject, IL2DbindingVec, IL2DUnbindingVec, ILTableIDs, context);
     }
 }
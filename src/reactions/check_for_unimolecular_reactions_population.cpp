@@ -12,7 +12,7 @@
 void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject)
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context)
 {
     // In this routine, we treat the unimolecular reactions based on population by looping over reaction list, which is more acurate for large k*dt;
     // we need to track the molecules that can be destroyed or dissociated, hope this can be faster than the loop over molecule list
@@ -30,7 +30,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                 long double lambda { oneRxn.rateList.at(0).rate * params.timeStep * Constants::usToSeconds * NA };
                 long double prob { exp(-lambda) };
                 unsigned numEvents { 0 };
-                double rNum { 1.0 * rand_gsl() };
+                double rNum { 1.0 * rand_gsl(context.r) };
                 while (rNum > prob) {
                     ++numEvents;
                     prob += (exp(-lambda) * pow(lambda, numEvents)) / MathFuncs::gammFactorial(numEvents);
@@ -49,7 +49,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                     std::vector<int> destoryMolIndex {};
                     while (numEvents > 0) {
                         // chose one A whose TrajStatus should be None
-                        int randIntNum { static_cast<int>(1.0 * NA * rand_gsl()) };
+                        int randIntNum { static_cast<int>(1.0 * NA * rand_gsl(context.r)) };
                         if (randIntNum == NA) {
                             randIntNum = NA - 1;
                         }
@@ -62,7 +62,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                                 }
                             }
 
-                            complexList[moleculeList[oneTemp.monomerList[randIntNum]].myComIndex].destroy(moleculeList, complexList);
+                            complexList[moleculeList[oneTemp.monomerList[randIntNum]].myComIndex].destroy(moleculeList, complexList, context);
 
                             // remove the molecule from the SimulVolume subsCellList
                             // have this here to avoid circular header calls with SimulVolume and Molecule_Complex
@@ -102,7 +102,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                 long double lambda { oneRxn.rateList.at(0).rate * params.timeStep * Constants::usToSeconds * NA };
                 long double prob { exp(-lambda) };
                 unsigned numEvents { 0 };
-                double rNum { 1.0 * rand_gsl() };
+                double rNum { 1.0 * rand_gsl(context.r) };
                 while (rNum > prob) {
                     ++numEvents;
                     prob += (exp(-lambda) * pow(lambda, numEvents)) / MathFuncs::gammFactorial(numEvents);
@@ -157,7 +157,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
             long double lambda { oneRxn.rateList.at(0).rate * params.timeStep * Constants::usToSeconds * NA };
             long double prob { exp(-lambda) };
             unsigned numEvents { 0 };
-            double rNum { 1.0 * rand_gsl() };
+            double rNum { 1.0 * rand_gsl(context.r) };
             while (rNum > prob) {
                 ++numEvents;
                 prob += (exp(-lambda) * pow(lambda, numEvents)) / MathFuncs::gammFactorial(numEvents);
@@ -166,7 +166,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
             //Allow one to create more than one in this case, since it would occur with a smaller time-step.
 
             /*if(numEvents>NA){
-	      std::cout <<" WARNING: CANNOT perform N Creation Events of : "<<numEvents<<" Not enough species exist, perform: "<<NA<<std::endl;
+	      context.log <<" WARNING: CANNOT perform N Creation Events of : "<<numEvents<<" Not enough species exist, perform: "<<NA<<std::endl;
 	      numEvents=NA;
 	      
 	      }*/
@@ -179,7 +179,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                 while (numEvents > 0) {
                     // chose one A whose TrajStatus should be None
 
-                    int randIntNum { static_cast<int>(1.0 * NA * rand_gsl()) };
+                    int randIntNum { static_cast<int>(1.0 * NA * rand_gsl(context.r)) };
                     if (randIntNum == NA) {
                         randIntNum = NA - 1;
                     }
@@ -188,7 +188,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                         int newComIndex { 0 };
                         create_molecule_and_complex_from_rxn(poolAList[randIntNum], newMolIndex, newComIndex, true,
                             molTemplateList[oneRxn.productMolList.back().molTypeIndex], params,
-                            oneRxn, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject);
+                            oneRxn, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject, context);
                         if (numEvents <= NA) {
                             //need to allow at least one molecule to create more than one if numEvents>NA
                             //so do not update TrajStatus in that case.
@@ -245,7 +245,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                     long double lambda { rate * params.timeStep * Constants::usToSeconds * NAB };
                     long double prob { exp(-lambda) };
                     unsigned numEvents { 0 };
-                    double rNum { 1.0 * rand_gsl() };
+                    double rNum { 1.0 * rand_gsl(context.r) };
                     while (rNum > prob) {
                         ++numEvents;
                         prob += (exp(-lambda) * pow(lambda, numEvents)) / MathFuncs::gammFactorial(numEvents);
@@ -273,7 +273,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                         // record the index of the selected mol
                         std::vector<int> dissociateMolIndex {};
                         while (numEvents > 0) {
-                            int randIntNum { static_cast<int>(1.0 * NAB * rand_gsl()) };
+                            int randIntNum { static_cast<int>(1.0 * NAB * rand_gsl(context.r)) };
                             if (randIntNum == NAB) {
                                 randIntNum = NAB - 1;
                             }
@@ -300,7 +300,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
 
                                 bool breakLinkComplex
                                     = break_interaction(ifaceIndexA, ifaceIndexB, moleculeList[molIndexA], moleculeList[molIndexB],
-                                        oneRxn, moleculeList, complexList, molTemplateList, membraneObject.implicitlipidIndex);
+                                        oneRxn, moleculeList, complexList, molTemplateList, membraneObject.implicitlipidIndex, context);
 
                                 if (breakLinkComplex)
                                     counterArrays.nLoops--;
@@ -328,7 +328,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                                 complexList[moleculeList[molIndexB].myComIndex].trajStatus = TrajStatus::propagated;
 
                                 if (oneRxn.isCoupled) {
-                                    if (oneRxn.coupledRxn.probCoupled > rand_gsl()) {
+                                    if (oneRxn.coupledRxn.probCoupled > rand_gsl(context.r)) {
                                         // std::cout << "PERFORMING Coupled RXN after Dissociation! probability: " << oneRxn.coupledRxn.probCoupled << std::endl;
                                         if (oneRxn.coupledRxn.rxnType == ReactionType::destruction) {
                                             int destroyProIndex { -1 };
@@ -348,7 +348,7 @@ void check_for_unimolecular_reactions_population(unsigned simItr, Parameters& pa
                                                     --counterArrays.copyNumSpecies[iface.index];
                                                 }
                                             }
-                                            complexList[moleculeList[destroyProIndex].myComIndex].destroy(moleculeList, complexList); // destroying the entire complex that this molecule is a part of.
+                                            complexList[moleculeList[destroyProIndex].myComIndex].destroy(moleculeList, complexList, context); // destroying the entire complex that this molecule is a part of.
 
                                             // remove the molecule from the SimulVolume subsCellList, have this here to avoid circular header calls with SimulVolume and Molecule_Complex
                                             for (auto itr = simulVolume.subCellList[moleculeList[destroyProIndex].mySubVolIndex].memberMolList.begin();
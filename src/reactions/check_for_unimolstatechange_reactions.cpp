@@ -8,7 +8,7 @@
 void check_for_unimolstatechange_reactions(unsigned simItr, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject)
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, gsl_rng* r)
 {
     for (unsigned molItr { 0 }; molItr < moleculeList.size(); ++molItr) {
         // only do checks if the Molecule exists
@@ -51,9 +51,9 @@ void check_for_unimolstatechange_reactions(unsigned simItr, Parameters& params,
                                             // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                                         }
 
-                                        if (prob > rand_gsl()) {
+                                        if (prob > rand_gsl(r)) {
                                             // to get higher resolution random numbers
-                                            // double rnum2 { rnum + rand_gsl() * Constants::iRandMax };
+                                            // double rnum2 { rnum + rand_gsl(r) * Constants::iRandMax };
 
                                             // if (prob > rnum2) {
                                             // std::cout << "State change at iteration " << simItr << ". Molecule "
@@ -135,9 +135,9 @@ void check_for_unimolstatechange_reactions(unsigned simItr, Parameters& params,
                                         // std::cout << "WARNING: prob of reaction > 0.5. If this is a reaction for a bimolecular binding with multiple binding sites, please use a smaller time step." << std::endl;
                                     }
 
-                                    if (prob > rand_gsl()) {
+                                    if (prob > rand_gsl(r)) {
                                         // to get higher resolution random numbers
-                                        // double rnum2 { rnum + rand_gsl() * Constants::iRandMax };
+                                        // double rnum2 { rnum + rand_gsl(r) * Constants::iRandMax };
 
                                         // if (prob > rnum2) {
                                         // std::cout << "State change at iteration " << simItr << ". Molecule "
@@ -7,7 +7,7 @@
 void check_for_zeroth_order_creation(unsigned simItr, Parameters& params, SimulVolume& simulVolume, const std::vector<ForwardRxn>& forwardRxns,
     const std::vector<CreateDestructRxn>& createDestructRxns, std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList,
-    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject)
+    std::map<std::string, int>& observablesList, copyCounters& counterArrays, Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     for (auto& oneRxn : createDestructRxns) {
@@ -30,8 +30,8 @@ void check_for_zeroth_order_creation(unsigned simItr, Parameters& params, SimulV
                 long double lambda { Constants::avogadro * oneRxn.rateList[0].rate * Volume * Constants::nm3ToLiters * params.timeStep * Constants::usToSeconds };
                 long double prob { exp(-lambda) };
                 unsigned numEvents { 0 };
-                double rNum { 1.0 * gsl_rng_uniform(r) };
-                // double rNum2 { rNum + rand_gsl() * Constants::iRandMax }; // to get higher resolution
+                double rNum { 1.0 * gsl_rng_uniform(context.r) };
+                // double rNum2 { rNum + rand_gsl(context.r) * Constants::iRandMax }; // to get higher resolution
 
                 while (rNum > prob) {
                     ++numEvents;
@@ -73,8 +73,8 @@ void check_for_zeroth_order_creation(unsigned simItr, Parameters& params, SimulV
                     * Constants::nm3ToLiters * params.timeStep * Constants::usToSeconds };
                 long double prob { exp(-lambda) };
                 unsigned numEvents { 0 };
-                double rNum { 1.0 * gsl_rng_uniform(r) };
-                // double rNum2 { rNum + rand_gsl() * Constants::iRandMax }; // to get higher resolution
+                double rNum { 1.0 * gsl_rng_uniform(context.r) };
+                // double rNum2 { rNum + rand_gsl(context.r) * Constants::iRandMax }; // to get higher resolution
 
                 // std::cout << "Volume: " << std::setprecision(20) << Volume << std::endl;
                 // std::cout << "create prob: " << std::setprecision(20) << prob << std::endl;
@@ -107,7 +107,7 @@ void check_for_zeroth_order_creation(unsigned simItr, Parameters& params, SimulV
                     int newMolIndex { 0 };
                     int newComIndex { 0 };
 
-                    create_molecule_and_complex_from_rxn(0, newMolIndex, newComIndex, false, oneTemp, params, oneRxn, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject);
+                    create_molecule_and_complex_from_rxn(0, newMolIndex, newComIndex, false, oneTemp, params, oneRxn, simulVolume, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject, context);
 
                     // update the copy number arrays
                     for (const auto& iface : moleculeList[newMolIndex].interfaceList)
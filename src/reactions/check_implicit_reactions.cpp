@@ -11,7 +11,7 @@
 void check_implicit_reactions(int pro1Index, int pro2Index, int simItr,
     const Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
     const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs)
+    const std::vector<BackRxn>& backRxns, copyCounters& counterArrays, Membrane& membraneObject, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, std::vector<double>& ILTableIDs, std::mutex& tableMutex, SimulContext& context)
 {
     // TRACE();
     // only consider when pro2 IS implicit-lipid
@@ -69,7 +69,7 @@ void check_implicit_reactions(int pro1Index, int pro2Index, int simItr,
                             absIface2 += tmpImplicitLipidStateIndex;
 
                             find_which_reaction(relIface1, relIface2, rxnIndex, rateIndex, isStateChangeBackRxn, state,
-                                moleculeList[pro1Index], moleculeList[pro2Index], forwardRxns, backRxns, molTemplateList);
+                                moleculeList[pro1Index], moleculeList[pro2Index], forwardRxns, backRxns, molTemplateList, context);
 
                             relIface2 -= tmpImplicitLipidStateIndex;
                             absIface2 -= tmpImplicitLipidStateIndex;
@@ -116,7 +116,7 @@ void check_implicit_reactions(int pro1Index, int pro2Index, int simItr,
                                             absIface1, absIface2, Dtot, magMol1, magMol2 };
                                         determine_2D_implicitlipid_reaction_probability(simItr, rxnIndex, rateIndex, isStateChangeBackRxn,
                                             ILTableIDs, biMolData, params, moleculeList, complexList, forwardRxns, backRxns,
-                                            IL2DbindingVec, IL2DUnbindingVec, membraneObject, relStateIndex);
+                                            IL2DbindingVec, IL2DUnbindingVec, membraneObject, relStateIndex, tableMutex);
                                     } else {
                                         //3D->2D reaction
                                         double Dtot = 1.0 / 3.0 * (complexList[moleculeList[pro1Index].myComIndex].D.x + complexList[moleculeList[pro2Index].myComIndex].D.x)
@@ -103,20 +103,20 @@ bool moleculeOverlaps(const Parameters& params, SimulVolume& simulVolume, Molecu
 void create_molecule_and_complex_from_rxn(int parentMolIndex, int& newMolIndex, int& newComIndex, bool createInVicinity,
     MolTemplate& createdMolTemp, Parameters& params, const CreateDestructRxn& currRxn, SimulVolume& simulVolume,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, SimulContext& context)
 {
     newMolIndex = 0;
     newComIndex = 0;
-    if (Molecule::emptyMolList.size() > 0) {
+    if (context.emptyMolList.size() > 0) {
         // Check to make sure the object pointed to by the last element in the each list is actually empty
         // If it isn't delete it from the list and move on until you find one that is
         try {
-            while (!moleculeList[Molecule::emptyMolList.back()].isEmpty)
-                Molecule::emptyMolList.pop_back();
+            while (!moleculeList[context.emptyMolList.back()].isEmpty)
+                context.emptyMolList.pop_back();
 
             // if there's an available empty Molecule spot, make the new Molecule in place
-            newMolIndex = Molecule::emptyMolList.back();
-            Molecule::emptyMolList.pop_back(); // remove the empty Molecule spot index from the list
+            newMolIndex = context.emptyMolList.back();
+            context.emptyMolList.pop_back(); // remove the empty Molecule spot index from the list
         } catch (std::out_of_range& e) {
             newMolIndex = moleculeList.size();
             moleculeList.emplace_back(); // create new empty Molecule spot
@@ -126,15 +126,15 @@ void create_molecule_and_complex_from_rxn(int parentMolIndex, int& newMolIndex,
         moleculeList.emplace_back(); // create new empty Molecule spot
     }
 
-    if (Complex::emptyComList.size() > 0) {
+    if (context.emptyComList.size() > 0) {
         // Check to make sure the object pointed to by the last element in the each list is actually empty
         // If it isn't delete it from the list and move on until you find one that is
         try {
-            while (!complexList[Complex::emptyComList.back()].isEmpty)
-                Complex::emptyComList.pop_back();
+            while (!complexList[context.emptyComList.back()].isEmpty)
+                context.emptyComList.pop_back();
             // if there's an available empty Complex spot, make the new Complex in place
-            newComIndex = Complex::emptyComList.back();
-            Complex::emptyComList.pop_back(); // remove the empty Complex spot index from the list
+            newComIndex = context.emptyComList.back();
+            context.emptyComList.pop_back(); // remove the empty Complex spot index from the list
         } catch (std::out_of_range) {
             newComIndex = complexList.size();
             complexList.emplace_back(); // create new empty Complex spot
@@ -150,7 +150,7 @@ void create_molecule_and_complex_from_rxn(int parentMolIndex, int& newMolIndex,
         bool needsResampling { true };
         while (needsResampling) {
             moleculeList[newMolIndex] = initialize_molecule_after_uni_reaction(
-                newMolIndex, moleculeList[parentMolIndex], params, createdMolTemp, currRxn);
+                newMolIndex, moleculeList[parentMolIndex], params, createdMolTemp, currRxn, context);
             needsResampling = moleculeOverlaps(params, simulVolume, moleculeList[newMolIndex], moleculeList,
                 complexList, forwardRxns, molTemplateList, membraneObject);
         }
@@ -158,7 +158,7 @@ void create_molecule_and_complex_from_rxn(int parentMolIndex, int& newMolIndex,
         bool needsResampling { true };
         while (needsResampling) {
             moleculeList[newMolIndex]
-                = initialize_molecule_after_zeroth_reaction(newMolIndex, params, createdMolTemp, currRxn, membraneObject);
+                = initialize_molecule_after_zeroth_reaction(newMolIndex, params, createdMolTemp, currRxn, membraneObject, context);
             needsResampling = moleculeOverlaps(params, simulVolume, moleculeList[newMolIndex], moleculeList,
                 complexList, forwardRxns, molTemplateList, membraneObject);
         }
@@ -166,9 +166,9 @@ void create_molecule_and_complex_from_rxn(int parentMolIndex, int& newMolIndex,
 
     moleculeList[newMolIndex].myComIndex = newComIndex;
     moleculeList[newMolIndex].trajStatus = TrajStatus::propagated;
-    complexList[newComIndex] = Complex { newComIndex, moleculeList.at(newMolIndex), createdMolTemp };
+    complexList[newComIndex] = Complex { newComIndex, moleculeList.at(newMolIndex), createdMolTemp, context.numMolTypes };
     complexList[newComIndex].trajStatus = TrajStatus::propagated;
-    ++Complex::numberOfComplexes;
+    ++context.numberOfComplexes;
 
     // add to monomerList if canDestroy = true
     {
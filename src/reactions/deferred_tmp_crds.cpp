@@ -0,0 +1,118 @@
+#include "boundary_conditions/boundary_geometry.hpp"
+#include "reactions/association/association.hpp"
+
+/*While a Complex defers its moves, rotate() and translate_tmp_crds() move only its reacting Molecule and its
+  tmpComCoord, and keep each move. update_deferred_tmp_com_crds() and update_deferred_tmp_crds() then apply them to
+  each of the other members in the same order and with the same arithmetic, so their temporary coordinates come out
+  exactly as if they had been moved along, and an association that gets canceled first never moves their interfaces.
+ */
+
+namespace {
+// mass weighted, as in update_complex_tmp_com_crds
+Coord com_of_members(const Complex& targCom, const std::vector<Molecule>& moleculeList)
+{
+    double totMass { 0 };
+    Coord com { 0, 0, 0 };
+    for (auto& memMol : targCom.memberList) {
+        totMass += moleculeList[memMol].mass;
+        com.x += moleculeList[memMol].comCoord.x * moleculeList[memMol].mass;
+        com.y += moleculeList[memMol].comCoord.y * moleculeList[memMol].mass;
+        com.z += moleculeList[memMol].comCoord.z * moleculeList[memMol].mass;
+    }
+    com /= totMass;
+    return com;
+}
+}
+
+void translate_tmp_crds(const Vector& transVec, Complex& targCom, std::vector<Molecule>& moleculeList)
+{
+    if (targCom.deferredMolIndex != -1) {
+        DeferredMove move {};
+        move.transVec = transVec;
+        targCom.deferredMoves.push_back(move);
+
+        targCom.tmpComCoord = transVec + targCom.tmpComCoord;
+        moleculeList[targCom.deferredMolIndex].update_association_coords(transVec);
+        return;
+    }
+
+    for (auto& mp : targCom.memberList)
+        moleculeList[mp].update_association_coords(transVec);
+}
+
+void defer_tmp_crds(Complex& targCom, Molecule& reactMol, std::vector<Molecule>& moleculeList)
+{
+    reactMol.set_tmp_association_coords();
+    targCom.deferredMolIndex = reactMol.index;
+    targCom.deferredMoves.clear();
+    targCom.tmpComCoord = com_of_members(targCom, moleculeList);
+}
+
+void update_deferred_tmp_com_crds(Complex& targCom, std::vector<Molecule>& moleculeList)
+{
+    for (auto& memMol : targCom.memberList) {
+        if (memMol == targCom.deferredMolIndex)
+            continue;
+
+        // as update_deferred_tmp_crds does to the COM. A Molecule without interfaces is translated from its comCoord
+        // each time, see Molecule::update_association_coords
+        Molecule& oneMol = moleculeList[memMol];
+        oneMol.tmpComCoord = oneMol.comCoord;
+        for (auto& move : targCom.deferredMoves) {
+            if (move.isRotation)
+                oneMol.tmpComCoord = rotate_point(oneMol.tmpComCoord, move.rotOrigin, move.rotQuat);
+            else if (oneMol.interfaceList.empty())
+                oneMol.tmpComCoord = (move.transVec + oneMol.comCoord);
+            else
+                oneMol.tmpComCoord = (move.transVec + oneMol.tmpComCoord);
+        }
+    }
+}
+
+void update_deferred_tmp_crds(const Complex& targCom, Molecule& oneMol)
+{
+    oneMol.set_tmp_association_coords();
+    for (auto& move : targCom.deferredMoves) {
+        if (move.isRotation) {
+            Quat rotQuat { move.rotQuat };
+            rotate_tmp_crds(move.rotOrigin, rotQuat, oneMol);
+        }
+        else
+            oneMol.update_association_coords(move.transVec);
+    }
+}
+
+void update_deferred_tmp_crds(Complex& targCom, std::vector<Molecule>& moleculeList)
+{
+    for (auto& memMol : targCom.memberList) {
+        // check_for_structure_overlap_system may have moved some already
+        Molecule& oneMol = moleculeList[memMol];
+        if (memMol != targCom.deferredMolIndex && oneMol.tmpICoords.size() != oneMol.interfaceList.size())
+            update_deferred_tmp_crds(targCom, oneMol);
+    }
+    targCom.deferredMolIndex = -1;
+    targCom.deferredMoves.clear();
+}
+
+void clear_tmp_crds(Complex& targCom, std::vector<Molecule>& moleculeList)
+{
+    for (auto& memMol : targCom.memberList)
+        moleculeList[memMol].clear_tmp_association_coords();
+    targCom.deferredMolIndex = -1;
+    targCom.deferredMoves.clear();
+}
+
+bool deferred_crds_stay_in_box(const Complex& targCom, const std::vector<Molecule>& moleculeList,
+    const Membrane& membraneObject)
+{
+    /*Every interface is within targCom.radius of the Complex's comCoord, and so within radius plus their distance of
+      the COM of the members, which tmpComCoord is, moved. The tolerance covers the rounding of the moves, which
+      reflect_traj_tmp_crds_box and check_if_spans_box see applied to each member instead*/
+    const double tol { 1E-6 };
+    Vector comShift { com_of_members(targCom, moleculeList) - targCom.comCoord };
+    double reach { targCom.radius + comShift.get_magnitude() + tol };
+
+    BoxWalls walls { membraneObject, 0.0 };
+    std::array<bool, 3> canBeOutside { walls.can_be_outside(targCom.tmpComCoord, reach) };
+    return !canBeOutside[0] && !canBeOutside[1] && !canBeOutside[2];
+}
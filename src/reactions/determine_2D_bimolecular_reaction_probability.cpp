@@ -1,13 +1,14 @@
 #include "reactions/bimolecular/2D_reaction_table_functions.hpp"
 #include "reactions/bimolecular/bimolecular_reactions.hpp"
 #include "tracing.hpp"
+#include <mutex>
 #include <sstream>
 
 void determine_2D_bimolecular_reaction_probability(int simItr, int rxnIndex, int rateIndex, bool isStateChangeBackRxn,
     unsigned& DDTableIndex, double* tableIDs, BiMolData& biMolData, const Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns,
     const std::vector<BackRxn>& backRxns, Membrane& membraneObject, std::vector<gsl_matrix*>& normMatrices,
-    std::vector<gsl_matrix*>& survMatrices, std::vector<gsl_matrix*>& pirMatrices)
+    std::vector<gsl_matrix*>& survMatrices, std::vector<gsl_matrix*>& pirMatrices, std::mutex& tableMutex)
 {
     // TRACE();
     double Dr1 {};
@@ -81,40 +82,51 @@ void determine_2D_bimolecular_reaction_probability(int simItr, int rxnIndex, int
             if (forwardRxns[rxnIndex].isSymmetric == true)
                 ktemp *= 2.0; // for A(a)+A(a)->A(a!).A(a!) case
 
-            for (int l = 0; l < DDTableIndex; ++l) {
-                if (std::abs(tableIDs[l] - ktemp) < 1e-8 && std::abs(tableIDs[params.max2DRxns + l] - biMolData.Dtot) < 1E-4) {
-                    probValExists = true;
-                    probMatrixIndex = l;
-                    break;
+            // the tables can be shared with Simulations on other threads. a table isn't changed once it's made, so
+            // only the lookup is locked, and the matrices are used through these
+            gsl_matrix* survMatrix { nullptr };
+            gsl_matrix* normMatrix { nullptr };
+            gsl_matrix* pirMatrix { nullptr };
+            {
+                std::lock_guard<std::mutex> tableLock { tableMutex };
+                for (int l = 0; l < DDTableIndex; ++l) {
+                    if (std::abs(tableIDs[l] - ktemp) < 1e-8 && std::abs(tableIDs[params.max2DRxns + l] - biMolData.Dtot) < 1E-4) {
+                        probValExists = true;
+                        probMatrixIndex = l;
+                        break;
+                    }
                 }
-            }
 
-            if (!probValExists) {
-                // first dimension (+0*params.max2DRxns)
-                tableIDs[DDTableIndex] = ktemp;
-                // second dimension (+1*params.max2DRxns)
-                tableIDs[DDTableIndex + params.max2DRxns] = biMolData.Dtot;
-                size_t veclen { size_lookup(forwardRxns[rxnIndex].bindRadius, biMolData.Dtot, params, RMax) };
-                // std::cout << "Create new 2D table: " << ktemp << ", Dtot: " << biMolData.Dtot << " size: " << veclen
-                //           << '\n';
-                survMatrices.resize(DDTableIndex + 1);
-                normMatrices.resize(DDTableIndex + 1);
-                pirMatrices.resize(DDTableIndex + 1);
-                survMatrices[DDTableIndex] = gsl_matrix_alloc(2, veclen);
-                normMatrices[DDTableIndex] = gsl_matrix_alloc(2, veclen);
-                pirMatrices[DDTableIndex] = gsl_matrix_alloc(veclen, veclen);
-
-                create_DDMatrices(survMatrices[DDTableIndex], normMatrices[DDTableIndex], pirMatrices[DDTableIndex],
-                    forwardRxns[rxnIndex].bindRadius, biMolData.Dtot, RMax, ktemp, params);
-                probMatrixIndex = DDTableIndex;
-                DDTableIndex += 1;
-                if (DDTableIndex == params.max2DRxns) {
-                    std::cout << "You have hit the maximum number of unique 2D reactions "
-                                 "allowed: "
-                              << params.max2DRxns << '\n';
-                    std::cout << "terminating...." << '\n';
-                    exit(1);
+                if (!probValExists) {
+                    // first dimension (+0*params.max2DRxns)
+                    tableIDs[DDTableIndex] = ktemp;
+                    // second dimension (+1*params.max2DRxns)
+                    tableIDs[DDTableIndex + params.max2DRxns] = biMolData.Dtot;
+                    size_t veclen { size_lookup(forwardRxns[rxnIndex].bindRadius, biMolData.Dtot, params, RMax) };
+                    // std::cout << "Create new 2D table: " << ktemp << ", Dtot: " << biMolData.Dtot << " size: " << veclen
+                    //           << '\n';
+                    survMatrices.resize(DDTableIndex + 1);
+                    normMatrices.resize(DDTableIndex + 1);
+                    pirMatrices.resize(DDTableIndex + 1);
+                    survMatrices[DDTableIndex] = gsl_matrix_alloc(2, veclen);
+                    normMatrices[DDTableIndex] = gsl_matrix_alloc(2, veclen);
+                    pirMatrices[DDTableIndex] = gsl_matrix_alloc(veclen, veclen);
+
+                    create_DDMatrices(survMatrices[DDTableIndex], normMatrices[DDTableIndex], pirMatrices[DDTableIndex],
+                        forwardRxns[rxnIndex].bindRadius, biMolData.Dtot, RMax, ktemp, params);
+                    probMatrixIndex = DDTableIndex;
+                    DDTableIndex += 1;
+                    if (DDTableIndex == params.max2DRxns) {
+                        std::cerr << "You have hit the maximum number of unique 2D reactions "
+                                     "allowed: "
+                                  << params.max2DRxns << '\n';
+                        std::cerr << "terminating...." << '\n';
+                        exit(1);
+                    }
                 }
+                survMatrix = survMatrices[probMatrixIndex];
+                normMatrix = normMatrices[probMatrixIndex];
+                pirMatrix = pirMatrices[probMatrixIndex];
             }
             probValExists = false; // reset
 
@@ -183,8 +195,8 @@ void determine_2D_bimolecular_reaction_probability(int simItr, int rxnIndex, int
                         // restart reweighting in 2D.
                         currnorm = 1.0;
                     } else {
-                        p0_ratio = DDpirr_pfree_ratio_ps(pirMatrices[probMatrixIndex], survMatrices[probMatrixIndex],
-                            normMatrices[probMatrixIndex], R1, biMolData.Dtot, params.timeStep,
+                        p0_ratio = DDpirr_pfree_ratio_ps(pirMatrix, survMatrix,
+                            normMatrix, R1, biMolData.Dtot, params.timeStep,
                             moleculeList[proA].prevsep[s], moleculeList[proA].ps_prev[s], 1E-10,
                             forwardRxns[rxnIndex].bindRadius);
                         currnorm = moleculeList[proA].prevnorm[s] * p0_ratio;
@@ -193,7 +205,7 @@ void determine_2D_bimolecular_reaction_probability(int simItr, int rxnIndex, int
                 }
             }
             rxnProb = get_prevSurv(
-                survMatrices[probMatrixIndex], biMolData.Dtot, params.timeStep, R1, forwardRxns[rxnIndex].bindRadius);
+                survMatrix, biMolData.Dtot, params.timeStep, R1, forwardRxns[rxnIndex].bindRadius);
             moleculeList[biMolData.pro1Index].probvec.back() = rxnProb * currnorm;
             moleculeList[biMolData.pro2Index].probvec.back() = rxnProb * currnorm;
             if (rxnProb > 1.000001) {
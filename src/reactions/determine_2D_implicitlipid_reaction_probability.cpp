@@ -3,10 +3,12 @@
 #include "reactions/implicitlipid/implicitlipid_reactions.hpp"
 #include "tracing.hpp"
 
+#include <mutex>
+
 void determine_2D_implicitlipid_reaction_probability(int simItr, int rxnIndex, int rateIndex, bool isStateChangeBackRxn,
     std::vector<double>& ILTableIDs, BiMolData& biMolData, const Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<BackRxn>& backRxns, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, Membrane& membraneObject, const int& relStateIndex)
+    const std::vector<BackRxn>& backRxns, std::vector<double>& IL2DbindingVec, std::vector<double>& IL2DUnbindingVec, Membrane& membraneObject, const int& relStateIndex, std::mutex& tableMutex)
 {
     // TRACE();
     double Dr1 {};
@@ -77,35 +79,41 @@ void determine_2D_implicitlipid_reaction_probability(int simItr, int rxnIndex, i
                 kb = backRxns[forwardRxns[rxnIndex].conjBackRxnIndex].rateList[rateIndex].rate;
             }
 
-            for (int l = 0; l < IL2DbindingVec.size(); ++l) {
-                if (std::abs(ILTableIDs[l * 3] - ktemp) < 1e-8 && std::abs(ILTableIDs[l * 3 + 1] - biMolData.Dtot) < 1E-4 && std::abs(ILTableIDs[l * 3 + 2] - kb) < 1e-8) {
-                    probValExists = true;
-                    probMatrixIndex = l;
-                    break;
+            // the tables can be shared with Simulations on other threads, and IL2DbindingVec grows as they are made
+            double bindingProb { 0 };
+            {
+                std::lock_guard<std::mutex> tableLock { tableMutex };
+                for (int l = 0; l < IL2DbindingVec.size(); ++l) {
+                    if (std::abs(ILTableIDs[l * 3] - ktemp) < 1e-8 && std::abs(ILTableIDs[l * 3 + 1] - biMolData.Dtot) < 1E-4 && std::abs(ILTableIDs[l * 3 + 2] - kb) < 1e-8) {
+                        probValExists = true;
+                        probMatrixIndex = l;
+                        break;
+                    }
                 }
-            }
 
-            if (!probValExists) {
-                // first dimension out of i elements (2*i)
-                ILTableIDs.push_back(ktemp);
-                // second dimension (2*i+1)
-                ILTableIDs.push_back(biMolData.Dtot);
-
-                ILTableIDs.push_back(kb);
-                paramsIL params2D {};
-                params2D.kb = kb;
-                params2D.R2D = 0.0;
-                params2D.sigma = forwardRxns[rxnIndex].bindRadius;
-                params2D.Dtot = biMolData.Dtot;
-                params2D.ka = ktemp;
-
-                params2D.area = membraneObject.totalSA;
-                params2D.dt = params.timeStep;
-                params2D.Nlipid = membraneObject.numberOfFreeLipidsEachState[relStateIndex];
-                params2D.Na = membraneObject.numberOfProteinEachState[relStateIndex]; // the initial number of protein's interfaces that can bind to surface
-
-                probMatrixIndex = IL2DbindingVec.size();
-                IL2DbindingVec.push_back(pimplicitlipid_2D(params2D));
+                if (!probValExists) {
+                    // first dimension out of i elements (2*i)
+                    ILTableIDs.push_back(ktemp);
+                    // second dimension (2*i+1)
+                    ILTableIDs.push_back(biMolData.Dtot);
+
+                    ILTableIDs.push_back(kb);
+                    paramsIL params2D {};
+                    params2D.kb = kb;
+                    params2D.R2D = 0.0;
+                    params2D.sigma = forwardRxns[rxnIndex].bindRadius;
+                    params2D.Dtot = biMolData.Dtot;
+                    params2D.ka = ktemp;
+
+                    params2D.area = membraneObject.totalSA;
+                    params2D.dt = params.timeStep;
+                    params2D.Nlipid = membraneObject.numberOfFreeLipidsEachState[relStateIndex];
+                    params2D.Na = membraneObject.numberOfProteinEachState[relStateIndex]; // the initial number of protein's interfaces that can bind to surface
+
+                    probMatrixIndex = IL2DbindingVec.size();
+                    IL2DbindingVec.push_back(pimplicitlipid_2D(params2D));
+                }
+                bindingProb = IL2DbindingVec[probMatrixIndex];
             }
             probValExists = false; // reset
 
@@ -116,7 +124,7 @@ void determine_2D_implicitlipid_reaction_probability(int simItr, int rxnIndex, i
             double currnorm { 1.0 };
             double rho = 1.0 * membraneObject.numberOfFreeLipidsEachState[relStateIndex] / membraneObject.totalSA;
 
-            double rxnProb = rho * IL2DbindingVec[probMatrixIndex];
+            double rxnProb = rho * bindingProb;
             if (rxnProb > 1.000001) {
                 std::cerr << "Error: prob of reaction is: " << rxnProb << " > 1. Avoid this using a smaller time step." << std::endl;
                 exit(1);
@@ -4,7 +4,7 @@
 #include "tracing.hpp"
 
 bool determine_if_reaction_occurs(int& crossIndex1, int& crossIndex2, const double maxRandInt, Molecule& mol,
-    std::vector<Molecule>& moleculeList, const std::vector<ForwardRxn>& forwardRxns)
+    std::vector<Molecule>& moleculeList, const std::vector<ForwardRxn>& forwardRxns, gsl_rng* r)
 {
     // TRACE();
     bool willReact { false };
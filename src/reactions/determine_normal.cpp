@@ -1,18 +1,18 @@
 #include "reactions/association/association.hpp"
 #include "tracing.hpp"
 
-Vector determine_normal(Vector normal, const MolTemplate& molTemplate, Molecule oneMol)
+Vector determine_normal(Vector normal, const MolTemplate& molTemplate, MolGeometry oneMol)
 {
     // TRACE();
-    if (oneMol.interfaceList.empty()) {
+    if (oneMol.iCoords.empty()) {
         // std::cout << "Molecule is a point, has no normal." << std::endl;
         return { 0, 0, 0 };
     }
 
-    for (auto& coord : oneMol.tmpICoords)
-        coord -= oneMol.tmpComCoord;
-    oneMol.tmpComCoord -= oneMol.tmpComCoord;
-    Molecule tmpMol { oneMol }; // tmp molecule for rot check later
+    for (auto& coord : oneMol.iCoords)
+        coord -= oneMol.comCoord;
+    oneMol.comCoord -= oneMol.comCoord;
+    std::vector<Coord> tmpICoords { oneMol.iCoords }; // for rot check later
 
     // see if it's already oriented, this is not necessary.
     /*  int numUnmatched { 0 };
@@ -30,11 +30,11 @@ Vector determine_normal(Vector normal, const MolTemplate& molTemplate, Molecule
     totalRotQuat.rotate(normal);
 
     { // check to make sure the rotations were successful
-        for (unsigned ifaceIndex { 0 }; ifaceIndex < oneMol.tmpICoords.size(); ifaceIndex++) {
-            Vector tmpVec { oneMol.tmpICoords[ifaceIndex] - oneMol.tmpComCoord };
+        for (unsigned ifaceIndex { 0 }; ifaceIndex < oneMol.iCoords.size(); ifaceIndex++) {
+            Vector tmpVec { oneMol.iCoords[ifaceIndex] - oneMol.comCoord };
             totalRotQuat.rotate(tmpVec);
-            oneMol.tmpICoords[ifaceIndex] = Coord(tmpVec.x, tmpVec.y, tmpVec.z);
-            if (oneMol.tmpICoords[ifaceIndex] != tmpMol.tmpICoords[ifaceIndex]) {
+            oneMol.iCoords[ifaceIndex] = Coord(tmpVec.x, tmpVec.y, tmpVec.z);
+            if (oneMol.iCoords[ifaceIndex] != tmpICoords[ifaceIndex]) {
                 // std::cout << "Backwards rotation unsuccessful on interface " << ifaceIndex << std::endl;
                 return { 0, 0, 0 };
             }
@@ -183,19 +183,19 @@ bool determine_parent_complex_IL(int pro1Index, int pro2Index, int newComIndex,
         }
 
         if (tmpc1.size() + tmpc2.size() != complexList[c1].memberList.size()) {
-            std::cout << " complex sizes don't match the parent! " << tmpc1.size() << ' ' << tmpc2.size() << " original size: " << complexList[c1].memberList.size() << std::endl;
-            std::cout << " pros in c1: " << std::endl;
+            std::cerr << " complex sizes don't match the parent! " << tmpc1.size() << ' ' << tmpc2.size() << " original size: " << complexList[c1].memberList.size() << std::endl;
+            std::cerr << " pros in c1: " << std::endl;
             for (auto memMol : tmpc1)
-                std::cout << memMol << '\t';
-            std::cout << " pros in c2: " << std::endl;
+                std::cerr << memMol << '\t';
+            std::cerr << " pros in c2: " << std::endl;
             for (auto memMol : tmpc2)
-                std::cout << memMol << '\t';
-            std::cout << "display molecules " << std::endl;
+                std::cerr << memMol << '\t';
+            std::cerr << "display molecules " << std::endl;
             for (auto mp : tmpc1)
-                moleculeList[mp].display_all();
-            std::cout << " pros in c2: " << std::endl;
+                moleculeList[mp].display_all(std::cerr);
+            std::cerr << " pros in c2: " << std::endl;
             for (auto mp : tmpc2)
-                moleculeList[mp].display_all();
+                moleculeList[mp].display_all(std::cerr);
 
             std::cerr
                 << "ERROR: Combined size of dissociated complexes does not match the parent complex. Exiting...\n";
@@ -30,12 +30,12 @@ int find_reaction_rate_state(int simItr, int relIfaceIndex1, int relIfaceIndex2,
     if (reactIndex1 == -1 || reactIndex2 == -1) {
         std::cerr << llinebreak;
         std::cerr << "ERROR: Association product has incorrect dissociation reaction.\n";
-        reactMol1.display(molTemplateList[reactMol1.molTypeIndex]);
+        reactMol1.display(std::cerr, molTemplateList[reactMol1.molTypeIndex]);
         std::cerr << linebreak;
-        reactMol2.display(molTemplateList[reactMol2.molTypeIndex]);
+        reactMol2.display(std::cerr, molTemplateList[reactMol2.molTypeIndex]);
         std::cerr << llinebreak;
-        backRxn.display();
-        std::cout << std::endl;
+        backRxn.display(std::cerr);
+        std::cerr << std::endl;
         exit(1);
     }
 
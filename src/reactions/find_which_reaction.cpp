@@ -4,7 +4,7 @@
 void find_which_reaction(int ifaceIndex1, int ifaceIndex2, int& rxnIndex, int& rateIndex, bool& isStateChangeBackRxn,
     const Interface::State& currState, const Molecule& reactMol1, const Molecule& reactMol2,
     const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
-    const std::vector<MolTemplate>& molTemplateList)
+    const std::vector<MolTemplate>& molTemplateList, SimulContext& context)
 {
     // TRACE();
     for (auto rxnItr : currState.myForwardRxns) {
@@ -118,7 +118,7 @@ void find_which_reaction(int ifaceIndex1, int ifaceIndex2, int& rxnIndex, int& r
             if (matches == 1) {
                 rateIndex = matchList[0][0];
                 rxnIndex = oneRxn.relRxnIndex;
-                ++totMatches;
+                ++context.totMatches;
                 return;
             } else if (matches == 0) {
                 // if there are no matching rates and the reaction symmetric (i.e. interface 1 binding to interface 1,
@@ -137,7 +137,7 @@ void find_which_reaction(int ifaceIndex1, int ifaceIndex2, int& rxnIndex, int& r
                     if (matches == 1) {
                         rateIndex = matchList[0][0];
                         rxnIndex = oneRxn.relRxnIndex;
-                        ++totMatches;
+                        ++context.totMatches;
                         return;
                     } else if (matches == 0) {
                         return;
@@ -152,7 +152,7 @@ void find_which_reaction(int ifaceIndex1, int ifaceIndex2, int& rxnIndex, int& r
                         }
                         rateIndex = matchList[bestFitIndex][0];
                         rxnIndex = oneRxn.relRxnIndex;
-                        ++totMatches;
+                        ++context.totMatches;
                         return;
                     }
                 }
@@ -169,7 +169,7 @@ void find_which_reaction(int ifaceIndex1, int ifaceIndex2, int& rxnIndex, int& r
                 }
                 rateIndex = matchList[bestFitIndex][0];
                 rxnIndex = oneRxn.relRxnIndex;
-                ++totMatches;
+                ++context.totMatches;
                 return;
             }
         }
@@ -166,7 +166,7 @@ Coord find_position_after_association(double arc1, Coord Iface1, Coord Iface2, d
         }
     }
     if (std::isnan(new_position1.x) || std::isnan(new_position1.y)) {
-        std::cout << "WRONG: non position is generated in 'find_position_after_association'...EXIT! " << std::endl;
+        std::cerr << "WRONG: non position is generated in 'find_position_after_association'...EXIT! " << std::endl;
         exit(1);
     }
     return new_position1;
@@ -425,13 +425,40 @@ Coord rotate_on_sphere(Coord Targ, Coord COM, std::array<double, 9> crdset, doub
         if (targjk.magnitude < 1E-8 || std::abs(targi.magnitude - 1.0) < 1E-8) {
             targnew = Coord { Targ.x, Targ.y, Targ.z };
         } else {
-            std::cout << "WRONG! NON is generated after the rotation on sphere! EXIT..." << std::endl;
+            std::cerr << "WRONG! NON is generated after the rotation on sphere! EXIT..." << std::endl;
             exit(1);
         }
     }
     return targnew;
 }
 
+/* A complex moving on the sphere surface only turns about the sphere center: translate_on_sphere is the rotation about
+   the normal of the plane Origin-COM-COMnew taking COM to COMnew, and rotate_on_sphere the rotation about O-COMnew.
+   Both are built here without the coords sets, and combined into one quaternion. */
+Quat rotation_on_sphere(Coord COM, Coord COMnew, double dangle)
+{
+    Vector i = Vector { COM.x, COM.y, COM.z };
+    i.normalize();
+    Vector inew = Vector { COMnew.x, COMnew.y, COMnew.z };
+    inew.normalize();
+
+    // translation: (1 + cos, sin * axis) is the quaternion of half the angle between i and inew
+    Quat transQuat { 1.0, 0.0, 0.0, 0.0 };
+    Coord dcom = COMnew - COM;
+    if (dcom.get_magnitude() >= 1E-8) { // otherwise no translation on sphere, as in translate_on_sphere
+        // i x inew, of magnitude sin (Vector::cross normalizes)
+        double axisX = i.y * inew.z - i.z * inew.y;
+        double axisY = i.z * inew.x - i.x * inew.z;
+        double axisZ = i.x * inew.y - i.y * inew.x;
+        transQuat = Quat { 1.0 + i.dot(inew), axisX, axisY, axisZ }.unit();
+    }
+
+    // rotation by dangle about O-COMnew, the sphere normal at the new position
+    double sinHalf = sin(0.5 * dangle);
+    Quat rotQuat { cos(0.5 * dangle), sinHalf * inew.x, sinHalf * inew.y, sinHalf * inew.z };
+    return rotQuat * transQuat;
+}
+
 double calc_bindRadius2D(double bindRadius, Coord iFace)
 {
     double R;
@@ -441,7 +468,7 @@ double calc_bindRadius2D(double bindRadius, Coord iFace)
     return bindRadius2D;
 }
 
-void set_memProtein_sphere(Complex reactCom, Molecule& memProtein, std::vector<Molecule> moleculeList, const Membrane membraneObject)
+void set_memProtein_sphere(const Complex& reactCom, Molecule& memProtein, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject)
 {
     //if (membraneObject.implicitLipid == false){ //for explicit lipid model; lipid is a member of reactCom
     double r = 0.0;
@@ -484,13 +511,13 @@ void set_memProtein_sphere(Complex reactCom, Molecule& memProtein, std::vector<M
         memProtein.interfaceList[0].coord = (R - bond) / R * memProtein.comCoord;
     }
     if (memProtein.isLipid == false && memProtein.isImplicitLipid == false) {
-        std::cout << "WRONG: failed to create memProtein, in the step to adjust complex's orientation on sphere. Exit..." << std::endl;
+        std::cerr << "WRONG: failed to create memProtein, in the step to adjust complex's orientation on sphere. Exit..." << std::endl;
         exit(1);
     }
     //memProtein.comCoord =  (memProtein.comCoord.get_magnitude() + 0.1) / memProtein.comCoord.get_magnitude()  * memProtein.comCoord;
     //memProtein.interfaceList[0].coord = (memProtein.interfaceList[0].coord.get_magnitude() + 0.1)/memProtein.interfaceList[0].coord.get_magnitude() *  memProtein.interfaceList[0].coord;
 }
-void find_Lipid_sphere(Complex reactCom, Molecule& Lipid, std::vector<Molecule> moleculeList, const Membrane membraneObject)
+void find_Lipid_sphere(const Complex& reactCom, Molecule& Lipid, const std::vector<Molecule>& moleculeList, const Membrane& membraneObject)
 {
     //if (membraneObject.implicitLipid == false){ //for explicit lipid model; lipid is a member of reactCom
     double r = 0.0;
@@ -526,7 +553,7 @@ void find_Lipid_sphere(Complex reactCom, Molecule& Lipid, std::vector<Molecule>
     }
 
     if (Lipid.isLipid == false && Lipid.isImplicitLipid == false) {
-        std::cout << "WRONG: failed to create memProtein, in the step to adjust complex's orientation on sphere. Exit..." << std::endl;
+        std::cerr << "WRONG: failed to create memProtein, in the step to adjust complex's orientation on sphere. Exit..." << std::endl;
         exit(1);
     }
 
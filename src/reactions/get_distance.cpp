@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "reactions/bimolecular/bimolecular_reactions.hpp"
 
 bool get_distance(int pro1, int pro2, int iface1, int iface2, int rxnIndex, int rateIndex, bool isStateChangeBackRxn,
@@ -24,6 +25,9 @@ bool get_distance(int pro1, int pro2, int iface1, int iface2, int rxnIndex, int
                         && std::abs(complexList[moleculeList[pro2].myComIndex].D.z - 0) < 1E-10)
                 ? 0
                 : moleculeList[pro1].interfaceList[iface1].coord.z - moleculeList[pro2].interfaceList[iface2].coord.z };
+        // a Complex is kept whole, so its own interfaces only meet without going through a periodic side
+        if (moleculeList[pro1].myComIndex != moleculeList[pro2].myComIndex)
+            minimum_image(dx, dy, dz, membraneObject);
         R1 = sqrt((dx * dx) + (dy * dy) + (dz * dz));
         sep = R1 - currRxn.bindRadius;
     }
@@ -4,7 +4,7 @@
 #include <numeric>
 
 Molecule initialize_molecule_after_zeroth_reaction(
-    int index, Parameters& params, MolTemplate& molTemplate, const CreateDestructRxn& currRxn, const Membrane& membraneObject)
+    int index, Parameters& params, MolTemplate& molTemplate, const CreateDestructRxn& currRxn, const Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     /*!
@@ -26,7 +26,7 @@ Molecule initialize_molecule_after_zeroth_reaction(
     tmp.interfaceList = std::vector<Molecule::Iface>(molTemplate.interfaceList.size());
 
     // Create center of mass
-    tmp.create_random_coords(molTemplate, membraneObject);
+    tmp.create_random_coords(molTemplate, membraneObject, context.r);
     if (currRxn.productMolList.back().molTypeIndex == molTemplate.molTypeIndex) {
         for (auto& rxnIface : currRxn.productMolList.back().interfaceList) {
             tmp.interfaceList[rxnIface.relIfaceIndex].stateIden = rxnIface.requiresState;
@@ -49,17 +49,17 @@ Molecule initialize_molecule_after_zeroth_reaction(
 
     // iterate number of molecules in the system and set index
     tmp.index = index;
-    ++Molecule::numberOfMolecules;
+    ++context.numberOfMolecules;
     params.numTotalUnits = params.numTotalUnits + molTemplate.interfaceList.size() + 1;
 
     // keep track of molecule types
-    ++MolTemplate::numEachMolType[molTemplate.molTypeIndex];
+    ++context.numEachMolType[molTemplate.molTypeIndex];
 
     return tmp;
 }
 
 Molecule initialize_molecule_after_uni_reaction(int index, const Molecule& parentMol, Parameters& params,
-    MolTemplate& molTemplate, const CreateDestructRxn& currRxn)
+    MolTemplate& molTemplate, const CreateDestructRxn& currRxn, SimulContext& context)
 {
     // TRACE();
     Molecule tmp {};
@@ -74,8 +74,8 @@ Molecule initialize_molecule_after_uni_reaction(int index, const Molecule& paren
     tmp.interfaceList = std::vector<Molecule::Iface>(molTemplate.interfaceList.size());
 
     // put the specie in a random position around the specie which created it
-    double theta { rand_gsl() * 2 * M_PI };
-    double phi { std::acos(rand_gsl() * 2 - 1) };
+    double theta { rand_gsl(context.r) * 2 * M_PI };
+    double phi { std::acos(rand_gsl(context.r) * 2 - 1) };
     double cosTheta { std::cos(theta) };
     double sinTheta { std::sin(theta) };
     double cosPhi { std::cos(phi) };
@@ -115,11 +115,11 @@ Molecule initialize_molecule_after_uni_reaction(int index, const Molecule& paren
 
     // iterate number of molecules in the system and set index
     tmp.index = index;
-    ++Molecule::numberOfMolecules;
+    ++context.numberOfMolecules;
     params.numTotalUnits = params.numTotalUnits + molTemplate.interfaceList.size() + 1;
 
     // keep track of molecule types
-    ++MolTemplate::numEachMolType[molTemplate.molTypeIndex];
+    ++context.numEachMolType[molTemplate.molTypeIndex];
 
     return tmp;
 }
@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "classes/class_Rxns.hpp"
 #include "reactions/association/association.hpp"
 #include "reactions/shared_reaction_functions.hpp"
@@ -11,50 +12,43 @@
   includes all proteins, not just checkOverlap proteins.
 
 */
-void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& reactCom2,
-    std::vector<Molecule>& moleculeList, const Parameters& params,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList)
+double max_association_displacement(const Complex& reactCom, const Parameters& params)
 {
-    // TRACE();
-    double dx, dy, dz;
-    double R2;
-    double Dtot1, Dtot2, cf, Dr1, Dr2;
-    bool in2D = false;
-    double dim1 = 3; //dimensionality
-    double dim2 = 3; //dimensionality
+    double dim = 3; //dimensionality
 
     /*Assume diffusion is isotropic!*/
-    Dtot1 = reactCom1.D.x; //Dtot1 = 1.0 / 3.0 * (reactCom1.D.x) + 1.0 / 3.0 * (reactCom1.D.y) + 1.0 / 3.0 * (reactCom1.D.z);
-    Dtot2 = reactCom2.D.x; //Dtot2 = 1.0 / 3.0 * ( reactCom2.D.x) + 1.0 / 3.0 * ( reactCom2.D.y) + 1.0 / 3.0 * ( reactCom2.D.z);
+    double Dtot = reactCom.D.x; //Dtot = 1.0 / 3.0 * (reactCom.D.x) + 1.0 / 3.0 * (reactCom.D.y) + 1.0 / 3.0 * (reactCom.D.z);
 
-    /*Calculate a mean square displacement for each complex given D and dimensionality.*/
-    if (reactCom1.D.z < 1e-16) {
-        //complex 1 is in 2D
-        dim1 = 2;
+    /*Calculate a mean square displacement for the complex given D and dimensionality.*/
+    if (reactCom.D.z < 1e-16) {
+        //complex is in 2D
+        dim = 2;
     }
-    if (reactCom2.D.z < 1e-16) {
-        //complex 2 is in 2D
-        dim2 = 2;
-    }
-    if (dim1 == 2 && dim2 == 2)
-        in2D = true;
 
     /*rotational displacement*/
-    cf = cos(sqrt(2.0 * (dim1 - 1) * reactCom1.Dr.z * params.timeStep));
-    Dr1 = 2.0 * reactCom1.radius * reactCom1.radius * (1.0 - cf);
-    cf = cos(sqrt(2.0 * (dim2 - 1) * reactCom2.Dr.z * params.timeStep));
-    Dr2 = 2.0 * reactCom2.radius * reactCom2.radius * (1.0 - cf);
+    double cf = cos(sqrt(2.0 * (dim - 1) * reactCom.Dr.z * params.timeStep));
+    double Dr = 2.0 * reactCom.radius * reactCom.radius * (1.0 - cf);
+
+    Dtot += Dr / (2.0 * dim * params.timeStep); //in 2D, use 4, 3D, use 6
 
-    Dtot1 += Dr1 / (2.0 * dim1 * params.timeStep); //in 2D, use 4
-    Dtot2 += Dr2 / (2.0 * dim2 * params.timeStep); //in 2D, use 4, 3D, use 6
+    double avgDisp = sqrt(2.0 * dim * Dtot * params.timeStep); //from Einstein relation.
 
-    double avgDisp1 = sqrt(2.0 * dim1 * Dtot1 * params.timeStep); //from Einstein relation.
-    double avgDisp2 = sqrt(2.0 * dim2 * Dtot2 * params.timeStep); //from Einstein relation.
+    /*calculated average displacement of the complex in the step, due to both translational and rotational diffusion. Use this distance multiplied by params.scaleMaxDisplace to decide if motion is too large */
+    return params.scaleMaxDisplace * avgDisp; //nm
+}
 
-    /*calculated average displacement of both complexes in the step, due to both translational and rotational diffusion. Use this distance multiplied by params.scaleMaxDisplace to decide if motion is too large */
-    double LARGE_DISP1 = params.scaleMaxDisplace * avgDisp1; //nm
+void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& reactCom2,
+    std::vector<Molecule>& moleculeList, const Parameters& params,
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<Complex>& complexList,
+    const Membrane& membraneObject)
+{
+    // TRACE();
+    double dx, dy, dz;
+    double R2;
+
+    double LARGE_DISP1 = max_association_displacement(reactCom1, params); //nm
     double LDISP1SQ = LARGE_DISP1 * LARGE_DISP1;
-    double LARGE_DISP2 = params.scaleMaxDisplace * avgDisp2; //nm
+    double LARGE_DISP2 = max_association_displacement(reactCom2, params); //nm
     double LDISP2SQ = LARGE_DISP2 * LARGE_DISP2;
 
     int mp;
@@ -69,6 +63,7 @@ void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& react
     dx = reactCom1.tmpComCoord.x - reactCom1.comCoord.x;
     dy = reactCom1.tmpComCoord.y - reactCom1.comCoord.y;
     dz = reactCom1.tmpComCoord.z - reactCom1.comCoord.z;
+    minimum_image(dx, dy, dz, membraneObject); // reactCom2 can have been moved to the image next to reactCom1
 
     R2 = dx * dx + dy * dy + dz * dz;
     if (R2 > LDISP1SQ) {
@@ -81,6 +76,7 @@ void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& react
     dx = reactCom2.tmpComCoord.x - reactCom2.comCoord.x;
     dy = reactCom2.tmpComCoord.y - reactCom2.comCoord.y;
     dz = reactCom2.tmpComCoord.z - reactCom2.comCoord.z;
+    minimum_image(dx, dy, dz, membraneObject);
 
     R2 = dx * dx + dy * dy + dz * dz;
     if (R2 > LDISP2SQ) {
@@ -98,6 +94,7 @@ void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& react
         dx = moleculeList[mp].tmpComCoord.x - moleculeList[mp].comCoord.x;
         dy = moleculeList[mp].tmpComCoord.y - moleculeList[mp].comCoord.y;
         dz = moleculeList[mp].tmpComCoord.z - moleculeList[mp].comCoord.z;
+        minimum_image(dx, dy, dz, membraneObject);
 
         R2 = dx * dx + dy * dy + dz * dz;
         // double moleculeRad=molTemplateList[moleculeList[mp].molTypeIndex].radius*2.0;//they are the exact same protein at different positions
@@ -118,6 +115,7 @@ void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& react
         dx = moleculeList[mp].tmpComCoord.x - moleculeList[mp].comCoord.x;
         dy = moleculeList[mp].tmpComCoord.y - moleculeList[mp].comCoord.y;
         dz = moleculeList[mp].tmpComCoord.z - moleculeList[mp].comCoord.z;
+        minimum_image(dx, dy, dz, membraneObject);
 
         R2 = dx * dx + dy * dy + dz * dz;
         // double moleculeRad=molTemplateList[moleculeList[mp].molTypeIndex].radius*2.0;//they are the exact same protein at different positions
@@ -131,3 +129,28 @@ void measure_complex_displacement(bool& flag, Complex& reactCom1, Complex& react
 
     } //all proteins in Com2
 }
+
+void measure_deferred_displacement(bool& flag, const Molecule& reactMol1, const Molecule& reactMol2,
+    const Complex& reactCom1, const Complex& reactCom2, const Parameters& params, const Membrane& membraneObject)
+{
+    /*The COMs of the moved complexes can differ from their tmpComCoord by rounding, so those are only canceled if
+      they're further out than that. The reacting proteins are at their final tmp coords already, as in the full test*/
+    const double tol { 1E-6 };
+    auto is_displaced = [&](const Molecule& reactMol, const Complex& reactCom) {
+        double LARGE_DISP = max_association_displacement(reactCom, params);
+        double LDISPSQ = LARGE_DISP * LARGE_DISP;
+
+        Vector comDisp { reactCom.tmpComCoord - reactCom.comCoord };
+        minimum_image(comDisp, membraneObject);
+        if (comDisp.get_magnitude() > LARGE_DISP + tol)
+            return true;
+
+        double dx = reactMol.tmpComCoord.x - reactMol.comCoord.x;
+        double dy = reactMol.tmpComCoord.y - reactMol.comCoord.y;
+        double dz = reactMol.tmpComCoord.z - reactMol.comCoord.z;
+        minimum_image(dx, dy, dz, membraneObject);
+        return dx * dx + dy * dy + dz * dz > LDISPSQ;
+    };
+    if (is_displaced(reactMol1, reactCom1) || is_displaced(reactMol2, reactCom2))
+        flag = true;
+}
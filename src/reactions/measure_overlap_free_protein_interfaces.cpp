@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "classes/class_Rxns.hpp"
 #include "reactions/association/association.hpp"
 #include "reactions/shared_reaction_functions.hpp"
@@ -9,8 +10,9 @@
   Cancelled. base1 is not associating in this step, it is part of the system, base2 is performing association this step.
   For baseTmp, access its Tmp coords, as it is testing its new orientation!
  */
-void measure_overlap_free_protein_interfaces(Molecule base1, Molecule baseTmp, bool& flagCancel,
-    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns)
+void measure_overlap_free_protein_interfaces(const Molecule& base1, const Molecule& baseTmp, bool& flagCancel,
+    const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<BackRxn>& backRxns,
+    const Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     int pro1MolType = base1.molTypeIndex;
@@ -60,7 +62,7 @@ void measure_overlap_free_protein_interfaces(Molecule base1, Molecule baseTmp, b
                         bool isStateChangeBackRxn { false };
 
                         find_which_reaction(relIface1, relIface2, rxnIndex, rateIndex, isStateChangeBackRxn, state,
-                            base1, baseTmp, forwardRxns, backRxns, molTemplateList);
+                            base1, baseTmp, forwardRxns, backRxns, molTemplateList, context);
 
                         if (rxnIndex != -1 && rateIndex != -1) {
 
@@ -71,6 +73,7 @@ void measure_overlap_free_protein_interfaces(Molecule base1, Molecule baseTmp, b
                             double dx = base1.interfaceList[relIface1].coord.x - baseTmp.tmpICoords[relIface2].x;
                             double dy = base1.interfaceList[relIface1].coord.y - baseTmp.tmpICoords[relIface2].y;
                             double dz = base1.interfaceList[relIface1].coord.z - baseTmp.tmpICoords[relIface2].z;
+                            minimum_image(dx, dy, dz, membraneObject);
 
                             d2 = dx * dx + dy * dy + dz * dz;
                             if (d2 < bindrad2) {
@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "classes/class_Rxns.hpp"
 #include "reactions/association/association.hpp"
 #include "reactions/shared_reaction_functions.hpp"
@@ -9,7 +10,8 @@
   Cancelled. base1 is not associating in this step, it is part of the system, base2 is performing association this step.
   For baseTmp, access its Tmp coords, as it is testing its new orientation!
  */
-void measure_overlap_protein_interfaces(Molecule base1, Molecule baseTmp, bool& flagCancel)
+void measure_overlap_protein_interfaces(const Molecule& base1, const Molecule& baseTmp, bool& flagCancel,
+    const Membrane& membraneObject)
 {
     // TRACE();
     for (unsigned i { 0 }; i < base1.interfaceList.size(); i++) {
@@ -22,6 +24,7 @@ void measure_overlap_protein_interfaces(Molecule base1, Molecule baseTmp, bool&
             double dx = base1.interfaceList[i].coord.x - baseTmp.tmpICoords[m].x;
             double dy = base1.interfaceList[i].coord.y - baseTmp.tmpICoords[m].y;
             double dz = base1.interfaceList[i].coord.z - baseTmp.tmpICoords[m].z;
+            minimum_image(dx, dy, dz, membraneObject);
 
             d2 = dx * dx + dy * dy + dz * dz;
             if (d2 < bindrad2) {
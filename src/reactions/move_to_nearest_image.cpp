@@ -0,0 +1,18 @@
+#include "boundary_conditions/boundary_geometry.hpp"
+#include "reactions/association/association.hpp"
+
+Coord move_to_nearest_image(Coord reactIface1, Coord reactIface2, Complex& reactCom2,
+    std::vector<Molecule>& moleculeList, const Membrane& membraneObject)
+{
+    if (!membraneObject.hasPeriodic)
+        return Coord {};
+
+    // the reacting interfaces are within reach through the periodic sides, so reactCom2 is placed on that side
+    Coord sep { reactIface1 - reactIface2 };
+    Coord nearestSep { sep };
+    minimum_image(nearestSep, membraneObject);
+    Coord shift { sep - nearestSep };
+    if (shift.x != 0 || shift.y != 0 || shift.z != 0)
+        translate_tmp_crds(Vector { shift }, reactCom2, moleculeList);
+    return shift;
+}
@@ -3,7 +3,13 @@
 
 #include <cmath>
 
-Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
+namespace {
+/* templateICoord(k) is the k-th interface coordinate of the template, which has numTemplateIfaces interfaces and its
+ * center of mass at templateComCoord
+ */
+template <typename TemplateICoord>
+Quat orient_to_template(TemplateICoord templateICoord, const Coord& templateComCoord, size_t numTemplateIfaces,
+    bool isRod, MolGeometry& targMol)
 {
     // TRACE();
     Quat firstRot {};
@@ -12,9 +18,9 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
         // determine the interface-center of mass vector (v0, v1), the rotation vector (u), and the angle to rotate
         // (angle)
         // arbitrarily the center of mass to first interface of the MolTemplate
-        Vector vec1 { oneTemplate.interfaceList[0].iCoord - oneTemplate.comCoord };
+        Vector vec1 { templateICoord(0) - templateComCoord };
         // the center of mass to first interface of the target Molecule
-        Vector vec2 { targMol.tmpICoords[0] - targMol.tmpComCoord };
+        Vector vec2 { targMol.iCoords[0] - targMol.comCoord };
         // the rotation vector formed by v0 cross v1
         vec1.calc_magnitude();
         vec2.calc_magnitude();
@@ -29,9 +35,9 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
             sa * rotAxis.z };
         firstRot = firstRot.unit();
         {
-            Vector tmpVec { targMol.tmpICoords[0] - targMol.tmpComCoord };
+            Vector tmpVec { targMol.iCoords[0] - targMol.comCoord };
             firstRot.rotate(tmpVec);
-            if (std::abs(tmpVec.x - oneTemplate.interfaceList[0].iCoord.x) > 1E-8 || std::abs(tmpVec.y - oneTemplate.interfaceList[0].iCoord.y) > 1E-8 || std::abs(tmpVec.z - oneTemplate.interfaceList[0].iCoord.z) > 1E-8) {
+            if (std::abs(tmpVec.x - templateICoord(0).x) > 1E-8 || std::abs(tmpVec.y - templateICoord(0).y) > 1E-8 || std::abs(tmpVec.z - templateICoord(0).z) > 1E-8) {
                 angle = -angle;
                 sa = sin(angle / 2);
                 firstRot = Quat { cos(angle / 2), sa * rotAxis.x, sa * rotAxis.y,
@@ -40,27 +46,27 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
             }
         }
 
-        for (auto& iface : targMol.tmpICoords) {
-            Vector tmpVec { iface - targMol.tmpComCoord };
+        for (auto& iface : targMol.iCoords) {
+            Vector tmpVec { iface - targMol.comCoord };
             firstRot.rotate(tmpVec);
             iface = Coord { tmpVec.x, tmpVec.y, tmpVec.z };
         }
     }
 
-    if (targMol.interfaceList.size() > 1) {
+    if (targMol.iCoords.size() > 1) {
         // if the protein has more than one interface, use a second one to make sure all the interfaces line up
         // First check to make sure they're not in a line. If so, use the last interface
         size_t ifaceIndex { 1 };
         {
-            Vector ifaceVec1 { oneTemplate.interfaceList[0].iCoord - oneTemplate.comCoord };
-            Vector ifaceVec2 { oneTemplate.interfaceList[1].iCoord - oneTemplate.comCoord };
+            Vector ifaceVec1 { templateICoord(0) - templateComCoord };
+            Vector ifaceVec2 { templateICoord(1) - templateComCoord };
             ifaceVec1.calc_magnitude();
             ifaceVec2.calc_magnitude();
 
             double ang1 { ifaceVec1.dot_theta(ifaceVec2) };
-            if ((ang1 == 0 || ang1 == M_PI) && !oneTemplate.isRod && oneTemplate.interfaceList.size() > 2) {
-                size_t tmpIndex { oneTemplate.interfaceList.size() - 1 };
-                Vector ifaceVec3 { oneTemplate.interfaceList[tmpIndex].iCoord - oneTemplate.comCoord };
+            if ((ang1 == 0 || ang1 == M_PI) && !isRod && numTemplateIfaces > 2) {
+                size_t tmpIndex { numTemplateIfaces - 1 };
+                Vector ifaceVec3 { templateICoord(tmpIndex) - templateComCoord };
                 ifaceVec3.calc_magnitude();
                 double ang2 { ifaceVec1.dot_theta(ifaceVec3) };
                 if (ang2 == 0 || ang2 == M_PI) {
@@ -72,9 +78,9 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
                 ifaceIndex = tmpIndex;
             }
         }
-        Vector v0 { oneTemplate.interfaceList[ifaceIndex].iCoord - oneTemplate.comCoord };
-        Vector v1 { targMol.tmpICoords[ifaceIndex] - targMol.tmpComCoord };
-        Vector rotAxis { targMol.tmpICoords[0] - targMol.tmpComCoord };
+        Vector v0 { templateICoord(ifaceIndex) - templateComCoord };
+        Vector v1 { targMol.iCoords[ifaceIndex] - targMol.comCoord };
+        Vector rotAxis { targMol.iCoords[0] - targMol.comCoord };
         v0.calc_magnitude();
         v1.calc_magnitude();
         rotAxis.normalize();
@@ -95,9 +101,9 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
         secondRot = secondRot.unit();
 
         //        {
-        //            Vector tmpVec { targMol.tmpICoords[ifaceIndex] - targMol.tmpComCoord };
+        //            Vector tmpVec { targMol.iCoords[ifaceIndex] - targMol.comCoord };
         //            firstRot.rotate(tmpVec);
-        //            if(std::abs(tmpVec.x - oneTemplate.interfaceList[ifaceIndex].iCoord.x) > 1E-8 || std::abs(tmpVec.y - oneTemplate.interfaceList[ifaceIndex].iCoord.y) > 1E-8 || std::abs(tmpVec.z - oneTemplate.interfaceList[ifaceIndex].iCoord.z) > 1E-8) {
+        //            if(std::abs(tmpVec.x - templateICoord(ifaceIndex).x) > 1E-8 || std::abs(tmpVec.y - templateICoord(ifaceIndex).y) > 1E-8 || std::abs(tmpVec.z - templateICoord(ifaceIndex).z) > 1E-8) {
         //                angle = -angle;
         //                sa = sin(angle/2);
         //                secondRot = Quat { cos(angle / 2), sa * rotAxis.x, sa * rotAxis.y,
@@ -108,8 +114,8 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
 
         // might not need this, but good for a check after
         // to make sure it worked
-        for (auto& iface : targMol.tmpICoords) {
-            Vector tmpVec { iface - targMol.tmpComCoord };
+        for (auto& iface : targMol.iCoords) {
+            Vector tmpVec { iface - targMol.comCoord };
             secondRot.rotate(tmpVec);
             iface = Coord { tmpVec.x, tmpVec.y, tmpVec.z };
         }
@@ -117,5 +123,20 @@ Quat orient_crds_to_template(const MolTemplate& oneTemplate, Molecule& targMol)
 
     // now use the inverse quat product to rotate the norm to
     // its actual position
-    return (targMol.tmpICoords.size() > 1) ? (secondRot * firstRot) : firstRot;
+    return (targMol.iCoords.size() > 1) ? (secondRot * firstRot) : firstRot;
+}
+}
+
+Quat orient_crds_to_template(const MolTemplate& oneTemplate, MolGeometry& targMol)
+{
+    return orient_to_template(
+        [&oneTemplate](size_t ifaceIndex) -> const Coord& { return oneTemplate.interfaceList[ifaceIndex].iCoord; },
+        oneTemplate.comCoord, oneTemplate.interfaceList.size(), oneTemplate.isRod, targMol);
+}
+
+Quat orient_crds_to_template(const MolGeometry& oneTemplate, bool isRod, MolGeometry& targMol)
+{
+    return orient_to_template(
+        [&oneTemplate](size_t ifaceIndex) -> const Coord& { return oneTemplate.iCoords[ifaceIndex]; },
+        oneTemplate.comCoord, oneTemplate.iCoords.size(), isRod, targMol);
 }
@@ -9,19 +9,19 @@ void perform_bimolecular_state_change(int stateChangeIface, int facilitatorIface
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context)
 {
     if (membraneObject.isSphere == true) {
         perform_bimolecular_state_change_sphere(stateChangeIface, facilitatorIface, rxnItr,
             stateChangeMol, facilitatorMol, stateChangeCom, facilitatorCom,
             counterArrays, params, forwardRxns,
             backRxns, moleculeList, complexList,
-            molTemplateList, observablesList, membraneObject);
+            molTemplateList, observablesList, membraneObject, context);
     } else {
         perform_bimolecular_state_change_box(stateChangeIface, facilitatorIface, rxnItr,
             stateChangeMol, facilitatorMol, stateChangeCom, facilitatorCom,
             counterArrays, params, forwardRxns,
             backRxns, moleculeList, complexList,
-            molTemplateList, observablesList, membraneObject);
+            molTemplateList, observablesList, membraneObject, context);
     }
 }
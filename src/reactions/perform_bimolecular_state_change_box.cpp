@@ -10,7 +10,7 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     const auto& stateList = molTemplateList[stateChangeMol.molTypeIndex].interfaceList[stateChangeIface].stateList;
@@ -49,6 +49,9 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
     // create references to reacting interfaces
     Coord& reactIface1 = facilitatorMol.tmpICoords[facilitatorIface];
     Coord& reactIface2 = stateChangeMol.tmpICoords[stateChangeIface];
+    Coord imageShift {};
+    if (stateChangeCom.index != facilitatorCom.index)
+        imageShift = move_to_nearest_image(reactIface1, reactIface2, stateChangeCom, moleculeList, membraneObject);
     //    std::cout <<" ORIGINAL CRDS: "<<std::endl;
     //write_xyz_assoc_cout( stateChangeCom, facilitatorCom, moleculeList);
 
@@ -60,7 +63,6 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
     //orientation corrections for membrane bound components
     bool isOnMembrane = false;
     bool transitionToSurface = false;
-    Molecule memProtein;
     double tol = 1E-14;
     int slowPro;
 
@@ -84,11 +86,9 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
             /*Store coordinates of one protein to recover membrane-bound orientation*/
 
             if (stateChangeCom.D.x < facilitatorCom.D.x) {
-                slowPro = stateChangeMol.index;
-                memProtein = stateChangeMol; //rotate relative to the slower protein.
+                slowPro = stateChangeMol.index; //rotate relative to the slower protein.
             } else {
                 slowPro = facilitatorMol.index;
-                memProtein = facilitatorMol;
             }
 
             DzSum = 1; // to prevent divide by 0
@@ -105,11 +105,9 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
             if (stateChangeCom.D.z < tol || facilitatorCom.D.z < tol) {
 	      transitionToSurface = true; //both can't be less than tol, or would not be in this loop.
 	      if (stateChangeCom.D.z < facilitatorCom.D.z) {
-                slowPro = stateChangeMol.index;
-                memProtein = stateChangeMol; //rotate relative to the slower protein.
+                slowPro = stateChangeMol.index; //rotate relative to the slower protein.
 	      } else {
                 slowPro = facilitatorMol.index;
-                memProtein = facilitatorMol;
 	      }
 	      
 	      // std::cout << "TRANSITIONING FROM 3D->2D " << std::endl;
@@ -215,12 +213,12 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
 
         if (slowPro == facilitatorMol.index) {
             //	facilitatorMol.display_assoc_icoords("CURRORIENTATION_TOROTATE1");
-            memRot = save_mem_orientation(memProtein, facilitatorMol, molTemplateList[facilitatorMol.molTypeIndex]);
+            memRot = save_mem_orientation(facilitatorMol, facilitatorMol, molTemplateList[facilitatorMol.molTypeIndex]);
             pivot = facilitatorMol.tmpComCoord;
 
         } else {
             //stateChangeMol.display_assoc_icoords("CURRORIENTATION_TOROTATE2");
-            memRot = save_mem_orientation(memProtein, stateChangeMol, molTemplateList[stateChangeMol.molTypeIndex]);
+            memRot = save_mem_orientation(stateChangeMol, stateChangeMol, molTemplateList[stateChangeMol.molTypeIndex]);
             pivot = stateChangeMol.tmpComCoord;
         }
 
@@ -322,8 +320,8 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
     update_complex_tmp_com_crds(facilitatorCom, moleculeList);
     update_complex_tmp_com_crds(stateChangeCom, moleculeList);
 
-    reflect_traj_tmp_crds(params, moleculeList, facilitatorCom, traj, membraneObject, 0.0); //uses tmpCoords to calculate traj.
-    reflect_traj_tmp_crds(params, moleculeList, stateChangeCom, traj, membraneObject, 0.0);
+    reflect_traj_tmp_crds_box(params, moleculeList, facilitatorCom, traj, membraneObject, 0.0); //uses tmpCoords to calculate traj.
+    reflect_traj_tmp_crds_box(params, moleculeList, stateChangeCom, traj, membraneObject, 0.0);
 
     if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-15) {
         // update the temporary coordinates for both complexes
@@ -343,7 +341,7 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
     if (cancelAssoc == false)
         check_if_spans_box(cancelAssoc, params, facilitatorCom, stateChangeCom, moleculeList, membraneObject);
     if (cancelAssoc == false)
-        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
+        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
 
     if (cancelAssoc) {
         // std::cout << "Canceling association, returning complexes to original state.\n";
@@ -374,12 +372,14 @@ void perform_bimolecular_state_change_box(int stateChangeIface, int facilitatorI
         for (unsigned int i { 0 }; i < moleculeList[memMol].interfaceList.size(); ++i)
             moleculeList[memMol].interfaceList[i].coord = moleculeList[memMol].tmpICoords[i];
         moleculeList[memMol].clear_tmp_association_coords();
+        moleculeList[memMol].imageOffset -= imageShift;
         moleculeList[memMol].trajStatus = TrajStatus::propagated;
     }
     stateChangeCom.update_properties(moleculeList, molTemplateList);
 
     // Enforce boundary conditions
-    reflect_complex_rad_rot(membraneObject, facilitatorCom, moleculeList, 0.0);
+    reflect_complex_rad_rot_box(membraneObject, facilitatorCom, moleculeList, 0.0);
+    wrap_complex_periodic(stateChangeCom, moleculeList, membraneObject);
 
     for (unsigned crossItr { 0 }; crossItr < stateChangeMol.crossbase.size(); ++crossItr) {
         int skipMol { stateChangeMol.crossbase[crossItr] };
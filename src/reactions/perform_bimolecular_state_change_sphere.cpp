@@ -11,7 +11,7 @@ void perform_bimolecular_state_change_sphere(int stateChangeIface, int facilitat
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     const auto& stateList = molTemplateList[stateChangeMol.molTypeIndex].interfaceList[stateChangeIface].stateList;
@@ -468,8 +468,8 @@ void perform_bimolecular_state_change_sphere(int stateChangeIface, int facilitat
     update_complex_tmp_com_crds(facilitatorCom, moleculeList);
     update_complex_tmp_com_crds(stateChangeCom, moleculeList);
 
-    reflect_traj_tmp_crds(params, moleculeList, facilitatorCom, traj, membraneObject, 0.0); //uses tmpCoords to calculate traj.
-    reflect_traj_tmp_crds(params, moleculeList, stateChangeCom, traj, membraneObject, 0.0);
+    reflect_traj_tmp_crds_sphere(params, moleculeList, facilitatorCom, traj, membraneObject, 0.0); //uses tmpCoords to calculate traj.
+    reflect_traj_tmp_crds_sphere(params, moleculeList, stateChangeCom, traj, membraneObject, 0.0);
 
     if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-15) {
         // update the temporary coordinates for both complexes
@@ -489,7 +489,7 @@ void perform_bimolecular_state_change_sphere(int stateChangeIface, int facilitat
     if (cancelAssoc == false)
         check_if_spans_sphere(cancelAssoc, params, facilitatorCom, stateChangeCom, moleculeList, membraneObject);
     if (cancelAssoc == false)
-        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
+        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
 
     if (cancelAssoc) {
         // std::cout << "Canceling association, returning complexes to original state.\n";
@@ -525,7 +525,7 @@ void perform_bimolecular_state_change_sphere(int stateChangeIface, int facilitat
     stateChangeCom.update_properties(moleculeList, molTemplateList);
 
     // Enforce boundary conditions
-    reflect_complex_rad_rot(membraneObject, facilitatorCom, moleculeList, 0.0);
+    reflect_complex_rad_rot_sphere(membraneObject, facilitatorCom, moleculeList, 0.0);
 
     for (unsigned crossItr { 0 }; crossItr < stateChangeMol.crossbase.size(); ++crossItr) {
         int skipMol { stateChangeMol.crossbase[crossItr] };
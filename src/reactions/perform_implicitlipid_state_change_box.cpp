@@ -12,7 +12,7 @@ void perform_implicitlipid_state_change_box(int stateChangeIface, int facilitato
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     const auto& stateList = molTemplateList[stateChangeMol.molTypeIndex].interfaceList[stateChangeIface].stateList;
@@ -365,7 +365,7 @@ void perform_implicitlipid_state_change_box(int stateChangeIface, int facilitato
     update_complex_tmp_com_crds(facilitatorCom, moleculeList);
     //update_complex_tmp_com_crds(stateChangeCom, moleculeList);
 
-    reflect_traj_tmp_crds(params, moleculeList, facilitatorCom, traj, membraneObject, RS3D); //uses tmpCoords to calculate traj.
+    reflect_traj_tmp_crds_box(params, moleculeList, facilitatorCom, traj, membraneObject, RS3D); //uses tmpCoords to calculate traj.
     //reflect_traj_tmp_crds(params, moleculeList, stateChangeCom, traj, membraneObject);
 
     if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-50) {
@@ -386,7 +386,7 @@ void perform_implicitlipid_state_change_box(int stateChangeIface, int facilitato
     if (cancelAssoc == false)
         check_if_spans_box(cancelAssoc, params, facilitatorCom, stateChangeCom, moleculeList, membraneObject);
     if (cancelAssoc == false)
-        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
+        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
 
     if (cancelAssoc) {
         // std::cout << "Canceling association, returning complexes to original state.\n";
@@ -464,7 +464,7 @@ void perform_implicitlipid_state_change_box(int stateChangeIface, int facilitato
     stateChangeCom.update_properties(moleculeList, molTemplateList);
 
     // Enforce boundary conditions
-    reflect_complex_rad_rot(membraneObject, facilitatorCom, moleculeList, RS3D);
+    reflect_complex_rad_rot_box(membraneObject, facilitatorCom, moleculeList, RS3D);
 
     //for (unsigned crossItr { 0 }; crossItr < stateChangeMol.crossbase.size(); ++crossItr) {
     //    int skipMol { stateChangeMol.crossbase[crossItr] };
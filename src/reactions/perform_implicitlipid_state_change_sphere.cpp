@@ -14,7 +14,7 @@ void perform_implicitlipid_state_change_sphere(int stateChangeIface, int facilit
     Molecule& stateChangeMol, Molecule& facilitatorMol, Complex& stateChangeCom, Complex& facilitatorCom,
     copyCounters& counterArrays, const Parameters& params, std::vector<ForwardRxn>& forwardRxns,
     std::vector<BackRxn>& backRxns, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, std::map<std::string, int>& observablesList, Membrane& membraneObject, SimulContext& context)
 {
     // TRACE();
     const auto& stateList = molTemplateList[stateChangeMol.molTypeIndex].interfaceList[stateChangeIface].stateList;
@@ -273,7 +273,7 @@ void perform_implicitlipid_state_change_sphere(int stateChangeIface, int facilit
     update_complex_tmp_com_crds(facilitatorCom, moleculeList);
     //update_complex_tmp_com_crds(stateChangeCom, moleculeList);
 
-    reflect_traj_tmp_crds(params, moleculeList, facilitatorCom, traj, membraneObject, RS3D); //uses tmpCoords to calculate traj.
+    reflect_traj_tmp_crds_sphere(params, moleculeList, facilitatorCom, traj, membraneObject, RS3D); //uses tmpCoords to calculate traj.
     //reflect_traj_tmp_crds(params, moleculeList, stateChangeCom, traj, membraneObject);
 
     if (std::abs(traj[0] + traj[1] + traj[2]) > 1E-15) {
@@ -294,7 +294,7 @@ void perform_implicitlipid_state_change_sphere(int stateChangeIface, int facilit
     if (cancelAssoc == false)
         check_if_spans_sphere(cancelAssoc, params, facilitatorCom, stateChangeCom, moleculeList, membraneObject);
     if (cancelAssoc == false)
-        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns);
+        check_for_structure_overlap_system(cancelAssoc, facilitatorCom, stateChangeCom, moleculeList, params, molTemplateList, complexList, forwardRxns, backRxns, membraneObject, context);
 
     if (cancelAssoc) {
         // std::cout << "Canceling association, returning complexes to original state.\n";
@@ -372,7 +372,7 @@ void perform_implicitlipid_state_change_sphere(int stateChangeIface, int facilit
     stateChangeCom.update_properties(moleculeList, molTemplateList);
 
     // Enforce boundary conditions
-    reflect_complex_rad_rot(membraneObject, facilitatorCom, moleculeList, RS3D);
+    reflect_complex_rad_rot_sphere(membraneObject, facilitatorCom, moleculeList, RS3D);
 
     //for (unsigned crossItr { 0 }; crossItr < stateChangeMol.crossbase.size(); ++crossItr) {
     //    int skipMol { stateChangeMol.crossbase[crossItr] };
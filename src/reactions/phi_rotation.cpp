@@ -30,9 +30,9 @@ void phi_rotation(Coord& reactIface1, Coord& reactIface2, int ifaceIndex2, Molec
      * Why the index of the fferior interface?
      *
      * The index of iface2 is needed because iface1 and iface2 are references to references to (yes, references to
-     * references) their respective coordinates in their respective Molecule's assocICoords vector. Since iface1,
-     * iface2, mol1, and mol2 are passed by value to calculate_phi(), and through it also to transform(). The
-     * transform() function does a coordinate transformation which changes the mol1 and mol2 coordinates but does
+     * references) their respective coordinates in their respective Molecule's assocICoords vector. Since iface1 and
+     * iface2 are passed by value to calculate_phi(), which passes copies of the mol1 and mol2 coordinates to
+     * transform(). The transform() function does a coordinate transformation which changes those copies but does
      * not change iface1 or iface2, since they are references to different objects. Because of this, the creation of
      * the projected vectors in calculate_phi() will fail unless the index of iface2 is passed to it.
      */
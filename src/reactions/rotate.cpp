@@ -1,22 +1,39 @@
 #include "reactions/association/association.hpp"
 
+Coord rotate_point(const Coord& point, const Coord& rotOrigin, Quat& rotQuat)
+{
+    Vector pointVec { point - rotOrigin };
+    rotQuat.rotate(pointVec);
+    return Coord(pointVec.x, pointVec.y, pointVec.z) + Coord(rotOrigin.x, rotOrigin.y, rotOrigin.z);
+}
+
+void rotate_tmp_crds(const Coord& rotOrigin, Quat& rotQuat, Molecule& targMol)
+{
+    targMol.tmpComCoord = rotate_point(targMol.tmpComCoord, rotOrigin, rotQuat);
+
+    // now rotate each interface of the molecule
+    for (auto& iface : targMol.tmpICoords)
+        iface = rotate_point(iface, rotOrigin, rotQuat);
+}
+
 void rotate(Coord& rotOrigin, Quat& rotQuat, Complex& targCom,
     std::vector<Molecule>& moleculeList)
 {
-    // First rotate all points in complex 1 around the reacting interface of
-    // protein p1, and translate them by vector
-    for (auto& mol : targCom.memberList) {
-        Vector comVec { moleculeList[mol].tmpComCoord - rotOrigin };
-        rotQuat.rotate(comVec);
-        moleculeList[mol].tmpComCoord = Coord(comVec.x, comVec.y, comVec.z) + Coord(rotOrigin.x, rotOrigin.y, rotOrigin.z);
+    if (targCom.deferredMolIndex != -1) {
+        // only the reacting molecule and the complex COM are moved for now, see defer_tmp_crds
+        DeferredMove move {};
+        move.isRotation = true;
+        move.rotOrigin = rotOrigin;
+        move.rotQuat = rotQuat;
+        targCom.deferredMoves.push_back(move);
 
-        // now rotate each member molecule of the complex
-        for (auto& iface : moleculeList[mol].tmpICoords) {
-            // get the vector from the interface to the target interface
-            Vector ifaceVec { iface - rotOrigin };
-            // rotate
-            rotQuat.rotate(ifaceVec);
-            iface = Coord(ifaceVec.x, ifaceVec.y, ifaceVec.z) + Coord(rotOrigin.x, rotOrigin.y, rotOrigin.z);
-        }
+        targCom.tmpComCoord = rotate_point(targCom.tmpComCoord, rotOrigin, rotQuat);
+        rotate_tmp_crds(rotOrigin, rotQuat, moleculeList[targCom.deferredMolIndex]);
+        return;
     }
-}
\ No newline at end of file
+
+    // First rotate all points in complex 1 around the reacting interface of
+    // protein p1, and translate them by vector
+    for (auto& mol : targCom.memberList)
+        rotate_tmp_crds(rotOrigin, rotQuat, moleculeList[mol]);
+}
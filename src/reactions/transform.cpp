@@ -1,6 +1,6 @@
 #include "reactions/association/association.hpp"
 
-void transform(Coord& reactIface, Molecule& reactMol1, Molecule& reactMol2, const Vector& axis)
+void transform(Coord& reactIface, MolGeometry& reactMol1, MolGeometry& reactMol2, const Vector& axis)
 {
     Vector alignAxis {};
 //     if (isOnMembrane)
@@ -26,12 +26,12 @@ void transform(Coord& reactIface, Molecule& reactMol1, Molecule& reactMol2, cons
 
     { // base1
         // rotate COM
-        Vector comVec { reactMol1.tmpComCoord - reactIface };
+        Vector comVec { reactMol1.comCoord - reactIface };
         rotQuat.rotate(comVec);
-        reactMol1.tmpComCoord = Coord(comVec.x, comVec.y, comVec.z) + reactIface;
+        reactMol1.comCoord = Coord(comVec.x, comVec.y, comVec.z) + reactIface;
 
         // rotate all the other interfaces
-        for (auto& coord : reactMol1.tmpICoords) {
+        for (auto& coord : reactMol1.iCoords) {
             Vector ifaceVec { coord - reactIface };
             // rotate the vector
             rotQuat.rotate(ifaceVec);
@@ -39,12 +39,12 @@ void transform(Coord& reactIface, Molecule& reactMol1, Molecule& reactMol2, cons
         }
     }
     { // base2
-        Vector comVec { reactMol2.tmpComCoord - reactIface };
+        Vector comVec { reactMol2.comCoord - reactIface };
         rotQuat.rotate(comVec);
-        reactMol2.tmpComCoord = Coord(comVec.x, comVec.y, comVec.z) + reactIface;
+        reactMol2.comCoord = Coord(comVec.x, comVec.y, comVec.z) + reactIface;
 
         // rotate the ifaces
-        for (auto& coord : reactMol2.tmpICoords) {
+        for (auto& coord : reactMol2.iCoords) {
             Vector ifaceVec { coord - reactIface };
             rotQuat.rotate(ifaceVec);
             coord = Coord(ifaceVec.x, ifaceVec.y, ifaceVec.z) + reactIface;
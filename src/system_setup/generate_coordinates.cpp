@@ -4,29 +4,29 @@
 
 void generate_coordinates(const Parameters& params, std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList,
-    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject)
+    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, SimulContext& context)
 {
     // First create all the molecules and their corresponding complexes, with random center of mass coordinates
     for (auto& oneTemp : molTemplateList) {
         if (oneTemp.isImplicitLipid == false) {
             for (unsigned itr { 0 }; itr < oneTemp.copies; ++itr) {
-                moleculeList.emplace_back(initialize_molecule(Complex::numberOfComplexes, params, oneTemp, membraneObject));
-                complexList.emplace_back(initialize_complex(moleculeList.back(), molTemplateList[moleculeList.back().molTypeIndex]));
+                moleculeList.emplace_back(initialize_molecule(context.numberOfComplexes, params, oneTemp, membraneObject, context));
+                complexList.emplace_back(initialize_complex(moleculeList.back(), molTemplateList[moleculeList.back().molTypeIndex], context));
                 oneTemp.monomerList.emplace_back(moleculeList.back().index);
             }
         } else {
-            moleculeList.emplace_back(initialize_molecule(Complex::numberOfComplexes, params, oneTemp, membraneObject));
-            complexList.emplace_back(initialize_complex(moleculeList.back(), molTemplateList[moleculeList.back().molTypeIndex]));
+            moleculeList.emplace_back(initialize_molecule(context.numberOfComplexes, params, oneTemp, membraneObject, context));
+            complexList.emplace_back(initialize_complex(moleculeList.back(), molTemplateList[moleculeList.back().molTypeIndex], context));
         }
     }
-    std::cout << "NUMBER OF MOLECULES IN GEN COORDS: " << moleculeList.size() << std::endl;
+    context.log << "NUMBER OF MOLECULES IN GEN COORDS: " << moleculeList.size() << std::endl;
 
     if (moleculeList.size() == 0 && params.numTotalUnits == 0) {
-        std::cout << "No molecules present, skipping coordinate generation.\n";
+        context.log << "No molecules present, skipping coordinate generation.\n";
         return;
     }
 
-    std::cout << "\nFinding and fixing overlapping proteins.\n";
+    context.log << "\nFinding and fixing overlapping proteins.\n";
     int currItr { 0 };
     while (currItr < 50) {
         bool hasOverlap { false };
@@ -67,7 +67,7 @@ void generate_coordinates(const Parameters& params, std::vector<Molecule>& molec
                                 Vector tmpVec { iface1.coord - iface2.coord };
                                 double mag = tmpVec.x * tmpVec.z + tmpVec.y * tmpVec.y + tmpVec.z * tmpVec.z;
                                 if (mag < forwardRxns[rxnIndex].bindRadius * forwardRxns[rxnIndex].bindRadius) {
-                                    mol2.create_random_coords(mol2Temp, membraneObject);
+                                    mol2.create_random_coords(mol2Temp, membraneObject, context.r);
                                     complexList[mol2.myComIndex].comCoord = mol2.comCoord;
                                     hasOverlap = true;
                                     ++numOverlap;
@@ -81,12 +81,12 @@ void generate_coordinates(const Parameters& params, std::vector<Molecule>& molec
                 }
             }
         }
-        std::cout << "Iteration: " << currItr << "\nOverlapping Proteins (" << std::boolalpha << hasOverlap
+        context.log << "Iteration: " << currItr << "\nOverlapping Proteins (" << std::boolalpha << hasOverlap
                   << "): " << numOverlap << '\n';
         if (!hasOverlap) {
-            std::cout << "No overlapping proteins found.\n";
+            context.log << "No overlapping proteins found.\n";
             break;
         }
     }
-    write_xyz("initial_crds.xyz", params, moleculeList, molTemplateList);
+    write_xyz(params.output_path("initial_crds.xyz"), params, moleculeList, molTemplateList);
 }
@@ -8,32 +8,32 @@
 //this is used to generate the added molecules and complexes
 void generate_coordinates_for_restart(Parameters& params, std::vector<Molecule>& moleculeList,
     std::vector<Complex>& complexList, std::vector<MolTemplate>& molTemplateList,
-    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, int numMolTemplateBeforeAdd, int numForwardRxnBdeforeAdd)
+    const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, int numMolTemplateBeforeAdd, int numForwardRxnBdeforeAdd, SimulContext& context)
 {
     for (int molTemplateListIndex = numMolTemplateBeforeAdd; molTemplateListIndex < molTemplateList.size(); molTemplateListIndex++) {
         MolTemplate oneTemp {};
         oneTemp = molTemplateList[molTemplateListIndex];
         for (unsigned itr { 0 }; itr < oneTemp.copies; ++itr) {
-            create_molecule_and_complex_for_restart(oneTemp, params, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject);
+            create_molecule_and_complex_for_restart(oneTemp, params, moleculeList, complexList, molTemplateList, forwardRxns, membraneObject, context);
         }
     }
 }
 
 void create_molecule_and_complex_for_restart(MolTemplate& createdMolTemp, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject)
+    std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, const Membrane& membraneObject, SimulContext& context)
 {
     int newMolIndex = 0;
     int newComIndex = 0;
-    if (Molecule::emptyMolList.size() > 0) {
+    if (context.emptyMolList.size() > 0) {
         // Check to make sure the object pointed to by the last element in the each list is actually empty
         // If it isn't delete it from the list and move on until you find one that is
         try {
-            while (!moleculeList[Molecule::emptyMolList.back()].isEmpty)
-                Molecule::emptyMolList.pop_back();
+            while (!moleculeList[context.emptyMolList.back()].isEmpty)
+                context.emptyMolList.pop_back();
 
             // if there's an available empty Molecule spot, make the new Molecule in place
-            newMolIndex = Molecule::emptyMolList.back();
-            Molecule::emptyMolList.pop_back(); // remove the empty Molecule spot index from the list
+            newMolIndex = context.emptyMolList.back();
+            context.emptyMolList.pop_back(); // remove the empty Molecule spot index from the list
         } catch (std::out_of_range& e) {
             newMolIndex = moleculeList.size();
             moleculeList.emplace_back(); // create new empty Molecule spot
@@ -43,15 +43,15 @@ void create_molecule_and_complex_for_restart(MolTemplate& createdMolTemp, Parame
         moleculeList.emplace_back(); // create new empty Molecule spot
     }
 
-    if (Complex::emptyComList.size() > 0) {
+    if (context.emptyComList.size() > 0) {
         // Check to make sure the object pointed to by the last element in the each list is actually empty
         // If it isn't delete it from the list and move on until you find one that is
         try {
-            while (!complexList[Complex::emptyComList.back()].isEmpty)
-                Complex::emptyComList.pop_back();
+            while (!complexList[context.emptyComList.back()].isEmpty)
+                context.emptyComList.pop_back();
             // if there's an available empty Complex spot, make the new Complex in place
-            newComIndex = Complex::emptyComList.back();
-            Complex::emptyComList.pop_back(); // remove the empty Complex spot index from the list
+            newComIndex = context.emptyComList.back();
+            context.emptyComList.pop_back(); // remove the empty Complex spot index from the list
         } catch (std::out_of_range) {
             newComIndex = complexList.size();
             complexList.emplace_back(); // create new empty Complex spot
@@ -66,20 +66,20 @@ void create_molecule_and_complex_for_restart(MolTemplate& createdMolTemp, Parame
     bool needsResampling { true };
     while (needsResampling) {
         moleculeList[newMolIndex]
-            = initialize_molecule_for_restart(newMolIndex, params, createdMolTemp, membraneObject);
+            = initialize_molecule_for_restart(newMolIndex, params, createdMolTemp, membraneObject, context);
         needsResampling = moleculeOverlapsForRestart(params, moleculeList[newMolIndex], moleculeList,
             complexList, forwardRxns, molTemplateList, membraneObject);
     }
 
     moleculeList[newMolIndex].myComIndex = newComIndex;
-    complexList[newComIndex] = Complex { newComIndex, moleculeList.at(newMolIndex), createdMolTemp };
-    ++Complex::numberOfComplexes;
+    complexList[newComIndex] = Complex { newComIndex, moleculeList.at(newMolIndex), createdMolTemp, context.numMolTypes };
+    ++context.numberOfComplexes;
 
     createdMolTemp.monomerList.emplace_back(newMolIndex); //add this new molecule to the monomerList
 }
 
 Molecule initialize_molecule_for_restart(
-    int index, Parameters& params, MolTemplate& molTemplate, const Membrane& membraneObject)
+    int index, Parameters& params, MolTemplate& molTemplate, const Membrane& membraneObject, SimulContext& context)
 {
     /*!
      * \brief Creates a molecule according to add.inp, assigns
@@ -100,18 +100,18 @@ Molecule initialize_molecule_for_restart(
     tmp.interfaceList = std::vector<Molecule::Iface>(molTemplate.interfaceList.size());
 
     // Create center of mass
-    tmp.create_random_coords(molTemplate, membraneObject);
+    tmp.create_random_coords(molTemplate, membraneObject, context.r);
 
     // clean up
     tmp.isEmpty = false;
 
     // iterate number of molecules in the system and set index
     tmp.index = index;
-    ++Molecule::numberOfMolecules;
+    ++context.numberOfMolecules;
     params.numTotalUnits = params.numTotalUnits + molTemplate.interfaceList.size() + 1;
 
     // keep track of molecule types
-    ++MolTemplate::numEachMolType[molTemplate.molTypeIndex];
+    ++context.numEachMolType[molTemplate.molTypeIndex];
 
     return tmp;
 }
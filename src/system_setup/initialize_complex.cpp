@@ -1,6 +1,6 @@
 #include "system_setup/system_setup.hpp"
 
-Complex initialize_complex(const Molecule& mol, const MolTemplate& molTemp)
+Complex initialize_complex(const Molecule& mol, const MolTemplate& molTemp, SimulContext& context)
 {
   /*Creates a new complex (end of complexList array) to hold the newly generated molecule, assigns coords*/
   Complex tmp;
@@ -8,14 +8,14 @@ Complex initialize_complex(const Molecule& mol, const MolTemplate& molTemp)
     tmp.D = molTemp.D;
     tmp.Dr = molTemp.Dr;
     tmp.radius = molTemp.radius;
-    tmp.index = Complex::numberOfComplexes;
+    tmp.index = context.numberOfComplexes;
     tmp.mass = molTemp.mass;
     tmp.memberList.push_back(mol.index);
     tmp.isEmpty = false;
-    tmp.numEachMol = std::vector<int>(MolTemplate::numMolTypes);
+    tmp.numEachMol = std::vector<int>(context.numMolTypes);
     ++tmp.numEachMol[molTemp.molTypeIndex];
     
-    ++Complex::numberOfComplexes;
+    ++context.numberOfComplexes;
     
     return tmp;
 }
@@ -2,7 +2,7 @@
 
 #include <numeric>
 
-Molecule initialize_molecule(int comIndex, const Parameters& params, const MolTemplate& molTemplate, const Membrane &membraneObject)
+Molecule initialize_molecule(int comIndex, const Parameters& params, const MolTemplate& molTemplate, const Membrane &membraneObject, SimulContext& context)
 {
     Molecule tmp {};
     tmp.molTypeIndex = molTemplate.molTypeIndex;
@@ -16,14 +16,14 @@ Molecule initialize_molecule(int comIndex, const Parameters& params, const MolTe
 
     // Create center of mass
     tmp.interfaceList = std::vector<Molecule::Iface>(molTemplate.interfaceList.size());
-    tmp.create_random_coords(molTemplate, membraneObject);
+    tmp.create_random_coords(molTemplate, membraneObject, context.r);
 
     // iterate number of molecules in the system and set index
-    tmp.index = Molecule::numberOfMolecules;
-    ++Molecule::numberOfMolecules;
+    tmp.index = context.numberOfMolecules;
+    ++context.numberOfMolecules;
 
     // keep track of molecule types
-    ++MolTemplate::numEachMolType[molTemplate.molTypeIndex];
+    ++context.numEachMolType[molTemplate.molTypeIndex];
 
     return tmp;
 }
@@ -1,7 +1,8 @@
 #include "system_setup/system_setup.hpp"
 #include "tracing.hpp"
 
-void set_rMaxLimit(Parameters& params, const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, int numDoubleBeforeAdd, int numMolTemplateBeforeAdd)
+void set_rMaxLimit(Parameters& params, const std::vector<MolTemplate>& molTemplateList, const std::vector<ForwardRxn>& forwardRxns, int numDoubleBeforeAdd, int numMolTemplateBeforeAdd,
+    const std::vector<int>& absToRelIface, std::ostream& log)
 {
     /*For each reaction, need distance from the interface to the COM for both partners, plus the
      * bindrad+sqrt(6*Dtot*deltat)
@@ -21,17 +22,17 @@ void set_rMaxLimit(Parameters& params, const std::vector<MolTemplate>& molTempla
             Interface iface2;
             if (rxnIface1.molTypeIndex < numMolTemplateBeforeAdd) {
                 iface1 = molTemplateList.at(rxnIface1.molTypeIndex)
-                             .interfaceList.at(MolTemplate::absToRelIface.at(rxnIface1.absIfaceIndex));
+                             .interfaceList.at(absToRelIface.at(rxnIface1.absIfaceIndex));
             } else {
                 iface1 = molTemplateList.at(rxnIface1.molTypeIndex)
-                             .interfaceList.at(MolTemplate::absToRelIface.at(rxnIface1.absIfaceIndex - numDoubleBeforeAdd));
+                             .interfaceList.at(absToRelIface.at(rxnIface1.absIfaceIndex - numDoubleBeforeAdd));
             }
             if (rxnIface2.molTypeIndex < numMolTemplateBeforeAdd) {
                 iface2 = molTemplateList.at(rxnIface2.molTypeIndex)
-                             .interfaceList.at(MolTemplate::absToRelIface.at(rxnIface2.absIfaceIndex));
+                             .interfaceList.at(absToRelIface.at(rxnIface2.absIfaceIndex));
             } else {
                 iface2 = molTemplateList.at(rxnIface2.molTypeIndex)
-                             .interfaceList.at(MolTemplate::absToRelIface.at(rxnIface2.absIfaceIndex - numDoubleBeforeAdd));
+                             .interfaceList.at(absToRelIface.at(rxnIface2.absIfaceIndex - numDoubleBeforeAdd));
             }
 
             double scal { 1.0 / 3.0 };
@@ -82,5 +83,5 @@ void set_rMaxLimit(Parameters& params, const std::vector<MolTemplate>& molTempla
             }
         }
     }
-    std::cout << "Rmaxlimit: " << params.rMaxLimit << std::endl;
+    log << "Rmaxlimit: " << params.rMaxLimit << std::endl;
 }
@@ -12,7 +12,7 @@
 #include "reactions/association/functions_for_spherical_system.hpp"
 #include "trajectory_functions/trajectory_functions.hpp"
 
-Coord calculate_update_position_interface(const Complex targCom, const Coord ifacecrds) // iface is cardesian coords
+Coord calculate_update_position_interface(const Complex& targCom, const Coord& ifacecrds) // iface is cardesian coords
 {
     Coord finalcrds; // for output
     Coord trajTrans = targCom.trajTrans;
@@ -47,11 +47,12 @@ Coord calculate_update_position_interface(const Complex targCom, const Coord ifa
     Coord finalcrds1 = rotate_on_sphere(targ, COMnew, dangle);
     finalcrds = find_cardesian_coords(finalcrds1);
     */
+    // the same rotation about the sphere center as Complex::propagate
     Coord COM = targCom.comCoord;
     Coord COMnew = targCom.comCoord + targCom.trajTrans;
-    std::array<double, 9> Crdset = inner_coord_set(COM, COMnew);
-    std::array<double, 9> Crdsetnew = inner_coord_set_new(COM, COMnew);
-    finalcrds = translate_on_sphere(ifacecrds, COM, COMnew, Crdset, Crdsetnew);
-    finalcrds = rotate_on_sphere(finalcrds, COMnew, Crdsetnew, dangle);
+    Quat rotQuat = rotation_on_sphere(COM, COMnew, dangle);
+    Vector ifaceVec { ifacecrds - COM };
+    rotQuat.rotate(ifaceVec);
+    finalcrds = Coord { ifaceVec.x, ifaceVec.y, ifaceVec.z } + COMnew;
     return finalcrds;
 }
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "boundary_conditions/reflect_functions.hpp"
+#include "tracing.hpp"
+#include "trajectory_functions/trajectory_functions.hpp"
+
+void catch_up_dormant_complex(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList,
+    std::vector<Complex>& complexList, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r)
+{
+    // TRACE();
+    if (targCom.isEmpty || targCom.isDormant || targCom.numDormantSteps == 0)
+        return;
+
+    // propagate() marks the members propagated, but this move doesn't count as their move of this step
+    std::vector<TrajStatus> memberStatusList {};
+    for (auto& memMol : targCom.memberList)
+        memberStatusList.push_back(moleculeList[memMol].trajStatus);
+    bool hasTrialMove { memberStatusList[0] == TrajStatus::canBeResampled };
+
+    // the move covers move_time(), i.e. numDormantSteps + 1 steps, so one less leaves out this step
+    --targCom.numDormantSteps;
+    create_complex_propagation_vectors(params, targCom, moleculeList, complexList, molTemplateList, membraneObject, r);
+    targCom.propagate(moleculeList, membraneObject, molTemplateList);
+    if (membraneObject.isSphere) {
+        double RS3Dinput { 0.0 };
+        for (auto& molIndex : targCom.memberList) {
+            for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
+                if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - moleculeList[molIndex].molTypeIndex) < 1E-2) {
+                    RS3Dinput = membraneObject.RS3Dvect[RS3Dindex + 300];
+                    break;
+                }
+            }
+        }
+        reflect_complex_rad_rot_sphere(membraneObject, targCom, moleculeList, RS3Dinput);
+    }
+
+    for (unsigned memItr { 0 }; memItr < targCom.memberList.size(); ++memItr)
+        moleculeList[targCom.memberList[memItr]].trajStatus = memberStatusList[memItr];
+    if (hasTrialMove)
+        create_complex_propagation_vectors(params, targCom, moleculeList, complexList, molTemplateList, membraneObject, r);
+}
@@ -5,33 +5,33 @@
 #include "trajectory_functions/trajectory_functions.hpp"
 
 void create_complex_propagation_vectors(const Parameters& params, Complex& targCom, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r)
 {
     // TRACE();
     // the diffusion inside the sphere is the same as inside a box system.
     // on sphere surface, we set D.z = 0.
 
     if (targCom.D.z < 1E-14 && membraneObject.isSphere == true) { // on sphere surface
-        Coord targTrans = create_complex_propagation_vectors_on_sphere(params, targCom);
+        Coord targTrans = create_complex_propagation_vectors_on_sphere(params, targCom, r);
         // now setup translational motion vector
         targCom.trajTrans.x = targTrans.x;
         targCom.trajTrans.y = targTrans.y;
         targCom.trajTrans.z = targTrans.z;
 
         // now setup the rotation
-        targCom.trajRot.x = sqrt(2.0 * params.timeStep * targCom.Dr.x) * GaussV();
-        targCom.trajRot.y = sqrt(2.0 * params.timeStep * targCom.Dr.y) * GaussV();
-        targCom.trajRot.z = sqrt(2.0 * params.timeStep * targCom.Dr.z) * GaussV();
+        targCom.trajRot.x = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.Dr.x) * GaussV(r);
+        targCom.trajRot.y = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.Dr.y) * GaussV(r);
+        targCom.trajRot.z = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.Dr.z) * GaussV(r);
 
     } else { // box system or inside the sphere (not on the sphere)
         // Create Gaussian distributed random translational motion
-        targCom.trajTrans.x = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV();
-        targCom.trajTrans.y = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV();
-        targCom.trajTrans.z = sqrt(2.0 * params.timeStep * targCom.D.z) * GaussV();
+        targCom.trajTrans.x = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.D.x) * GaussV(r);
+        targCom.trajTrans.y = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.D.y) * GaussV(r);
+        targCom.trajTrans.z = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.D.z) * GaussV(r);
         // create Gaussian distributed random rotational motion
-        targCom.trajRot.x = sqrt(2.0 * params.timeStep * targCom.Dr.x) * GaussV();
-        targCom.trajRot.y = sqrt(2.0 * params.timeStep * targCom.Dr.y) * GaussV();
-        targCom.trajRot.z = sqrt(2.0 * params.timeStep * targCom.Dr.z) * GaussV();
+        targCom.trajRot.x = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.Dr.x) * GaussV(r);
+        targCom.trajRot.y = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.Dr.y) * GaussV(r);
+        targCom.trajRot.z = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.Dr.z) * GaussV(r);
     }
 
     //determine RS3Dinput
@@ -47,16 +47,16 @@ void create_complex_propagation_vectors(const Parameters& params, Complex& targC
     }
 
     //  reflect the boundary and also check_if_span, but not necessary for complex on sphere surface
-    reflect_traj_complex_rad_rot(params, moleculeList, targCom, membraneObject, RS3Dinput);
+    reflect_traj_complex_rad_rot(params, moleculeList, targCom, membraneObject, RS3Dinput, r);
 
     // // Create Gaussian distributed random translational motion
-    // targCom.trajTrans.x = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV();
-    // targCom.trajTrans.y = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV();
-    // targCom.trajTrans.z = sqrt(2.0 * params.timeStep * targCom.D.z) * GaussV();
+    // targCom.trajTrans.x = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV(r);
+    // targCom.trajTrans.y = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV(r);
+    // targCom.trajTrans.z = sqrt(2.0 * params.timeStep * targCom.D.z) * GaussV(r);
     // // create Gaussian distributed random rotational motion
-    // targCom.trajRot.x = sqrt(2.0 * params.timeStep * targCom.Dr.x) * GaussV();
-    // targCom.trajRot.y = sqrt(2.0 * params.timeStep * targCom.Dr.y) * GaussV();
-    // targCom.trajRot.z = sqrt(2.0 * params.timeStep * targCom.Dr.z) * GaussV();
+    // targCom.trajRot.x = sqrt(2.0 * params.timeStep * targCom.Dr.x) * GaussV(r);
+    // targCom.trajRot.y = sqrt(2.0 * params.timeStep * targCom.Dr.y) * GaussV(r);
+    // targCom.trajRot.z = sqrt(2.0 * params.timeStep * targCom.Dr.z) * GaussV(r);
     // std::array<double, 9> M = create_euler_rotation_matrix(targCom.trajRot);
     // //reflect_traj_complex_rad_rot(params, moleculeList, targCom, M, membraneObject);
 
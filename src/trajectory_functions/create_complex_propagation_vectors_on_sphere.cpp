@@ -4,45 +4,38 @@
 #include "trajectory_functions/trajectory_functions.hpp"
 
 // only works for complex on sphere surface
-Coord create_complex_propagation_vectors_on_sphere(const Parameters& params, Complex& targCom)
+Coord create_complex_propagation_vectors_on_sphere(const Parameters& params, Complex& targCom, gsl_rng* r)
 {
     // TRACE();
     Coord trajTrans;
 
-    double dx = sqrt(2.0 * params.timeStep * targCom.D.x) * GaussV();
-    double dy = sqrt(2.0 * params.timeStep * targCom.D.y) * GaussV();
+    double dx = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.D.x) * GaussV(r);
+    double dy = sqrt(2.0 * targCom.move_time(params.timeStep) * targCom.D.y) * GaussV(r);
     double dl = sqrt(dx * dx + dy * dy); // propagation length
-    double dangle = acos(dx / dl);
-    if (dy < 0.0) {
-        dangle = 2.0 * M_PI - dangle;
-    } // propagation direction
-    double rotangle = dangle - M_PI / 2.0;
+    if (dl < 1E-14) {
+        trajTrans.zero_crds();
+        return trajTrans;
+    }
     Coord COM = targCom.comCoord;
-    Coord COMsphere = find_spherical_coords(COM);
-    double dtheta = dl / COMsphere.z;
-    Coord COMnewtmp = Coord { COMsphere.x - dtheta, COMsphere.y, COMsphere.z };
-    COMnewtmp = find_cardesian_coords(COMnewtmp);
-    // define the inner-coords-set
+    double R = COM.get_magnitude();
+    // define the inner-coords-set: i along O-COM, j along increasing phi, k along decreasing theta
     Vector i = Vector { COM.x, COM.y, COM.z };
     i.normalize();
-    Vector temp = Vector { 0.0, 0.0, COM.get_magnitude() };
-    temp.normalize();
+    Vector temp = Vector { 0.0, 0.0, 1.0 };
+    if (std::abs(std::abs(COM.z) - R) < 1E-8) { // at a pole, phi is undefined, any tangent will do
+        temp = Vector { -1.0, 0.0, 0.0 };
+    }
     Vector j = temp.cross(i);
     j.normalize();
     Vector k = i.cross(j);
     k.normalize();
-    //std::vector<Vector> crdset;
-    std::array<double, 9> crdset;
-    crdset[0] = i.x;
-    crdset[1] = i.y;
-    crdset[2] = i.z;
-    crdset[3] = j.x;
-    crdset[4] = j.y;
-    crdset[5] = j.z;
-    crdset[6] = k.x;
-    crdset[7] = k.y;
-    crdset[8] = k.z;
-    Coord COMnew = rotate_on_sphere(COMnewtmp, COM, crdset, rotangle);
+    // move by the geodesic distance dl along the great circle leaving COM in the direction dx * j + dy * k
+    double dtheta = dl / R;
+    double cosTheta = cos(dtheta);
+    double sinTheta = sin(dtheta);
+    Coord COMnew = Coord { cosTheta * COM.x + R * sinTheta * (dx * j.x + dy * k.x) / dl,
+        cosTheta * COM.y + R * sinTheta * (dx * j.y + dy * k.y) / dl,
+        cosTheta * COM.z + R * sinTheta * (dx * j.z + dy * k.z) / dl };
 
     trajTrans.x = COMnew.x - targCom.comCoord.x;
     trajTrans.y = COMnew.y - targCom.comCoord.y;
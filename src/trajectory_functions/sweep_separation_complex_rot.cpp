@@ -5,12 +5,12 @@
 
 void sweep_separation_complex_rot(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r)
 {
     if (membraneObject.isSphere)
-        sweep_separation_complex_rot_sphere(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+        sweep_separation_complex_rot_sphere(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r);
     else
-        sweep_separation_complex_rot_box(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+        sweep_separation_complex_rot_box(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r);
 
     // /*
     //   In this version, complex com1Index is on the membrane.
@@ -140,12 +140,12 @@ void sweep_separation_complex_rot(int simItr, int pro1Index, Parameters& params,
     //      break from loop*/
     //     if (hasOverlap) {
     //         ++itr;
-    //         complexList[com1Index].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[com1Index].D.x) * GaussV();
-    //         complexList[com1Index].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[com1Index].D.y) * GaussV();
-    //         complexList[com1Index].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[com1Index].D.z) * GaussV();
-    //         complexList[com1Index].trajRot.x = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.x) * GaussV();
-    //         complexList[com1Index].trajRot.y = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.y) * GaussV();
-    //         complexList[com1Index].trajRot.z = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.z) * GaussV();
+    //         complexList[com1Index].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[com1Index].D.x) * GaussV(r);
+    //         complexList[com1Index].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[com1Index].D.y) * GaussV(r);
+    //         complexList[com1Index].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[com1Index].D.z) * GaussV(r);
+    //         complexList[com1Index].trajRot.x = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.x) * GaussV(r);
+    //         complexList[com1Index].trajRot.y = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.y) * GaussV(r);
+    //         complexList[com1Index].trajRot.z = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.z) * GaussV(r);
 
     //         M = create_euler_rotation_matrix(complexList[com1Index].trajRot);
     //         reflect_traj_complex_rad_rot(params, moleculeList, complexList[com1Index], M, membraneObject, RS3Dinput);
@@ -164,17 +164,17 @@ void sweep_separation_complex_rot(int simItr, int pro1Index, Parameters& params,
 
     //                 /*If p2 just dissociated, also don'numOverlap try to move again*/
     //                 complexList[com2Index].trajTrans.x
-    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].D.x) * GaussV();
+    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].D.x) * GaussV(r);
     //                 complexList[com2Index].trajTrans.y
-    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].D.y) * GaussV();
+    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].D.y) * GaussV(r);
     //                 complexList[com2Index].trajTrans.z
-    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].D.z) * GaussV();
+    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].D.z) * GaussV(r);
     //                 complexList[com2Index].trajRot.x
-    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.x) * GaussV();
+    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.x) * GaussV(r);
     //                 complexList[com2Index].trajRot.y
-    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.y) * GaussV();
+    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.y) * GaussV(r);
     //                 complexList[com2Index].trajRot.z
-    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.z) * GaussV();
+    //                     = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.z) * GaussV(r);
     //                 std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[com2Index].trajRot);
     //                 reflect_traj_complex_rad_rot(params, moleculeList, complexList[com2Index], M2, membraneObject, RS3Dinput);
     //             }
@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "boundary_conditions/reflect_functions.hpp"
 #include "math/matrix.hpp"
 #include "math/rand_gsl.hpp"
@@ -6,7 +7,7 @@
 
 void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& params,
     std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns,
-    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+    const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r)
 {
     // TRACE();
     /*
@@ -59,7 +60,7 @@ void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& par
 
     //determine RS3Dinput
     double RS3Dinput { 0.0 };
-    Complex targCom { complexList[com1Index] };
+    const Complex& targCom = complexList[com1Index];
     for (auto& molIndex : targCom.memberList) {
         for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
             if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - moleculeList[molIndex].molTypeIndex) < 1E-2) {
@@ -100,7 +101,7 @@ void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& par
                     int i2 { ifaceList[maxRows * memMolItr + crossMolItr] };
 
                     Vector iface1Vec { moleculeList[pro1Index].interfaceList[i1].coord - complexList[com1Index].comCoord };
-                    std::array<double, 9> M = create_euler_rotation_matrix(complexList[com1Index].trajRot);
+                    const std::array<double, 9>& M { complexList[com1Index].traj_rotation().M };
                     iface1Vec = matrix_rotate(iface1Vec, M);
 
                     double dx1 { complexList[com1Index].comCoord.x + iface1Vec.x + complexList[com1Index].trajTrans.x };
@@ -114,7 +115,7 @@ void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& par
                     // }
 
                     Vector iface2Vec { moleculeList[pro2Index].interfaceList[i2].coord - complexList[com2Index].comCoord };
-                    std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[com2Index].trajRot);
+                    const std::array<double, 9>& M2 { complexList[com2Index].traj_rotation().M };
                     iface2Vec = matrix_rotate(iface2Vec, M2);
                     double dx2 { complexList[com2Index].comCoord.x + iface2Vec.x + complexList[com2Index].trajTrans.x };
                     double dy2 { complexList[com2Index].comCoord.y + iface2Vec.y + complexList[com2Index].trajTrans.y };
@@ -130,6 +131,7 @@ void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& par
                     double df1 { dx1 - dx2 };
                     double df2 { dy1 - dy2 };
                     double df3 { dz1 - dz2 };
+                    minimum_image(df1, df2, df3, membraneObject);
 
                     dr2 = (df1 * df1) + (df2 * df2) + (df3 * df3);
 
@@ -146,15 +148,15 @@ void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& par
          break from loop*/
         if (hasOverlap) {
             ++itr;
-            complexList[com1Index].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[com1Index].D.x) * GaussV();
-            complexList[com1Index].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[com1Index].D.y) * GaussV();
-            complexList[com1Index].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[com1Index].D.z) * GaussV();
-            complexList[com1Index].trajRot.x = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.x) * GaussV();
-            complexList[com1Index].trajRot.y = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.y) * GaussV();
-            complexList[com1Index].trajRot.z = sqrt(2.0 * params.timeStep * complexList[com1Index].Dr.z) * GaussV();
+            complexList[com1Index].trajTrans.x = sqrt(2.0 * complexList[com1Index].move_time(params.timeStep) * complexList[com1Index].D.x) * GaussV(r);
+            complexList[com1Index].trajTrans.y = sqrt(2.0 * complexList[com1Index].move_time(params.timeStep) * complexList[com1Index].D.y) * GaussV(r);
+            complexList[com1Index].trajTrans.z = sqrt(2.0 * complexList[com1Index].move_time(params.timeStep) * complexList[com1Index].D.z) * GaussV(r);
+            complexList[com1Index].trajRot.x = sqrt(2.0 * complexList[com1Index].move_time(params.timeStep) * complexList[com1Index].Dr.x) * GaussV(r);
+            complexList[com1Index].trajRot.y = sqrt(2.0 * complexList[com1Index].move_time(params.timeStep) * complexList[com1Index].Dr.y) * GaussV(r);
+            complexList[com1Index].trajRot.z = sqrt(2.0 * complexList[com1Index].move_time(params.timeStep) * complexList[com1Index].Dr.z) * GaussV(r);
 
             // reflectList[com1Index] = 0;
-            reflect_traj_complex_rad_rot(params, moleculeList, complexList[com1Index], membraneObject, RS3Dinput);
+            reflect_traj_complex_rad_rot_box(params, moleculeList, complexList[com1Index], membraneObject, RS3Dinput, r);
             // reflectList[com1Index] = 1;
 
             int resampleList[complexList.size()]; // if this is 0, we need resample
@@ -175,14 +177,14 @@ void sweep_separation_complex_rot_box(int simItr, int pro1Index, Parameters& par
                      */
 
                         /*If p2 just dissociated, also don'numOverlap try to move again*/
-                        complexList[com2Index].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[com2Index].D.x) * GaussV();
-                        complexList[com2Index].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[com2Index].D.y) * GaussV();
-                        complexList[com2Index].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[com2Index].D.z) * GaussV();
-                        complexList[com2Index].trajRot.x = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.x) * GaussV();
-                        complexList[com2Index].trajRot.y = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.y) * GaussV();
-                        complexList[com2Index].trajRot.z = sqrt(2.0 * params.timeStep * complexList[com2Index].Dr.z) * GaussV();
+                        complexList[com2Index].trajTrans.x = sqrt(2.0 * complexList[com2Index].move_time(params.timeStep) * complexList[com2Index].D.x) * GaussV(r);
+                        complexList[com2Index].trajTrans.y = sqrt(2.0 * complexList[com2Index].move_time(params.timeStep) * complexList[com2Index].D.y) * GaussV(r);
+                        complexList[com2Index].trajTrans.z = sqrt(2.0 * complexList[com2Index].move_time(params.timeStep) * complexList[com2Index].D.z) * GaussV(r);
+                        complexList[com2Index].trajRot.x = sqrt(2.0 * complexList[com2Index].move_time(params.timeStep) * complexList[com2Index].Dr.x) * GaussV(r);
+                        complexList[com2Index].trajRot.y = sqrt(2.0 * complexList[com2Index].move_time(params.timeStep) * complexList[com2Index].Dr.y) * GaussV(r);
+                        complexList[com2Index].trajRot.z = sqrt(2.0 * complexList[com2Index].move_time(params.timeStep) * complexList[com2Index].Dr.z) * GaussV(r);
                         // reflectList[com2Index] = 0;
-                        reflect_traj_complex_rad_rot(params, moleculeList, complexList[com2Index], membraneObject, RS3Dinput);
+                        reflect_traj_complex_rad_rot_box(params, moleculeList, complexList[com2Index], membraneObject, RS3Dinput, r);
                         // reflectList[com2Index] = 1;
                         resampleList[com2Index] = 1;
                     }
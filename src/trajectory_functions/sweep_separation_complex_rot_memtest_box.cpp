@@ -1,10 +1,11 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "boundary_conditions/reflect_functions.hpp"
 #include "math/matrix.hpp"
 #include "math/rand_gsl.hpp"
 #include "tracing.hpp"
 #include "trajectory_functions/trajectory_functions.hpp"
 
-void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r)
 {
     /*
       In this version, complex comIndex1 is on the membrane.
@@ -66,7 +67,7 @@ void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Paramet
 
     //determine RS3Dinput
     double RS3Dinput { 0.0 };
-    Complex targCom { complexList[comIndex1] };
+    const Complex& targCom = complexList[comIndex1];
     for (auto& molIndex : targCom.memberList) {
         for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
             if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - moleculeList[molIndex].molTypeIndex) < 1E-2) {
@@ -107,7 +108,7 @@ void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Paramet
                     int relIface2 { ifaceList[maxRows * memMolItr + crossMemItr] };
 
                     Vector iface1Vec { moleculeList[pro1Index].interfaceList[relIface1].coord - complexList[comIndex1].comCoord };
-                    std::array<double, 9> M = create_euler_rotation_matrix(complexList[comIndex1].trajRot);
+                    const std::array<double, 9>& M { complexList[comIndex1].traj_rotation().M };
                     iface1Vec = matrix_rotate(iface1Vec, M);
 
                     double dx1 { complexList[comIndex1].comCoord.x + iface1Vec.x + complexList[comIndex1].trajTrans.x };
@@ -121,7 +122,7 @@ void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Paramet
                     // }
 
                     Vector iface2Vec { moleculeList[p2].interfaceList[relIface2].coord - complexList[comIndex2].comCoord };
-                    std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[comIndex2].trajRot);
+                    const std::array<double, 9>& M2 { complexList[comIndex2].traj_rotation().M };
                     iface2Vec = matrix_rotate(iface2Vec, M2);
                     double dx2 { complexList[comIndex2].comCoord.x + iface2Vec.x + complexList[comIndex2].trajTrans.x };
                     double dy2 { complexList[comIndex2].comCoord.y + iface2Vec.y + complexList[comIndex2].trajTrans.y };
@@ -131,6 +132,7 @@ void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Paramet
                     double df1 { dx1 - dx2 };
                     double df2 { dy1 - dy2 };
                     double df3 { dz1 - dz2 };
+                    minimum_image(df1, df2, df3, membraneObject);
 
                     dr2 = (df1 * df1) + (df2 * df2);
                     if (memCheckList[maxRows * memMolItr + crossMemItr] != 1)
@@ -149,15 +151,15 @@ void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Paramet
          break from loop*/
         if (hasOverlap) {
             ++itr;
-            complexList[comIndex1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.x) * GaussV();
-            complexList[comIndex1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.y) * GaussV();
-            complexList[comIndex1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.z) * GaussV();
-            complexList[comIndex1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.x) * GaussV();
-            complexList[comIndex1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.y) * GaussV();
-            complexList[comIndex1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.z) * GaussV();
+            complexList[comIndex1].trajTrans.x = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].D.x) * GaussV(r);
+            complexList[comIndex1].trajTrans.y = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].D.y) * GaussV(r);
+            complexList[comIndex1].trajTrans.z = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].D.z) * GaussV(r);
+            complexList[comIndex1].trajRot.x = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.x) * GaussV(r);
+            complexList[comIndex1].trajRot.y = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.y) * GaussV(r);
+            complexList[comIndex1].trajRot.z = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.z) * GaussV(r);
 
             // reflectList[comIndex1] = 0;
-            reflect_traj_complex_rad_rot(params, moleculeList, complexList[comIndex1], membraneObject, RS3Dinput);
+            reflect_traj_complex_rad_rot_box(params, moleculeList, complexList[comIndex1], membraneObject, RS3Dinput, r);
             // reflectList[comIndex1] = 1;
 
             int resampleList[complexList.size()]; // if this is 0, we need resample
@@ -180,15 +182,15 @@ void sweep_separation_complex_rot_memtest_box(int simItr, int pro1Index, Paramet
                      */
 
                         /*If p2 just dissociated, also don't try to move again*/
-                        complexList[comIndex2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.x) * GaussV();
-                        complexList[comIndex2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.y) * GaussV();
-                        complexList[comIndex2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.z) * GaussV();
-                        complexList[comIndex2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.x) * GaussV();
-                        complexList[comIndex2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.y) * GaussV();
-                        complexList[comIndex2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.z) * GaussV();
+                        complexList[comIndex2].trajTrans.x = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].D.x) * GaussV(r);
+                        complexList[comIndex2].trajTrans.y = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].D.y) * GaussV(r);
+                        complexList[comIndex2].trajTrans.z = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].D.z) * GaussV(r);
+                        complexList[comIndex2].trajRot.x = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.x) * GaussV(r);
+                        complexList[comIndex2].trajRot.y = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.y) * GaussV(r);
+                        complexList[comIndex2].trajRot.z = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.z) * GaussV(r);
 
                         // reflectList[comIndex2] = 0;
-                        reflect_traj_complex_rad_rot(params, moleculeList, complexList[comIndex2], membraneObject, RS3Dinput);
+                        reflect_traj_complex_rad_rot_box(params, moleculeList, complexList[comIndex2], membraneObject, RS3Dinput, r);
                         // reflectList[comIndex2] = 1;
                         resampleList[comIndex2] = 1;
                     }
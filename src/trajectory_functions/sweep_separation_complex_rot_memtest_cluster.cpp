@@ -5,13 +5,13 @@
 #include "trajectory_functions/trajectory_functions.hpp"
 
 void sweep_separation_complex_rot_memtest_cluster(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList,
-    std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+    std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log)
 {
     // TRACE();
     if (membraneObject.isSphere)
-        sweep_separation_complex_rot_memtest_cluster_sphere(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+        sweep_separation_complex_rot_memtest_cluster_sphere(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r, log);
     else
-        sweep_separation_complex_rot_memtest_cluster_box(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+        sweep_separation_complex_rot_memtest_cluster_box(simItr, pro1Index, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r);
 }
 
 // #include "boundary_conditions/reflect_functions.hpp"
@@ -154,12 +154,12 @@ void sweep_separation_complex_rot_memtest_cluster(int simItr, int pro1Index, Par
 //          break from loop*/
 //         if (hasOverlap) {
 //             ++itr;
-//             complexList[comIndex1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.x) * GaussV();
-//             complexList[comIndex1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.y) * GaussV();
-//             complexList[comIndex1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.z) * GaussV();
-//             complexList[comIndex1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.x) * GaussV();
-//             complexList[comIndex1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.y) * GaussV();
-//             complexList[comIndex1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.z) * GaussV();
+//             complexList[comIndex1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.x) * GaussV(r);
+//             complexList[comIndex1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.y) * GaussV(r);
+//             complexList[comIndex1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.z) * GaussV(r);
+//             complexList[comIndex1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.x) * GaussV(r);
+//             complexList[comIndex1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.y) * GaussV(r);
+//             complexList[comIndex1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.z) * GaussV(r);
 
 //             M = create_euler_rotation_matrix(complexList[comIndex1].trajRot);
 //             reflect_traj_complex_rad_rot(params, moleculeList, complexList[comIndex1], M, membraneObject, RS3Dinput);
@@ -177,17 +177,17 @@ void sweep_separation_complex_rot_memtest_cluster(int simItr, int pro1Index, Par
 
 //                     /*If p2 just dissociated, also don't try to move again*/
 //                     complexList[comIndex2].trajTrans.x
-//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.x) * GaussV();
+//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.x) * GaussV(r);
 //                     complexList[comIndex2].trajTrans.y
-//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.y) * GaussV();
+//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.y) * GaussV(r);
 //                     complexList[comIndex2].trajTrans.z
-//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.z) * GaussV();
+//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.z) * GaussV(r);
 //                     complexList[comIndex2].trajRot.x
-//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.x) * GaussV();
+//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.x) * GaussV(r);
 //                     complexList[comIndex2].trajRot.y
-//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.y) * GaussV();
+//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.y) * GaussV(r);
 //                     complexList[comIndex2].trajRot.z
-//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.z) * GaussV();
+//                         = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.z) * GaussV(r);
 //                     std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[comIndex2].trajRot);
 //                     reflect_traj_complex_rad_rot(params, moleculeList, complexList[comIndex2], M2, membraneObject, RS3Dinput);
 //                 }
@@ -1,3 +1,4 @@
+#include "boundary_conditions/boundary_geometry.hpp"
 #include "boundary_conditions/reflect_functions.hpp"
 #include "classes/class_Cluster.hpp"
 #include "math/matrix.hpp"
@@ -5,13 +6,13 @@
 #include "tracing.hpp"
 #include "trajectory_functions/trajectory_functions.hpp"
 
-void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r)
 {
     // try cluster sweep first
     int comIndex1 { moleculeList[pro1Index].myComIndex };
     //determine RS3Dinput
     double RS3Dinput { 0.0 };
-    Complex targCom { complexList[comIndex1] };
+    const Complex& targCom = complexList[comIndex1];
     for (auto& molIndex : targCom.memberList) {
         for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
             if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - moleculeList[molIndex].molTypeIndex) < 1E-2) {
@@ -64,12 +65,26 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
     // std::cout << "In sweep_separation: pairList.size = " << pairList.size() << std::endl;
 
     if (pairList.size() > maxPairs) {
+        // each sub-step covers only a fraction of this timestep, so the steps skipped while dormant are caught up first
+        for (auto& pair : pairList) {
+            for (int k : { pair.k1, pair.k2 }) {
+                catch_up_dormant_complex(params, complexList[k], moleculeList, complexList, molTemplateList, membraneObject, r);
+                for (auto& memMol : complexList[k].memberList) {
+                    for (auto& partnerMol : moleculeList[memMol].crossbase) {
+                        if (moleculeList[partnerMol].isImplicitLipid == false)
+                            catch_up_dormant_complex(params, complexList[moleculeList[partnerMol].myComIndex],
+                                moleculeList, complexList, molTemplateList, membraneObject, r);
+                    }
+                }
+            }
+        }
+
         nStep = 10;
         params.timeStep = params.timeStep / (1.0 * nStep); //perform repeated smaller updates, to converge positions.
 
         // resample the traj for the timeStep changed
         int currStop = pairList.size(); // resample trajectories for all proteins that need keep moving
-        resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput);
+        resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput, r);
 
         // find the partner of pairList'complex'member, this is for the propagate of these molecule continuely when there is subStep
         for (i = 0; i < pairList.size(); i++) {
@@ -118,23 +133,23 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
                     if (flag == 0) {
 
                         if (membraneObject.isSphere == true && complexList[k].D.z < 1E-15) { // complex on sphere surface
-                            Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k1]);
+                            Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k1], r);
                             complexList[k].trajTrans.x = targTrans.x;
                             complexList[k].trajTrans.y = targTrans.y;
                             complexList[k].trajTrans.z = targTrans.z;
-                            complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                            complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                            complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                            complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                            complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                            complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                         } else {
-                            complexList[k].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k].D.x) * GaussV();
-                            complexList[k].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k].D.y) * GaussV();
-                            complexList[k].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k].D.z) * GaussV();
-                            complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                            complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                            complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                            complexList[k].trajTrans.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.x) * GaussV(r);
+                            complexList[k].trajTrans.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.y) * GaussV(r);
+                            complexList[k].trajTrans.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.z) * GaussV(r);
+                            complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                            complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                            complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                         }
 
-                        reflect_traj_complex_rad_rot(params, moleculeList, complexList[k], membraneObject, RS3Dinput);
+                        reflect_traj_complex_rad_rot_box(params, moleculeList, complexList[k], membraneObject, RS3Dinput, r);
 
                         didMove.push_back(k);
                     }
@@ -170,12 +185,12 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
 
             // if (resampleList[k1] == 0) {
             //     // resample complex k1
-            //     complexList[k1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k1].D.x) * GaussV();
-            //     complexList[k1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k1].D.y) * GaussV();
-            //     complexList[k1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k1].D.z) * GaussV();
-            //     complexList[k1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k1].Dr.x) * GaussV();
-            //     complexList[k1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k1].Dr.y) * GaussV();
-            //     complexList[k1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k1].Dr.z) * GaussV();
+            //     complexList[k1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k1].D.x) * GaussV(r);
+            //     complexList[k1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k1].D.y) * GaussV(r);
+            //     complexList[k1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k1].D.z) * GaussV(r);
+            //     complexList[k1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k1].Dr.x) * GaussV(r);
+            //     complexList[k1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k1].Dr.y) * GaussV(r);
+            //     complexList[k1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k1].Dr.z) * GaussV(r);
 
             //     reflect_traj_complex_rad_rot(params, moleculeList, complexList[k1], membraneObject, RS3Dinput);
             //     resampleList[k1] = 1;
@@ -183,12 +198,12 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
 
             // if (resampleList[k2] == 0) {
             //     // resample complex k2
-            //     complexList[k2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k2].D.x) * GaussV();
-            //     complexList[k2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k2].D.y) * GaussV();
-            //     complexList[k2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k2].D.z) * GaussV();
-            //     complexList[k2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k2].Dr.x) * GaussV();
-            //     complexList[k2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k2].Dr.y) * GaussV();
-            //     complexList[k2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k2].Dr.z) * GaussV();
+            //     complexList[k2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k2].D.x) * GaussV(r);
+            //     complexList[k2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k2].D.y) * GaussV(r);
+            //     complexList[k2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k2].D.z) * GaussV(r);
+            //     complexList[k2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k2].Dr.x) * GaussV(r);
+            //     complexList[k2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k2].Dr.y) * GaussV(r);
+            //     complexList[k2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k2].Dr.z) * GaussV(r);
 
             //     reflect_traj_complex_rad_rot(params, moleculeList, complexList[k2], membraneObject, RS3Dinput);
             //     resampleList[k2] = 1;
@@ -202,7 +217,7 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
             }
 
             Vector iface1Vec { moleculeList[p1].interfaceList[i1].coord - complexList[k1].comCoord };
-            std::array<double, 9> M = create_euler_rotation_matrix(complexList[k1].trajRot);
+            const std::array<double, 9>& M { complexList[k1].traj_rotation().M };
             iface1Vec = matrix_rotate(iface1Vec, M);
 
             double dx1 { complexList[k1].comCoord.x + iface1Vec.x + complexList[k1].trajTrans.x };
@@ -210,7 +225,7 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
             double dz1 { complexList[k1].comCoord.z + iface1Vec.z + complexList[k1].trajTrans.z };
 
             Vector iface2Vec { moleculeList[p2].interfaceList[i2].coord - complexList[k2].comCoord };
-            std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[k2].trajRot);
+            const std::array<double, 9>& M2 { complexList[k2].traj_rotation().M };
             iface2Vec = matrix_rotate(iface2Vec, M2);
             double dx2 { complexList[k2].comCoord.x + iface2Vec.x + complexList[k2].trajTrans.x };
             double dy2 { complexList[k2].comCoord.y + iface2Vec.y + complexList[k2].trajTrans.y };
@@ -220,6 +235,7 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
             double df1 { dx1 - dx2 };
             double df2 { dy1 - dy2 };
             double df3 { dz1 - dz2 };
+            minimum_image(df1, df2, df3, membraneObject);
 
             double dr2 = (df1 * df1) + (df2 * df2);
             if (pairList[i].memtest != 1)
@@ -227,7 +243,7 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
 
             if (dr2 < pairList[i].bindrad * pairList[i].bindrad) {
                 int currStop = i + 1;
-                resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput);
+                resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput, r);
                 it++;
                 i = 0;
                 // std::cout << "it++: " << it << std::endl;
@@ -249,10 +265,10 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
                 p1 = pairList[i].p1;
                 p2 = pairList[i].p2;
                 if (moleculeList[p1].trajStatus == TrajStatus::none || moleculeList[p1].trajStatus == TrajStatus::canBeResampled) {
-                    sweep_separation_complex_rot_memtest_box(simItr, p1, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+                    sweep_separation_complex_rot_memtest_box(simItr, p1, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r);
                 }
                 if (moleculeList[p2].trajStatus == TrajStatus::none || moleculeList[p2].trajStatus == TrajStatus::canBeResampled) {
-                    sweep_separation_complex_rot_memtest_box(simItr, p2, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+                    sweep_separation_complex_rot_memtest_box(simItr, p2, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r);
                 }
             }
         }
@@ -295,7 +311,7 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
                 }
             }
             int currStop = pairList.size(); // resample trajectories for all proteins that need keep moving
-            resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput);
+            resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput, r);
 
             for (i = 0; i < partnerOfPairList.size(); i++) {
                 int p = partnerOfPairList[i];
@@ -322,23 +338,23 @@ void sweep_separation_complex_rot_memtest_cluster_box(int simItr, int pro1Index,
                         if (flag == 0) {
 
                             if (membraneObject.isSphere == true && complexList[k].D.z < 1E-15) { // complex on sphere surface
-                                Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k1]);
+                                Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k1], r);
                                 complexList[k].trajTrans.x = targTrans.x;
                                 complexList[k].trajTrans.y = targTrans.y;
                                 complexList[k].trajTrans.z = targTrans.z;
-                                complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                                complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                                complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                                complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                                complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                                complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                             } else {
-                                complexList[k].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k].D.x) * GaussV();
-                                complexList[k].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k].D.y) * GaussV();
-                                complexList[k].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k].D.z) * GaussV();
-                                complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                                complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                                complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                                complexList[k].trajTrans.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.x) * GaussV(r);
+                                complexList[k].trajTrans.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.y) * GaussV(r);
+                                complexList[k].trajTrans.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.z) * GaussV(r);
+                                complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                                complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                                complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                             }
 
-                            reflect_traj_complex_rad_rot(params, moleculeList, complexList[k], membraneObject, RS3Dinput);
+                            reflect_traj_complex_rad_rot_box(params, moleculeList, complexList[k], membraneObject, RS3Dinput, r);
 
                             didMove.push_back(k);
                         }
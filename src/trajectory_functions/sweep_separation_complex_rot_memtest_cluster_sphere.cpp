@@ -5,13 +5,13 @@
 #include "tracing.hpp"
 #include "trajectory_functions/trajectory_functions.hpp"
 
-void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log)
 {
     // try cluster sweep first
     int comIndex1 { moleculeList[pro1Index].myComIndex };
     //determine RS3Dinput
     double RS3Dinput { 0.0 };
-    Complex targCom { complexList[comIndex1] };
+    const Complex& targCom = complexList[comIndex1];
     for (auto& molIndex : targCom.memberList) {
         for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
             if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - moleculeList[molIndex].molTypeIndex) < 1E-2) {
@@ -64,12 +64,26 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
     // std::cout << "In sweep_separation: pairList.size = " << pairList.size() << std::endl;
 
     if (pairList.size() > maxPairs) {
+        // each sub-step covers only a fraction of this timestep, so the steps skipped while dormant are caught up first
+        for (auto& pair : pairList) {
+            for (int k : { pair.k1, pair.k2 }) {
+                catch_up_dormant_complex(params, complexList[k], moleculeList, complexList, molTemplateList, membraneObject, r);
+                for (auto& memMol : complexList[k].memberList) {
+                    for (auto& partnerMol : moleculeList[memMol].crossbase) {
+                        if (moleculeList[partnerMol].isImplicitLipid == false)
+                            catch_up_dormant_complex(params, complexList[moleculeList[partnerMol].myComIndex],
+                                moleculeList, complexList, molTemplateList, membraneObject, r);
+                    }
+                }
+            }
+        }
+
         nStep = 5;
         params.timeStep = params.timeStep / (1.0 * nStep); //perform repeated smaller updates, to converge positions.
 
         // resample the traj for the timeStep changed
         int currStop = pairList.size(); // resample trajectories for all proteins that need keep moving
-        resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput);
+        resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput, r);
 
         // find the partner of pairList'complex'member, this is for the propagate of these molecule continuely when there is subStep
         for (i = 0; i < pairList.size(); i++) {
@@ -118,23 +132,23 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
                     if (flag == 0) {
 
                         if (membraneObject.isSphere == true && complexList[k].D.z < 1E-15) { // complex on sphere surface
-                            Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k]);
+                            Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k], r);
                             complexList[k].trajTrans.x = targTrans.x;
                             complexList[k].trajTrans.y = targTrans.y;
                             complexList[k].trajTrans.z = targTrans.z;
-                            complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                            complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                            complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                            complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                            complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                            complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                         } else {
-                            complexList[k].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k].D.x) * GaussV();
-                            complexList[k].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k].D.y) * GaussV();
-                            complexList[k].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k].D.z) * GaussV();
-                            complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                            complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                            complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                            complexList[k].trajTrans.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.x) * GaussV(r);
+                            complexList[k].trajTrans.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.y) * GaussV(r);
+                            complexList[k].trajTrans.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.z) * GaussV(r);
+                            complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                            complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                            complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                         }
 
-                        reflect_traj_complex_rad_rot(params, moleculeList, complexList[k], membraneObject, RS3Dinput);
+                        reflect_traj_complex_rad_rot_sphere(params, moleculeList, complexList[k], membraneObject, RS3Dinput, r);
 
                         didMove.push_back(k);
                     }
@@ -170,12 +184,12 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
 
             // if (resampleList[k1] == 0) {
             //     // resample complex k1
-            //     complexList[k1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k1].D.x) * GaussV();
-            //     complexList[k1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k1].D.y) * GaussV();
-            //     complexList[k1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k1].D.z) * GaussV();
-            //     complexList[k1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k1].Dr.x) * GaussV();
-            //     complexList[k1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k1].Dr.y) * GaussV();
-            //     complexList[k1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k1].Dr.z) * GaussV();
+            //     complexList[k1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k1].D.x) * GaussV(r);
+            //     complexList[k1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k1].D.y) * GaussV(r);
+            //     complexList[k1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k1].D.z) * GaussV(r);
+            //     complexList[k1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k1].Dr.x) * GaussV(r);
+            //     complexList[k1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k1].Dr.y) * GaussV(r);
+            //     complexList[k1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k1].Dr.z) * GaussV(r);
 
             //     reflect_traj_complex_rad_rot(params, moleculeList, complexList[k1], membraneObject, RS3Dinput);
             //     resampleList[k1] = 1;
@@ -183,12 +197,12 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
 
             // if (resampleList[k2] == 0) {
             //     // resample complex k2
-            //     complexList[k2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k2].D.x) * GaussV();
-            //     complexList[k2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k2].D.y) * GaussV();
-            //     complexList[k2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k2].D.z) * GaussV();
-            //     complexList[k2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k2].Dr.x) * GaussV();
-            //     complexList[k2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k2].Dr.y) * GaussV();
-            //     complexList[k2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k2].Dr.z) * GaussV();
+            //     complexList[k2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k2].D.x) * GaussV(r);
+            //     complexList[k2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k2].D.y) * GaussV(r);
+            //     complexList[k2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k2].D.z) * GaussV(r);
+            //     complexList[k2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k2].Dr.x) * GaussV(r);
+            //     complexList[k2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k2].Dr.y) * GaussV(r);
+            //     complexList[k2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k2].Dr.z) * GaussV(r);
 
             //     reflect_traj_complex_rad_rot(params, moleculeList, complexList[k2], membraneObject, RS3Dinput);
             //     resampleList[k2] = 1;
@@ -210,7 +224,7 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
                 dz1 = iface_final.z;
             } else {
                 Vector iface1Vec { moleculeList[p1].interfaceList[i1].coord - complexList[k1].comCoord };
-                std::array<double, 9> M = create_euler_rotation_matrix(complexList[k1].trajRot);
+                const std::array<double, 9>& M { complexList[k1].traj_rotation().M };
                 iface1Vec = matrix_rotate(iface1Vec, M);
 
                 dx1 = complexList[k1].comCoord.x + iface1Vec.x + complexList[k1].trajTrans.x;
@@ -226,7 +240,7 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
                 dz2 = iface_final.z;
             } else {
                 Vector iface2Vec { moleculeList[p2].interfaceList[i2].coord - complexList[k2].comCoord };
-                std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[k2].trajRot);
+                const std::array<double, 9>& M2 { complexList[k2].traj_rotation().M };
                 iface2Vec = matrix_rotate(iface2Vec, M2);
                 dx2 = complexList[k2].comCoord.x + iface2Vec.x + complexList[k2].trajTrans.x;
                 dy2 = complexList[k2].comCoord.y + iface2Vec.y + complexList[k2].trajTrans.y;
@@ -243,7 +257,7 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
 
             if (dr2 < pairList[i].bindrad * pairList[i].bindrad) {
                 int currStop = i + 1;
-                resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput);
+                resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput, r);
                 it++;
                 i = 0;
                 // std::cout << "it++: " << it << std::endl;
@@ -258,17 +272,17 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
 
         if (it == maxit) {
             // Tried cluster sweep and it failed. Now try pairs.
-            std::cout << " WARNING ***************************************************** " << '\n';
-            std::cout << "At " << (simItr - params.itrRestartFrom) * timeStepOrg * 1E-6 << " s,";
-            std::cout << "cluster sweep can't solve overlap. Now try pairs. " << '\n';
+            log << " WARNING ***************************************************** " << '\n';
+            log << "At " << (simItr - params.itrRestartFrom) * timeStepOrg * 1E-6 << " s,";
+            log << "cluster sweep can't solve overlap. Now try pairs. " << '\n';
             for (i = 0; i < pairList.size(); i++) {
                 p1 = pairList[i].p1;
                 p2 = pairList[i].p2;
                 if (moleculeList[p1].trajStatus == TrajStatus::none || moleculeList[p1].trajStatus == TrajStatus::canBeResampled) {
-                    sweep_separation_complex_rot_memtest_sphere(simItr, p1, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+                    sweep_separation_complex_rot_memtest_sphere(simItr, p1, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r, log);
                 }
                 if (moleculeList[p2].trajStatus == TrajStatus::none || moleculeList[p2].trajStatus == TrajStatus::canBeResampled) {
-                    sweep_separation_complex_rot_memtest_sphere(simItr, p2, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject);
+                    sweep_separation_complex_rot_memtest_sphere(simItr, p2, params, moleculeList, complexList, forwardRxns, molTemplateList, membraneObject, r, log);
                 }
             }
         }
@@ -311,7 +325,7 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
                 }
             }
             int currStop = pairList.size(); // resample trajectories for all proteins that need keep moving
-            resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput);
+            resample_traj(currStop, pairList, moleculeList, complexList, params, membraneObject, RS3Dinput, r);
 
             for (i = 0; i < partnerOfPairList.size(); i++) {
                 int p = partnerOfPairList[i];
@@ -338,23 +352,23 @@ void sweep_separation_complex_rot_memtest_cluster_sphere(int simItr, int pro1Ind
                         if (flag == 0) {
 
                             if (membraneObject.isSphere == true && complexList[k].D.z < 1E-15) { // complex on sphere surface
-                                Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k]);
+                                Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[k], r);
                                 complexList[k].trajTrans.x = targTrans.x;
                                 complexList[k].trajTrans.y = targTrans.y;
                                 complexList[k].trajTrans.z = targTrans.z;
-                                complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                                complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                                complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                                complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                                complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                                complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                             } else {
-                                complexList[k].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[k].D.x) * GaussV();
-                                complexList[k].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[k].D.y) * GaussV();
-                                complexList[k].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[k].D.z) * GaussV();
-                                complexList[k].trajRot.x = sqrt(2.0 * params.timeStep * complexList[k].Dr.x) * GaussV();
-                                complexList[k].trajRot.y = sqrt(2.0 * params.timeStep * complexList[k].Dr.y) * GaussV();
-                                complexList[k].trajRot.z = sqrt(2.0 * params.timeStep * complexList[k].Dr.z) * GaussV();
+                                complexList[k].trajTrans.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.x) * GaussV(r);
+                                complexList[k].trajTrans.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.y) * GaussV(r);
+                                complexList[k].trajTrans.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].D.z) * GaussV(r);
+                                complexList[k].trajRot.x = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.x) * GaussV(r);
+                                complexList[k].trajRot.y = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.y) * GaussV(r);
+                                complexList[k].trajRot.z = sqrt(2.0 * complexList[k].move_time(params.timeStep) * complexList[k].Dr.z) * GaussV(r);
                             }
 
-                            reflect_traj_complex_rad_rot(params, moleculeList, complexList[k], membraneObject, RS3Dinput);
+                            reflect_traj_complex_rad_rot_sphere(params, moleculeList, complexList[k], membraneObject, RS3Dinput, r);
 
                             didMove.push_back(k);
                         }
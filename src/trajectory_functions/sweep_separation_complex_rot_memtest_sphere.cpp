@@ -16,7 +16,7 @@
 #include "tracing.hpp"
 #include "trajectory_functions/trajectory_functions.hpp"
 
-void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject)
+void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Parameters& params, std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList, const std::vector<ForwardRxn>& forwardRxns, const std::vector<MolTemplate>& molTemplateList, const Membrane& membraneObject, gsl_rng* r, std::ostream& log)
 {
     /*
       In this version, complex comIndex1 is on the membrane.
@@ -78,7 +78,7 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
 
     //determine RS3Dinput
     double RS3Dinput { 0.0 };
-    Complex targCom { complexList[comIndex1] };
+    const Complex& targCom = complexList[comIndex1];
     for (auto& molIndex : targCom.memberList) {
         for (int RS3Dindex = 0; RS3Dindex < 100; RS3Dindex++) {
             if (std::abs(membraneObject.RS3Dvect[RS3Dindex + 400] - moleculeList[molIndex].molTypeIndex) < 1E-2) {
@@ -126,7 +126,7 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
                         dz1 = iface_final.z;
                     } else { // complex inside sphere
                         Vector iface1Vec { moleculeList[pro1Index].interfaceList[relIface1].coord - complexList[comIndex1].comCoord };
-                        std::array<double, 9> M = create_euler_rotation_matrix(complexList[comIndex1].trajRot);
+                        const std::array<double, 9>& M { complexList[comIndex1].traj_rotation().M };
                         iface1Vec = matrix_rotate(iface1Vec, M);
                         dx1 = complexList[comIndex1].comCoord.x + iface1Vec.x + complexList[comIndex1].trajTrans.x;
                         dy1 = complexList[comIndex1].comCoord.y + iface1Vec.y + complexList[comIndex1].trajTrans.y;
@@ -147,7 +147,7 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
                         dz2 = iface_final.z;
                     } else { // complex inside sphere
                         Vector iface2Vec { moleculeList[p2].interfaceList[relIface2].coord - complexList[comIndex2].comCoord };
-                        std::array<double, 9> M2 = create_euler_rotation_matrix(complexList[comIndex2].trajRot);
+                        const std::array<double, 9>& M2 { complexList[comIndex2].traj_rotation().M };
                         iface2Vec = matrix_rotate(iface2Vec, M2);
                         dx2 = complexList[comIndex2].comCoord.x + iface2Vec.x + complexList[comIndex2].trajTrans.x;
                         dy2 = complexList[comIndex2].comCoord.y + iface2Vec.y + complexList[comIndex2].trajTrans.y;
@@ -176,24 +176,24 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
         if (hasOverlap) {
             ++itr;
             if (complexList[comIndex1].D.z < 1E-15) { // complex on sphere surface
-                Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[comIndex1]);
+                Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[comIndex1], r);
                 complexList[comIndex1].trajTrans.x = targTrans.x;
                 complexList[comIndex1].trajTrans.y = targTrans.y;
                 complexList[comIndex1].trajTrans.z = targTrans.z;
-                complexList[comIndex1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.x) * GaussV();
-                complexList[comIndex1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.y) * GaussV();
-                complexList[comIndex1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.z) * GaussV();
+                complexList[comIndex1].trajRot.x = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.x) * GaussV(r);
+                complexList[comIndex1].trajRot.y = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.y) * GaussV(r);
+                complexList[comIndex1].trajRot.z = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.z) * GaussV(r);
             } else {
-                complexList[comIndex1].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.x) * GaussV();
-                complexList[comIndex1].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.y) * GaussV();
-                complexList[comIndex1].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].D.z) * GaussV();
-                complexList[comIndex1].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.x) * GaussV();
-                complexList[comIndex1].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.y) * GaussV();
-                complexList[comIndex1].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex1].Dr.z) * GaussV();
+                complexList[comIndex1].trajTrans.x = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].D.x) * GaussV(r);
+                complexList[comIndex1].trajTrans.y = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].D.y) * GaussV(r);
+                complexList[comIndex1].trajTrans.z = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].D.z) * GaussV(r);
+                complexList[comIndex1].trajRot.x = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.x) * GaussV(r);
+                complexList[comIndex1].trajRot.y = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.y) * GaussV(r);
+                complexList[comIndex1].trajRot.z = sqrt(2.0 * complexList[comIndex1].move_time(params.timeStep) * complexList[comIndex1].Dr.z) * GaussV(r);
             }
 
             // reflectList[comIndex1] = 0;
-            reflect_traj_complex_rad_rot(params, moleculeList, complexList[comIndex1], membraneObject, RS3Dinput);
+            reflect_traj_complex_rad_rot_sphere(params, moleculeList, complexList[comIndex1], membraneObject, RS3Dinput, r);
             // reflectList[comIndex1] = 1;
 
             int resampleList[complexList.size()]; // if this is 0, we need resample
@@ -215,24 +215,24 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
 
                         /*If p2 just dissociated, also don't try to move again*/
                         if (complexList[comIndex2].D.z < 1E-15) { // complex on sphere surface
-                            Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[comIndex2]);
+                            Coord targTrans = create_complex_propagation_vectors_on_sphere(params, complexList[comIndex2], r);
                             complexList[comIndex2].trajTrans.x = targTrans.x;
                             complexList[comIndex2].trajTrans.y = targTrans.y;
                             complexList[comIndex2].trajTrans.z = targTrans.z;
-                            complexList[comIndex2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.x) * GaussV();
-                            complexList[comIndex2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.y) * GaussV();
-                            complexList[comIndex2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.z) * GaussV();
+                            complexList[comIndex2].trajRot.x = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.x) * GaussV(r);
+                            complexList[comIndex2].trajRot.y = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.y) * GaussV(r);
+                            complexList[comIndex2].trajRot.z = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.z) * GaussV(r);
                         } else {
-                            complexList[comIndex2].trajTrans.x = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.x) * GaussV();
-                            complexList[comIndex2].trajTrans.y = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.y) * GaussV();
-                            complexList[comIndex2].trajTrans.z = sqrt(2.0 * params.timeStep * complexList[comIndex2].D.z) * GaussV();
-                            complexList[comIndex2].trajRot.x = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.x) * GaussV();
-                            complexList[comIndex2].trajRot.y = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.y) * GaussV();
-                            complexList[comIndex2].trajRot.z = sqrt(2.0 * params.timeStep * complexList[comIndex2].Dr.z) * GaussV();
+                            complexList[comIndex2].trajTrans.x = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].D.x) * GaussV(r);
+                            complexList[comIndex2].trajTrans.y = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].D.y) * GaussV(r);
+                            complexList[comIndex2].trajTrans.z = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].D.z) * GaussV(r);
+                            complexList[comIndex2].trajRot.x = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.x) * GaussV(r);
+                            complexList[comIndex2].trajRot.y = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.y) * GaussV(r);
+                            complexList[comIndex2].trajRot.z = sqrt(2.0 * complexList[comIndex2].move_time(params.timeStep) * complexList[comIndex2].Dr.z) * GaussV(r);
                         }
 
                         // reflectList[comIndex2] = 0;
-                        reflect_traj_complex_rad_rot(params, moleculeList, complexList[comIndex2], membraneObject, RS3Dinput);
+                        reflect_traj_complex_rad_rot_sphere(params, moleculeList, complexList[comIndex2], membraneObject, RS3Dinput, r);
                         // reflectList[comIndex2] = 1;
                         resampleList[comIndex2] = 1;
                     }
@@ -246,8 +246,8 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
 
         if (itr == maxItr - 1) {
             if (comIndex1 != comIndex2) {
-                std::cout << " WARNING ***************************************************** " << '\n';
-                std::cout << "At simItr " << simItr << ", pair check can't solve overlap: " << pro1Index
+                log << " WARNING ***************************************************** " << '\n';
+                log << "At simItr " << simItr << ", pair check can't solve overlap: " << pro1Index
                           << " max cross: " << moleculeList[pro1Index].crossbase.size() << " n overlap: " << tsave
                           << " pro1: " << overlapList[0] << " D: " << complexList[comIndex1].D.x << " "
                           << complexList[comIndex2].D.x << " Last separation: " << sqrt(dr2) << '\n';
@@ -273,7 +273,7 @@ void sweep_separation_complex_rot_memtest_sphere(int simItr, int pro1Index, Para
                     }
                 }
             } else {
-                std::cout << "Reached max iterations in sweep (memCheckList) without solving overlap, but proteins are "
+                log << "Reached max iterations in sweep (memCheckList) without solving overlap, but proteins are "
                              "within the same complex. Last separation: "
                           << sqrt(dr2) << '\n';
             }
@@ -0,0 +1,76 @@
+#include "trajectory_functions/trajectory_functions.hpp"
+
+int update_dormant_complexes(const Parameters& params, SimulVolume& simulVolume, const Membrane& membraneObject,
+    std::vector<Molecule>& moleculeList, std::vector<Complex>& complexList)
+{
+    // TRACE();
+    // mean squared displacement of the member furthest from the COM over one step,
+    // from translation and rotation of the bounding sphere
+    auto step_displacement2 = [&params](const Complex& oneCom) {
+        return 2.0 * params.timeStep * (oneCom.D.x + oneCom.D.y + oneCom.D.z)
+            + 2.0 * params.timeStep * (oneCom.Dr.x + oneCom.Dr.y + oneCom.Dr.z) * oneCom.radius * oneCom.radius;
+    };
+
+    // a neighbor on the regular timestep can still move this far toward an isolated Complex
+    double maxStepDisplace2 { 0.0 };
+    if (params.maxStepMultiple > 1) {
+        for (auto& oneCom : complexList) {
+            if (oneCom.isEmpty == false && moleculeList[oneCom.memberList[0]].isImplicitLipid == false)
+                maxStepDisplace2 = std::max(maxStepDisplace2, step_displacement2(oneCom));
+        }
+        simulVolume.build_isolation_grid(params.rMaxLimit + sqrt(params.maxStepMultiple * 6.0 * maxStepDisplace2),
+            moleculeList, membraneObject);
+    }
+
+    int numDormant { 0 };
+    double maxDisplace2 { params.dormantDisplace * params.dormantDisplace };
+    for (auto& oneCom : complexList) {
+        bool wasDormant { oneCom.isDormant };
+        oneCom.isDormant = false;
+        if (oneCom.isEmpty || oneCom.ncross > 0)
+            continue;
+
+        // a Complex wakes up as soon as any member reacted, dissociated or found a reaction partner
+        bool isQuiet { true };
+        for (auto& memMol : oneCom.memberList) {
+            if (moleculeList[memMol].isImplicitLipid || moleculeList[memMol].trajStatus != TrajStatus::none
+                || moleculeList[memMol].crossbase.empty() == false) {
+                isQuiet = false;
+                break;
+            }
+        }
+        if (isQuiet == false)
+            continue;
+
+        double stepDisplace2 { step_displacement2(oneCom) };
+
+        // multiple time stepping: a Complex further than rMaxLimit from anything can take as many steps at once as
+        // keep the relative displacement along the line of centers within 3 standard deviations of the gap. The gap is
+        // measured when the Complex goes dormant, which it may do with steps left over from before a dissociation
+        if (wasDormant == false) {
+            oneCom.stepMultiple = 1;
+            if (params.maxStepMultiple > 1) {
+                double relDisplace2 { 3.0 * (stepDisplace2 + maxStepDisplace2) };
+                double maxGap { sqrt(params.maxStepMultiple * relDisplace2) };
+                double gap { simulVolume.find_isolation_distance(oneCom, moleculeList, membraneObject, params.rMaxLimit + maxGap)
+                    - params.rMaxLimit };
+                if (gap > 0)
+                    oneCom.stepMultiple = std::max(1, std::min(params.maxStepMultiple, int(gap * gap / relDisplace2)));
+            }
+        }
+
+        // the skipped steps are caught up in one move once the Complex wakes up, so the position error
+        // a neighbor can see is bounded by the RMS displacement accumulated while dormant
+        bool withinDisplace { (oneCom.numDormantSteps + 1) * stepDisplace2 <= maxDisplace2 };
+        bool withinMultiple { oneCom.numDormantSteps + 1 < oneCom.stepMultiple };
+        if (withinDisplace == false && withinMultiple == false)
+            continue;
+
+        oneCom.isDormant = true;
+        ++oneCom.numDormantSteps;
+        ++numDormant;
+        for (auto& memMol : oneCom.memberList)
+            moleculeList[memMol].trajStatus = TrajStatus::propagated;
+    }
+    return numDormant;
+}